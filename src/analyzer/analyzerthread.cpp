@@ -36,6 +36,11 @@ mixxx::Logger kLogger("AnalyzerThread");
 // continuous feedback.
 const mixxx::Duration kBusyProgressInhibitDuration = mixxx::Duration::fromMillis(60);
 
+// The number of chunks that are decoded before they are passed to the
+// analyzers when running on a worker pool. Larger batches reduce the
+// synchronization overhead, the analyzers are still invoked per chunk.
+constexpr std::size_t kChunksPerBatch = 16;
+
 void deleteAnalyzerThread(AnalyzerThread* plainPtr) {
     if (plainPtr) {
         plainPtr->deleteAfterFinished();
@@ -62,12 +67,14 @@ AnalyzerThread::Pointer AnalyzerThread::createInstance(
         int id,
         mixxx::DbConnectionPoolPtr dbConnectionPool,
         UserSettingsPointer pConfig,
-        AnalyzerModeFlags modeFlags) {
+        AnalyzerModeFlags modeFlags,
+        std::shared_ptr<AnalyzerWorkerPool> pWorkerPool) {
     return Pointer(new AnalyzerThread(
                            id,
                            dbConnectionPool,
                            pConfig,
-                           modeFlags),
+                           modeFlags,
+                           std::move(pWorkerPool)),
             deleteAnalyzerThread);
 }
 
@@ -75,7 +82,8 @@ AnalyzerThread::AnalyzerThread(
         int id,
         mixxx::DbConnectionPoolPtr dbConnectionPool,
         UserSettingsPointer pConfig,
-        AnalyzerModeFlags modeFlags)
+        AnalyzerModeFlags modeFlags,
+        std::shared_ptr<AnalyzerWorkerPool> pWorkerPool)
         : WorkerThread(
             QString("AnalyzerThread %1").arg(id),
             (modeFlags & AnalyzerModeFlags::LowPriority ? QThread::LowPriority : QThread::InheritPriority)),
@@ -83,10 +91,16 @@ AnalyzerThread::AnalyzerThread(
           m_dbConnectionPool(std::move(dbConnectionPool)),
           m_pConfig(pConfig),
           m_modeFlags(modeFlags),
+          m_pWorkerPool(std::move(pWorkerPool)),
           m_nextTrack(2), // minimum capacity
-          m_sampleBuffer(mixxx::kAnalysisSamplesPerChunk),
           m_emittedState(AnalyzerThreadState::Void) {
     std::call_once(registerMetaTypesOnceFlag, registerMetaTypesOnce);
+    if (m_pWorkerPool) {
+        m_batches.push_back(std::make_unique<AnalysisBatch>(kChunksPerBatch));
+        m_batches.push_back(std::make_unique<AnalysisBatch>(kChunksPerBatch));
+    } else {
+        m_batches.push_back(std::make_unique<AnalysisBatch>(1));
+    }
 }
 
 void AnalyzerThread::doRun() {
@@ -233,76 +247,92 @@ AnalyzerThread::AnalysisResult AnalyzerThread::analyzeAudioSource(
     emitBusyProgress(kAnalyzerProgressNone);
 
     mixxx::IndexRange remainingFrameRange = audioSource->frameIndexRange();
+    std::size_t batchIndex = 0;
     while (!remainingFrameRange.empty()) {
-        sleepWhileSuspended();
-        if (isStopping()) {
-            return AnalysisResult::Cancelled;
-        }
+        AnalysisBatch* const pBatch = m_batches[batchIndex].get();
+        // The analyzers have finished this batch before the previous
+        // one has been submitted
+        DEBUG_ASSERT(!pBatch->tasks.isPending());
+        pBatch->chunks.clear();
+
+        // 1st step: Decode the next chunks of audio data
+        while (!remainingFrameRange.empty() &&
+                pBatch->chunks.size() < pBatch->maxChunks) {
+            sleepWhileSuspended();
+            if (isStopping()) {
+                waitForAnalyzers();
+                return AnalysisResult::Cancelled;
+            }
 
-        // 1st step: Decode next chunk of audio data
-
-        // Split the range for the next chunk from the remaining (= to-be-analyzed) frames
-        auto chunkFrameRange =
-                remainingFrameRange.splitAndShrinkFront(
-                        math_min(mixxx::kAnalysisFramesPerChunk, remainingFrameRange.length()));
-        DEBUG_ASSERT(!chunkFrameRange.empty());
-
-        // Request the next chunk of audio data
-        const auto readableSampleFrames =
-                audioSourceProxy.readSampleFrames(
-                        mixxx::WritableSampleFrames(
-                                chunkFrameRange,
-                                mixxx::SampleBuffer::WritableSlice(m_sampleBuffer)));
-        // The returned range fits into the requested range
-        DEBUG_ASSERT(readableSampleFrames.frameIndexRange().isSubrangeOf(chunkFrameRange));
-
-        // Sometimes the duration of the audio source is inaccurate and adjusted
-        // while reading. We need to adjust all frame ranges to reflect this new
-        // situation by restoring all invariants and consistency requirements!
-
-        // Shrink the original range of the current chunks to the actual available
-        // range.
-        chunkFrameRange = intersect(chunkFrameRange, audioSourceProxy.frameIndexRange());
-        // The audio data that has just been read should still fit into the adjusted
-        // chunk range.
-        DEBUG_ASSERT(readableSampleFrames.frameIndexRange().isSubrangeOf(chunkFrameRange));
-
-        // We also need to adjust the remaining frame range for the next requests.
-        remainingFrameRange = intersect(remainingFrameRange, audioSourceProxy.frameIndexRange());
-        // Currently the range will never grow, but lets also account for this case
-        // that might become relevant in the future.
-        VERIFY_OR_DEBUG_ASSERT(remainingFrameRange.empty() ||
-                remainingFrameRange.end() == audioSourceProxy.frameIndexRange().end()) {
-            if (chunkFrameRange.length() < mixxx::kAnalysisFramesPerChunk) {
-                // If we have read an incomplete chunk while the range has grown
-                // we need to discard the read results and re-read the current
-                // chunk!
-
-                remainingFrameRange.growFront(chunkFrameRange.length());
-                continue;
+            // Split the range for the next chunk from the remaining (= to-be-analyzed) frames
+            auto chunkFrameRange =
+                    remainingFrameRange.splitAndShrinkFront(
+                            math_min(mixxx::kAnalysisFramesPerChunk, remainingFrameRange.length()));
+            DEBUG_ASSERT(!chunkFrameRange.empty());
+
+            // Request the next chunk of audio data
+            const auto readableSampleFrames =
+                    audioSourceProxy.readSampleFrames(
+                            mixxx::WritableSampleFrames(
+                                    chunkFrameRange,
+                                    mixxx::SampleBuffer::WritableSlice(
+                                            pBatch->sampleBuffer,
+                                            static_cast<SINT>(pBatch->chunks.size()) *
+                                                    mixxx::kAnalysisSamplesPerChunk,
+                                            mixxx::kAnalysisSamplesPerChunk)));
+            // The returned range fits into the requested range
+            DEBUG_ASSERT(readableSampleFrames.frameIndexRange().isSubrangeOf(chunkFrameRange));
+
+            // Sometimes the duration of the audio source is inaccurate and adjusted
+            // while reading. We need to adjust all frame ranges to reflect this new
+            // situation by restoring all invariants and consistency requirements!
+
+            // Shrink the original range of the current chunks to the actual available
+            // range.
+            chunkFrameRange = intersect(chunkFrameRange, audioSourceProxy.frameIndexRange());
+            // The audio data that has just been read should still fit into the adjusted
+            // chunk range.
+            DEBUG_ASSERT(readableSampleFrames.frameIndexRange().isSubrangeOf(chunkFrameRange));
+
+            // We also need to adjust the remaining frame range for the next requests.
+            remainingFrameRange = intersect(remainingFrameRange, audioSourceProxy.frameIndexRange());
+            // Currently the range will never grow, but lets also account for this case
+            // that might become relevant in the future.
+            VERIFY_OR_DEBUG_ASSERT(remainingFrameRange.empty() ||
+                    remainingFrameRange.end() == audioSourceProxy.frameIndexRange().end()) {
+                if (chunkFrameRange.length() < mixxx::kAnalysisFramesPerChunk) {
+                    // If we have read an incomplete chunk while the range has grown
+                    // we need to discard the read results and re-read the current
+                    // chunk!
+
+                    remainingFrameRange.growFront(chunkFrameRange.length());
+                    continue;
+                }
+                DEBUG_ASSERT(remainingFrameRange.end() < audioSourceProxy.frameIndexRange().end());
+                kLogger.warning()
+                        << "Unexpected growth of the audio source while reading"
+                        << mixxx::IndexRange::forward(
+                                remainingFrameRange.end(), audioSourceProxy.frameIndexRange().end());
+                remainingFrameRange.growBack(
+                        audioSourceProxy.frameIndexRange().end() - remainingFrameRange.end());
+            }
+
+            if (!readableSampleFrames.frameIndexRange().empty()) {
+                pBatch->chunks.push_back(readableSampleFrames);
             }
-            DEBUG_ASSERT(remainingFrameRange.end() < audioSourceProxy.frameIndexRange().end());
-            kLogger.warning()
-                    << "Unexpected growth of the audio source while reading"
-                    << mixxx::IndexRange::forward(
-                            remainingFrameRange.end(), audioSourceProxy.frameIndexRange().end());
-            remainingFrameRange.growBack(
-                    audioSourceProxy.frameIndexRange().end() - remainingFrameRange.end());
         }
 
         sleepWhileSuspended();
         if (isStopping()) {
+            waitForAnalyzers();
             return AnalysisResult::Cancelled;
         }
 
-        // 2nd: step: Analyze chunk of decoded audio data
-        if (!readableSampleFrames.frameIndexRange().empty()) {
-            for (auto&& analyzer : m_analyzers) {
-                analyzer.processSamples(
-                        readableSampleFrames.readableData(),
-                        readableSampleFrames.readableLength());
-            }
-        }
+        // 2nd: step: Analyze the decoded chunks. Each analyzer must have
+        // finished the previous batch before receiving the next one.
+        waitForAnalyzers();
+        analyzeBatch(pBatch);
+        batchIndex = (batchIndex + 1) % m_batches.size();
 
         // Don't check again for paused/stopped again and simply finish
         // the current iteration by emitting progress.
@@ -325,10 +355,44 @@ AnalyzerThread::AnalysisResult AnalyzerThread::analyzeAudioSource(
             emitBusyProgress(kAnalyzerProgressUnknown);
         }
     }
+    waitForAnalyzers();
 
     return AnalysisResult::Finished;
 }
 
+void AnalyzerThread::analyzeBatch(AnalysisBatch* pBatch) {
+    if (pBatch->chunks.empty()) {
+        return;
+    }
+    for (auto&& analyzer : m_analyzers) {
+        if (!analyzer.isActive()) {
+            continue;
+        }
+        AnalyzerWithState* const pAnalyzer = &analyzer;
+        const auto analyzeChunks = [pAnalyzer, pBatch] {
+            for (const auto& chunk : pBatch->chunks) {
+                pAnalyzer->processSamples(
+                        chunk.readableData(),
+                        chunk.readableLength());
+            }
+        };
+        if (m_pWorkerPool) {
+            m_pWorkerPool->submit(&pBatch->tasks, analyzeChunks);
+        } else {
+            analyzeChunks();
+        }
+    }
+}
+
+void AnalyzerThread::waitForAnalyzers() {
+    if (!m_pWorkerPool) {
+        return;
+    }
+    for (const auto& pBatch : m_batches) {
+        m_pWorkerPool->wait(&pBatch->tasks);
+    }
+}
+
 void AnalyzerThread::emitBusyProgress(AnalyzerProgress busyProgress) {
     DEBUG_ASSERT(m_currentTrack.has_value());
     if ((m_emittedState == AnalyzerThreadState::Busy) &&
@@ -1,11 +1,14 @@
 #pragma once
 
+#include <memory>
 #include <optional>
 #include <vector>
 
 #include "analyzer/analyzer.h"
 #include "analyzer/analyzerprogress.h"
 #include "analyzer/analyzertrack.h"
+#include "analyzer/constants.h"
+#include "analyzer/analyzerworkerpool.h"
 #include "preferences/usersettings.h"
 #include "rigtorp/SPSCQueue.h"
 #include "sources/audiosource.h"
@@ -22,6 +25,9 @@ enum AnalyzerModeFlags {
     WithBeats = 0x01,
     WithWaveform = 0x02,
     LowPriority = 0x04,
+    // Run the analyzers of each track concurrently on a shared
+    // AnalyzerWorkerPool
+    ParallelAnalyzers = 0x08,
     All = WithBeats | WithWaveform,
 };
 
@@ -59,13 +65,15 @@ class AnalyzerThread : public WorkerThread {
             int id,
             mixxx::DbConnectionPoolPtr dbConnectionPool,
             UserSettingsPointer pConfig,
-            AnalyzerModeFlags modeFlags);
+            AnalyzerModeFlags modeFlags,
+            std::shared_ptr<AnalyzerWorkerPool> pWorkerPool = nullptr);
 
     /*private*/ AnalyzerThread(
             int id,
             mixxx::DbConnectionPoolPtr dbConnectionPool,
             UserSettingsPointer pConfig,
-            AnalyzerModeFlags modeFlags);
+            AnalyzerModeFlags modeFlags,
+            std::shared_ptr<AnalyzerWorkerPool> pWorkerPool);
     ~AnalyzerThread() override = default;
 
     int id() const {
@@ -100,6 +108,9 @@ class AnalyzerThread : public WorkerThread {
     const mixxx::DbConnectionPoolPtr m_dbConnectionPool;
     const UserSettingsPointer m_pConfig;
     const AnalyzerModeFlags m_modeFlags;
+    // Shared by all threads of a TrackAnalysisScheduler. The analyzers
+    // run serially in this thread if not set.
+    const std::shared_ptr<AnalyzerWorkerPool> m_pWorkerPool;
 
     /////////////////////////////////////////////////////////////////////////
     // Thread-safe atomic values
@@ -118,7 +129,23 @@ class AnalyzerThread : public WorkerThread {
 
     std::vector<AnalyzerWithState> m_analyzers;
 
-    mixxx::SampleBuffer m_sampleBuffer;
+    // Consecutive chunks of decoded audio data that are passed to the
+    // analyzers together
+    struct AnalysisBatch {
+        explicit AnalysisBatch(std::size_t maxChunks)
+                : maxChunks(maxChunks),
+                  sampleBuffer(maxChunks * mixxx::kAnalysisSamplesPerChunk) {
+            chunks.reserve(maxChunks);
+        }
+
+        const std::size_t maxChunks;
+        mixxx::SampleBuffer sampleBuffer;
+        std::vector<mixxx::ReadableSampleFrames> chunks;
+        AnalyzerWorkerPool::TaskGroup tasks;
+    };
+    // With a worker pool the next batch is decoded while the analyzers
+    // are still processing the previous one
+    std::vector<std::unique_ptr<AnalysisBatch>> m_batches;
 
     std::optional<AnalyzerTrack> m_currentTrack;
 
@@ -134,6 +161,13 @@ class AnalyzerThread : public WorkerThread {
     AnalysisResult analyzeAudioSource(
             const mixxx::AudioSourcePointer& audioSource);
 
+    // Passes all chunks of the batch to the active analyzers, either
+    // directly or by submitting one task per analyzer to the worker pool
+    void analyzeBatch(AnalysisBatch* pBatch);
+
+    // Blocks until the analyzers have finished all submitted batches
+    void waitForAnalyzers();
+
     // Blocks the worker thread until a next track becomes available
     TrackPointer receiveNextTrack();
 
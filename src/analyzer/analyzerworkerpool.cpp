@@ -0,0 +1,133 @@
+#include "analyzer/analyzerworkerpool.h"
+
+#include "util/assert.h"
+
+AnalyzerWorkerPool::AnalyzerWorkerPool(int numWorkers, QThread::Priority priority)
+        : m_nextQueue(0),
+          m_queuedTasks(0),
+          m_bQuit(false) {
+    DEBUG_ASSERT(numWorkers >= 0);
+    m_queues.reserve(numWorkers);
+    for (int i = 0; i < numWorkers; ++i) {
+        m_queues.push_back(std::make_unique<TaskQueue>());
+    }
+    m_workers.reserve(numWorkers);
+    for (int i = 0; i < numWorkers; ++i) {
+        WorkerThread* pWorker = new WorkerThread(this, i);
+        pWorker->start(priority);
+        m_workers.push_back(pWorker);
+    }
+}
+
+AnalyzerWorkerPool::~AnalyzerWorkerPool() {
+    {
+        std::lock_guard<std::mutex> lock(m_idleMutex);
+        m_bQuit = true;
+    }
+    m_idle.notify_all();
+    for (const auto& pWorker : m_workers) {
+        pWorker->wait();
+        delete pWorker;
+    }
+    DEBUG_ASSERT(m_queuedTasks.load() == 0);
+}
+
+void AnalyzerWorkerPool::submit(TaskGroup* pGroup, Task task) {
+    DEBUG_ASSERT(pGroup);
+    if (m_queues.empty()) {
+        task();
+        return;
+    }
+    pGroup->m_pending.fetch_add(1, std::memory_order_relaxed);
+    const int queueIndex = static_cast<int>(
+            m_nextQueue.fetch_add(1, std::memory_order_relaxed) % m_queues.size());
+    {
+        TaskQueue* pQueue = m_queues[queueIndex].get();
+        std::lock_guard<std::mutex> lock(pQueue->mutex);
+        pQueue->tasks.push_back(QueuedTask{pGroup, std::move(task)});
+    }
+    {
+        std::lock_guard<std::mutex> lock(m_idleMutex);
+        m_queuedTasks.fetch_add(1);
+    }
+    m_idle.notify_one();
+}
+
+void AnalyzerWorkerPool::wait(TaskGroup* pGroup) {
+    DEBUG_ASSERT(pGroup);
+    if (m_queues.empty()) {
+        DEBUG_ASSERT(!pGroup->isPending());
+        return;
+    }
+    // Help instead of blocking while there is work left
+    const int queueIndex = static_cast<int>(
+            m_nextQueue.load(std::memory_order_relaxed) % m_queues.size());
+    while (pGroup->isPending() && tryRunTask(queueIndex)) {
+    }
+    // Always acquire the mutex, even if no task is pending anymore. The
+    // worker that finished the last task might still hold it and the
+    // group must not be destroyed before it has been released.
+    std::unique_lock<std::mutex> lock(pGroup->m_mutex);
+    pGroup->m_finished.wait(lock, [pGroup] {
+        return !pGroup->isPending();
+    });
+}
+
+bool AnalyzerWorkerPool::tryRunTask(int queueIndex) {
+    const int numQueues = static_cast<int>(m_queues.size());
+    for (int i = 0; i < numQueues; ++i) {
+        TaskQueue* pQueue = m_queues[(queueIndex + i) % numQueues].get();
+        QueuedTask queuedTask;
+        {
+            std::lock_guard<std::mutex> lock(pQueue->mutex);
+            if (pQueue->tasks.empty()) {
+                continue;
+            }
+            // The oldest tasks first, both from the own and from foreign
+            // queues. They belong to the threads that have been waiting
+            // the longest.
+            queuedTask = std::move(pQueue->tasks.front());
+            pQueue->tasks.pop_front();
+        }
+        m_queuedTasks.fetch_sub(1);
+        runTask(&queuedTask);
+        return true;
+    }
+    return false;
+}
+
+// static
+void AnalyzerWorkerPool::runTask(QueuedTask* pQueuedTask) {
+    pQueuedTask->task();
+    TaskGroup* pGroup = pQueuedTask->pGroup;
+    std::lock_guard<std::mutex> lock(pGroup->m_mutex);
+    if (pGroup->m_pending.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        pGroup->m_finished.notify_all();
+    }
+}
+
+void AnalyzerWorkerPool::runWorker(int workerIndex) {
+    while (true) {
+        if (tryRunTask(workerIndex)) {
+            continue;
+        }
+        std::unique_lock<std::mutex> lock(m_idleMutex);
+        m_idle.wait(lock, [this] {
+            return m_bQuit || m_queuedTasks.load() > 0;
+        });
+        if (m_bQuit && m_queuedTasks.load() == 0) {
+            return;
+        }
+    }
+}
+
+AnalyzerWorkerPool::WorkerThread::WorkerThread(
+        AnalyzerWorkerPool* pPool, int workerIndex)
+        : m_pPool(pPool),
+          m_workerIndex(workerIndex) {
+    setObjectName(QStringLiteral("AnalyzerWorker %1").arg(workerIndex + 1));
+}
+
+void AnalyzerWorkerPool::WorkerThread::run() {
+    m_pPool->runWorker(m_workerIndex);
+}
@@ -0,0 +1,109 @@
+#pragma once
+
+#include <QThread>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "util/class.h"
+
+/// AnalyzerWorkerPool runs the analyzers of all AnalyzerThreads on a
+/// shared set of worker threads.
+///
+/// Each AnalyzerThread still decodes its track once, but instead of running
+/// all analyzers serially over the decoded samples it submits one task per
+/// analyzer. Tasks are distributed round-robin over per-worker queues and
+/// idle workers steal from the queues of busy workers, so the cores stay
+/// saturated when a single expensive analyzer (e.g. beat detection) would
+/// otherwise keep one thread busy while the others are idle.
+///
+/// Threads waiting for their tasks in wait() help by running queued tasks,
+/// including those submitted by other threads.
+class AnalyzerWorkerPool {
+  public:
+    typedef std::function<void()> Task;
+
+    /// Tracks the completion of the tasks submitted by a single thread.
+    /// It must not be destroyed while tasks are pending.
+    class TaskGroup {
+      public:
+        TaskGroup()
+                : m_pending(0) {
+        }
+
+        bool isPending() const {
+            return m_pending.load(std::memory_order_acquire) > 0;
+        }
+
+      private:
+        friend class AnalyzerWorkerPool;
+
+        std::atomic<int> m_pending;
+        std::mutex m_mutex;
+        std::condition_variable m_finished;
+
+        DISALLOW_COPY_AND_ASSIGN(TaskGroup);
+    };
+
+    /// Without any workers all tasks are run immediately by submit().
+    AnalyzerWorkerPool(int numWorkers, QThread::Priority priority);
+    /// Runs the remaining queued tasks before joining the workers.
+    ~AnalyzerWorkerPool();
+
+    int numWorkers() const {
+        return static_cast<int>(m_workers.size());
+    }
+
+    /// Queues the task and returns immediately. Thread-safe.
+    void submit(TaskGroup* pGroup, Task task);
+
+    /// Returns after all tasks of the group have finished.
+    void wait(TaskGroup* pGroup);
+
+  private:
+    struct QueuedTask {
+        TaskGroup* pGroup;
+        Task task;
+    };
+
+    struct TaskQueue {
+        std::mutex mutex;
+        std::deque<QueuedTask> tasks;
+    };
+
+    class WorkerThread : public QThread {
+      public:
+        WorkerThread(AnalyzerWorkerPool* pPool, int workerIndex);
+
+      protected:
+        void run() override;
+
+      private:
+        AnalyzerWorkerPool* const m_pPool;
+        const int m_workerIndex;
+    };
+
+    /// Runs the next task of the queue with the given index or steals
+    /// one from the other queues. Returns false if all queues are empty.
+    bool tryRunTask(int queueIndex);
+
+    static void runTask(QueuedTask* pQueuedTask);
+
+    void runWorker(int workerIndex);
+
+    std::vector<std::unique_ptr<TaskQueue>> m_queues;
+    std::vector<WorkerThread*> m_workers;
+    std::atomic<unsigned int> m_nextQueue;
+
+    // Only incremented while holding m_idleMutex to avoid lost wake-ups
+    std::atomic<int> m_queuedTasks;
+    std::mutex m_idleMutex;
+    std::condition_variable m_idle;
+    bool m_bQuit;
+
+    DISALLOW_COPY_AND_ASSIGN(AnalyzerWorkerPool);
+};
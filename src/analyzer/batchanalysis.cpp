@@ -0,0 +1,215 @@
+#include "analyzer/batchanalysis.h"
+
+#include <QCoreApplication>
+#include <QDir>
+#include <QEventLoop>
+#include <QSqlQuery>
+#include <QSqlRecord>
+#include <QTextStream>
+
+#include "analyzer/trackanalysisscheduler.h"
+#include "database/mixxxdb.h"
+#include "library/dao/analysisdao.h"
+#include "library/queryutil.h"
+#include "library/trackcollectionmanager.h"
+#include "sources/soundsourceproxy.h"
+#include "util/db/dbconnectionpooled.h"
+#include "util/db/dbconnectionpooler.h"
+#include "util/logger.h"
+#include "util/performancetimer.h"
+#include "util/sandbox.h"
+
+namespace {
+
+mixxx::Logger kLogger("BatchAnalysis");
+
+constexpr int kExitCodeSuccess = 0;
+constexpr int kExitCodeFailure = 1;
+
+// Print a progress line after this many tracks
+constexpr int kProgressReportTracks = 100;
+
+const ConfigKey kWaveformGenerationConfigKey(
+        QStringLiteral("[Library]"),
+        QStringLiteral("EnableWaveformGenerationWithAnalysis"));
+
+class TrackAnalysisSchedulerEnvironmentImpl
+        : public TrackAnalysisSchedulerEnvironment {
+  public:
+    explicit TrackAnalysisSchedulerEnvironmentImpl(
+            const TrackCollectionManager* pTrackCollectionManager)
+            : m_pTrackCollectionManager(pTrackCollectionManager) {
+    }
+
+    TrackPointer loadTrackById(TrackId trackId) const override {
+        return m_pTrackCollectionManager->getTrackById(trackId);
+    }
+
+  private:
+    const TrackCollectionManager* const m_pTrackCollectionManager;
+};
+
+QString formatHours(double seconds) {
+    return QString::number(seconds / 3600.0, 'f', 2) + QStringLiteral(" h");
+}
+
+} // anonymous namespace
+
+BatchAnalysis::BatchAnalysis(UserSettingsPointer pConfig, int numAnalyzerThreads)
+        : m_pConfig(std::move(pConfig)),
+          m_numAnalyzerThreads(numAnalyzerThreads) {
+    DEBUG_ASSERT(m_numAnalyzerThreads > 0);
+}
+
+QList<AnalyzerScheduledTrack> BatchAnalysis::queryUnanalyzedTracks(
+        const QSqlDatabase& database,
+        bool withWaveform) {
+    QString missingWaveform;
+    if (withWaveform) {
+        missingWaveform = QStringLiteral(
+                " OR NOT EXISTS (SELECT 1 FROM track_analysis "
+                "WHERE track_analysis.track_id=library.id AND "
+                "track_analysis.type=%1)")
+                                  .arg(AnalysisDao::TYPE_WAVEFORM);
+    }
+    QSqlQuery query(database);
+    query.setForwardOnly(true);
+    query.prepare(QStringLiteral(
+            "SELECT library.id, library.duration "
+            "FROM library INNER JOIN track_locations "
+            "ON library.location=track_locations.id "
+            "WHERE library.mixxx_deleted=0 AND track_locations.fs_deleted=0 AND "
+            "(library.bpm IS NULL OR library.bpm<=0 OR "
+            "library.key IS NULL OR library.key=''%1)")
+                          .arg(missingWaveform));
+    QList<AnalyzerScheduledTrack> tracks;
+    if (!query.exec()) {
+        LOG_FAILED_QUERY(query);
+        return tracks;
+    }
+    const int idColumn = query.record().indexOf("id");
+    const int durationColumn = query.record().indexOf("duration");
+    while (query.next()) {
+        const TrackId trackId(query.value(idColumn));
+        m_trackDurations.insert(trackId, query.value(durationColumn).toDouble());
+        tracks.append(AnalyzerScheduledTrack(trackId));
+    }
+    return tracks;
+}
+
+int BatchAnalysis::run() {
+    QTextStream out(stdout);
+
+    // Usually done in CoreServices::initialize(), which is skipped
+    Sandbox::setPermissionsFilePath(
+            QDir(m_pConfig->getSettingsPath()).filePath("sandbox.cfg"));
+
+    VERIFY_OR_DEBUG_ASSERT(SoundSourceProxy::registerProviders()) {
+        kLogger.critical() << "Failed to register any SoundSource providers";
+        return kExitCodeFailure;
+    }
+
+    const auto pDbConnectionPool = MixxxDb(m_pConfig).connectionPool();
+    if (!pDbConnectionPool) {
+        return kExitCodeFailure;
+    }
+    // The thread-local connection of the main thread must outlive
+    // all other objects that access the database
+    const mixxx::DbConnectionPooler dbConnectionPooler(pDbConnectionPool);
+    const QSqlDatabase dbConnection = mixxx::DbConnectionPooled(pDbConnectionPool);
+    if (!dbConnection.isOpen()) {
+        kLogger.critical() << "Failed to open the library database";
+        return kExitCodeFailure;
+    }
+    if (!MixxxDb::initDatabaseSchema(dbConnection)) {
+        kLogger.critical() << "Failed to initialize or upgrade the database schema";
+        return kExitCodeFailure;
+    }
+
+    const bool withWaveform = m_pConfig->getValue(kWaveformGenerationConfigKey, true);
+    int modeFlags = AnalyzerModeFlags::WithBeats | AnalyzerModeFlags::ParallelAnalyzers;
+    if (withWaveform) {
+        modeFlags |= AnalyzerModeFlags::WithWaveform;
+    }
+
+    TrackCollectionManager trackCollectionManager(nullptr, m_pConfig, pDbConnectionPool);
+    const QList<AnalyzerScheduledTrack> tracks =
+            queryUnanalyzedTracks(dbConnection, withWaveform);
+    out << "Analyzing " << tracks.size() << " tracks with "
+        << m_numAnalyzerThreads << " analyzer threads" << '\n';
+    out.flush();
+    if (tracks.isEmpty()) {
+        return kExitCodeSuccess;
+    }
+
+    int analyzedTracks = 0;
+    int failedTracks = 0;
+    double analyzedSeconds = 0.0;
+    PerformanceTimer timer;
+    const auto reportProgress = [&] {
+        const double elapsedSeconds = timer.elapsed().toDoubleSeconds();
+        if (elapsedSeconds <= 0) {
+            return;
+        }
+        const int finishedTracks = analyzedTracks + failedTracks;
+        out << finishedTracks << "/" << tracks.size() << " tracks, "
+            << QString::number(finishedTracks * 60.0 / elapsedSeconds, 'f', 1)
+            << " tracks/min, "
+            << QString::number(analyzedSeconds / elapsedSeconds, 'f', 1)
+            << "x realtime" << '\n';
+        out.flush();
+    };
+
+    auto pScheduler = TrackAnalysisScheduler::createInstance(
+            std::make_unique<const TrackAnalysisSchedulerEnvironmentImpl>(
+                    &trackCollectionManager),
+            m_numAnalyzerThreads,
+            pDbConnectionPool,
+            m_pConfig,
+            static_cast<AnalyzerModeFlags>(modeFlags));
+    QObject::connect(pScheduler.get(),
+            &TrackAnalysisScheduler::trackProgress,
+            [&](TrackId trackId, AnalyzerProgress analyzerProgress) {
+                if (analyzerProgress == kAnalyzerProgressDone) {
+                    ++analyzedTracks;
+                    analyzedSeconds += m_trackDurations.value(trackId);
+                } else if (analyzerProgress == kAnalyzerProgressUnknown) {
+                    ++failedTracks;
+                    kLogger.warning() << "Failed to analyze track" << trackId;
+                } else {
+                    return;
+                }
+                if ((analyzedTracks + failedTracks) % kProgressReportTracks == 0) {
+                    reportProgress();
+                }
+            });
+    QEventLoop eventLoop;
+    QObject::connect(pScheduler.get(),
+            &TrackAnalysisScheduler::finished,
+            &eventLoop,
+            &QEventLoop::quit);
+
+    timer.start();
+    pScheduler->scheduleTracks(tracks);
+    pScheduler->resume();
+    eventLoop.exec();
+    const mixxx::Duration elapsed = timer.elapsed();
+
+    // Stops the worker threads and releases all tracks, which saves
+    // the analysis results in the database
+    pScheduler.reset();
+    QCoreApplication::sendPostedEvents(nullptr, QEvent::DeferredDelete);
+
+    out << "Analyzed " << analyzedTracks << " tracks ("
+        << formatHours(analyzedSeconds) << " of audio) in "
+        << formatHours(elapsed.toDoubleSeconds()) << '\n';
+    out.flush();
+    reportProgress();
+    if (failedTracks > 0) {
+        // Unreadable files are expected in large libraries and don't
+        // fail the whole run
+        out << "Failed to analyze " << failedTracks << " tracks" << '\n';
+        out.flush();
+    }
+    return kExitCodeSuccess;
+}
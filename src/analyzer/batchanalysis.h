@@ -0,0 +1,39 @@
+#pragma once
+
+#include <QHash>
+#include <QList>
+#include <QSqlDatabase>
+
+#include "analyzer/analyzerscheduledtrack.h"
+#include "preferences/usersettings.h"
+#include "track/trackid.h"
+
+/// Analyzes all library tracks that are missing analysis results and exits,
+/// without the GUI, the audio engine, or any sound or controller devices.
+/// Used by the --analyze-library command line option for pre-analyzing
+/// libraries on build servers.
+///
+/// Opens the library database from the settings directory, schedules the
+/// tracks on a TrackAnalysisScheduler and prints throughput statistics to
+/// stdout.
+class BatchAnalysis final {
+  public:
+    BatchAnalysis(UserSettingsPointer pConfig, int numAnalyzerThreads);
+
+    /// Blocks until all tracks have been analyzed. Returns the exit code
+    /// of the application.
+    int run();
+
+  private:
+    /// Selects the tracks without a BPM or key, or without a waveform
+    /// if waveforms are generated during analysis. The durations
+    /// are stored in m_trackDurations.
+    QList<AnalyzerScheduledTrack> queryUnanalyzedTracks(
+            const QSqlDatabase& database,
+            bool withWaveform);
+
+    const UserSettingsPointer m_pConfig;
+    const int m_numAnalyzerThreads;
+
+    QHash<TrackId, double> m_trackDurations;
+};
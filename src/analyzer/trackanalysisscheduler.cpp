@@ -6,6 +6,7 @@
 #include "track/track.h"
 #include "track/trackid.h"
 #include "util/logger.h"
+#include "util/math.h"
 
 namespace {
 
@@ -71,6 +72,24 @@ TrackAnalysisScheduler::TrackAnalysisScheduler(
                 << "worker threads. Priority: "
                 << (modeFlags & AnalyzerModeFlags::LowPriority ? "low" : "normal");
     }
+    // All worker threads share a single pool for running their analyzers
+    // concurrently. The worker threads help while waiting for their
+    // analyzers and only decode most of the time. The pool only gets the
+    // cores that are not already occupied by the worker threads.
+    std::shared_ptr<AnalyzerWorkerPool> pWorkerPool;
+    if (modeFlags & AnalyzerModeFlags::ParallelAnalyzers) {
+        const int numPoolThreads = math_max(1,
+                QThread::idealThreadCount() - math_max(numWorkerThreads, 0));
+        kLogger.debug()
+                << "Running analyzers on"
+                << numPoolThreads
+                << "pool threads";
+        pWorkerPool = std::make_shared<AnalyzerWorkerPool>(
+                numPoolThreads,
+                modeFlags & AnalyzerModeFlags::LowPriority
+                        ? QThread::LowPriority
+                        : QThread::InheritPriority);
+    }
     // 1st pass: Create worker threads
     m_workers.reserve(numWorkerThreads);
     for (int threadId = 0; threadId < numWorkerThreads; ++threadId) {
@@ -78,7 +97,8 @@ TrackAnalysisScheduler::TrackAnalysisScheduler(
                 threadId,
                 pDbConnectionPool,
                 pConfig,
-                modeFlags));
+                modeFlags,
+                pWorkerPool));
         connect(m_workers.back().thread(),
                 &AnalyzerThread::progress,
                 this,
@@ -1,7 +1,12 @@
 #include "control/control.h"
 
+#include <thread>
+#include <vector>
+
 #include "control/controlobject.h"
+#include "control/controlsnapshot.h"
 #include "moc_control.cpp"
+#include "util/fpclassify.h"
 #include "util/stat.h"
 
 namespace {
@@ -13,20 +18,48 @@ namespace {
 /// configuration object would be arduous.
 UserSettingsPointer s_pUserConfig;
 
-/// Mutex guarding access to s_qCOHash and s_qCOAliasHash.
-MMutex s_qCOHashMutex;
+struct ControlEntry {
+    ConfigKey key;
+    QWeakPointer<ControlDoublePrivate> pControl;
+};
+
+/// Lock guarding access to s_keyIds, s_controlEntries and s_qCOAliasHash.
+/// Looking up existing controls is by far the most frequent operation and
+/// only needs a read lock.
+MReadWriteLock s_controlsLock;
 
-/// Hash of ControlDoublePrivate instantiations.
-QHash<ConfigKey, QWeakPointer<ControlDoublePrivate>> s_qCOHash
-        GUARDED_BY(s_qCOHashMutex);
+/// Ids of all interned ConfigKeys, including aliases. An id is the index
+/// of the key in s_controlEntries. Ids are never removed or reused.
+QHash<ConfigKey, int> s_keyIds
+        GUARDED_BY(s_controlsLock);
+
+/// ControlDoublePrivate instantiations by ConfigKey id.
+std::vector<ControlEntry> s_controlEntries
+        GUARDED_BY(s_controlsLock);
 
 /// Hash of aliases between ConfigKeys. Solely used for looking up the first
 /// alias associated with a key.
 QHash<ConfigKey, ConfigKey> s_qCOAliasHash
-        GUARDED_BY(s_qCOHashMutex);
+        GUARDED_BY(s_controlsLock);
 
 /// is used instead of a nullptr, helps to omit null checks everywhere
 QWeakPointer<ControlDoublePrivate> s_pDefaultCO;
+
+int findKeyId(const ConfigKey& key) REQUIRES_SHARED(s_controlsLock) {
+    return s_keyIds.value(key, -1);
+}
+
+int internKeyId(const ConfigKey& key) REQUIRES(s_controlsLock) {
+    const auto it = s_keyIds.constFind(key);
+    if (it != s_keyIds.constEnd()) {
+        return it.value();
+    }
+    const int id = static_cast<int>(s_controlEntries.size());
+    s_controlEntries.push_back(ControlEntry{key, {}});
+    s_keyIds.insert(key, id);
+    return id;
+}
+
 } // namespace
 
 ControlDoublePrivate::ControlDoublePrivate()
@@ -37,7 +70,12 @@ ControlDoublePrivate::ControlDoublePrivate()
           m_trackFlags(Stat::COUNT | Stat::SUM | Stat::AVERAGE |
                   Stat::SAMPLE_VARIANCE | Stat::MIN | Stat::MAX),
           // default CO is read only
-          m_confirmRequired(true) {
+          m_confirmRequired(true),
+          m_pSnapshotSlot(nullptr),
+          m_snapshotSlotUsers(0),
+          m_dispatchEnabled(false),
+          m_changesSinceDispatch(0),
+          m_pLastSender(nullptr) {
 }
 
 ControlDoublePrivate::ControlDoublePrivate(
@@ -55,7 +93,12 @@ ControlDoublePrivate::ControlDoublePrivate(
           m_trackType(Stat::UNSPECIFIED),
           m_trackFlags(Stat::COUNT | Stat::SUM | Stat::AVERAGE |
                   Stat::SAMPLE_VARIANCE | Stat::MIN | Stat::MAX),
-          m_confirmRequired(false) {
+          m_confirmRequired(false),
+          m_pSnapshotSlot(nullptr),
+          m_snapshotSlotUsers(0),
+          m_dispatchEnabled(false),
+          m_changesSinceDispatch(0),
+          m_pLastSender(nullptr) {
     initialize(defaultValue);
 }
 
@@ -84,10 +127,14 @@ void ControlDoublePrivate::initialize(double defaultValue) {
 }
 
 ControlDoublePrivate::~ControlDoublePrivate() {
-    s_qCOHashMutex.lock();
-    //qDebug() << "ControlDoublePrivate::s_qCOHash.remove(" << m_key.group << "," << m_key.item << ")";
-    s_qCOHash.remove(m_key);
-    s_qCOHashMutex.unlock();
+    {
+        const MWriteLocker locker(&s_controlsLock);
+        const int id = findKeyId(m_key);
+        // The entry might already refer to a new control with the same key
+        if (id >= 0 && s_controlEntries[id].pControl.isNull()) {
+            s_controlEntries[id].pControl.clear();
+        }
+    }
 
     if (m_bPersistInConfiguration) {
         UserSettingsPointer pConfig = s_pUserConfig;
@@ -106,22 +153,74 @@ void ControlDoublePrivate::setUserConfig(const UserSettingsPointer& pConfig) {
 
 // static
 void ControlDoublePrivate::insertAlias(const ConfigKey& alias, const ConfigKey& key) {
-    MMutexLocker locker(&s_qCOHashMutex);
+    const MWriteLocker locker(&s_controlsLock);
 
-    auto it = s_qCOHash.constFind(key);
-    VERIFY_OR_DEBUG_ASSERT(it != s_qCOHash.constEnd()) {
+    const int id = findKeyId(key);
+    VERIFY_OR_DEBUG_ASSERT(id >= 0) {
         qWarning() << "cannot create alias for null control" << key;
         return;
     }
 
-    QSharedPointer<ControlDoublePrivate> pControl = it.value();
+    QSharedPointer<ControlDoublePrivate> pControl = s_controlEntries[id].pControl.lock();
     VERIFY_OR_DEBUG_ASSERT(!pControl.isNull()) {
         qWarning() << "cannot create alias for expired control" << key;
         return;
     }
 
     s_qCOAliasHash.insert(key, alias);
-    s_qCOHash.insert(alias, pControl);
+    s_controlEntries[internKeyId(alias)].pControl = pControl;
+}
+
+// static
+ConfigKeyId ControlDoublePrivate::internKey(const ConfigKey& key) {
+    if (!key.isValid()) {
+        return ConfigKeyId();
+    }
+    {
+        const MReadLocker locker(&s_controlsLock);
+        const int id = findKeyId(key);
+        if (id >= 0) {
+            return ConfigKeyId(id);
+        }
+    }
+    const MWriteLocker locker(&s_controlsLock);
+    return ConfigKeyId(internKeyId(key));
+}
+
+// static
+QSharedPointer<ControlDoublePrivate> ControlDoublePrivate::getControl(
+        ConfigKeyId id,
+        ControlFlags flags) {
+    if (!id.isValid()) {
+        if (!flags.testFlag(ControlFlag::AllowInvalidKey)) {
+            qWarning() << "ControlDoublePrivate::getControl returning nullptr"
+                       << "for invalid ConfigKeyId";
+            DEBUG_ASSERT(!"Unexpected invalid key");
+        }
+        return nullptr;
+    }
+
+    ConfigKey key;
+    // Scope for MReadLocker.
+    {
+        const MReadLocker locker(&s_controlsLock);
+        VERIFY_OR_DEBUG_ASSERT(id.value() < static_cast<int>(s_controlEntries.size())) {
+            return nullptr;
+        }
+        const ControlEntry& entry = s_controlEntries[id.value()];
+        auto pControl = entry.pControl.lock();
+        if (pControl) {
+            return pControl;
+        }
+        key = entry.key;
+    }
+
+    if (!flags.testFlag(ControlFlag::NoWarnIfMissing)) {
+        qWarning() << "ControlDoublePrivate::getControl returning NULL for ("
+                   << key.group << "," << key.item << ")";
+        DEBUG_ASSERT(flags.testFlag(ControlFlag::NoAssertIfMissing));
+    }
+    return nullptr;
 }
 
 // static
@@ -142,12 +241,12 @@ QSharedPointer<ControlDoublePrivate> ControlDoublePrivate::getControl(
         return nullptr;
     }
 
-    // Scope for MMutexLocker.
+    // Scope for MReadLocker.
     {
-        const MMutexLocker locker(&s_qCOHashMutex);
-        const auto it = s_qCOHash.find(key);
-        if (it != s_qCOHash.end()) {
-            auto pControl = it.value().lock();
+        const MReadLocker locker(&s_controlsLock);
+        const int id = findKeyId(key);
+        if (id >= 0) {
+            auto pControl = s_controlEntries[id].pControl.lock();
             if (pControl) {
                 // Control object already exists
                 if (pCreatorCO) {
@@ -159,9 +258,6 @@ QSharedPointer<ControlDoublePrivate> ControlDoublePrivate::getControl(
                     return nullptr;
                 }
                 return pControl;
-            } else {
-                // The weak pointer has become invalid and can be cleaned up
-                s_qCOHash.erase(it);
             }
         }
     }
@@ -174,9 +270,8 @@ QSharedPointer<ControlDoublePrivate> ControlDoublePrivate::getControl(
                         bTrack,
                         bPersist,
                         defaultValue));
-        const MMutexLocker locker(&s_qCOHashMutex);
-        //qDebug() << "ControlDoublePrivate::s_qCOHash.insert(" << key.group << "," << key.item << ")";
-        s_qCOHash.insert(key, pControl);
+        const MWriteLocker locker(&s_controlsLock);
+        s_controlEntries[internKeyId(key)].pControl = pControl;
         return pControl;
     }
 
@@ -195,7 +290,7 @@ QSharedPointer<ControlDoublePrivate> ControlDoublePrivate::getDefaultControl() {
         // Try again with the mutex locked to protect against creating two
         // ControlDoublePrivateConst objects. Access to s_defaultCO itself is
         // thread save.
-        MMutexLocker locker(&s_qCOHashMutex);
+        const MWriteLocker locker(&s_controlsLock);
         defaultCO = s_pDefaultCO.lock();
         if (!defaultCO) {
             defaultCO = QSharedPointer<ControlDoublePrivate>(new ControlDoublePrivateConst());
@@ -208,15 +303,12 @@ QSharedPointer<ControlDoublePrivate> ControlDoublePrivate::getDefaultControl() {
 // static
 QList<QSharedPointer<ControlDoublePrivate>> ControlDoublePrivate::getAllInstances() {
     QList<QSharedPointer<ControlDoublePrivate>> result;
-    MMutexLocker locker(&s_qCOHashMutex);
-    result.reserve(s_qCOHash.size());
-    for (auto it = s_qCOHash.begin(); it != s_qCOHash.end(); ++it) {
-        auto pControl = it.value().lock();
+    const MReadLocker locker(&s_controlsLock);
+    result.reserve(static_cast<int>(s_controlEntries.size()));
+    for (const auto& entry : s_controlEntries) {
+        auto pControl = entry.pControl.lock();
         if (pControl) {
             result.append(std::move(pControl));
-        } else {
-            // The weak pointer has become invalid and can be cleaned up
-            s_qCOHash.erase(it);
         }
     }
     return result;
@@ -225,21 +317,22 @@ QList<QSharedPointer<ControlDoublePrivate>> ControlDoublePrivate::getAllInstance
 // static
 QList<QSharedPointer<ControlDoublePrivate>> ControlDoublePrivate::takeAllInstances() {
     QList<QSharedPointer<ControlDoublePrivate>> result;
-    MMutexLocker locker(&s_qCOHashMutex);
-    result.reserve(s_qCOHash.size());
-    for (auto it = s_qCOHash.begin(); it != s_qCOHash.end(); ++it) {
-        auto pControl = it.value().lock();
+    const MWriteLocker locker(&s_controlsLock);
+    result.reserve(static_cast<int>(s_controlEntries.size()));
+    for (auto& entry : s_controlEntries) {
+        auto pControl = entry.pControl.lock();
         if (pControl) {
             result.append(std::move(pControl));
         }
+        // Keep the entry, the id of the key remains valid
+        entry.pControl.clear();
     }
-    s_qCOHash.clear();
     return result;
 }
 
 //static
 QHash<ConfigKey, ConfigKey> ControlDoublePrivate::getControlAliases() {
-    MMutexLocker locker(&s_qCOHashMutex);
+    const MReadLocker locker(&s_controlsLock);
     // lock thread-unsafe copy constructors of QHash
     return s_qCOAliasHash;
 }
@@ -273,11 +366,55 @@ void ControlDoublePrivate::setAndConfirm(double value, QObject* pSender) {
     setInner(value, pSender);
 }
 
+void ControlDoublePrivate::detachSnapshotSlot(ControlSnapshotSlot* pSlot) {
+    ControlSnapshotSlot* pExpected = pSlot;
+    if (!m_pSnapshotSlot.compare_exchange_strong(pExpected, nullptr)) {
+        return;
+    }
+    // A setter that has registered itself before the slot was detached
+    // might still be pushing into it. Setters that register afterwards
+    // don't see the slot anymore. Both operations are sequentially
+    // consistent, so one of them sees the other.
+    while (m_snapshotSlotUsers.load() != 0) {
+        std::this_thread::yield();
+    }
+}
+
+void ControlDoublePrivate::pushToSnapshotSlot() {
+    m_snapshotSlotUsers.fetch_add(1);
+    ControlSnapshotSlot* pSnapshotSlot = m_pSnapshotSlot.load();
+    if (pSnapshotSlot) {
+        // Publish what was actually stored rather than our own argument.
+        // A concurrent setter may store its value between our store and our
+        // push, so we re-read after pushing and push again until the stored
+        // value is stable. The last push of any setter then always carries
+        // the final value of m_value.
+        double storedValue = m_value.getValue();
+        while (true) {
+            pSnapshotSlot->push(storedValue);
+            const double currentValue = m_value.getValue();
+            if (currentValue == storedValue ||
+                    (util_isnan(currentValue) && util_isnan(storedValue))) {
+                break;
+            }
+            storedValue = currentValue;
+        }
+    }
+    m_snapshotSlotUsers.fetch_sub(1, std::memory_order_release);
+}
+
 void ControlDoublePrivate::setInner(double value, QObject* pSender) {
     if (m_bIgnoreNops && get() == value) {
         return;
     }
     m_value.setValue(value);
+    if (m_pSnapshotSlot.load(std::memory_order_relaxed)) {
+        pushToSnapshotSlot();
+    }
+    if (m_dispatchEnabled.load(std::memory_order_relaxed)) {
+        m_pLastSender.store(pSender, std::memory_order_relaxed);
+        m_changesSinceDispatch.fetch_add(1, std::memory_order_release);
+    }
     emit valueChanged(value, pSender);
 
     if (m_bTrack) {
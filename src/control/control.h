@@ -5,6 +5,7 @@
 #include <QObject>
 #include <QSharedPointer>
 #include <QString>
+#include <atomic>
 
 #include "control/controlbehavior.h"
 #include "control/controlvalue.h"
@@ -12,6 +13,7 @@
 #include "util/mutex.h"
 
 class ControlObject;
+class ControlSnapshotSlot;
 
 enum class ControlFlag {
     None = 0,
@@ -57,6 +59,16 @@ class ControlDoublePrivate : public QObject {
             double defaultValue = 0.0);
     static QSharedPointer<ControlDoublePrivate> getDefaultControl();
 
+    // Returns the interned id of the given ConfigKey, which may be used to
+    // look up the control repeatedly without hashing the key. The control
+    // doesn't need to exist yet. Returns an invalid id for an invalid key.
+    static ConfigKeyId internKey(const ConfigKey& key);
+
+    // Gets the existing ControlDoublePrivate for an interned ConfigKey.
+    static QSharedPointer<ControlDoublePrivate> getControl(
+            ConfigKeyId id,
+            ControlFlags flags = ControlFlag::None);
+
     // Returns a list of all existing instances.
     static QList<QSharedPointer<ControlDoublePrivate>> getAllInstances();
     // Clears all existing instances and returns them as a list.
@@ -148,6 +160,32 @@ class ControlDoublePrivate : public QObject {
         return m_confirmRequired;
     }
 
+    // Forwards all value changes to the slot of a ControlSnapshot. Only
+    // a single snapshot per control is supported. Returns false if the
+    // control is already attached to a slot.
+    bool attachSnapshotSlot(ControlSnapshotSlot* pSlot) {
+        ControlSnapshotSlot* pExpected = nullptr;
+        return m_pSnapshotSlot.compare_exchange_strong(pExpected, pSlot);
+    }
+    // Stops forwarding value changes to the slot. Waits until concurrent
+    // setters have finished pushing into the slot, so the slot may be
+    // destroyed afterwards.
+    void detachSnapshotSlot(ControlSnapshotSlot* pSlot);
+
+    // Counts the value changes for ControlChangeDispatcher, which delivers
+    // them at most once per GUI frame.
+    void setDispatchEnabled(bool enabled) {
+        m_dispatchEnabled.store(enabled, std::memory_order_relaxed);
+        m_changesSinceDispatch.store(0, std::memory_order_relaxed);
+    }
+    // Returns the number of value changes since the last call and the
+    // setter of the most recent change.
+    int takeChangesSinceDispatch(QObject** ppLastSender) {
+        const int changes = m_changesSinceDispatch.exchange(0, std::memory_order_acquire);
+        *ppLastSender = m_pLastSender.load(std::memory_order_relaxed);
+        return changes;
+    }
+
   signals:
     // Emitted when the ControlDoublePrivate value changes. pSender is a
     // pointer to the setter of the value (potentially NULL).
@@ -172,6 +210,7 @@ class ControlDoublePrivate : public QObject {
 
     void initialize(double defaultValue);
     virtual void setInner(double value, QObject* pSender);
+    void pushToSnapshotSlot();
 
     const ConfigKey m_key;
 
@@ -204,6 +243,14 @@ class ControlDoublePrivate : public QObject {
     ControlValueAtomic<double> m_defaultValue;
 
     QSharedPointer<ControlNumericBehavior> m_pBehavior;
+
+    std::atomic<ControlSnapshotSlot*> m_pSnapshotSlot;
+    // The number of setters that might be pushing into m_pSnapshotSlot
+    std::atomic<int> m_snapshotSlotUsers;
+
+    std::atomic<bool> m_dispatchEnabled;
+    std::atomic<int> m_changesSinceDispatch;
+    std::atomic<QObject*> m_pLastSender;
 };
 
 /// The constant ControlDoublePrivate version is used as dummy for default
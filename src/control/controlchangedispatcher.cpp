@@ -0,0 +1,141 @@
+#include "control/controlchangedispatcher.h"
+
+#include <QCoreApplication>
+#include <QHash>
+#include <QThread>
+#include <QVector>
+
+#include "control/control.h"
+#include "control/controlproxy.h"
+#include "util/counter.h"
+#include "util/mutex.h"
+
+namespace {
+
+struct Subscription {
+    QSharedPointer<ControlDoublePrivate> pControl;
+    QVector<ControlProxy*> proxies;
+};
+
+/// Mutex guarding all subscriptions
+MMutex s_mutex;
+
+bool s_enabled GUARDED_BY(s_mutex) = false;
+
+QHash<ControlDoublePrivate*, Subscription> s_subscriptions GUARDED_BY(s_mutex);
+
+struct PendingNotification {
+    ControlProxy* pProxy;
+    ControlDoublePrivate* pControl;
+    QObject* pSender;
+};
+
+bool isSubscribed(ControlProxy* pProxy, ControlDoublePrivate* pControl)
+        REQUIRES(s_mutex) {
+    const auto it = s_subscriptions.constFind(pControl);
+    return it != s_subscriptions.constEnd() && it->proxies.contains(pProxy);
+}
+
+} // namespace
+
+// static
+void ControlChangeDispatcher::setEnabled(bool enabled) {
+    MMutexLocker lock(&s_mutex);
+    s_enabled = enabled;
+}
+
+// static
+bool ControlChangeDispatcher::isEnabled() {
+    MMutexLocker lock(&s_mutex);
+    return s_enabled;
+}
+
+// static
+bool ControlChangeDispatcher::subscribe(ControlProxy* pProxy,
+        const QSharedPointer<ControlDoublePrivate>& pControl) {
+    MMutexLocker lock(&s_mutex);
+    if (!s_enabled) {
+        return false;
+    }
+    Subscription& subscription = s_subscriptions[pControl.data()];
+    if (!subscription.pControl) {
+        subscription.pControl = pControl;
+        pControl->setDispatchEnabled(true);
+    }
+    DEBUG_ASSERT(!subscription.proxies.contains(pProxy));
+    subscription.proxies.append(pProxy);
+    return true;
+}
+
+// static
+void ControlChangeDispatcher::unsubscribe(ControlProxy* pProxy,
+        const QSharedPointer<ControlDoublePrivate>& pControl) {
+    MMutexLocker lock(&s_mutex);
+    const auto it = s_subscriptions.find(pControl.data());
+    if (it == s_subscriptions.end()) {
+        return;
+    }
+    it->proxies.removeOne(pProxy);
+    if (it->proxies.isEmpty()) {
+        it->pControl->setDispatchEnabled(false);
+        s_subscriptions.erase(it);
+    }
+}
+
+// static
+void ControlChangeDispatcher::dispatch() {
+    DEBUG_ASSERT(QThread::currentThread() == QCoreApplication::instance()->thread());
+    QThread* const pMainThread = QThread::currentThread();
+
+    int numDelivered = 0;
+    int numSuppressed = 0;
+    QVector<PendingNotification> mainThreadNotifications;
+    {
+        MMutexLocker lock(&s_mutex);
+        if (!s_enabled) {
+            return;
+        }
+        for (const auto& subscription : qAsConst(s_subscriptions)) {
+            QObject* pLastSender;
+            const int numChanges =
+                    subscription.pControl->takeChangesSinceDispatch(&pLastSender);
+            if (numChanges == 0) {
+                continue;
+            }
+            for (ControlProxy* pProxy : subscription.proxies) {
+                if (pProxy->thread() == pMainThread) {
+                    mainThreadNotifications.append(
+                            {pProxy, subscription.pControl.data(), pLastSender});
+                } else {
+                    // Only posts an event to the thread of the proxy. The
+                    // lock prevents the proxy from being destroyed meanwhile.
+                    pProxy->dispatchValueChanged(pLastSender);
+                }
+            }
+            numDelivered += subscription.proxies.size();
+            numSuppressed += (numChanges - 1) * subscription.proxies.size();
+        }
+    }
+
+    // Receivers in the main thread are invoked directly and may subscribe or
+    // unsubscribe proxies, so the lock must not be held.
+    for (const auto& notification : qAsConst(mainThreadNotifications)) {
+        {
+            MMutexLocker lock(&s_mutex);
+            if (!isSubscribed(notification.pProxy, notification.pControl)) {
+                // Destroyed by one of the previous receivers
+                continue;
+            }
+        }
+        notification.pProxy->dispatchValueChanged(notification.pSender);
+    }
+
+    if (numDelivered > 0) {
+        Counter delivered(QStringLiteral("ControlChangeDispatcher delivered"));
+        delivered.increment(numDelivered);
+    }
+    if (numSuppressed > 0) {
+        Counter suppressed(QStringLiteral("ControlChangeDispatcher suppressed"));
+        suppressed.increment(numSuppressed);
+    }
+}
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <QSharedPointer>
+
+class ControlDoublePrivate;
+class ControlProxy;
+
+/// Delivers the value changes of controls to subscribed ControlProxys at most
+/// once per GUI frame, instead of posting a queued event for every single
+/// change. Meant for subscribers that only display the current value, e.g.
+/// widgets or controller feedback, of controls that are updated much more
+/// often than the screen, e.g. VU meters, the play position or beat indicators.
+///
+/// The setter of a control only increments a counter, the notification itself
+/// is emitted from dispatch(), which is called by GuiTick in the main thread.
+/// Subscribers that live in other threads, like controller scripts, receive
+/// a queued signal.
+///
+/// The dispatcher is only enabled while a GuiTick exists. Otherwise subscribe()
+/// fails and subscribers must fall back to regular signal connections.
+class ControlChangeDispatcher final {
+  public:
+    static void setEnabled(bool enabled);
+    static bool isEnabled();
+
+    /// Returns false if the dispatcher is disabled. Thread-safe.
+    static bool subscribe(ControlProxy* pProxy,
+            const QSharedPointer<ControlDoublePrivate>& pControl);
+    /// Must be called before the proxy is destroyed. Thread-safe.
+    static void unsubscribe(ControlProxy* pProxy,
+            const QSharedPointer<ControlDoublePrivate>& pControl);
+
+    /// Emits the notifications for all controls that have changed since the
+    /// last call. Must be called from the main thread.
+    static void dispatch();
+
+  private:
+    ControlChangeDispatcher() = delete;
+};
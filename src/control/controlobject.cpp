@@ -67,6 +67,15 @@ ControlObject* ControlObject::getControl(const ConfigKey& key, ControlFlags flag
     return nullptr;
 }
 
+// static
+ControlObject* ControlObject::getControl(ConfigKeyId keyId, ControlFlags flags) {
+    QSharedPointer<ControlDoublePrivate> pCDP = ControlDoublePrivate::getControl(keyId, flags);
+    if (pCDP) {
+        return pCDP->getCreatorCO();
+    }
+    return nullptr;
+}
+
 void ControlObject::setValueFromMidi(MidiOpCode o, double v) {
     m_pControl->setValueFromMidi(o, v);
 }
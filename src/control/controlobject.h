@@ -32,6 +32,9 @@ class ControlObject : public QObject {
         ConfigKey key(group, item);
         return getControl(key, flags);
     }
+    // Returns a pointer to the ControlObject matching the given interned
+    // ConfigKey, without hashing the key again
+    static ControlObject* getControl(ConfigKeyId keyId, ControlFlags flags = ControlFlag::None);
 
     QString name() const {
         return m_pControl ?  m_pControl->name() : QString();
@@ -5,27 +5,63 @@
 ControlObjectScript::ControlObjectScript(
         const ConfigKey& key, const RuntimeLoggingCategory& logger, QObject* pParent)
         : ControlProxy(key, pParent, ControlFlag::AllowMissingOrInvalid),
+          m_keyId(ControlDoublePrivate::internKey(key)),
           m_logger(logger),
           m_proxy(key, logger, this),
           m_skipSuperseded(false) {
 }
 
+ControlObjectScript::~ControlObjectScript() {
+    // Unsubscribe before the overridden dispatchValueChanged() is gone
+    if (m_bDispatched) {
+        ControlChangeDispatcher::unsubscribe(this, m_pControl);
+        m_bDispatched = false;
+    }
+}
+
+void ControlObjectScript::connectSkipSuperseded() {
+    // Superseded events are skipped by delivering at most one change per
+    // GUI frame. Without a running dispatcher, the queued events are
+    // compressed by the CompressingProxy instead.
+    if (ControlChangeDispatcher::subscribe(this, m_pControl)) {
+        m_bDispatched = true;
+        return;
+    }
+    connect(m_pControl.data(),
+            &ControlDoublePrivate::valueChanged,
+            &m_proxy,
+            &CompressingProxy::slotValueChanged,
+            Qt::QueuedConnection);
+    connect(&m_proxy,
+            &CompressingProxy::signalValueChanged,
+            this,
+            &ControlObjectScript::slotValueChanged,
+            Qt::DirectConnection);
+}
+
+void ControlObjectScript::disconnectSkipSuperseded() {
+    if (m_bDispatched) {
+        ControlChangeDispatcher::unsubscribe(this, m_pControl);
+        m_bDispatched = false;
+        return;
+    }
+    disconnect(m_pControl.data(),
+            &ControlDoublePrivate::valueChanged,
+            &m_proxy,
+            &CompressingProxy::slotValueChanged);
+    disconnect(&m_proxy,
+            &CompressingProxy::signalValueChanged,
+            this,
+            &ControlObjectScript::slotValueChanged);
+}
+
 bool ControlObjectScript::addScriptConnection(const ScriptConnection& conn) {
     if (m_scriptConnections.isEmpty()) {
         // Only connect the slots when they are actually needed
         // by script connections.
         m_skipSuperseded = conn.skipSuperseded;
         if (conn.skipSuperseded) {
-            connect(m_pControl.data(),
-                    &ControlDoublePrivate::valueChanged,
-                    &m_proxy,
-                    &CompressingProxy::slotValueChanged,
-                    Qt::QueuedConnection);
-            connect(&m_proxy,
-                    &CompressingProxy::signalValueChanged,
-                    this,
-                    &ControlObjectScript::slotValueChanged,
-                    Qt::DirectConnection);
+            connectSkipSuperseded();
         } else {
             connect(m_pControl.data(),
                     &ControlDoublePrivate::valueChanged,
@@ -48,14 +84,7 @@ bool ControlObjectScript::addScriptConnection(const ScriptConnection& conn) {
                             "differing state of the skipSuperseded. Disable "
                             "skipping of superseded events for all these "
                             "callback functions.";
-            disconnect(m_pControl.data(),
-                    &ControlDoublePrivate::valueChanged,
-                    &m_proxy,
-                    &CompressingProxy::slotValueChanged);
-            disconnect(&m_proxy,
-                    &CompressingProxy::signalValueChanged,
-                    this,
-                    &ControlObjectScript::slotValueChanged);
+            disconnectSkipSuperseded();
             connect(m_pControl.data(),
                     &ControlDoublePrivate::valueChanged,
                     this,
@@ -95,14 +124,7 @@ bool ControlObjectScript::removeScriptConnection(const ScriptConnection& conn) {
     if (m_scriptConnections.isEmpty()) {
         // no ScriptConnections left, so disconnect signals
         if (m_skipSuperseded) {
-            disconnect(m_pControl.data(),
-                    &ControlDoublePrivate::valueChanged,
-                    &m_proxy,
-                    &CompressingProxy::slotValueChanged);
-            disconnect(&m_proxy,
-                    &CompressingProxy::signalValueChanged,
-                    this,
-                    &ControlObjectScript::slotValueChanged);
+            disconnectSkipSuperseded();
         } else {
             disconnect(m_pControl.data(),
                     &ControlDoublePrivate::valueChanged,
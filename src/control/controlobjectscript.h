@@ -14,6 +14,12 @@ class ControlObjectScript : public ControlProxy {
     explicit ControlObjectScript(const ConfigKey& key,
             const RuntimeLoggingCategory& logger,
             QObject* pParent = nullptr);
+    ~ControlObjectScript() override;
+
+    /// The interned key, for looking up the ControlObject repeatedly
+    ConfigKeyId getKeyId() const {
+        return m_keyId;
+    }
 
     bool addScriptConnection(const ScriptConnection& conn);
 
@@ -31,6 +37,12 @@ class ControlObjectScript : public ControlProxy {
         emit trigger(get(), this);
     }
 
+  protected:
+    // Script callbacks are also invoked for changes made by the script itself
+    void dispatchValueChanged(QObject*) override {
+        emitValueChanged();
+    }
+
   signals:
     // It will connect to the slotValueChanged as well
     void trigger(double, QObject*);
@@ -41,7 +53,11 @@ class ControlObjectScript : public ControlProxy {
     virtual void slotValueChanged(double v, QObject*);
 
   private:
+    void connectSkipSuperseded();
+    void disconnectSkipSuperseded();
+
     QVector<ScriptConnection> m_scriptConnections;
+    const ConfigKeyId m_keyId;
     const RuntimeLoggingCategory m_logger;
     CompressingProxy m_proxy;
     bool m_skipSuperseded; // This flag is combined for all connections of this Control Object
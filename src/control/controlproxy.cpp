@@ -10,7 +10,8 @@ ControlProxy::ControlProxy(const QString& g, const QString& i, QObject* pParent,
 }
 
 ControlProxy::ControlProxy(const ConfigKey& key, QObject* pParent, ControlFlags flags)
-        : QObject(pParent) {
+        : QObject(pParent),
+          m_bDispatched(false) {
     m_pControl = ControlDoublePrivate::getControl(key, flags);
     if (!m_pControl) {
         DEBUG_ASSERT(flags & ControlFlag::AllowMissingOrInvalid);
@@ -21,6 +22,9 @@ ControlProxy::ControlProxy(const ConfigKey& key, QObject* pParent, ControlFlags
 
 ControlProxy::~ControlProxy() {
     //qDebug() << "ControlProxy::~ControlProxy()";
+    if (m_bDispatched) {
+        ControlChangeDispatcher::unsubscribe(this, m_pControl);
+    }
 }
 
 const ConfigKey& ControlProxy::getKey() const {
@@ -5,6 +5,7 @@
 #include <QString>
 
 #include "control/control.h"
+#include "control/controlchangedispatcher.h"
 #include "preferences/usersettings.h"
 #include "util/platform.h"
 
@@ -100,6 +101,25 @@ class ControlProxy : public QObject {
         return true;
     }
 
+    /// Like connectValueChanged() with an AutoConnection, but delivers at
+    /// most one valueChanged() signal per GUI frame with the most recent
+    /// value. Intended for receivers in the main thread that only display
+    /// the value. Falls back to connectValueChanged() if the
+    /// ControlChangeDispatcher is not running.
+    template<typename Receiver, typename Slot>
+    bool connectValueChangedCoalesced(Receiver receiver, Slot func) {
+        if (!valid()) {
+            return false;
+        }
+        if (!m_bDispatched) {
+            if (!ControlChangeDispatcher::subscribe(this, m_pControl)) {
+                return connectValueChanged(receiver, func);
+            }
+            m_bDispatched = true;
+        }
+        return connect(this, &ControlProxy::valueChanged, receiver, func, Qt::AutoConnection);
+    }
+
     /// Called from update();
     virtual void emitValueChanged() {
         emit valueChanged(get());
@@ -184,6 +204,20 @@ class ControlProxy : public QObject {
     }
 
   protected:
+    /// Called by the ControlChangeDispatcher at most once per GUI frame
+    /// if the value has changed. pSetter is the setter of the most recent
+    /// change.
+    virtual void dispatchValueChanged(QObject* pSetter) {
+        if (pSetter != this) {
+            emitValueChanged();
+        }
+    }
+
     /// Pointer to connected control.
     QSharedPointer<ControlDoublePrivate> m_pControl;
+
+    /// Subscribed to the ControlChangeDispatcher
+    bool m_bDispatched;
+
+    friend class ControlChangeDispatcher;
 };
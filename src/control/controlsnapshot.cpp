@@ -0,0 +1,77 @@
+#include "control/controlsnapshot.h"
+
+#include "util/assert.h"
+
+ControlSnapshot::ControlSnapshot() = default;
+
+ControlSnapshot::~ControlSnapshot() {
+    const int numControls = size();
+    for (int i = 0; i < numControls; ++i) {
+        Block* pBlock = m_blocks[i / kBlockSize].get();
+        m_controls[i]->detachSnapshotSlot(&pBlock->pendingSlots[i % kBlockSize]);
+    }
+}
+
+const double* ControlSnapshot::registerControl(
+        const QSharedPointer<ControlDoublePrivate>& pControl) {
+    VERIFY_OR_DEBUG_ASSERT(pControl) {
+        return nullptr;
+    }
+    // Controls like quantize are read by several engine controls of the
+    // same deck, which share the published value
+    for (int i = 0; i < size(); ++i) {
+        if (m_controls[i] == pControl) {
+            return &m_blocks[i / kBlockSize]->values[i % kBlockSize];
+        }
+    }
+    const int index = size();
+    if (index % kBlockSize == 0) {
+        m_blocks.push_back(std::make_unique<Block>());
+    }
+    Block* pBlock = m_blocks.back().get();
+    const int slotIndex = index % kBlockSize;
+    ControlSnapshotSlot* pSlot = &pBlock->pendingSlots[slotIndex];
+    pSlot->m_pDirtyMask = &pBlock->dirtyMask;
+    pSlot->m_dirtyBit = std::uint64_t{1} << slotIndex;
+    VERIFY_OR_DEBUG_ASSERT(pControl->attachSnapshotSlot(pSlot)) {
+        // The slot is reused by the next registration
+        if (slotIndex == 0) {
+            m_blocks.pop_back();
+        }
+        return nullptr;
+    }
+    // Writes that happened before attaching the slot are not pushed
+    const double value = pControl->get();
+    pBlock->values[slotIndex] = value;
+    pSlot->m_pendingValue.store(value, std::memory_order_relaxed);
+    m_controls.push_back(pControl);
+    return &pBlock->values[slotIndex];
+}
+
+void ControlSnapshot::publish() {
+    for (const auto& pBlock : m_blocks) {
+        std::uint64_t dirtyMask = pBlock->dirtyMask.exchange(0, std::memory_order_acquire);
+        for (int slotIndex = 0; dirtyMask != 0; ++slotIndex, dirtyMask >>= 1) {
+            if (dirtyMask & 1) {
+                pBlock->values[slotIndex] =
+                        pBlock->pendingSlots[slotIndex].m_pendingValue.load(
+                                std::memory_order_relaxed);
+            }
+        }
+    }
+}
+
+SnapshotControlProxy::SnapshotControlProxy(ControlSnapshot* pSnapshot,
+        const ConfigKey& key,
+        ControlFlags flags)
+        : m_pControl(ControlDoublePrivate::getControl(key, flags)),
+          m_pValue(nullptr) {
+    if (!m_pControl) {
+        DEBUG_ASSERT(flags & ControlFlag::AllowMissingOrInvalid);
+        m_pControl = ControlDoublePrivate::getDefaultControl();
+        return;
+    }
+    if (pSnapshot) {
+        m_pValue = pSnapshot->registerControl(m_pControl);
+    }
+}
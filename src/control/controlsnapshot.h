@@ -0,0 +1,112 @@
+#pragma once
+
+#include <QSharedPointer>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "control/control.h"
+#include "util/class.h"
+
+/// The pending value of a control in a ControlSnapshot. Written by
+/// ControlDoublePrivate whenever the control value changes, from any thread.
+class ControlSnapshotSlot final {
+  public:
+    void push(double value) {
+        m_pendingValue.store(value, std::memory_order_relaxed);
+        // The release ordering publishes the pending value together with
+        // the dirty flag
+        m_pDirtyMask->fetch_or(m_dirtyBit, std::memory_order_release);
+    }
+
+  private:
+    friend class ControlSnapshot;
+
+    std::atomic<double> m_pendingValue{0.0};
+    std::atomic<std::uint64_t>* m_pDirtyMask{nullptr};
+    std::uint64_t m_dirtyBit{0};
+};
+
+/// A contiguous, double-buffered copy of control values for code that reads
+/// the same controls on every engine callback.
+///
+/// Writers don't need to know about the snapshot: Whenever a registered control
+/// changes its value, it is stored in a pending slot and marked as dirty. The
+/// owner calls publish() once per callback, which copies only the dirty values
+/// into the plain array that is read by SnapshotControlProxy. Multiple writes
+/// between two callbacks are coalesced into a single update, and the values
+/// stay consistent during the callback.
+///
+/// All controls must be registered before the first call of publish().
+/// publish() and all reads must happen on the same thread, usually the
+/// engine thread. Values that are written by the engine itself during
+/// the callback only become visible after the next publish() and should
+/// not be read through a snapshot.
+class ControlSnapshot final {
+  public:
+    ControlSnapshot();
+    ~ControlSnapshot();
+
+    /// Returns the location of the published value in the snapshot, or
+    /// nullptr if the control could not be registered, e.g. because it
+    /// is already part of another snapshot. Registering the same control
+    /// again returns the same location.
+    const double* registerControl(
+            const QSharedPointer<ControlDoublePrivate>& pControl);
+
+    /// Copies all values that have changed since the last call.
+    void publish();
+
+    int size() const {
+        return static_cast<int>(m_controls.size());
+    }
+
+  private:
+    static constexpr int kBlockSize = 64;
+
+    // Writers only touch the dirty mask and the pending slots, which are
+    // kept apart from the published values that are read by the engine.
+    struct Block {
+        double values[kBlockSize];
+        std::atomic<std::uint64_t> dirtyMask{0};
+        ControlSnapshotSlot pendingSlots[kBlockSize];
+    };
+
+    std::vector<std::unique_ptr<Block>> m_blocks;
+    std::vector<QSharedPointer<ControlDoublePrivate>> m_controls;
+
+    DISALLOW_COPY_AND_ASSIGN(ControlSnapshot);
+};
+
+/// A read-only proxy for a control in a ControlSnapshot. Reading it is a plain
+/// load of the published value. Without a snapshot it reads the control
+/// directly, like PollingControlProxy.
+class SnapshotControlProxy final {
+  public:
+    SnapshotControlProxy(ControlSnapshot* pSnapshot,
+            const ConfigKey& key,
+            ControlFlags flags = ControlFlag::None);
+
+    bool valid() const {
+        return m_pControl->getKey().isValid();
+    }
+
+    /// Returns the value as of the last ControlSnapshot::publish().
+    /// Must only be called on the thread that publishes the snapshot.
+    double get() const {
+        if (m_pValue) {
+            return *m_pValue;
+        }
+        return m_pControl->get();
+    }
+
+    bool toBool() const {
+        return get() > 0.0;
+    }
+
+  private:
+    // not null
+    QSharedPointer<ControlDoublePrivate> m_pControl;
+    const double* m_pValue;
+};
@@ -206,6 +206,10 @@ ControlPickerMenu::ControlPickerMenu(QWidget* pParent)
     addDeckAndSamplerAndPreviewDeckControl("eject", tr("Eject"), tr("Eject track"), transportMenu);
     addDeckAndSamplerControl("repeat", tr("Repeat Mode"), tr("Toggle repeat mode"), transportMenu);
     addDeckAndSamplerControl("slip_enabled", tr("Slip Mode"), tr("Toggle slip mode"), transportMenu);
+    addDeckAndSamplerControl("preload_fully",
+            tr("Preload Fully"),
+            tr("Toggle decoding the whole track into memory when loading it"),
+            transportMenu);
 
     // BPM / Beatgrid
     QMenu* bpmMenu = addSubmenu(tr("BPM / Beatgrid"));
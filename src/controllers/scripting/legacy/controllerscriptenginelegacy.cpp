@@ -7,6 +7,7 @@
 #include "errordialoghandler.h"
 #include "mixer/playermanager.h"
 #include "moc_controllerscriptenginelegacy.cpp"
+#include "util/timer.h"
 
 ControllerScriptEngineLegacy::ControllerScriptEngineLegacy(
         Controller* controller, const RuntimeLoggingCategory& logger)
@@ -100,6 +101,8 @@ void ControllerScriptEngineLegacy::setScriptFiles(
 }
 
 bool ControllerScriptEngineLegacy::initialize() {
+    // Reported in developer mode, next to SkinLoader::parseSkin
+    ScopedTimer timer("ControllerScriptEngineLegacy::initialize");
     if (!ControllerScriptEngineBase::initialize()) {
         return false;
     }
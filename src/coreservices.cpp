@@ -116,8 +116,8 @@ CoreServices::CoreServices(const CmdlineArgs& args, QApplication* pApp)
     // called after the GUI is initialized
     initializeSettings();
     initializeLogging();
-    // Only record stats in developer mode.
-    if (m_cmdlineArgs.getDeveloper()) {
+    // Only record stats in developer mode or for writing a trace.
+    if (m_cmdlineArgs.getStatsEnabled()) {
         StatsManager::createInstance();
     }
     mixxx::Translations::initializeTranslations(
@@ -135,7 +135,7 @@ CoreServices::~CoreServices() {
     CLEAR_AND_CHECK_DELETED(m_pKbdConfig);
     CLEAR_AND_CHECK_DELETED(m_pKbdConfigEmpty);
 
-    if (m_cmdlineArgs.getDeveloper()) {
+    if (m_cmdlineArgs.getStatsEnabled()) {
         StatsManager::destroy();
     }
 
@@ -1,6 +1,8 @@
 #include "dialog/dlgdevelopertools.h"
 
 #include <QDateTime>
+#include <QTreeWidgetItem>
+#include <algorithm>
 
 #include "control/control.h"
 #include "moc_dlgdevelopertools.cpp"
@@ -47,6 +49,11 @@ DlgDeveloperTools::DlgDeveloperTools(QWidget* pParent,
             this,
             &DlgDeveloperTools::slotControlDump);
 
+    connect(audioCallbacksDump,
+            &QPushButton::clicked,
+            this,
+            &DlgDeveloperTools::slotAudioCallbacksDump);
+
     // Set up the log search box
     connect(logSearch,
             &QLineEdit::returnPressed,
@@ -98,6 +105,112 @@ void DlgDeveloperTools::timerEvent(QTimerEvent* pEvent) {
         if (pManager) {
             pManager->updateStats();
         }
+    } else if (toolTabWidget->currentWidget() == audioCallbacksTab) {
+        StatsManager* pManager = StatsManager::instance();
+        if (pManager) {
+            pManager->updateStats();
+            updateAudioCallbacks();
+        }
+    }
+}
+
+namespace {
+
+QString formatMillis(qint64 nanos) {
+    return QString::number(nanos / 1e6, 'f', 3);
+}
+
+bool sameCallbacks(const QVector<AudioCallbackProfile>& lhs,
+        const QVector<AudioCallbackProfile>& rhs) {
+    if (lhs.size() != rhs.size()) {
+        return false;
+    }
+    for (int i = 0; i < lhs.size(); ++i) {
+        if (lhs[i].startNanos != rhs[i].startNanos) {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+void DlgDeveloperTools::updateAudioCallbacks() {
+    const QVector<AudioCallbackProfile> callbacks =
+            StatsManager::instance()->worstAudioCallbacks();
+    if (sameCallbacks(callbacks, m_audioCallbacks)) {
+        return;
+    }
+    m_audioCallbacks = callbacks;
+
+    audioCallbacksTree->clear();
+    for (const auto& profile : callbacks) {
+        auto* pCallbackItem = new QTreeWidgetItem(audioCallbacksTree);
+        pCallbackItem->setText(0,
+                tr("At %1 s").arg(QString::number(profile.startNanos / 1e9, 'f', 3)));
+        pCallbackItem->setText(1, tr("%1 ms").arg(formatMillis(profile.durationNanos)));
+        pCallbackItem->setText(2, tr("%1 ms").arg(formatMillis(profile.budgetNanos)));
+        if (profile.xrunReported) {
+            pCallbackItem->setText(3, tr("reported"));
+        } else if (profile.isOverrun()) {
+            pCallbackItem->setText(3, tr("overrun"));
+        }
+
+        // Slowest stages first
+        QVector<AudioCallbackProfile::StageTime> stages(
+                profile.stages, profile.stages + profile.numStages);
+        std::sort(stages.begin(),
+                stages.end(),
+                [](const auto& lhs, const auto& rhs) {
+                    return lhs.nanos > rhs.nanos;
+                });
+        for (const auto& stage : qAsConst(stages)) {
+            auto* pStageItem = new QTreeWidgetItem(pCallbackItem);
+            pStageItem->setText(0, AudioCallbackProfiler::stageName(stage.stageId));
+            pStageItem->setText(1, tr("%1 ms").arg(formatMillis(stage.nanos)));
+        }
+        if (profile.numDroppedStages > 0) {
+            auto* pDroppedItem = new QTreeWidgetItem(pCallbackItem);
+            pDroppedItem->setText(0,
+                    tr("%n more stage(s) not recorded", "", profile.numDroppedStages));
+        }
+    }
+    audioCallbacksTree->resizeColumnToContents(0);
+}
+
+void DlgDeveloperTools::slotAudioCallbacksDump() {
+    StatsManager* pManager = StatsManager::instance();
+    if (!pManager) {
+        return;
+    }
+
+    QString timestamp = QDateTime::currentDateTime()
+            .toString("yyyy-MM-dd_hh'h'mm'm'ss's'");
+    QString dumpFileName = m_pConfig->getSettingsPath() +
+            "/audio_callbacks_" + timestamp + ".csv";
+    QFile dumpFile;
+    // Note: QFile is closed if it falls out of scope
+    dumpFile.setFileName(dumpFileName);
+    if (!dumpFile.open(QIODevice::WriteOnly | QIODevice::Text)) {
+        qWarning() << "open" << dumpFileName << "failed";
+        return;
+    }
+
+    // One line per stage of each callback
+    dumpFile.write("start_ms,duration_ms,budget_ms,xrun_reported,stage,stage_ms\n");
+    const QVector<AudioCallbackProfile> callbacks = pManager->worstAudioCallbacks();
+    for (const auto& profile : callbacks) {
+        const QString callback = formatMillis(profile.startNanos) + "," +
+                formatMillis(profile.durationNanos) + "," +
+                formatMillis(profile.budgetNanos) + "," +
+                QString::number(profile.xrunReported ? 1 : 0) + ",";
+        for (int i = 0; i < profile.numStages; ++i) {
+            const auto& stage = profile.stages[i];
+            QString line = callback + "\"" +
+                    AudioCallbackProfiler::stageName(stage.stageId) + "\"," +
+                    formatMillis(stage.nanos) + "\n";
+            dumpFile.write(line.toLocal8Bit());
+        }
     }
 }
 
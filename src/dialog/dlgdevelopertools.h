@@ -9,6 +9,7 @@
 #include "control/controlsortfiltermodel.h"
 #include "dialog/ui_dlgdevelopertoolsdlg.h"
 #include "preferences/usersettings.h"
+#include "util/audiocallbackprofiler.h"
 #include "util/statmodel.h"
 
 class DlgDeveloperTools : public QDialog, public Ui::DlgDeveloperTools {
@@ -23,14 +24,19 @@ class DlgDeveloperTools : public QDialog, public Ui::DlgDeveloperTools {
     void slotControlSearch(const QString& search);
     void slotLogSearch();
     void slotControlDump();
+    void slotAudioCallbacksDump();
 
   private:
+    void updateAudioCallbacks();
+
     UserSettingsPointer m_pConfig;
     ControlSortFilterModel m_controlProxyModel;
 
     StatModel m_statModel;
     QSortFilterProxyModel m_statProxyModel;
 
+    QVector<AudioCallbackProfile> m_audioCallbacks;
+
     QFile m_logFile;
     QTextCursor m_logCursor;
 };
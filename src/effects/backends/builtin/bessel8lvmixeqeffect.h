@@ -40,6 +40,11 @@ class Bessel8LVMixEQEffect : public EffectProcessorImpl<Bessel8LVMixEQEffectGrou
             const EffectEnableState enableState,
             const GroupFeatureState& groupFeatureState) override;
 
+    SINT getTailFrames(const mixxx::EngineParameters& engineParameters) const override {
+        // Covers the filter ringing and the delay compensation of the bands
+        return engineParameters.sampleRate() / 10;
+    }
+
   private:
     QString debugString() const {
         return getId();
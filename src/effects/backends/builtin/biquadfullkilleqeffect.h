@@ -74,6 +74,11 @@ class BiquadFullKillEQEffect : public EffectProcessorImpl<BiquadFullKillEQEffect
             const EffectEnableState enableState,
             const GroupFeatureState& groupFeatureState) override;
 
+    SINT getTailFrames(const mixxx::EngineParameters& engineParameters) const override {
+        // Covers the filter ringing and the delay compensation of the bands
+        return engineParameters.sampleRate() / 10;
+    }
+
     void setFilters(mixxx::audio::SampleRate sampleRate,
             double lowFreqCorner,
             double highFreqCorner);
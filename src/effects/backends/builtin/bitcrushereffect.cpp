@@ -18,6 +18,7 @@ EffectManifestPointer BitCrusherEffect::getManifest() {
     pManifest->setDescription(QObject::tr(
             "Adds noise by the reducing the bit depth and sample rate"));
     pManifest->setEffectRampsFromDry(true);
+    pManifest->setBlockProcessingSupported(true);
 
     EffectManifestParameterPointer depth = pManifest->addParameter();
     depth->setId("bit_depth");
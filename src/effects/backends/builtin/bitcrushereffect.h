@@ -40,6 +40,12 @@ class BitCrusherEffect : public EffectProcessorImpl<BitCrusherGroupState> {
             const EffectEnableState enableState,
             const GroupFeatureState& groupFeatureState) override;
 
+    SINT getTailFrames(const mixxx::EngineParameters& engineParameters) const override {
+        Q_UNUSED(engineParameters);
+        // Silent input is crushed to silence immediately
+        return 0;
+    }
+
   private:
     QString debugString() const {
         return getId();
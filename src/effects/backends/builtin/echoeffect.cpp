@@ -3,7 +3,6 @@
 #include <QtDebug>
 
 #include "util/math.h"
-#include "util/rampingvalue.h"
 #include "util/sample.h"
 
 constexpr int EchoGroupState::kMaxDelaySeconds;
@@ -31,6 +30,7 @@ EffectManifestPointer EchoEffect::getManifest() {
 
     pManifest->setAddDryToWet(true);
     pManifest->setEffectRampsFromDry(true);
+    pManifest->setBlockProcessingSupported(true);
 
     pManifest->setId(getId());
     pManifest->setName(QObject::tr("Echo"));
@@ -165,27 +165,28 @@ void EchoEffect::processChannel(
     int read_position = pGroupState->write_position;
     decrementRing(&read_position, delay_samples, pGroupState->delay_buf.size());
 
-    RampingValue<CSAMPLE_GAIN> send(send_current,
-            pGroupState->prev_send,
-            engineParameters.framesPerBuffer());
     // Feedback the delay buffer and then add the new input.
+    const CSAMPLE_GAIN* pSendRamped = m_sendRamp.process(
+            &pGroupState->prev_send, send_current, engineParameters);
+    const CSAMPLE_GAIN* pFeedbackRamped = m_feedbackRamp.process(
+            &pGroupState->prev_feedback, feedback_current, engineParameters);
 
-    RampingValue<CSAMPLE_GAIN> feedback(feedback_current,
-            pGroupState->prev_feedback,
-            engineParameters.framesPerBuffer());
+    // Both read positions advance in lockstep, so they either differ for the
+    // whole buffer or not at all.
+    const bool crossfadeDelay = read_position != prev_read_position;
 
     int rampIndex = 0;
     //TODO: rewrite to remove assumption of stereo buffer
     for (SINT i = 0;
             i < engineParameters.samplesPerBuffer();
             i += engineParameters.channelCount()) {
-        CSAMPLE_GAIN send_ramped = send.getNth(rampIndex);
-        CSAMPLE_GAIN feedback_ramped = feedback.getNth(rampIndex);
+        const CSAMPLE_GAIN send_ramped = pSendRamped[rampIndex];
+        const CSAMPLE_GAIN feedback_ramped = pFeedbackRamped[rampIndex];
         ++rampIndex;
 
         CSAMPLE bufferedSampleLeft = pGroupState->delay_buf[read_position];
         CSAMPLE bufferedSampleRight = pGroupState->delay_buf[read_position + 1];
-        if (read_position != prev_read_position) {
+        if (crossfadeDelay) {
             const CSAMPLE_GAIN frac = static_cast<CSAMPLE_GAIN>(i) /
                     engineParameters.samplesPerBuffer();
             bufferedSampleLeft *= frac;
@@ -245,10 +246,7 @@ void EchoEffect::processChannel(
         SampleUtil::applyRampingGain(pOutput, 1.0, 0.0, engineParameters.samplesPerBuffer());
         pGroupState->delay_buf.clear();
         pGroupState->prev_send = 0;
-    } else {
-        pGroupState->prev_send = send_current;
     }
 
-    pGroupState->prev_feedback = feedback_current;
     pGroupState->prev_delay_samples = delay_samples;
 }
@@ -64,6 +64,11 @@ class EchoEffect : public EffectProcessorImpl<EchoGroupState> {
             const EffectEnableState enableState,
             const GroupFeatureState& groupFeatures) override;
 
+    SINT getTailFrames(const mixxx::EngineParameters& engineParameters) const override {
+        // Echoes of earlier input may still be anywhere in the delay line
+        return EchoGroupState::kMaxDelaySeconds * engineParameters.sampleRate();
+    }
+
   private:
     QString debugString() const {
         return getId();
@@ -76,5 +81,8 @@ class EchoEffect : public EffectProcessorImpl<EchoGroupState> {
     EngineEffectParameterPointer m_pQuantizeParameter;
     EngineEffectParameterPointer m_pTripletParameter;
 
+    EffectParameterRamp m_sendRamp;
+    EffectParameterRamp m_feedbackRamp;
+
     DISALLOW_COPY_AND_ASSIGN(EchoEffect);
 };
@@ -44,6 +44,12 @@ class FilterEffect : public EffectProcessorImpl<FilterGroupState> {
             const EffectEnableState enableState,
             const GroupFeatureState& groupFeatures) override;
 
+    SINT getTailFrames(const mixxx::EngineParameters& engineParameters) const override {
+        // Long enough for a resonant filter at the lowest corner frequency
+        // to ring out
+        return engineParameters.sampleRate() / 10;
+    }
+
   private:
     QString debugString() const {
         return getId();
@@ -148,14 +148,12 @@ void FlangerEffect::processChannel(
     // the number of channels.
 
     const auto mix = static_cast<CSAMPLE_GAIN>(m_pMixParameter->value());
-    RampingValue<CSAMPLE_GAIN> mixRamped(
-            pState->prev_mix, mix, engineParameters.framesPerBuffer());
-    pState->prev_mix = mix;
+    const CSAMPLE_GAIN* pMixRamped = m_mixRamp.process(
+            &pState->prev_mix, mix, engineParameters);
 
     const auto regen = static_cast<CSAMPLE_GAIN>(m_pRegenParameter->value());
-    RampingValue<CSAMPLE_GAIN> regenRamped(
-            pState->prev_regen, regen, engineParameters.framesPerBuffer());
-    pState->prev_regen = regen;
+    const CSAMPLE_GAIN* pRegenRamped = m_regenRamp.process(
+            &pState->prev_regen, regen, engineParameters);
 
     // With and Manual is limited by amount of amplitude that remains from width
     // to kMaxDelayMs
@@ -165,13 +163,10 @@ void FlangerEffect::processChannel(
     double minManual = kCenterDelayMs - (kMaxLfoWidthMs - width) / 2;
     manual = math_clamp(manual, minManual, maxManual);
 
-    RampingValue<double> widthRamped(
-            pState->prev_width, width, engineParameters.framesPerBuffer());
-    pState->prev_width = static_cast<CSAMPLE_GAIN>(width);
-
-    RampingValue<double> manualRamped(
-            pState->prev_manual, manual, engineParameters.framesPerBuffer());
-    pState->prev_manual = static_cast<CSAMPLE_GAIN>(manual);
+    const CSAMPLE_GAIN* pWidthRamped = m_widthRamp.process(
+            &pState->prev_width, static_cast<CSAMPLE_GAIN>(width), engineParameters);
+    const CSAMPLE_GAIN* pManualRamped = m_manualRamp.process(
+            &pState->prev_manual, static_cast<CSAMPLE_GAIN>(manual), engineParameters);
 
     CSAMPLE* delayLeft = pState->delayLeft;
     CSAMPLE* delayRight = pState->delayRight;
@@ -180,10 +175,10 @@ void FlangerEffect::processChannel(
     for (SINT i = 0;
             i < engineParameters.samplesPerBuffer();
             i += engineParameters.channelCount()) {
-        CSAMPLE_GAIN mix_ramped = mixRamped.getNth(rampIndex);
-        CSAMPLE_GAIN regen_ramped = regenRamped.getNth(rampIndex);
-        double width_ramped = widthRamped.getNth(rampIndex);
-        double manual_ramped = manualRamped.getNth(rampIndex);
+        const CSAMPLE_GAIN mix_ramped = pMixRamped[rampIndex];
+        const CSAMPLE_GAIN regen_ramped = pRegenRamped[rampIndex];
+        const double width_ramped = pWidthRamped[rampIndex];
+        const double manual_ramped = pManualRamped[rampIndex];
         ++rampIndex;
 
         pState->lfoFrames++;
@@ -77,5 +77,10 @@ class FlangerEffect : public EffectProcessorImpl<FlangerGroupState> {
     EngineEffectParameterPointer m_pMixParameter;
     EngineEffectParameterPointer m_pTripletParameter;
 
+    EffectParameterRamp m_mixRamp;
+    EffectParameterRamp m_regenRamp;
+    EffectParameterRamp m_widthRamp;
+    EffectParameterRamp m_manualRamp;
+
     DISALLOW_COPY_AND_ASSIGN(FlangerEffect);
 };
@@ -20,6 +20,7 @@ EffectManifestPointer GraphicEQEffect::getManifest() {
     pManifest->setDescription(QObject::tr(
             "An 8-band graphic equalizer based on biquad filters"));
     pManifest->setEffectRampsFromDry(true);
+    pManifest->setBlockProcessingSupported(true);
     pManifest->setIsMasterEQ(true);
 
     // Display rounded center frequencies for each filter
@@ -48,6 +48,11 @@ class GraphicEQEffect : public EffectProcessorImpl<GraphicEQEffectGroupState> {
             const EffectEnableState enableState,
             const GroupFeatureState& groupFeatureState) override;
 
+    SINT getTailFrames(const mixxx::EngineParameters& engineParameters) const override {
+        // Long enough for the narrow low bands to ring out
+        return engineParameters.sampleRate() / 10;
+    }
+
   private:
     QString debugString() const {
         return getId();
@@ -26,6 +26,7 @@ EffectManifestPointer LinkwitzRiley8EQEffect::getManifest() {
                         "dB/octave).") +
             " " + EqualizerUtil::adjustFrequencyShelvesTip());
     pManifest->setIsMixingEQ(true);
+    pManifest->setBlockProcessingSupported(true);
 
     EqualizerUtil::createCommonParameters(pManifest.data(), false);
     return pManifest;
@@ -116,13 +117,13 @@ void LinkwitzRiley8EQEffect::processChannel(
         pState->setFilters(engineParameters.sampleRate(), pState->m_loFreq, pState->m_hiFreq);
     }
 
-    pState->m_high2->process(pInput,
+    // HighPass first run and LowPass first run for low and bandpass
+    pState->m_high2->processPair(pInput,
             pState->m_pHighBuf,
-            engineParameters.samplesPerBuffer()); // HighPass first run
-    pState->m_low2->process(pInput,
+            pState->m_low2,
+            pInput,
             pState->m_pLowBuf,
-            engineParameters
-                    .samplesPerBuffer()); // LowPass first run for low and bandpass
+            engineParameters.samplesPerBuffer());
 
     if (fMid != pState->old_mid || fHigh != pState->old_high) {
         SampleUtil::applyRampingGain(pState->m_pHighBuf,
@@ -142,29 +143,24 @@ void LinkwitzRiley8EQEffect::processChannel(
                 engineParameters.samplesPerBuffer());
     }
 
-    pState->m_high1->process(pState->m_pHighBuf,
+    // HighPass + BandPass second run and LowPass second run
+    pState->m_high1->processPair(pState->m_pHighBuf,
             pState->m_pMidBuf,
-            engineParameters
-                    .samplesPerBuffer()); // HighPass + BandPass second run
-    pState->m_low1->process(pState->m_pLowBuf,
+            pState->m_low1,
             pState->m_pLowBuf,
-            engineParameters.samplesPerBuffer()); // LowPass second run
+            pState->m_pLowBuf,
+            engineParameters.samplesPerBuffer());
 
     if (fLow != pState->old_low) {
-        SampleUtil::copy2WithRampingGain(pOutput,
-                pState->m_pLowBuf,
-                static_cast<CSAMPLE_GAIN>(pState->old_low),
-                fLow,
-                pState->m_pMidBuf,
-                1,
-                1,
+        SampleUtil::copyWithGains<SampleUtil::RampingGain>(pOutput,
+                {pState->m_pLowBuf, pState->m_pMidBuf},
+                {{static_cast<CSAMPLE_GAIN>(pState->old_low), fLow},
+                        {CSAMPLE_GAIN_ONE, CSAMPLE_GAIN_ONE}},
                 engineParameters.samplesPerBuffer());
     } else {
-        SampleUtil::copy2WithGain(pOutput,
-                pState->m_pLowBuf,
-                fLow,
-                pState->m_pMidBuf,
-                1,
+        SampleUtil::copyWithGains<SampleUtil::ConstantGain>(pOutput,
+                {pState->m_pLowBuf, pState->m_pMidBuf},
+                {{fLow}, {CSAMPLE_GAIN_ONE}},
                 engineParameters.samplesPerBuffer());
     }
 
@@ -56,6 +56,11 @@ class LinkwitzRiley8EQEffect : public EffectProcessorImpl<LinkwitzRiley8EQEffect
             const EffectEnableState enableState,
             const GroupFeatureState& groupFeatureState) override;
 
+    SINT getTailFrames(const mixxx::EngineParameters& engineParameters) const override {
+        // The crossover filters ring out within a few milliseconds
+        return engineParameters.sampleRate() / 10;
+    }
+
   private:
     QString debugString() const {
         return getId();
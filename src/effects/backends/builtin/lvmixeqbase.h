@@ -103,12 +103,17 @@ class LVMixEQEffectGroupState : public EffectState {
             m_delay3->process(pInput, m_pHighBuf, numSamples);
         }
 
-        if (fMid != 0 || m_oldMid != 0) {
+        const bool processMid = fMid != 0 || m_oldMid != 0;
+        const bool processLow = fLow != 0 || m_oldLow != 0;
+        if (processMid) {
             m_delay2->process(pInput, m_pBandBuf, numSamples);
-            m_low2->process(m_pBandBuf, m_pBandBuf, numSamples);
         }
-
-        if (fLow != 0 || m_oldLow != 0) {
+        if (processMid && processLow) {
+            // Both low passes in one pass
+            m_low2->processPair(m_pBandBuf, m_pBandBuf, m_low1, pInput, m_pLowBuf, numSamples);
+        } else if (processMid) {
+            m_low2->process(m_pBandBuf, m_pBandBuf, numSamples);
+        } else if (processLow) {
             m_low1->process(pInput, m_pLowBuf, numSamples);
         }
 
@@ -121,13 +126,9 @@ class LVMixEQEffectGroupState : public EffectState {
         if (fLow == m_oldLow &&
                 fMid == m_oldMid &&
                 fHigh == m_oldHigh) {
-            SampleUtil::copy3WithGain(pOutput,
-                    m_pLowBuf,
-                    fLow,
-                    m_pBandBuf,
-                    fMid,
-                    m_pHighBuf,
-                    fHigh,
+            SampleUtil::copyWithGains<SampleUtil::ConstantGain>(pOutput,
+                    {m_pLowBuf, m_pBandBuf, m_pHighBuf},
+                    {{fLow}, {fMid}, {fHigh}},
                     numSamples);
         } else {
             SINT copySamples = 0;
@@ -155,27 +156,19 @@ class LVMixEQEffectGroupState : public EffectState {
                 m_rampHoldOff -= copySamples;
                 rampingSamples = numSamples - copySamples;
 
-                SampleUtil::copy3WithGain(pOutput,
-                        m_pLowBuf,
-                        m_oldLow,
-                        m_pBandBuf,
-                        m_oldMid,
-                        m_pHighBuf,
-                        m_oldHigh,
+                SampleUtil::copyWithGains<SampleUtil::ConstantGain>(pOutput,
+                        {m_pLowBuf, m_pBandBuf, m_pHighBuf},
+                        {{m_oldLow}, {m_oldMid}, {m_oldHigh}},
                         copySamples);
             }
 
             if (rampingSamples) {
-                SampleUtil::copy3WithRampingGain(&pOutput[copySamples],
-                        &m_pLowBuf[copySamples],
-                        m_oldLow,
-                        fLow,
-                        &m_pBandBuf[copySamples],
-                        m_oldMid,
-                        fMid,
-                        &m_pHighBuf[copySamples],
-                        m_oldHigh,
-                        fHigh,
+                SampleUtil::copyWithGains<SampleUtil::RampingGain>(
+                        &pOutput[copySamples],
+                        {&m_pLowBuf[copySamples],
+                                &m_pBandBuf[copySamples],
+                                &m_pHighBuf[copySamples]},
+                        {{m_oldLow, fLow}, {m_oldMid, fMid}, {m_oldHigh, fHigh}},
                         rampingSamples);
 
                 m_oldLow = fLow;
@@ -205,16 +198,11 @@ class LVMixEQEffectGroupState : public EffectState {
             m_low1->processAndPauseFilter(pInput, m_pLowBuf, numSamples);
         }
 
-        SampleUtil::copy3WithRampingGain(pOutput,
-                m_pLowBuf,
-                m_oldLow,
-                0.0,
-                m_pBandBuf,
-                m_oldMid,
-                0.0,
-                m_pHighBuf,
-                m_oldHigh,
-                1.0,
+        SampleUtil::copyWithGains<SampleUtil::RampingGain>(pOutput,
+                {m_pLowBuf, m_pBandBuf, m_pHighBuf},
+                {{m_oldLow, CSAMPLE_GAIN_ZERO},
+                        {m_oldMid, CSAMPLE_GAIN_ZERO},
+                        {m_oldHigh, CSAMPLE_GAIN_ONE}},
                 numSamples);
     }
 
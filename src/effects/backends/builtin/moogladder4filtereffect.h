@@ -43,6 +43,11 @@ class MoogLadder4FilterEffect : public EffectProcessorImpl<MoogLadder4FilterGrou
             const EffectEnableState enableState,
             const GroupFeatureState& groupFeatures) override;
 
+    SINT getTailFrames(const mixxx::EngineParameters& engineParameters) const override {
+        // Long enough for the self-oscillation at high resonance to decay
+        return engineParameters.sampleRate() / 10;
+    }
+
   private:
     QString debugString() const {
         return getId();
@@ -58,6 +58,11 @@ class ParametricEQEffect : public EffectProcessorImpl<ParametricEQEffectGroupSta
             const EffectEnableState enableState,
             const GroupFeatureState& groupFeatureState) override;
 
+    SINT getTailFrames(const mixxx::EngineParameters& engineParameters) const override {
+        // Long enough for a narrow peak filter to ring out
+        return engineParameters.sampleRate() / 10;
+    }
+
   private:
     QString debugString() const {
         return getId();
@@ -166,16 +166,14 @@ void PhaserEffect::processChannel(
 
     CSAMPLE left = 0, right = 0;
 
-    CSAMPLE_GAIN oldDepth = pState->oldDepth;
-    const CSAMPLE_GAIN depthDelta = (depth - oldDepth) / engineParameters.framesPerBuffer();
-    const CSAMPLE_GAIN depthStart = oldDepth + depthDelta;
+    const CSAMPLE_GAIN* pDepthRamped = m_depthRamp.process(
+            &pState->oldDepth, depth, engineParameters);
 
     const auto stereoCheck = static_cast<int>(m_pStereoParameter->value());
-    int counter = 0;
 
-    for (SINT i = 0;
+    for (SINT i = 0, frame = 0;
             i < engineParameters.samplesPerBuffer();
-            i += engineParameters.channelCount()) {
+            i += engineParameters.channelCount(), ++frame) {
         left = pInput[i] + std::tanh(left * feedback);
         right = pInput[i + 1] + std::tanh(right * feedback);
 
@@ -187,7 +185,7 @@ void PhaserEffect::processChannel(
 
         // Updating filter coefficients once every 'updateCoef' samples to avoid
         // extra computing
-        if ((counter++) % updateCoef == 0) {
+        if (frame % updateCoef == 0) {
             const auto delayLeft = static_cast<CSAMPLE>(0.5 + 0.5 * sin(pState->leftPhase));
             const auto delayRight = static_cast<CSAMPLE>(0.5 + 0.5 * sin(pState->rightPhase));
 
@@ -206,12 +204,11 @@ void PhaserEffect::processChannel(
         left = processSample(left, oldInLeft, oldOutLeft, filterCoefLeft, stages);
         right = processSample(right, oldInRight, oldOutRight, filterCoefRight, stages);
 
-        const CSAMPLE_GAIN depth = depthStart + depthDelta * (i / engineParameters.channelCount());
+        const CSAMPLE_GAIN depthRamped = pDepthRamped[frame];
 
         // Computing output combining the original and processed sample
-        pOutput[i] = pInput[i] * (1.0f - 0.5f * depth) + left * depth * 0.5f;
-        pOutput[i + 1] = pInput[i + 1] * (1.0f - 0.5f * depth) + right * depth * 0.5f;
+        pOutput[i] = pInput[i] * (1.0f - 0.5f * depthRamped) + left * depthRamped * 0.5f;
+        pOutput[i + 1] = pInput[i + 1] * (1.0f - 0.5f * depthRamped) +
+                right * depthRamped * 0.5f;
     }
-
-    pState->oldDepth = depth;
 }
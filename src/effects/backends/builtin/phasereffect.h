@@ -68,6 +68,8 @@ class PhaserEffect : public EffectProcessorImpl<PhaserGroupState> {
     EngineEffectParameterPointer m_pTripletParameter;
     EngineEffectParameterPointer m_pStereoParameter;
 
+    EffectParameterRamp m_depthRamp;
+
     //Passing the sample through a series of allpass filters
     inline CSAMPLE processSample(CSAMPLE input,
             CSAMPLE* oldIn,
@@ -14,6 +14,7 @@ EffectManifestPointer ReverbEffect::getManifest() {
     EffectManifestPointer pManifest(new EffectManifest());
     pManifest->setAddDryToWet(true);
     pManifest->setEffectRampsFromDry(true);
+    pManifest->setBlockProcessingSupported(true);
 
     pManifest->setId(getId());
     pManifest->setName(QObject::tr("Reverb"));
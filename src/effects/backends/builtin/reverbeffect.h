@@ -52,6 +52,11 @@ class ReverbEffect : public EffectProcessorImpl<ReverbGroupState> {
             const EffectEnableState enableState,
             const GroupFeatureState& groupFeatures) override;
 
+    SINT getTailFrames(const mixxx::EngineParameters& engineParameters) const override {
+        // The plate keeps reverberating long after the input became silent
+        return engineParameters.sampleRate();
+    }
+
   private:
     QString debugString() const {
         return getId();
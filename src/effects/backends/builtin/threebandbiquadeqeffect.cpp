@@ -61,6 +61,7 @@ EffectManifestPointer ThreeBandBiquadEQEffect::getManifest() {
                         "shelving high pass and kill switches.") +
             " " + EqualizerUtil::adjustFrequencyShelvesTip());
     pManifest->setEffectRampsFromDry(true);
+    pManifest->setBlockProcessingSupported(true);
     pManifest->setIsMixingEQ(true);
 
     EqualizerUtil::createCommonParameters(pManifest.data(), true);
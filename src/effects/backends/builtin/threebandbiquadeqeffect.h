@@ -59,6 +59,11 @@ class ThreeBandBiquadEQEffect : public EffectProcessorImpl<ThreeBandBiquadEQEffe
             const EffectEnableState enableState,
             const GroupFeatureState& groupFeatureState) override;
 
+    SINT getTailFrames(const mixxx::EngineParameters& engineParameters) const override {
+        // The biquads ring out within a few milliseconds
+        return engineParameters.sampleRate() / 10;
+    }
+
     void setFilters(int sampleRate, double lowFreqCorner, double highFreqCorner);
 
   private:
@@ -1,7 +1,5 @@
 #include "effects/backends/builtin/whitenoiseeffect.h"
 
-#include "util/rampingvalue.h"
-
 namespace {
 const QString dryWetParameterId = QStringLiteral("dry_wet");
 } // anonymous namespace
@@ -51,23 +49,23 @@ void WhiteNoiseEffect::processChannel(
     WhiteNoiseGroupState& gs = *pState;
 
     CSAMPLE drywet = static_cast<CSAMPLE>(m_pDryWetParameter->value());
-    RampingValue<CSAMPLE_GAIN> drywet_ramping_value(
-            drywet, gs.previous_drywet, engineParameters.framesPerBuffer());
+    const CSAMPLE_GAIN* pDryWetRamped = m_dryWetRamp.process(
+            &gs.previous_drywet, drywet, engineParameters);
 
     std::uniform_real_distribution<> r_distributor(0.0, 1.0);
 
-    for (SINT i = 0; i < engineParameters.samplesPerBuffer(); i++) {
-        CSAMPLE_GAIN drywet_ramped = drywet_ramping_value.getNth(i);
-
-        float noise = static_cast<float>(
-                r_distributor(gs.gen));
+    SINT i = 0;
+    for (SINT frame = 0; frame < engineParameters.framesPerBuffer(); ++frame) {
+        const CSAMPLE_GAIN drywet_ramped = pDryWetRamped[frame];
+        for (int channel = 0; channel < engineParameters.channelCount(); ++channel, ++i) {
+            float noise = static_cast<float>(
+                    r_distributor(gs.gen));
 
-        pOutput[i] = pInput[i] * (1 - drywet_ramped) + noise * drywet_ramped;
+            pOutput[i] = pInput[i] * (1 - drywet_ramped) + noise * drywet_ramped;
+        }
     }
 
     if (enableState == EffectEnableState::Disabling) {
         gs.previous_drywet = 0;
-    } else {
-        gs.previous_drywet = drywet;
     }
 }
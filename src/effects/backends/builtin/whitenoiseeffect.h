@@ -47,6 +47,7 @@ class WhiteNoiseEffect : public EffectProcessorImpl<WhiteNoiseGroupState> {
 
   private:
     EngineEffectParameterPointer m_pDryWetParameter;
+    EffectParameterRamp m_dryWetRamp;
 
     DISALLOW_COPY_AND_ASSIGN(WhiteNoiseEffect);
 };
@@ -30,6 +30,7 @@ class EffectManifest {
               m_isMasterEQ(false),
               m_effectRampsFromDry(false),
               m_bAddDryToWet(false),
+              m_bBlockProcessingSupported(false),
               m_metaknobDefault(0.0) {
     }
 
@@ -148,6 +149,20 @@ class EffectManifest {
         m_bAddDryToWet = addDryToWet;
     }
 
+    /// The effect produces the same output if a buffer is split into
+    /// consecutive smaller buffers while its parameters and the beat length
+    /// don't change, which allows EngineEffectChain to process it in
+    /// cache-sized blocks. Changes are ramped across the buffer given to the
+    /// effect, so EngineEffectChain processes buffers with changes as a
+    /// whole. Effects that evaluate other parts of the GroupFeatureState once
+    /// per buffer, e.g. to sync to the beat, must not opt in.
+    bool blockProcessingSupported() const {
+        return m_bBlockProcessingSupported;
+    }
+    void setBlockProcessingSupported(bool blockProcessingSupported) {
+        m_bBlockProcessingSupported = blockProcessingSupported;
+    }
+
     double metaknobDefault() const {
         return m_metaknobDefault;
     }
@@ -187,5 +202,6 @@ class EffectManifest {
     QList<EffectManifestParameterPointer> m_parameters;
     bool m_effectRampsFromDry;
     bool m_bAddDryToWet;
+    bool m_bBlockProcessingSupported;
     double m_metaknobDefault;
 };
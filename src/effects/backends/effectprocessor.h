@@ -10,7 +10,9 @@
 #include "engine/effects/groupfeaturestate.h"
 #include "engine/effects/message.h"
 #include "engine/engine.h"
+#include "util/defs.h"
 #include "util/sample.h"
+#include "util/samplebuffer.h"
 #include "util/types.h"
 #include "util/unique_ptr_vector.h"
 
@@ -53,11 +55,21 @@
 /// relatively small compared to the additional code complexity.)
 class EffectState {
   public:
-    EffectState(const mixxx::EngineParameters& engineParameters) {
+    EffectState(const mixxx::EngineParameters& engineParameters)
+            : m_silentFrames(0),
+              m_idle(false) {
         // Subclasses should call engineParametersChanged here.
         Q_UNUSED(engineParameters);
     };
     virtual ~EffectState(){};
+
+  private:
+    template<typename EffectSpecificState>
+    friend class EffectProcessorImpl;
+
+    // Maintained by EffectProcessorImpl, see EffectProcessorImpl::getTailFrames()
+    SINT m_silentFrames;
+    bool m_idle;
 };
 
 /// EffectProcessor is an abstract base class for interfacing with an EffectSlot
@@ -110,6 +122,74 @@ class EffectProcessor {
     /// the dry signal is delayed to overlap with the output wet signal
     /// after processing all effects in the effects chain.
     virtual SINT getGroupDelayFrames() = 0;
+
+    /// Called from the audio thread after process(). Returns true if the
+    /// internal state of the effect for the given channels has decayed to
+    /// silence, so it will produce silence as long as the input is silent.
+    /// EngineEffect skips processing silent input in that case.
+    virtual bool isIdle(const ChannelHandle& inputHandle,
+            const ChannelHandle& outputHandle) const = 0;
+};
+
+/// EffectParameterRamp smoothes the changes of an effect parameter between
+/// buffers to avoid zipper noise. It writes the value of the parameter for
+/// each frame of the buffer into an array, ramping linearly from its value in
+/// the previous buffer to the current value, which is reached at the last
+/// frame. The inner loops of the effects read the ramped values from the
+/// array without any branches, so they can be vectorized.
+///
+/// The array is allocated in the main thread and shared by all EffectStates
+/// of an EffectProcessorImpl subclass, which holds one EffectParameterRamp per
+/// smoothed parameter. The value of the previous buffer is kept in the
+/// EffectState, so every channel is smoothed independently.
+class EffectParameterRamp {
+  public:
+    EffectParameterRamp()
+            : m_ramp(MAX_BUFFER_LEN / mixxx::kEngineChannelCount),
+              m_constantValue(CSAMPLE_GAIN_ZERO),
+              m_constantFrames(0) {
+    }
+
+    /// Fills the array with the ramp from *pPrevious to value for the frames
+    /// of the buffer and returns it. *pPrevious is updated to value for
+    /// the next buffer. The returned array is never null, even if the buffer
+    /// exceeds the capacity of the array, because the effects read it
+    /// unconditionally.
+    const CSAMPLE_GAIN* process(CSAMPLE_GAIN* pPrevious,
+            CSAMPLE_GAIN value,
+            const mixxx::EngineParameters& engineParameters) {
+        SINT numFrames = engineParameters.framesPerBuffer();
+        VERIFY_OR_DEBUG_ASSERT(numFrames <= m_ramp.size()) {
+            numFrames = m_ramp.size();
+        }
+        CSAMPLE_GAIN* pRamp = m_ramp.data();
+        const CSAMPLE_GAIN previous = *pPrevious;
+        *pPrevious = value;
+        if (previous == value || numFrames <= 0) {
+            // Most of the time the parameter is not touched, so a constant
+            // array is only written once
+            if (m_constantFrames < numFrames || m_constantValue != value) {
+                SampleUtil::fill(pRamp, value, numFrames);
+                m_constantValue = value;
+                m_constantFrames = numFrames;
+            }
+            return pRamp;
+        }
+        const CSAMPLE_GAIN delta = (value - previous) / numFrames;
+        // note: LOOP VECTORIZED.
+        for (SINT i = 0; i < numFrames; ++i) {
+            pRamp[i] = previous + delta * (i + 1);
+        }
+        // Avoid rounding errors at the last frame
+        pRamp[numFrames - 1] = value;
+        m_constantFrames = 0;
+        return pRamp;
+    }
+
+  private:
+    mixxx::SampleBuffer m_ramp;
+    CSAMPLE_GAIN m_constantValue;
+    SINT m_constantFrames;
 };
 
 /// EffectProcessorImpl manages a separate EffectState for every combination of
@@ -148,6 +228,29 @@ class EffectProcessorImpl : public EffectProcessor {
         return 0;
     }
 
+    /// Effects that produce silence from silent input can override this to
+    /// return for how long their output may still be audible after the input
+    /// became silent, e.g. while a filter rings out. After the input and the
+    /// output have been silent for that long the effect is idle, see
+    /// EffectProcessor::isIdle(). By default the effect is never idle.
+    virtual SINT getTailFrames(const mixxx::EngineParameters& engineParameters) const {
+        Q_UNUSED(engineParameters);
+        return -1;
+    }
+
+    bool isIdle(const ChannelHandle& inputHandle,
+            const ChannelHandle& outputHandle) const final {
+        if (inputHandle.handle() >= m_channelStateMatrix.size()) {
+            return false;
+        }
+        const auto& outputChannelStates = m_channelStateMatrix.at(inputHandle);
+        if (outputHandle.handle() >= static_cast<int>(outputChannelStates.size())) {
+            return false;
+        }
+        const EffectSpecificState* pState = outputChannelStates[outputHandle.handle()].get();
+        return pState != nullptr && pState->m_idle;
+    }
+
     void process(const ChannelHandle& inputHandle,
             const ChannelHandle& outputHandle,
             const CSAMPLE* pInput,
@@ -167,8 +270,10 @@ class EffectProcessorImpl : public EffectProcessor {
                               "main thread.";
             }
             SampleUtil::copy(pOutput, pInput, engineParameters.samplesPerBuffer());
+            return;
         }
         processChannel(pState, pInput, pOutput, engineParameters, enableState, groupFeatures);
+        updateIdle(pState, pInput, pOutput, engineParameters);
     }
 
     void initialize(const QSet<ChannelHandleAndGroup>& activeInputChannels,
@@ -246,6 +351,26 @@ class EffectProcessorImpl : public EffectProcessor {
     };
 
   private:
+    void updateIdle(EffectSpecificState* pState,
+            const CSAMPLE* pInput,
+            const CSAMPLE* pOutput,
+            const mixxx::EngineParameters& engineParameters) const {
+        const SINT tailFrames = getTailFrames(engineParameters);
+        if (tailFrames < 0) {
+            return;
+        }
+        // The output is only checked while the input is silent
+        if (SampleUtil::isSilent(pInput, engineParameters.samplesPerBuffer()) &&
+                SampleUtil::isSilent(pOutput, engineParameters.samplesPerBuffer())) {
+            if (pState->m_silentFrames <= tailFrames) {
+                pState->m_silentFrames += engineParameters.framesPerBuffer();
+            }
+        } else {
+            pState->m_silentFrames = 0;
+        }
+        pState->m_idle = pState->m_silentFrames > tailFrames;
+    }
+
     QSet<ChannelHandleAndGroup> m_registeredOutputChannels;
     ChannelHandleMap<unique_ptr_vector<EffectSpecificState>> m_channelStateMatrix;
 };
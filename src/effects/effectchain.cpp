@@ -168,7 +168,8 @@ void EffectChain::addToEngine() {
     m_pEngineEffectChain = new EngineEffectChain(
             m_group,
             m_pEffectsManager->registeredInputChannels(),
-            m_pEffectsManager->registeredOutputChannels());
+            m_pEffectsManager->registeredOutputChannels(),
+            m_pEffectsManager->effectChainBlockFrames());
     EffectsRequest* pRequest = new EffectsRequest();
     pRequest->type = EffectsRequest::ADD_EFFECT_CHAIN;
     pRequest->AddEffectChain.signalProcessingStage = m_signalProcessingStage;
@@ -15,6 +15,7 @@
 #include "effects/visibleeffectslist.h"
 #include "engine/effects/engineeffectsmanager.h"
 #include "util/assert.h"
+#include "util/math.h"
 
 namespace {
 const unsigned int kEffectMessagePipeFifoSize = 2048;
@@ -167,6 +168,12 @@ bool EffectsManager::isAdoptMetaknobSettingEnabled() const {
     return m_pConfig->getValue(ConfigKey("[Effects]", "AdoptMetaknobValue"), true);
 }
 
+SINT EffectsManager::effectChainBlockFrames() const {
+    return math_max(m_pConfig->getValue(
+                            ConfigKey("[Effects]", "ChainProcessingBlockFrames"), 0),
+            0);
+}
+
 void EffectsManager::readEffectsXml() {
     QDir settingsPath(m_pConfig->getSettingsPath());
     QFile file(settingsPath.absoluteFilePath(kEffectsXmlFile));
@@ -10,6 +10,7 @@
 #include "engine/channelhandle.h"
 #include "preferences/usersettings.h"
 #include "util/class.h"
+#include "util/types.h"
 
 class EngineEffectsManager;
 
@@ -70,6 +71,9 @@ class EffectsManager {
     }
 
     bool isAdoptMetaknobSettingEnabled() const;
+    /// The block size in which EngineEffectChains process their buffers,
+    /// 0 if the whole buffer is processed at once.
+    SINT effectChainBlockFrames() const;
 
   private:
     void addStandardEffectChains();
@@ -2,6 +2,9 @@
 
 #include <QFileInfo>
 #include <QtDebug>
+#include <algorithm>
+#include <cstdlib>
+#include <iterator>
 
 #include "control/controlobject.h"
 #include "moc_cachingreader.cpp"
@@ -37,13 +40,122 @@ constexpr SINT kDefaultHintFrames = 1024;
 // (kNumberOfCachedChunksInMemory = 1, 2, 3, ...) for testing purposes
 // to verify that the MRU/LRU cache works as expected. Even though
 // massive drop outs are expected to occur Mixxx should run reliably!
+//
+// The number can be overridden with [Master],cached_chunks_per_deck.
+// Adaptive growth is enabled by setting [Master],cached_chunks_per_deck_max
+// to a larger number.
 constexpr SINT kNumberOfCachedChunksInMemory = 80;
 
+// The number of chunk lookups after which the eviction rate is checked.
+constexpr int kChunkPoolWindowLookups = 2048;
+
+// The pool grows if more than 1 of kChunkPoolMaxEvictionRatio lookups
+// had to evict another chunk. Playing through a track evicts about one
+// chunk every few hundred lookups.
+constexpr int kChunkPoolMaxEvictionRatio = 32;
+
+// The number of chunks added at once when growing the pool, ~1.4 s of audio
+constexpr SINT kChunkPoolGrowthChunks = 8;
+
+SINT initialChunkCount(const UserSettingsPointer& pConfig) {
+    if (!pConfig) {
+        return kNumberOfCachedChunksInMemory;
+    }
+    const int count = pConfig->getValue(
+            ConfigKey("[Master]", "cached_chunks_per_deck"),
+            static_cast<int>(kNumberOfCachedChunksInMemory));
+    // The capacity of the read request FIFO is a quarter of this number
+    return math_max(static_cast<SINT>(count), SINT(4));
+}
+
+SINT maxChunkCount(const UserSettingsPointer& pConfig) {
+    const SINT initialCount = initialChunkCount(pConfig);
+    if (!pConfig) {
+        return initialCount;
+    }
+    const int count = pConfig->getValue(
+            ConfigKey("[Master]", "cached_chunks_per_deck_max"),
+            static_cast<int>(initialCount));
+    return math_max(static_cast<SINT>(count), initialCount);
+}
+
+// Pending read requests for chunks that have not been hinted by this
+// number of consecutive calls of hintAndMaybeWake() are cancelled. Two
+// calls tolerate the play position moving back and forth across a chunk
+// boundary.
+constexpr unsigned int kSupersededAfterHintCalls = 2;
+
+const QString kChunkLookupsTag = QStringLiteral("CachingReader: chunk lookups");
+const QString kChunkEvictionsTag = QStringLiteral("CachingReader: chunk evictions");
+const QString kChunkPoolSizeTag = QStringLiteral("CachingReader: chunk pool size");
+const QString kReadRequestsCoalescedTag =
+        QStringLiteral("CachingReader: read requests coalesced");
+const QString kReadRequestsSubmittedTag =
+        QStringLiteral("CachingReader: read requests submitted");
+const QString kReadRequestsServedTag =
+        QStringLiteral("CachingReader: read requests served");
+const QString kReadRequestsDeferredTag =
+        QStringLiteral("CachingReader: read requests deferred");
+const QString kReadRequestsSupersededTag =
+        QStringLiteral("CachingReader: read requests superseded");
+
+// The Hint::Type enum is ordered by priority, see the comments there
+int hintTypePriority(Hint::Type type) {
+    switch (type) {
+    case Hint::Type::SlipPosition:
+    case Hint::Type::CurrentPosition:
+        return 0;
+    case Hint::Type::LoopStartEnabled:
+        return 1;
+    default:
+        return 2;
+    }
+}
+
+const QString kDiskCacheDirectory = QStringLiteral("/decoded_cache");
+
+// The maximum memory of all fully preloaded tracks. Decoded audio at
+// 44.1 kHz takes about 20 MB per minute.
+constexpr int kPreloadBudgetMBDefault = 256;
+
+qint64 preloadBudgetBytes(const UserSettingsPointer& pConfig) {
+    int budgetMB = kPreloadBudgetMBDefault;
+    if (pConfig) {
+        budgetMB = pConfig->getValue(
+                ConfigKey("[Master]", "preload_budget_mb"),
+                kPreloadBudgetMBDefault);
+    }
+    return static_cast<qint64>(math_max(budgetMB, 0)) * 1024 * 1024;
+}
+
+// The decoded tracks cached on disk use about 10 MB per minute of audio
+// at 44.1 kHz. The cache is disabled by default.
+constexpr int kDiskCacheSizeMBDefault = 0;
+
+QString diskCacheDirectory(const UserSettingsPointer& pConfig) {
+    if (!pConfig) {
+        return QString();
+    }
+    return pConfig->getSettingsPath() + kDiskCacheDirectory;
+}
+
+qint64 diskCacheMaxSizeBytes(const UserSettingsPointer& pConfig) {
+    if (!pConfig) {
+        return 0;
+    }
+    const int sizeMB = pConfig->getValue(
+            ConfigKey("[Master]", "decoded_cache_size_mb"),
+            kDiskCacheSizeMBDefault);
+    return static_cast<qint64>(math_max(sizeMB, 0)) * 1024 * 1024;
+}
+
 } // anonymous namespace
 
 CachingReader::CachingReader(const QString& group,
         UserSettingsPointer config)
         : m_pConfig(config),
+          m_initialChunkCount(initialChunkCount(config)),
+          m_maxChunkCount(maxChunkCount(config)),
           // Limit the number of in-flight requests to the worker. This should
           // prevent to overload the worker when it is not able to fetch those
           // requests from the FIFO timely. Otherwise outdated requests pile up
@@ -53,21 +165,33 @@ CachingReader::CachingReader(const QString& group,
           // buffer, where new requests replace old requests when full. Those
           // old requests need to be returned immediately to the CachingReader
           // that must take ownership and free them!!!
-          m_chunkReadRequestFIFO(kNumberOfCachedChunksInMemory / 4),
+          m_chunkReadRequestFIFO(m_initialChunkCount / 4),
           // The capacity of the back channel must be equal to the number of
           // allocated chunks, because the worker use writeBlocking(). Otherwise
           // the worker could get stuck in a hot loop!!!
-          m_readerStatusUpdateFIFO(kNumberOfCachedChunksInMemory),
+          m_readerStatusUpdateFIFO(m_maxChunkCount),
           m_state(STATE_IDLE),
+          m_chunkLookups(0),
+          m_chunkEvictions(0),
+          m_hintCalls(0),
           m_mruCachingReaderChunk(nullptr),
           m_lruCachingReaderChunk(nullptr),
-          m_sampleBuffer(CachingReaderChunk::kSamples * kNumberOfCachedChunksInMemory),
-          m_worker(group, &m_chunkReadRequestFIFO, &m_readerStatusUpdateFIFO) {
-    m_allocatedCachingReaderChunks.reserve(kNumberOfCachedChunksInMemory);
+          // The pages of the reserve are not touched before the pool grows
+          m_sampleBuffer(CachingReaderChunk::kSamples * m_maxChunkCount),
+          m_pPreloadedSamples(nullptr),
+          m_worker(group,
+                  &m_chunkReadRequestFIFO,
+                  &m_readerStatusUpdateFIFO,
+                  diskCacheDirectory(config),
+                  diskCacheMaxSizeBytes(config),
+                  preloadBudgetBytes(config)) {
+    m_allocatedCachingReaderChunks.reserve(m_maxChunkCount);
+    m_missingChunks.reserve(m_maxChunkCount);
+    m_pendingReadRequests.reserve(m_maxChunkCount);
     // Divide up the allocated raw memory buffer into total_chunks
     // chunks. Initialize each chunk to hold nothing and add it to the free
-    // list.
-    for (SINT i = 0; i < kNumberOfCachedChunksInMemory; ++i) {
+    // list or the reserve.
+    for (SINT i = 0; i < m_maxChunkCount; ++i) {
         CachingReaderChunkForOwner* c =
                 new CachingReaderChunkForOwner(
                         mixxx::SampleBuffer::WritableSlice(
@@ -75,7 +199,11 @@ CachingReader::CachingReader(const QString& group,
                                 CachingReaderChunk::kSamples * i,
                                 CachingReaderChunk::kSamples));
         m_chunks.push_back(c);
-        m_freeChunks.push_back(c);
+        if (i < m_initialChunkCount) {
+            m_freeChunks.push_back(c);
+        } else {
+            m_reserveChunks.push_back(c);
+        }
     }
 
     // Forward signals from worker
@@ -155,6 +283,7 @@ CachingReaderChunkForOwner* CachingReader::allocateChunkExpireLRU(SINT chunkInde
     if (!pChunk) {
         if (m_lruCachingReaderChunk) {
             freeChunk(m_lruCachingReaderChunk);
+            ++m_chunkEvictions;
             pChunk = allocateChunk(chunkIndex);
         } else {
             kLogger.warning() << "No cached LRU chunk available for freeing";
@@ -204,7 +333,7 @@ CachingReaderChunkForOwner* CachingReader::lookupChunkAndFreshen(SINT chunkIndex
 }
 
 // Invoked from the UI thread!!
-void CachingReader::newTrack(TrackPointer pTrack) {
+void CachingReader::newTrack(TrackPointer pTrack, bool preloadFully) {
     auto newState = pTrack ? STATE_TRACK_LOADING : STATE_TRACK_UNLOADING;
     auto oldState = m_state.fetchAndStoreAcquire(newState);
 
@@ -219,7 +348,7 @@ void CachingReader::newTrack(TrackPointer pTrack) {
         kLogger.warning()
                 << "Loading a new track while loading a track may lead to inconsistent states";
     }
-    m_worker.newTrack(std::move(pTrack));
+    m_worker.newTrack(std::move(pTrack), preloadFully);
 }
 
 // Called from the engine thread
@@ -228,6 +357,8 @@ void CachingReader::process() {
     while (m_readerStatusUpdateFIFO.read(&update, 1) == 1) {
         auto* pChunk = update.takeFromWorker();
         if (pChunk) {
+            traceChunkReadFlow(Stat::FLOW_END, pChunk);
+            removePendingReadRequest(pChunk);
             // Result of a read request (with a chunk)
             DEBUG_ASSERT(atomicLoadRelaxed(m_state) != STATE_IDLE);
             DEBUG_ASSERT(
@@ -246,12 +377,14 @@ void CachingReader::process() {
                 // Insert or freshen the chunk in the MRU/LRU list after
                 // obtaining ownership from the worker.
                 freshenChunk(pChunk);
+                ++m_readRequestStats.served;
             } else {
                 // Discard chunks that don't carry any data
                 freeChunk(pChunk);
             }
-            // Adjust the readable frame index range (if available)
-            if (update.status != CHUNK_READ_DISCARDED) {
+            // Adjust the readable frame index range (if available). The
+            // range of a preloaded track has been decoded completely.
+            if (update.status != CHUNK_READ_DISCARDED && !m_pPreloadedSamples) {
                 m_readableFrameIndexRange = intersect(
                         m_readableFrameIndexRange,
                         update.readableFrameIndexRange());
@@ -273,15 +406,37 @@ void CachingReader::process() {
                     DEBUG_ASSERT(atomicLoadRelaxed(m_state) == STATE_TRACK_LOADING);
                     freeAllChunks();
                 }
+                shrinkChunkPool();
                 // Reset the readable frame index range
                 m_readableFrameIndexRange = update.readableFrameIndexRange();
+                m_pPreloadedSamples = nullptr;
                 m_state.storeRelease(STATE_TRACK_LOADED);
+            } else if (update.status == TRACK_PRELOADED) {
+                // Ignore the samples of a track that is already being
+                // replaced or unloaded. The worker frees them before
+                // loading the next track or sends them back with the
+                // TRACK_UNLOADED update.
+                if (atomicLoadRelaxed(m_state) == STATE_TRACK_LOADED) {
+                    m_readableFrameIndexRange = update.readableFrameIndexRange();
+                    m_pPreloadedSamples = update.getPreloadedSamples();
+                }
             } else {
                 DEBUG_ASSERT(update.status == TRACK_UNLOADED);
+                m_pPreloadedSamples = nullptr;
+                if (update.getPreloadedSamples()) {
+                    // Allow the worker to free the samples of the
+                    // unloaded track
+                    m_worker.releasePreloadedSamples();
+                }
                 // This message could be processed later when a new
                 // track is already loading! In this case the TRACK_LOADED will
                 // be the very next status update.
-                if (!m_state.testAndSetRelease(STATE_TRACK_UNLOADING, STATE_IDLE)) {
+                if (m_state.testAndSetRelease(STATE_TRACK_UNLOADING, STATE_IDLE)) {
+                    // The deck has been ejected. Release the chunks of the
+                    // old track and any chunks that the pool has grown by.
+                    freeAllChunks();
+                    shrinkChunkPool();
+                } else {
                     DEBUG_ASSERT(
                             atomicLoadRelaxed(m_state) == STATE_TRACK_LOADING ||
                             atomicLoadRelaxed(m_state) == STATE_IDLE);
@@ -341,6 +496,10 @@ CachingReader::ReadResult CachingReader::read(SINT startSample, SINT numSamples,
                     CachingReaderChunk::samples2frames(numSamples));
     DEBUG_ASSERT(!remainingFrameIndexRange.empty());
 
+    if (m_pPreloadedSamples) {
+        return readPreloaded(remainingFrameIndexRange, reverse, buffer);
+    }
+
     auto result = ReadResult::AVAILABLE;
     if (!intersect(remainingFrameIndexRange, m_readableFrameIndexRange).empty()) {
         // Fill the buffer up to the first readable sample with
@@ -508,16 +667,61 @@ CachingReader::ReadResult CachingReader::read(SINT startSample, SINT numSamples,
     return result;
 }
 
-void CachingReader::hintAndMaybeWake(const HintVector& hintList) {
+CachingReader::ReadResult CachingReader::readPreloaded(
+        const mixxx::IndexRange& frameIndexRange, bool reverse, CSAMPLE* buffer) {
+    DEBUG_ASSERT(m_pPreloadedSamples);
+    const auto readableFrameIndexRange =
+            intersect(frameIndexRange, m_readableFrameIndexRange);
+    const SINT numSamples =
+            CachingReaderChunk::frames2samples(frameIndexRange.length());
+    if (readableFrameIndexRange.empty()) {
+        SampleUtil::clear(buffer, numSamples);
+        return ReadResult::PARTIALLY_AVAILABLE;
+    }
+
+    // Silence before the first and after the last readable sample
+    const SINT prerollSamples = CachingReaderChunk::frames2samples(
+            readableFrameIndexRange.start() - frameIndexRange.start());
+    const SINT readableSamples = CachingReaderChunk::frames2samples(
+            readableFrameIndexRange.length());
+    const SINT postrollSamples = numSamples - prerollSamples - readableSamples;
+    const CSAMPLE* pSamples = m_pPreloadedSamples +
+            CachingReaderChunk::frames2samples(
+                    readableFrameIndexRange.start() -
+                    m_readableFrameIndexRange.start());
+    if (reverse) {
+        SampleUtil::clear(buffer, postrollSamples);
+        SampleUtil::copyReverse(buffer + postrollSamples, pSamples, readableSamples);
+        SampleUtil::clear(buffer + postrollSamples + readableSamples, prerollSamples);
+    } else {
+        SampleUtil::clear(buffer, prerollSamples);
+        SampleUtil::copy(buffer + prerollSamples, pSamples, readableSamples);
+        SampleUtil::clear(buffer + prerollSamples + readableSamples, postrollSamples);
+    }
+    return readableSamples == numSamples
+            ? ReadResult::AVAILABLE
+            : ReadResult::PARTIALLY_AVAILABLE;
+}
+
+void CachingReader::hintAndMaybeWake(const HintVector& hintList, SINT playFrame) {
     // If no file is loaded, skip.
     if (atomicLoadRelaxed(m_state) != STATE_TRACK_LOADED) {
         return;
     }
 
-    // For every chunk that the hints indicated, check if it is in the cache. If
-    // any are not, then wake.
-    bool shouldWake = false;
+    // All chunks of a preloaded track are in memory
+    if (m_pPreloadedSamples) {
+        return;
+    }
+
+    ++m_hintCalls;
+    const SINT playChunkIndex = CachingReaderChunk::indexForFrame(
+            math_max(playFrame, m_readableFrameIndexRange.start()));
 
+    // For every chunk that the hints indicated, check if it is in the cache.
+    // Collect the missing chunks first and request them in the order of
+    // their priority.
+    DEBUG_ASSERT(m_missingChunks.empty());
     for (const auto& hint: hintList) {
         SINT hintFrame = hint.frame;
         SINT hintFrameCount = hint.frameCount;
@@ -552,44 +756,196 @@ void CachingReader::hintAndMaybeWake(const HintVector& hintList) {
         const int firstChunkIndex = CachingReaderChunk::indexForFrame(readableFrameIndexRange.start());
         const int lastChunkIndex = CachingReaderChunk::indexForFrame(readableFrameIndexRange.end() - 1);
         for (int chunkIndex = firstChunkIndex; chunkIndex <= lastChunkIndex; ++chunkIndex) {
+            ++m_chunkLookups;
             CachingReaderChunkForOwner* pChunk = lookupChunk(chunkIndex);
             if (!pChunk) {
-                shouldWake = true;
-                pChunk = allocateChunkExpireLRU(chunkIndex);
-                if (!pChunk) {
-                    kLogger.warning()
-                            << "Failed to allocate chunk"
-                            << chunkIndex
-                            << "for read request";
-                    continue;
-                }
-                // Do not insert the allocated chunk into the MRU/LRU list,
-                // because it will be handed over to the worker immediately
-                CachingReaderChunkReadRequest request;
-                request.giveToWorker(pChunk);
-                if (kLogger.traceEnabled()) {
-                    kLogger.trace()
-                            << "Requesting read of chunk"
-                            << request.chunk;
-                }
-                if (m_chunkReadRequestFIFO.write(&request, 1) != 1) {
-                    kLogger.warning()
-                            << "Failed to submit read request for chunk"
-                            << chunkIndex;
-                    // Revoke the chunk from the worker and free it
-                    pChunk->takeFromWorker();
-                    freeChunk(pChunk);
+                // The capacity is only exceeded by hints for many more
+                // chunks than the cache could hold
+                if (m_missingChunks.size() < m_missingChunks.capacity()) {
+                    m_missingChunks.push_back(MissingChunk{chunkIndex,
+                            hintTypePriority(hint.type),
+                            std::abs(chunkIndex - playChunkIndex)});
+                } else {
+                    ++m_readRequestStats.deferred;
                 }
             } else if (pChunk->getState() == CachingReaderChunkForOwner::READY) {
                 // This will cause the chunk to be 'freshened' in the cache. The
                 // chunk will be moved to the end of the LRU list.
                 freshenChunk(pChunk);
+            } else {
+                DEBUG_ASSERT(pChunk->getState() == CachingReaderChunkForOwner::READ_PENDING);
+                // Still needed, revoke a previous cancellation. If the worker
+                // has already discarded the chunk it will be requested again.
+                for (auto& pendingReadRequest : m_pendingReadRequests) {
+                    if (pendingReadRequest.pChunk == pChunk) {
+                        pendingReadRequest.lastHintCall = m_hintCalls;
+                        break;
+                    }
+                }
+                pChunk->setReadCancelled(false);
             }
         }
     }
 
+    // Most urgent first and only once per chunk
+    std::sort(m_missingChunks.begin(),
+            m_missingChunks.end(),
+            [](const MissingChunk& lhs, const MissingChunk& rhs) {
+                if (lhs.chunkIndex != rhs.chunkIndex) {
+                    return lhs.chunkIndex < rhs.chunkIndex;
+                }
+                return lhs.typePriority < rhs.typePriority;
+            });
+    const auto uniqueEnd = std::unique(m_missingChunks.begin(),
+            m_missingChunks.end(),
+            [](const MissingChunk& lhs, const MissingChunk& rhs) {
+                return lhs.chunkIndex == rhs.chunkIndex;
+            });
+    m_readRequestStats.coalesced +=
+            static_cast<int>(std::distance(uniqueEnd, m_missingChunks.end()));
+    m_missingChunks.erase(uniqueEnd, m_missingChunks.end());
+    std::sort(m_missingChunks.begin(),
+            m_missingChunks.end(),
+            [](const MissingChunk& lhs, const MissingChunk& rhs) {
+                if (lhs.typePriority != rhs.typePriority) {
+                    return lhs.typePriority < rhs.typePriority;
+                }
+                return lhs.distance < rhs.distance;
+            });
+
+    bool shouldWake = false;
+    for (const auto& missingChunk : m_missingChunks) {
+        if (m_chunkReadRequestFIFO.writeAvailable() <= 0) {
+            // Don't allocate a chunk that cannot be requested
+            ++m_readRequestStats.deferred;
+            continue;
+        }
+        auto* pChunk = allocateChunkExpireLRU(missingChunk.chunkIndex);
+        if (!pChunk) {
+            kLogger.warning()
+                    << "Failed to allocate chunk"
+                    << missingChunk.chunkIndex
+                    << "for read request";
+            continue;
+        }
+        // Do not insert the allocated chunk into the MRU/LRU list,
+        // because it will be handed over to the worker immediately
+        CachingReaderChunkReadRequest request;
+        request.giveToWorker(pChunk);
+        if (kLogger.traceEnabled()) {
+            kLogger.trace()
+                    << "Requesting read of chunk"
+                    << request.chunk;
+        }
+        traceChunkReadFlow(Stat::FLOW_START, pChunk);
+        if (m_chunkReadRequestFIFO.write(&request, 1) != 1) {
+            kLogger.warning()
+                    << "Failed to submit read request for chunk"
+                    << missingChunk.chunkIndex;
+            // Revoke the chunk from the worker and free it
+            pChunk->takeFromWorker();
+            freeChunk(pChunk);
+            continue;
+        }
+        m_pendingReadRequests.push_back(PendingReadRequest{pChunk, m_hintCalls});
+        ++m_readRequestStats.submitted;
+        shouldWake = true;
+    }
+    m_missingChunks.clear();
+
+    // Cancel the pending requests that have been superseded by the hints
+    // of the last calls. The worker returns them without decoding.
+    for (const auto& pendingReadRequest : m_pendingReadRequests) {
+        if (m_hintCalls - pendingReadRequest.lastHintCall == kSupersededAfterHintCalls) {
+            pendingReadRequest.pChunk->setReadCancelled(true);
+            ++m_readRequestStats.superseded;
+        }
+    }
+
+    if (m_chunkLookups >= kChunkPoolWindowLookups) {
+        updateChunkPoolStats();
+    }
+
     // If there are chunks to be read, wake up.
     if (shouldWake) {
         m_worker.workReady();
     }
 }
+
+void CachingReader::removePendingReadRequest(CachingReaderChunkForOwner* pChunk) {
+    for (auto it = m_pendingReadRequests.begin(); it != m_pendingReadRequests.end(); ++it) {
+        if (it->pChunk == pChunk) {
+            // The order doesn't matter
+            *it = m_pendingReadRequests.back();
+            m_pendingReadRequests.pop_back();
+            return;
+        }
+    }
+    DEBUG_ASSERT(!"Unknown pending read request");
+}
+
+void CachingReader::updateChunkPoolStats() {
+    Counter(kChunkLookupsTag) += m_chunkLookups;
+    Counter(kChunkEvictionsTag) += m_chunkEvictions;
+    Counter(kReadRequestsCoalescedTag) +=
+            m_readRequestStats.coalesced - m_reportedReadRequestStats.coalesced;
+    Counter(kReadRequestsSubmittedTag) +=
+            m_readRequestStats.submitted - m_reportedReadRequestStats.submitted;
+    Counter(kReadRequestsServedTag) +=
+            m_readRequestStats.served - m_reportedReadRequestStats.served;
+    Counter(kReadRequestsDeferredTag) +=
+            m_readRequestStats.deferred - m_reportedReadRequestStats.deferred;
+    Counter(kReadRequestsSupersededTag) +=
+            m_readRequestStats.superseded - m_reportedReadRequestStats.superseded;
+    m_reportedReadRequestStats = m_readRequestStats;
+
+    if (m_chunkEvictions * kChunkPoolMaxEvictionRatio > m_chunkLookups &&
+            !m_reserveChunks.empty()) {
+        // Moving the list nodes doesn't allocate memory
+        auto last = m_reserveChunks.begin();
+        std::advance(last,
+                math_min(kChunkPoolGrowthChunks,
+                        static_cast<SINT>(m_reserveChunks.size())));
+        m_freeChunks.splice(m_freeChunks.end(),
+                m_reserveChunks,
+                m_reserveChunks.begin(),
+                last);
+        if (kLogger.debugEnabled()) {
+            kLogger.debug()
+                    << "Growing the chunk pool to"
+                    << numAvailableChunks()
+                    << "chunks after"
+                    << m_chunkEvictions
+                    << "evictions in"
+                    << m_chunkLookups
+                    << "lookups";
+        }
+    }
+    Stat::track(kChunkPoolSizeTag,
+            Stat::UNSPECIFIED,
+            Stat::experimentFlags(Stat::COUNT | Stat::AVERAGE | Stat::MIN | Stat::MAX),
+            numAvailableChunks());
+
+    m_chunkLookups = 0;
+    m_chunkEvictions = 0;
+}
+
+void CachingReader::shrinkChunkPool() {
+    // Chunks that are still pending are returned to the free list later
+    // and stay in the pool until the next track is unloaded.
+    const SINT excessChunks = math_min(
+            numAvailableChunks() - m_initialChunkCount,
+            static_cast<SINT>(m_freeChunks.size()));
+    if (excessChunks > 0) {
+        // Moving the list nodes doesn't free memory
+        auto first = m_freeChunks.end();
+        std::advance(first, -excessChunks);
+        m_reserveChunks.splice(m_reserveChunks.begin(),
+                m_freeChunks,
+                first,
+                m_freeChunks.end());
+    }
+    // The eviction rate of the previous track doesn't apply to the next
+    m_chunkLookups = 0;
+    m_chunkEvictions = 0;
+}
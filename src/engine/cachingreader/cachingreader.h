@@ -6,6 +6,7 @@
 #include <QVarLengthArray>
 #include <QVector>
 #include <list>
+#include <vector>
 
 #include "engine/cachingreader/cachingreaderworker.h"
 #include "engine/engineworker.h"
@@ -77,6 +78,18 @@ typedef QVarLengthArray<Hint, 512> HintVector;
 // least-recently-used list. When a chunk needs to be allocated and there are no
 // free chunks then the least recently used chunk is free'd (see
 // allocateChunkExpireLRU).
+//
+// The number of chunks is configurable. In adaptive mode the pool starts
+// with the configured number of chunks and grows up to a maximum while
+// chunks are evicted and requested again too often, e.g. when looping and
+// beatjumping across the track. The memory for the maximum number of chunks
+// is reserved up front, so growing doesn't allocate in the engine thread.
+//
+// Tracks can also be preloaded fully, e.g. for samplers. The worker then
+// decodes the whole track in the background after loading it, as long as
+// all preloaded tracks fit into a global memory budget. Once preloading has
+// finished all reads are served from the decoded samples without any chunk
+// lookups or read requests.
 class CachingReader : public QObject {
     Q_OBJECT
 
@@ -107,17 +120,61 @@ class CachingReader : public QObject {
     // that is not in the cache. If any hints do request a chunk not in cache,
     // then wake the reader so that it can process them. Must only be called
     // from the engine callback.
-    void hintAndMaybeWake(const HintVector& hintList);
+    //
+    // The missing chunks are requested once, ordered by the priority of the
+    // hint type and the distance from playFrame. Pending requests for chunks
+    // that are not hinted anymore, e.g. while scratching, are cancelled.
+    void hintAndMaybeWake(const HintVector& hintList, SINT playFrame);
 
     // Request that the CachingReader load a new track. These requests are
     // processed in the work thread, so the reader must be woken up via wake()
-    // for this to take effect.
-    void newTrack(TrackPointer pTrack);
+    // for this to take effect. If preloadFully is set the whole track is
+    // decoded into memory in the background after loading.
+    void newTrack(TrackPointer pTrack, bool preloadFully = false);
+
+    // Whether all samples of the loaded track are available in memory
+    bool isPreloadedFully() const {
+        return m_pPreloadedSamples != nullptr;
+    }
 
     void setScheduler(EngineWorkerScheduler* pScheduler) {
         m_worker.setScheduler(pScheduler);
     }
 
+    // Statistics about the read requests for hinted chunks since the
+    // reader has been created.
+    struct ReadRequestStats {
+        // Hints for a missing chunk that has already been hinted in
+        // the same call
+        int coalesced = 0;
+        // Requests that have been sent to the worker
+        int submitted = 0;
+        // Requests that have been answered with the decoded chunk
+        int served = 0;
+        // Missing chunks that have not been requested, because the worker
+        // is still busy with more urgent requests. They are requested when
+        // hinted again.
+        int deferred = 0;
+        // Pending requests that have been cancelled, because the chunk has
+        // not been hinted again
+        int superseded = 0;
+    };
+
+    const ReadRequestStats& readRequestStats() const {
+        return m_readRequestStats;
+    }
+
+    // Whether the worker has not returned all requested chunks yet
+    bool hasPendingReadRequests() const {
+        return !m_pendingReadRequests.empty();
+    }
+
+    // The number of chunks that are currently available for caching,
+    // i.e. excluding the reserve for adaptive growth.
+    SINT numAvailableChunks() const {
+        return m_chunks.size() - static_cast<SINT>(m_reserveChunks.size());
+    }
+
   signals:
     // Emitted once a new track is loaded and ready to be read from.
     void trackLoading();
@@ -127,6 +184,11 @@ class CachingReader : public QObject {
   private:
     const UserSettingsPointer m_pConfig;
 
+    // The number of chunks that are available initially and the maximum
+    // number of chunks in adaptive mode.
+    const SINT m_initialChunkCount;
+    const SINT m_maxChunkCount;
+
     // Thread-safe FIFOs for communication between the engine callback and
     // reader thread.
     FIFO<CachingReaderChunkReadRequest> m_chunkReadRequestFIFO;
@@ -157,6 +219,23 @@ class CachingReader : public QObject {
     // Gets a chunk from the free list, frees the LRU CachingReaderChunk if none available.
     CachingReaderChunkForOwner* allocateChunkExpireLRU(SINT chunkIndex);
 
+    // Reads the requested frames from the samples of a preloaded track
+    ReadResult readPreloaded(const mixxx::IndexRange& frameIndexRange,
+            bool reverse,
+            CSAMPLE* buffer);
+
+    // Removes the chunk from m_pendingReadRequests after it has been
+    // returned by the worker.
+    void removePendingReadRequest(CachingReaderChunkForOwner* pChunk);
+
+    // Reports the chunk lookups and evictions of the last window to the
+    // StatsManager and grows the pool if it is thrashing.
+    void updateChunkPoolStats();
+
+    // Returns the free chunks the pool has grown by to the reserve, so
+    // that each track starts with the initial number of chunks again.
+    void shrinkChunkPool();
+
     enum State {
         STATE_IDLE,
         STATE_TRACK_LOADING,
@@ -172,6 +251,43 @@ class CachingReader : public QObject {
     // and deletions. Iteration is not necessary.
     std::list<CachingReaderChunkForOwner*> m_freeChunks;
 
+    // Chunks that are not in use yet, but can be moved to the free list
+    // when the pool grows in adaptive mode.
+    std::list<CachingReaderChunkForOwner*> m_reserveChunks;
+
+    // Number of chunk lookups and LRU evictions while processing hints
+    // since the pool statistics have been updated.
+    int m_chunkLookups;
+    int m_chunkEvictions;
+
+    // A chunk that has been hinted but is not cached
+    struct MissingChunk {
+        SINT chunkIndex;
+        // The index of the Hint::Type, lower is more urgent
+        int typePriority;
+        // Distance from the play position in chunks
+        SINT distance;
+    };
+    // Collects the missing chunks while processing hints. The capacity is
+    // reserved up front.
+    std::vector<MissingChunk> m_missingChunks;
+
+    // A chunk that has been handed over to the worker
+    struct PendingReadRequest {
+        CachingReaderChunkForOwner* pChunk;
+        // The last call of hintAndMaybeWake() that has hinted the chunk
+        unsigned int lastHintCall;
+    };
+    std::vector<PendingReadRequest> m_pendingReadRequests;
+
+    // Incremented by each call of hintAndMaybeWake()
+    unsigned int m_hintCalls;
+
+    ReadRequestStats m_readRequestStats;
+    // The part of m_readRequestStats that has already been reported
+    // to the StatsManager
+    ReadRequestStats m_reportedReadRequestStats;
+
     // Keeps track of what CachingReaderChunks we've allocated and indexes them based on what
     // chunk number they are allocated to.
     QHash<int, CachingReaderChunkForOwner*> m_allocatedCachingReaderChunks;
@@ -186,5 +302,9 @@ class CachingReader : public QObject {
     // The readable frame index range as reported by the worker.
     mixxx::IndexRange m_readableFrameIndexRange;
 
+    // The decoded samples of m_readableFrameIndexRange if the track has
+    // been preloaded fully. Owned by the worker.
+    const CSAMPLE* m_pPreloadedSamples;
+
     CachingReaderWorker m_worker;
 };
@@ -33,7 +33,8 @@ const SINT CachingReaderChunk::kSamples =
 CachingReaderChunk::CachingReaderChunk(
         mixxx::SampleBuffer::WritableSlice sampleBuffer)
         : m_index(kInvalidChunkIndex),
-          m_sampleBuffer(std::move(sampleBuffer)) {
+          m_sampleBuffer(std::move(sampleBuffer)),
+          m_readCancelled(false) {
     DEBUG_ASSERT(m_sampleBuffer.length() == kSamples);
 }
 
@@ -41,6 +42,7 @@ void CachingReaderChunk::init(SINT index) {
     DEBUG_ASSERT(m_index == kInvalidChunkIndex || index == kInvalidChunkIndex);
     m_index = index;
     m_bufferedSampleFrames.frameIndexRange() = mixxx::IndexRange();
+    setReadCancelled(false);
 }
 
 // Frame index range of this chunk for the given audio source.
@@ -79,6 +81,20 @@ mixxx::IndexRange CachingReaderChunk::bufferSampleFrames(
     return m_bufferedSampleFrames.frameIndexRange();
 }
 
+mixxx::IndexRange CachingReaderChunk::bufferSampleFrames(
+        const mixxx::AudioSourcePointer& pAudioSource,
+        const CSAMPLE* pDecodedSamples) {
+    DEBUG_ASSERT(m_index != kInvalidChunkIndex);
+    const auto sourceFrameIndexRange = frameIndexRange(pAudioSource);
+    const SINT sampleCount = frames2samples(sourceFrameIndexRange.length());
+    SampleUtil::copy(m_sampleBuffer.data(), pDecodedSamples, sampleCount);
+    m_bufferedSampleFrames = mixxx::ReadableSampleFrames(
+            sourceFrameIndexRange,
+            mixxx::SampleBuffer::ReadableSlice(
+                    m_sampleBuffer.data(), sampleCount));
+    return m_bufferedSampleFrames.frameIndexRange();
+}
+
 mixxx::IndexRange CachingReaderChunk::readBufferedSampleFrames(
         CSAMPLE* sampleBuffer,
         const mixxx::IndexRange& frameIndexRange) const {
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <atomic>
+
 #include "sources/audiosource.h"
 
 // A Chunk is a memory-resident section of audio that has been cached.
@@ -56,6 +58,13 @@ public:
             const mixxx::AudioSourcePointer& pAudioSource,
             mixxx::SampleBuffer::WritableSlice tempOutputBuffer);
 
+    // Copy sample frames that have been decoded before, e.g. from the
+    // CachingReaderDiskCache, instead of reading them from the audio
+    // source. Returns the range of frames that have been copied.
+    mixxx::IndexRange bufferSampleFrames(
+            const mixxx::AudioSourcePointer& pAudioSource,
+            const CSAMPLE* pDecodedSamples);
+
     mixxx::IndexRange readBufferedSampleFrames(
             CSAMPLE* sampleBuffer,
             const mixxx::IndexRange& frameIndexRange) const;
@@ -63,6 +72,16 @@ public:
             CSAMPLE* reverseSampleBuffer,
             const mixxx::IndexRange& frameIndexRange) const;
 
+    // The owner may cancel a pending read request when the chunk is not
+    // needed anymore. This is the only state that is shared between the
+    // owner and the worker while the request is pending.
+    void setReadCancelled(bool cancelled) {
+        m_readCancelled.store(cancelled, std::memory_order_relaxed);
+    }
+    bool isReadCancelled() const {
+        return m_readCancelled.load(std::memory_order_relaxed);
+    }
+
 protected:
     explicit CachingReaderChunk(
             mixxx::SampleBuffer::WritableSlice sampleBuffer);
@@ -81,6 +100,8 @@ private:
     // set the corresponding frame index range.
     mixxx::SampleBuffer::WritableSlice m_sampleBuffer;
     mixxx::ReadableSampleFrames m_bufferedSampleFrames;
+
+    std::atomic<bool> m_readCancelled;
 };
 
 // This derived class is only accessible for the cache as the owner,
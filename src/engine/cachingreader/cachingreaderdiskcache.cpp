@@ -0,0 +1,353 @@
+#include "engine/cachingreader/cachingreaderdiskcache.h"
+
+#include <QCryptographicHash>
+#include <QDateTime>
+#include <QDir>
+#include <QFileInfo>
+#include <QLockFile>
+#include <cstring>
+
+#if defined(__LINUX__) || defined(__APPLE__)
+#include <fcntl.h>
+#endif
+
+#include "engine/cachingreader/cachingreaderchunk.h"
+#include "util/assert.h"
+#include "util/cache.h"
+#include "util/logger.h"
+
+namespace {
+
+mixxx::Logger kLogger("CachingReaderDiskCache");
+
+const QString kFileSuffix = QStringLiteral(".pcm");
+
+// Bump the version whenever the file layout changes
+constexpr quint32 kFileVersion = 2;
+
+// The cache file starts with this header, followed by one checksum per
+// chunk that is set after the samples of the chunk have been stored. The
+// samples start at the next page boundary.
+struct FileHeader {
+    char magic[8];
+    quint32 version;
+    quint32 sampleRate;
+    qint64 frameIndexStart;
+    qint64 frameIndexEnd;
+    quint32 chunkFrames;
+    quint32 channelCount;
+};
+
+constexpr qint64 kPageSize = 4096;
+
+// The checksum of chunks that have not been stored yet. Valid checksums
+// are never 0.
+constexpr quint32 kChunkNotStored = 0;
+
+static_assert(sizeof(CSAMPLE) == sizeof(quint32));
+
+// A Fletcher-like checksum over the bit patterns of the samples. It is
+// cheap compared to decoding and also detects reordered or zeroed pages.
+quint32 chunkChecksum(const CSAMPLE* pSamples, SINT numSamples) {
+    // Neither sum overflows for the number of samples in a chunk
+    quint64 sum1 = 0;
+    quint64 sum2 = 0;
+    for (SINT i = 0; i < numSamples; ++i) {
+        quint32 word;
+        std::memcpy(&word, &pSamples[i], sizeof(word));
+        sum1 += word;
+        sum2 += sum1;
+    }
+    const quint32 checksum =
+            static_cast<quint32>(sum1 ^ (sum1 >> 32)) +
+            31 * static_cast<quint32>(sum2 ^ (sum2 >> 32));
+    return checksum == kChunkNotStored ? 1 : checksum;
+}
+
+// Allocates the disk blocks of the whole file. Extending the file with
+// resize() alone creates a sparse file on most file systems, and writing
+// to the mapped pages of a sparse file raises SIGBUS when the disk is full.
+bool reserveFileSpace(QFile* pFile, qint64 fileSize) {
+#if defined(__LINUX__)
+    return posix_fallocate(pFile->handle(), 0, fileSize) == 0;
+#elif defined(__APPLE__)
+    fstore_t store;
+    std::memset(&store, 0, sizeof(store));
+    store.fst_flags = F_ALLOCATEALL;
+    store.fst_posmode = F_PEOFPOSMODE;
+    store.fst_offset = 0;
+    store.fst_length = fileSize;
+    if (fcntl(pFile->handle(), F_PREALLOCATE, &store) == -1) {
+        return false;
+    }
+    return pFile->resize(fileSize);
+#else
+    // NTFS allocates all clusters when extending a file that is not
+    // explicitly marked as sparse
+    return pFile->resize(fileSize);
+#endif
+}
+
+FileHeader makeFileHeader(
+        mixxx::audio::SampleRate sampleRate,
+        const mixxx::IndexRange& frameIndexRange) {
+    FileHeader header;
+    // Zero the padding for comparing headers with memcmp()
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.magic, "MIXXXPCM", sizeof(header.magic));
+    header.version = kFileVersion;
+    header.sampleRate = sampleRate.value();
+    header.frameIndexStart = frameIndexRange.start();
+    header.frameIndexEnd = frameIndexRange.end();
+    header.chunkFrames = static_cast<quint32>(CachingReaderChunk::kFrames);
+    header.channelCount = CachingReaderChunk::kChannels;
+    return header;
+}
+
+qint64 dataOffset(SINT numChunks) {
+    const qint64 headerSize = sizeof(FileHeader) + numChunks * sizeof(quint32);
+    return ((headerSize + kPageSize - 1) / kPageSize) * kPageSize;
+}
+
+} // anonymous namespace
+
+CachingReaderDiskCache::CachingReaderDiskCache(
+        const QString& directory, qint64 maxSizeBytes)
+        : m_directory(directory),
+          m_maxSizeBytes(maxSizeBytes),
+          m_bDisabled(false),
+          m_pData(nullptr) {
+}
+
+CachingReaderDiskCache::~CachingReaderDiskCache() {
+    close();
+}
+
+// static
+QString CachingReaderDiskCache::cacheFileName(const mixxx::FileInfo& fileInfo) {
+    // Hashing the contents of the whole file would be too expensive for
+    // each track load. Any modification of the file changes the size or
+    // the modification time.
+    const QFileInfo currentFileInfo(fileInfo.location());
+    QCryptographicHash hasher(QCryptographicHash::Sha256);
+    hasher.addData(fileInfo.location().toUtf8());
+    hasher.addData(QByteArray::number(currentFileInfo.size()));
+    hasher.addData(QByteArray::number(
+            currentFileInfo.lastModified().toMSecsSinceEpoch()));
+    const mixxx::cache_key_t key =
+            mixxx::cacheKeyFromMessageDigest(hasher.result());
+    return QString::number(key, 16) + kFileSuffix;
+}
+
+bool CachingReaderDiskCache::open(
+        const mixxx::FileInfo& fileInfo,
+        mixxx::audio::SampleRate sampleRate,
+        const mixxx::IndexRange& frameIndexRange) {
+    close();
+    if (!isEnabled() || !sampleRate.isValid() || frameIndexRange.empty()) {
+        return false;
+    }
+    m_frameIndexRange = frameIndexRange;
+    const qint64 fileSize = dataOffset(numChunks()) +
+            CachingReaderChunk::frames2samples(frameIndexRange.length()) *
+                    static_cast<qint64>(sizeof(CSAMPLE));
+    if (fileSize > m_maxSizeBytes) {
+        // This track would evict all other tracks and still not fit
+        return false;
+    }
+    if (!QDir().mkpath(m_directory)) {
+        kLogger.warning()
+                << "Failed to create directory"
+                << m_directory;
+        return false;
+    }
+
+    m_file.setFileName(QDir(m_directory).filePath(cacheFileName(fileInfo)));
+    // The lock is held until close(). Only the age of the lock file must
+    // not make it stale, because a track may stay loaded for hours. Locks
+    // of crashed processes are still detected as stale.
+    m_pLockFile = std::make_unique<QLockFile>(
+            m_file.fileName() + QStringLiteral(".lock"));
+    m_pLockFile->setStaleLockTime(0);
+    if (!m_pLockFile->tryLock(0)) {
+        if (kLogger.debugEnabled()) {
+            kLogger.debug()
+                    << "Cache file is in use by another deck"
+                    << m_file.fileName();
+        }
+        m_pLockFile.reset();
+        return false;
+    }
+    if (!m_file.open(QIODevice::ReadWrite)) {
+        kLogger.warning()
+                << "Failed to open cache file"
+                << m_file.fileName()
+                << m_file.errorString();
+        close();
+        return false;
+    }
+
+    const FileHeader header = makeFileHeader(sampleRate, frameIndexRange);
+    FileHeader existingHeader;
+    if (m_file.size() != fileSize ||
+            m_file.read(reinterpret_cast<char*>(&existingHeader),
+                    sizeof(existingHeader)) != sizeof(existingHeader) ||
+            std::memcmp(&header, &existingHeader, sizeof(header)) != 0) {
+        // A new file or one written by a different decoder. Truncating
+        // it first clears all chunk checksums. No other instance has
+        // mapped the file while we hold the lock.
+        if (!m_file.resize(0)) {
+            kLogger.warning()
+                    << "Failed to truncate cache file"
+                    << m_file.fileName()
+                    << m_file.errorString();
+            close();
+            return false;
+        }
+        if (!reserveFileSpace(&m_file, fileSize)) {
+            kLogger.warning()
+                    << "Failed to reserve"
+                    << fileSize
+                    << "bytes for cache file"
+                    << m_file.fileName()
+                    << "- disabling the decoded audio cache";
+            m_file.remove();
+            close();
+            m_bDisabled = true;
+            return false;
+        }
+        if (!m_file.seek(0) ||
+                m_file.write(reinterpret_cast<const char*>(&header),
+                        sizeof(header)) != sizeof(header) ||
+                !m_file.flush()) {
+            kLogger.warning()
+                    << "Failed to initialize cache file"
+                    << m_file.fileName()
+                    << m_file.errorString();
+            close();
+            return false;
+        }
+    }
+
+    m_pData = m_file.map(0, fileSize);
+    if (!m_pData) {
+        kLogger.warning()
+                << "Failed to map cache file"
+                << m_file.fileName()
+                << m_file.errorString();
+        close();
+        return false;
+    }
+
+    // The modification time of the cache files determines the order
+    // of eviction
+    m_file.setFileTime(QDateTime::currentDateTimeUtc(),
+            QFileDevice::FileModificationTime);
+    evict();
+    return true;
+}
+
+void CachingReaderDiskCache::close() {
+    if (m_pData) {
+        m_file.unmap(m_pData);
+        m_pData = nullptr;
+    }
+    if (m_file.isOpen()) {
+        m_file.close();
+    }
+    // Unlocks and removes the lock file
+    m_pLockFile.reset();
+    m_frameIndexRange = mixxx::IndexRange();
+}
+
+SINT CachingReaderDiskCache::numChunks() const {
+    return (m_frameIndexRange.length() + CachingReaderChunk::kFrames - 1) /
+            CachingReaderChunk::kFrames;
+}
+
+mixxx::IndexRange CachingReaderDiskCache::chunkFrameIndexRange(SINT chunkIndex) const {
+    // Same as CachingReaderChunk::frameIndexRange()
+    return intersect(
+            mixxx::IndexRange::forward(
+                    m_frameIndexRange.start() +
+                            chunkIndex * CachingReaderChunk::kFrames,
+                    CachingReaderChunk::kFrames),
+            m_frameIndexRange);
+}
+
+CSAMPLE* CachingReaderDiskCache::chunkData(SINT chunkIndex) const {
+    DEBUG_ASSERT(isOpen());
+    return reinterpret_cast<CSAMPLE*>(m_pData + dataOffset(numChunks())) +
+            CachingReaderChunk::frames2samples(
+                    chunkIndex * CachingReaderChunk::kFrames);
+}
+
+quint32* CachingReaderDiskCache::chunkChecksums() const {
+    DEBUG_ASSERT(isOpen());
+    return reinterpret_cast<quint32*>(m_pData + sizeof(FileHeader));
+}
+
+const CSAMPLE* CachingReaderDiskCache::lookupChunk(SINT chunkIndex) const {
+    if (!isOpen() || chunkIndex < 0 || chunkIndex >= numChunks()) {
+        return nullptr;
+    }
+    const quint32 storedChecksum = chunkChecksums()[chunkIndex];
+    if (storedChecksum == kChunkNotStored) {
+        return nullptr;
+    }
+    const CSAMPLE* pSamples = chunkData(chunkIndex);
+    const SINT numSamples = CachingReaderChunk::frames2samples(
+            chunkFrameIndexRange(chunkIndex).length());
+    if (chunkChecksum(pSamples, numSamples) != storedChecksum) {
+        kLogger.warning()
+                << "Discarding corrupt chunk"
+                << chunkIndex
+                << "of cache file"
+                << m_file.fileName();
+        return nullptr;
+    }
+    return pSamples;
+}
+
+void CachingReaderDiskCache::storeChunk(const CachingReaderChunk& chunk) {
+    const SINT chunkIndex = chunk.getIndex();
+    if (!isOpen() || chunkIndex < 0 || chunkIndex >= numChunks()) {
+        return;
+    }
+    const mixxx::IndexRange frameIndexRange = chunkFrameIndexRange(chunkIndex);
+    if (chunk.readBufferedSampleFrames(chunkData(chunkIndex), frameIndexRange) !=
+            frameIndexRange) {
+        return;
+    }
+    // The checksum is computed from the mapped pages and verified when
+    // reading them back. This does not depend on the order in which the
+    // kernel writes the dirty pages back to disk.
+    chunkChecksums()[chunkIndex] = chunkChecksum(chunkData(chunkIndex),
+            CachingReaderChunk::frames2samples(frameIndexRange.length()));
+}
+
+void CachingReaderDiskCache::evict() {
+    const QFileInfoList cacheFiles = QDir(m_directory).entryInfoList(
+            QStringList{QStringLiteral("*") + kFileSuffix},
+            QDir::Files,
+            QDir::Time); // most recently modified first
+    qint64 totalSize = 0;
+    for (const auto& cacheFile : cacheFiles) {
+        totalSize += cacheFile.size();
+    }
+    for (auto it = cacheFiles.crbegin();
+            it != cacheFiles.crend() && totalSize > m_maxSizeBytes;
+            ++it) {
+        if (it->absoluteFilePath() == QFileInfo(m_file).absoluteFilePath()) {
+            continue;
+        }
+        // Deleting a file that is still mapped by another deck is fine on
+        // POSIX systems and fails on Windows, where it is evicted later.
+        if (QFile::remove(it->absoluteFilePath())) {
+            kLogger.debug()
+                    << "Evicted cache file"
+                    << it->fileName();
+            totalSize -= it->size();
+        }
+    }
+}
@@ -0,0 +1,102 @@
+#pragma once
+
+#include <QFile>
+#include <QString>
+#include <memory>
+
+#include "audio/types.h"
+#include "util/class.h"
+#include "util/fileinfo.h"
+#include "util/indexrange.h"
+#include "util/types.h"
+
+class CachingReaderChunk;
+class QLockFile;
+
+// CachingReaderDiskCache keeps the decoded stereo samples of recently played
+// tracks in memory-mapped files on disk. The CachingReaderWorker consults it
+// before decoding a chunk with the SoundSource, so reading a chunk of a
+// previously played track only costs a copy (and possibly a page fault)
+// instead of seeking and decoding a compressed file.
+//
+// There is one cache file per track, keyed by the track location, file size
+// and modification time. The file is sized for the whole track and filled
+// chunk by chunk as the chunks are decoded. The disk space for the whole
+// file is reserved up front, because writing to an unallocated page of a
+// memory-mapped file raises SIGBUS when the disk is full. If reserving fails
+// the cache disables itself. The total size of all cache files in the
+// directory is bounded. Files that have not been opened for the longest time
+// are deleted first.
+//
+// Each stored chunk is guarded by a checksum of its samples, which is
+// verified on lookup. A chunk that has been written only partially, e.g.
+// because Mixxx crashed or the pages were never flushed, is decoded again.
+//
+// The class is not thread-safe. Each CachingReaderWorker owns its own
+// instance, all sharing the same directory. A cache file is locked while it
+// is open, so the same track loaded to a second deck is decoded without the
+// cache instead of truncating a file that is mapped by the other deck.
+class CachingReaderDiskCache {
+  public:
+    // A maxSizeBytes of 0 disables the cache.
+    CachingReaderDiskCache(const QString& directory, qint64 maxSizeBytes);
+    ~CachingReaderDiskCache();
+
+    bool isEnabled() const {
+        return m_maxSizeBytes > 0 && !m_bDisabled;
+    }
+
+    // Opens or creates the cache file for the given audio file. Cached
+    // chunks are only reused if the sample rate and the frame index range
+    // of the decoder match. Evicts old cache files if needed to stay
+    // within the size limit. Fails if the cache file is already open
+    // in another instance.
+    bool open(const mixxx::FileInfo& fileInfo,
+            mixxx::audio::SampleRate sampleRate,
+            const mixxx::IndexRange& frameIndexRange);
+    void close();
+
+    bool isOpen() const {
+        return m_pData != nullptr;
+    }
+
+    // The frame index range of the track passed to open()
+    const mixxx::IndexRange& frameIndexRange() const {
+        return m_frameIndexRange;
+    }
+
+    // Returns the cached samples of the chunk or nullptr if the chunk has
+    // not been stored yet or its checksum does not match.
+    const CSAMPLE* lookupChunk(SINT chunkIndex) const;
+
+    // Stores the samples that have been decoded into the chunk. Chunks that
+    // have only been read partially are not stored.
+    void storeChunk(const CachingReaderChunk& chunk);
+
+    // The name of the cache file for the given audio file. It changes
+    // when the audio file is modified.
+    static QString cacheFileName(const mixxx::FileInfo& fileInfo);
+
+  private:
+    SINT numChunks() const;
+    mixxx::IndexRange chunkFrameIndexRange(SINT chunkIndex) const;
+    CSAMPLE* chunkData(SINT chunkIndex) const;
+    quint32* chunkChecksums() const;
+
+    // Deletes the least recently opened cache files except the one that
+    // is currently open until the total size fits into m_maxSizeBytes.
+    void evict();
+
+    const QString m_directory;
+    const qint64 m_maxSizeBytes;
+
+    // Set when the disk space for a cache file could not be reserved
+    bool m_bDisabled;
+
+    std::unique_ptr<QLockFile> m_pLockFile;
+    QFile m_file;
+    uchar* m_pData;
+    mixxx::IndexRange m_frameIndexRange;
+
+    DISALLOW_COPY_AND_ASSIGN(CachingReaderDiskCache);
+};
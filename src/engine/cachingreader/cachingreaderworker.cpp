@@ -3,6 +3,7 @@
 #include <QAtomicInt>
 #include <QFileInfo>
 #include <QtDebug>
+#include <atomic>
 
 #include "analyzer/analyzersilence.h"
 #include "control/controlobject.h"
@@ -10,9 +11,11 @@
 #include "sources/soundsourceproxy.h"
 #include "track/track.h"
 #include "util/compatibility/qmutex.h"
+#include "util/counter.h"
 #include "util/event.h"
 #include "util/logger.h"
 #include "util/span.h"
+#include "util/stat.h"
 
 namespace {
 
@@ -21,16 +24,68 @@ mixxx::Logger kLogger("CachingReaderWorker");
 // we need the last silence frame and the first sound frame
 constexpr SINT kNumSoundFrameToVerify = 2;
 
+const QString kPreloadedBytesTag = QStringLiteral("CachingReaderWorker: preloaded bytes");
+
+// The memory used by the preloaded tracks of all players
+std::atomic<qint64> s_preloadedBytes(0);
+
+void reportPreloadedBytes(qint64 preloadedBytes) {
+    Stat::track(kPreloadedBytesTag,
+            Stat::UNSPECIFIED,
+            Stat::experimentFlags(Stat::COUNT | Stat::AVERAGE | Stat::MIN | Stat::MAX),
+            static_cast<double>(preloadedBytes));
+}
+
+void trackPreloadedBytes(qint64 deltaBytes) {
+    if (deltaBytes == 0) {
+        return;
+    }
+    reportPreloadedBytes(s_preloadedBytes.fetch_add(deltaBytes) + deltaBytes);
+}
+
+// Adds the bytes to the preloaded memory of all players unless that
+// would exceed the budget
+bool tryReservePreloadedBytes(qint64 bytes, qint64 budgetBytes) {
+    qint64 preloadedBytes = s_preloadedBytes.load();
+    do {
+        if (preloadedBytes + bytes > budgetBytes) {
+            return false;
+        }
+    } while (!s_preloadedBytes.compare_exchange_weak(
+            preloadedBytes, preloadedBytes + bytes));
+    reportPreloadedBytes(preloadedBytes + bytes);
+    return true;
+}
+
+qint64 sizeInBytes(const mixxx::SampleBuffer& buffer) {
+    return static_cast<qint64>(buffer.size()) * sizeof(CSAMPLE);
+}
+
 } // anonymous namespace
 
 CachingReaderWorker::CachingReaderWorker(
         const QString& group,
         FIFO<CachingReaderChunkReadRequest>* pChunkReadRequestFIFO,
-        FIFO<ReaderStatusUpdate>* pReaderStatusFIFO)
+        FIFO<ReaderStatusUpdate>* pReaderStatusFIFO,
+        const QString& diskCacheDirectory,
+        qint64 diskCacheMaxSizeBytes,
+        qint64 preloadBudgetBytes)
         : m_group(group),
           m_tag(QString("CachingReaderWorker %1").arg(m_group)),
           m_pChunkReadRequestFIFO(pChunkReadRequestFIFO),
-          m_pReaderStatusFIFO(pReaderStatusFIFO) {
+          m_pReaderStatusFIFO(pReaderStatusFIFO),
+          m_newTrackPreloadFully(false),
+          m_diskCache(diskCacheDirectory, diskCacheMaxSizeBytes),
+          m_preloadBudgetBytes(preloadBudgetBytes),
+          m_preloadChunkIndex(-1),
+          m_preloadFrameIndexStart(0),
+          m_preloadedSamplesUnloaded(0),
+          m_preloadedSamplesReleased(0) {
+}
+
+CachingReaderWorker::~CachingReaderWorker() {
+    trackPreloadedBytes(-sizeInBytes(m_preloadBuffer) -
+            sizeInBytes(m_unloadedPreloadBuffer));
 }
 
 ReaderStatusUpdate CachingReaderWorker::processReadRequest(
@@ -50,10 +105,32 @@ ReaderStatusUpdate CachingReaderWorker::processReadRequest(
         return result;
     }
 
-    // Try to read the data required for the chunk from the audio source
-    const mixxx::IndexRange bufferedFrameIndexRange = pChunk->bufferSampleFrames(
-            m_pAudioSource,
-            mixxx::SampleBuffer::WritableSlice(m_tempReadBuffer));
+    // Try to read the data required for the chunk from the disk cache
+    // and otherwise decode it from the audio source. The cached chunks
+    // are only valid as long as the readable frame range of the audio
+    // source has not changed.
+    const CSAMPLE* pCachedSamples = nullptr;
+    if (m_diskCache.isOpen() &&
+            m_diskCache.frameIndexRange() == m_pAudioSource->frameIndexRange()) {
+        pCachedSamples = m_diskCache.lookupChunk(pChunk->getIndex());
+    }
+    mixxx::IndexRange bufferedFrameIndexRange;
+    if (pCachedSamples) {
+        bufferedFrameIndexRange = pChunk->bufferSampleFrames(
+                m_pAudioSource,
+                pCachedSamples);
+        Counter("CachingReaderWorker: disk cache hit")++;
+    } else {
+        bufferedFrameIndexRange = pChunk->bufferSampleFrames(
+                m_pAudioSource,
+                mixxx::SampleBuffer::WritableSlice(m_tempReadBuffer));
+        if (m_diskCache.isOpen()) {
+            Counter("CachingReaderWorker: disk cache miss")++;
+            if (bufferedFrameIndexRange == chunkFrameIndexRange) {
+                m_diskCache.storeChunk(*pChunk);
+            }
+        }
+    }
     DEBUG_ASSERT(!m_pAudioSource ||
             bufferedFrameIndexRange.isSubrangeOf(m_pAudioSource->frameIndexRange()));
     // The readable frame range might have changed
@@ -91,15 +168,22 @@ ReaderStatusUpdate CachingReaderWorker::processReadRequest(
 }
 
 // WARNING: Always called from a different thread (GUI)
-void CachingReaderWorker::newTrack(TrackPointer pTrack) {
+void CachingReaderWorker::newTrack(TrackPointer pTrack, bool preloadFully) {
     {
         const auto locker = lockMutex(&m_newTrackMutex);
         m_pNewTrack = pTrack;
+        m_newTrackPreloadFully = preloadFully;
         m_newTrackAvailable.storeRelease(1);
     }
     workReady();
 }
 
+// WARNING: Always called from the engine thread
+void CachingReaderWorker::releasePreloadedSamples() {
+    m_preloadedSamplesReleased.fetchAndAddRelease(1);
+    workReady();
+}
+
 void CachingReaderWorker::run() {
     // the id of this thread, for debugging purposes
     static auto lastId = QAtomicInt(0);
@@ -111,25 +195,46 @@ void CachingReaderWorker::run() {
     while (!m_stop.loadAcquire()) {
         // Request is initialized by reading from FIFO
         CachingReaderChunkReadRequest request;
+        if (m_unloadedPreloadBuffer.size() > 0 &&
+                m_preloadedSamplesReleased.loadAcquire() ==
+                        m_preloadedSamplesUnloaded) {
+            // The engine has stopped reading from the preloaded samples
+            // of the unloaded track
+            trackPreloadedBytes(-sizeInBytes(m_unloadedPreloadBuffer));
+            mixxx::SampleBuffer().swap(m_unloadedPreloadBuffer);
+        }
         if (m_newTrackAvailable.loadAcquire()) {
             TrackPointer pLoadTrack;
+            bool preloadFully;
             { // locking scope
                 const auto locker = lockMutex(&m_newTrackMutex);
                 pLoadTrack = m_pNewTrack;
+                preloadFully = m_newTrackPreloadFully;
                 m_pNewTrack.reset();
                 m_newTrackAvailable.storeRelease(0);
             } // implicitly unlocks the mutex
             if (pLoadTrack) {
                 // in this case the engine is still running with the old track
-                loadTrack(pLoadTrack);
+                loadTrack(pLoadTrack, preloadFully);
             } else {
                 // here, the engine is already stopped
                 unloadTrack();
             }
         } else if (m_pChunkReadRequestFIFO->read(&request, 1) == 1) {
+            traceChunkReadFlow(Stat::FLOW_STEP, request.chunk);
+            if (request.chunk->isReadCancelled()) {
+                // Superseded by more recent hints, return the chunk
+                // without decoding
+                const auto update = ReaderStatusUpdate::readDiscarded(request.chunk);
+                m_pReaderStatusFIFO->writeBlocking(&update, 1);
+                continue;
+            }
             // Read the requested chunk and send the result
             const ReaderStatusUpdate update = processReadRequest(request);
             m_pReaderStatusFIFO->writeBlocking(&update, 1);
+        } else if (isPreloading()) {
+            // Requests of the engine take precedence, one chunk at a time
+            preloadNextChunk();
         } else {
             Event::end(m_tag);
             m_semaRun.acquire();
@@ -149,6 +254,10 @@ void CachingReaderWorker::discardAllPendingRequests() {
 void CachingReaderWorker::closeAudioSource() {
     discardAllPendingRequests();
 
+    cancelPreload();
+
+    m_diskCache.close();
+
     if (m_pAudioSource) {
         // Closes open file handles of the old track.
         m_pAudioSource->close();
@@ -160,27 +269,132 @@ void CachingReaderWorker::closeAudioSource() {
     DEBUG_ASSERT(!m_pChunkReadRequestFIFO->readAvailable());
 }
 
+void CachingReaderWorker::freePreloadedSamples() {
+    trackPreloadedBytes(-sizeInBytes(m_preloadBuffer) -
+            sizeInBytes(m_unloadedPreloadBuffer));
+    mixxx::SampleBuffer().swap(m_preloadBuffer);
+    mixxx::SampleBuffer().swap(m_unloadedPreloadBuffer);
+}
+
+void CachingReaderWorker::writeTrackUnloaded() {
+    const auto update = ReaderStatusUpdate::trackUnloaded();
+    m_pReaderStatusFIFO->writeBlocking(&update, 1);
+}
+
 void CachingReaderWorker::unloadTrack() {
     closeAudioSource();
 
-    const auto update = ReaderStatusUpdate::trackUnloaded();
+    if (m_preloadBuffer.size() == 0) {
+        writeTrackUnloaded();
+        return;
+    }
+
+    // The engine might still be reading from the preloaded samples. They
+    // are freed after the engine has processed this update.
+    DEBUG_ASSERT(m_unloadedPreloadBuffer.size() == 0);
+    m_unloadedPreloadBuffer.swap(m_preloadBuffer);
+    ++m_preloadedSamplesUnloaded;
+    const auto update = ReaderStatusUpdate::trackUnloaded(
+            m_unloadedPreloadBuffer.data());
     m_pReaderStatusFIFO->writeBlocking(&update, 1);
 }
 
-void CachingReaderWorker::loadTrack(const TrackPointer& pTrack) {
+void CachingReaderWorker::startPreload() {
+    DEBUG_ASSERT(!isPreloading());
+    DEBUG_ASSERT(m_preloadBuffer.size() == 0);
+    // The chunks are stored consecutively, starting with the first frame
+    // of the audio source
+    const SINT numChunks =
+            (m_pAudioSource->frameIndexRange().length() +
+                    CachingReaderChunk::kFrames - 1) /
+            CachingReaderChunk::kFrames;
+    const SINT numSamples = numChunks * CachingReaderChunk::kSamples;
+    const qint64 numBytes = static_cast<qint64>(numSamples) * sizeof(CSAMPLE);
+    if (!tryReservePreloadedBytes(numBytes, m_preloadBudgetBytes)) {
+        kLogger.info()
+                << m_group
+                << "Not preloading"
+                << numBytes
+                << "bytes exceeding the budget of"
+                << m_preloadBudgetBytes
+                << "bytes for all players";
+        return;
+    }
+    mixxx::SampleBuffer(numSamples).swap(m_preloadBuffer);
+    m_preloadChunkIndex = 0;
+    m_preloadFrameIndexStart = m_pAudioSource->frameIndexRange().start();
+}
+
+void CachingReaderWorker::preloadNextChunk() {
+    DEBUG_ASSERT(isPreloading());
+    CachingReaderChunkForOwner chunk(
+            mixxx::SampleBuffer::WritableSlice(
+                    m_preloadBuffer,
+                    m_preloadChunkIndex * CachingReaderChunk::kSamples,
+                    CachingReaderChunk::kSamples));
+    chunk.init(m_preloadChunkIndex);
+    CachingReaderChunkReadRequest request;
+    request.giveToWorker(&chunk);
+    const ReaderStatusUpdate update = processReadRequest(request);
+    if (update.status != CHUNK_READ_SUCCESS) {
+        kLogger.warning()
+                << m_group
+                << "Failed to preload chunk"
+                << m_preloadChunkIndex
+                << "- continuing to read chunks on demand";
+        cancelPreload();
+        return;
+    }
+    ++m_preloadChunkIndex;
+    if (m_preloadChunkIndex * CachingReaderChunk::kSamples < m_preloadBuffer.size()) {
+        return;
+    }
+    m_preloadChunkIndex = -1;
+
+    // Decoding errors might have shrunk the readable frame index range
+    const auto readableFrameIndexRange = m_pAudioSource->frameIndexRange();
+    if (kLogger.debugEnabled()) {
+        kLogger.debug()
+                << m_group
+                << "Preloaded"
+                << readableFrameIndexRange.length()
+                << "frames into"
+                << sizeInBytes(m_preloadBuffer)
+                << "bytes";
+    }
+    const auto preloadedUpdate = ReaderStatusUpdate::trackPreloaded(
+            readableFrameIndexRange,
+            m_preloadBuffer.data(CachingReaderChunk::frames2samples(
+                    readableFrameIndexRange.start() - m_preloadFrameIndexStart)));
+    m_pReaderStatusFIFO->writeBlocking(&preloadedUpdate, 1);
+}
+
+void CachingReaderWorker::cancelPreload() {
+    if (!isPreloading()) {
+        return;
+    }
+    m_preloadChunkIndex = -1;
+    trackPreloadedBytes(-sizeInBytes(m_preloadBuffer));
+    mixxx::SampleBuffer().swap(m_preloadBuffer);
+}
+
+void CachingReaderWorker::loadTrack(const TrackPointer& pTrack, bool preloadFully) {
     // This emit is directly connected and returns synchronized
     // after the engine has been stopped.
     emit trackLoading();
 
     closeAudioSource();
 
+    // The engine doesn't read from the previous track until it has
+    // received TRACK_LOADED or TRACK_UNLOADED for this track
+    freePreloadedSamples();
+
     if (!pTrack->getFileInfo().checkFileExists()) {
         kLogger.warning()
                 << m_group
                 << "File not found"
                 << pTrack->getFileInfo();
-        const auto update = ReaderStatusUpdate::trackUnloaded();
-        m_pReaderStatusFIFO->writeBlocking(&update, 1);
+        writeTrackUnloaded();
         emit trackLoadFailed(pTrack,
                 tr("The file '%1' could not be found.")
                         .arg(QDir::toNativeSeparators(pTrack->getLocation())));
@@ -195,8 +409,7 @@ void CachingReaderWorker::loadTrack(const TrackPointer& pTrack) {
                 << m_group
                 << "Failed to open file"
                 << pTrack->getFileInfo();
-        const auto update = ReaderStatusUpdate::trackUnloaded();
-        m_pReaderStatusFIFO->writeBlocking(&update, 1);
+        writeTrackUnloaded();
         emit trackLoadFailed(pTrack,
                 tr("The file '%1' could not be loaded.")
                         .arg(QDir::toNativeSeparators(pTrack->getLocation())));
@@ -212,8 +425,7 @@ void CachingReaderWorker::loadTrack(const TrackPointer& pTrack) {
                 << m_group
                 << "Failed to open empty file"
                 << pTrack->getFileInfo();
-        const auto update = ReaderStatusUpdate::trackUnloaded();
-        m_pReaderStatusFIFO->writeBlocking(&update, 1);
+        writeTrackUnloaded();
         emit trackLoadFailed(pTrack,
                 tr("The file '%1' is empty and could not be loaded.")
                         .arg(QDir::toNativeSeparators(pTrack->getLocation())));
@@ -228,6 +440,10 @@ void CachingReaderWorker::loadTrack(const TrackPointer& pTrack) {
         mixxx::SampleBuffer(tempReadBufferSize).swap(m_tempReadBuffer);
     }
 
+    m_diskCache.open(pTrack->getFileInfo(),
+            m_pAudioSource->getSignalInfo().getSampleRate(),
+            m_pAudioSource->frameIndexRange());
+
     const auto update =
             ReaderStatusUpdate::trackLoaded(
                     m_pAudioSource->frameIndexRange());
@@ -254,6 +470,12 @@ void CachingReaderWorker::loadTrack(const TrackPointer& pTrack) {
             pTrack,
             m_pAudioSource->getSignalInfo().getSampleRate(),
             sampleCount);
+
+    // The track is playable from the chunks read on demand while it is
+    // preloaded in the background
+    if (preloadFully) {
+        startPreload();
+    }
 }
 
 void CachingReaderWorker::quitWait() {
@@ -8,9 +8,11 @@
 
 #include "audio/frame.h"
 #include "engine/cachingreader/cachingreaderchunk.h"
+#include "engine/cachingreader/cachingreaderdiskcache.h"
 #include "engine/engineworker.h"
 #include "sources/audiosource.h"
 #include "track/track_decl.h"
+#include "util/event.h"
 #include "util/fifo.h"
 
 // POD with trivial ctor/dtor/copy for passing through FIFO
@@ -24,8 +26,17 @@ typedef struct CachingReaderChunkReadRequest {
     }
 } CachingReaderChunkReadRequest;
 
+// Links a chunk read request of the engine with its processing by the
+// worker and the returned result in exported traces.
+inline void traceChunkReadFlow(Stat::StatType type, const CachingReaderChunk* pChunk) {
+    static const QString tag = QStringLiteral("CachingReader chunk read");
+    // The worker owns a chunk for only one request at a time
+    Event::flow(tag, type, reinterpret_cast<quintptr>(pChunk));
+}
+
 enum ReaderStatus {
     TRACK_LOADED,
+    TRACK_PRELOADED,
     TRACK_UNLOADED,
     CHUNK_READ_SUCCESS,
     CHUNK_READ_EOF,
@@ -39,6 +50,11 @@ typedef struct ReaderStatusUpdate {
     CachingReaderChunk* chunk;
     SINT readableFrameIndexRangeStart;
     SINT readableFrameIndexRangeEnd;
+    // TRACK_PRELOADED: The decoded samples of the whole readable frame
+    // index range after the track has been preloaded fully.
+    // TRACK_UNLOADED: The samples of the previous track if it has been
+    // preloaded fully. The worker keeps them until they are released.
+    const CSAMPLE* preloadedSamples;
 
   public:
     ReaderStatus status;
@@ -51,6 +67,7 @@ typedef struct ReaderStatusUpdate {
         chunk = chunkArg;
         readableFrameIndexRangeStart = readableFrameIndexRangeArg.start();
         readableFrameIndexRangeEnd = readableFrameIndexRangeArg.end();
+        preloadedSamples = nullptr;
     }
 
     static ReaderStatusUpdate readDiscarded(
@@ -68,9 +85,22 @@ typedef struct ReaderStatusUpdate {
         return update;
     }
 
-    static ReaderStatusUpdate trackUnloaded() {
+    static ReaderStatusUpdate trackPreloaded(
+            const mixxx::IndexRange& readableFrameIndexRange,
+            const CSAMPLE* preloadedSamples) {
+        DEBUG_ASSERT(!readableFrameIndexRange.empty());
+        DEBUG_ASSERT(preloadedSamples);
+        ReaderStatusUpdate update;
+        update.init(TRACK_PRELOADED, nullptr, readableFrameIndexRange);
+        update.preloadedSamples = preloadedSamples;
+        return update;
+    }
+
+    static ReaderStatusUpdate trackUnloaded(
+            const CSAMPLE* preloadedSamples = nullptr) {
         ReaderStatusUpdate update;
         update.init(TRACK_UNLOADED, nullptr, mixxx::IndexRange());
+        update.preloadedSamples = preloadedSamples;
         return update;
     }
 
@@ -90,20 +120,38 @@ typedef struct ReaderStatusUpdate {
                 readableFrameIndexRangeStart,
                 readableFrameIndexRangeEnd);
     }
+
+    const CSAMPLE* getPreloadedSamples() const {
+        return preloadedSamples;
+    }
 } ReaderStatusUpdate;
 
 class CachingReaderWorker : public EngineWorker {
     Q_OBJECT
 
   public:
-    // Construct a CachingReader with the given group.
+    // Construct a CachingReader with the given group. Decoded chunks are
+    // stored in diskCacheDirectory up to a total of diskCacheMaxSizeBytes,
+    // 0 disables the disk cache. Tracks are only preloaded fully as long
+    // as the preloaded tracks of all workers fit into preloadBudgetBytes.
     CachingReaderWorker(const QString& group,
             FIFO<CachingReaderChunkReadRequest>* pChunkReadRequestFIFO,
-            FIFO<ReaderStatusUpdate>* pReaderStatusFIFO);
-    ~CachingReaderWorker() override = default;
+            FIFO<ReaderStatusUpdate>* pReaderStatusFIFO,
+            const QString& diskCacheDirectory = QString(),
+            qint64 diskCacheMaxSizeBytes = 0,
+            qint64 preloadBudgetBytes = 0);
+    ~CachingReaderWorker() override;
 
     // Request to load a new track. wake() must be called afterwards.
-    void newTrack(TrackPointer pTrack);
+    // If preloadFully is set the whole track is decoded into memory in
+    // the background after it has been loaded. Chunks are read on demand
+    // until the TRACK_PRELOADED update has been sent.
+    void newTrack(TrackPointer pTrack, bool preloadFully = false);
+
+    // Called from the engine thread after a TRACK_UNLOADED update with
+    // preloaded samples has been processed. The samples are freed by the
+    // worker thread afterwards.
+    void releasePreloadedSamples();
 
     // Run upkeep operations like loading tracks and reading from file. Run by a
     // thread pool via the EngineWorkerScheduler.
@@ -131,6 +179,7 @@ class CachingReaderWorker : public EngineWorker {
     QMutex m_newTrackMutex;
     QAtomicInt m_newTrackAvailable;
     TrackPointer m_pNewTrack;
+    bool m_newTrackPreloadFully;
 
     void discardAllPendingRequests();
 
@@ -143,7 +192,30 @@ class CachingReaderWorker : public EngineWorker {
     void unloadTrack();
 
     /// Internal method to load a track. Emits trackLoaded when finished.
-    void loadTrack(const TrackPointer& pTrack);
+    void loadTrack(const TrackPointer& pTrack, bool preloadFully);
+
+    /// Allocates m_preloadBuffer for decoding the whole track if it fits
+    /// into the preload budget. The chunks are decoded by preloadNextChunk()
+    /// in between the read requests of the engine.
+    void startPreload();
+
+    bool isPreloading() const {
+        return m_preloadChunkIndex >= 0;
+    }
+
+    /// Decodes the next chunk into m_preloadBuffer and sends the
+    /// TRACK_PRELOADED update after the last one.
+    void preloadNextChunk();
+
+    /// Frees m_preloadBuffer if the track has not been preloaded
+    /// completely. The engine has not seen these samples.
+    void cancelPreload();
+
+    /// Frees the preloaded samples of the current and the previous track.
+    /// Make sure engine has been stopped before
+    void freePreloadedSamples();
+
+    void writeTrackUnloaded();
 
     ReaderStatusUpdate processReadRequest(
             const CachingReaderChunkReadRequest& request);
@@ -159,5 +231,25 @@ class CachingReaderWorker : public EngineWorker {
     // before conversion to a stereo signal.
     mixxx::SampleBuffer m_tempReadBuffer;
 
+    // Decoded chunks of previously played tracks
+    CachingReaderDiskCache m_diskCache;
+
+    const qint64 m_preloadBudgetBytes;
+    // The next chunk to decode into m_preloadBuffer or -1 if the track
+    // is not being preloaded
+    SINT m_preloadChunkIndex;
+    // The first frame of the audio source when preloading started
+    SINT m_preloadFrameIndexStart;
+
+    // The decoded samples of the current track while and after it has
+    // been preloaded fully. After unloading the track they are moved to
+    // m_unloadedPreloadBuffer until the engine has released them.
+    mixxx::SampleBuffer m_preloadBuffer;
+    mixxx::SampleBuffer m_unloadedPreloadBuffer;
+    // The number of TRACK_UNLOADED updates with preloaded samples that
+    // have been sent and released.
+    int m_preloadedSamplesUnloaded;
+    QAtomicInt m_preloadedSamplesReleased;
+
     QAtomicInt m_stop;
 };
@@ -60,15 +60,19 @@ void ChannelMixer::applyEffectsInPlaceAndMixChannels(
         const ChannelHandle& outputHandle,
         unsigned int iBufferSize,
         unsigned int iSampleRate,
-        EngineEffectsManager* pEngineEffectsManager) {
+        EngineEffectsManager* pEngineEffectsManager,
+        EngineRealtimeWorkerPool* pWorkerPool) {
     // Signal flow overview:
     // 1. Calculate gains for each channel
     // 2. Pass each channel's calculated gain and input buffer to pEngineEffectsManager, which then:
     //    A) Applies the calculated gain to the channel buffer, modifying the original input buffer
     //    B) Applies effects to the buffer, modifying the original input buffer
-    // 4. Mix the channel buffers together to make pOutput, overwriting the pOutput buffer from the last engine callback
+    //    The channels may be processed concurrently on pWorkerPool.
+    // 3. Mix the channel buffers together to make pOutput, overwriting the pOutput buffer from the last engine callback
     ScopedTimer t("EngineMaster::applyEffectsInPlaceAndMixChannels");
-    SampleUtil::clear(pOutput, iBufferSize);
+    QVarLengthArray<EngineEffectsManager::PostFaderChannel, kPreallocatedChannels> postFaderChannels;
+    QVarLengthArray<const CSAMPLE*, kPreallocatedChannels> channelBuffers;
+    QVarLengthArray<SampleUtil::ConstantGain, kPreallocatedChannels> unityGains;
     for (auto* pChannelInfo : activeChannels) {
         EngineMaster::GainCache& gainCache = (*channelGainCache)[pChannelInfo->m_index];
         CSAMPLE_GAIN oldGain = gainCache.m_gain;
@@ -83,15 +87,27 @@ void ChannelMixer::applyEffectsInPlaceAndMixChannels(
             newGain = gainCalculator.getGain(pChannelInfo);
         }
         gainCache.m_gain = newGain;
-        pEngineEffectsManager->processPostFaderInPlace(pChannelInfo->m_handle,
-                outputHandle,
+        postFaderChannels.append(EngineEffectsManager::PostFaderChannel{
+                pChannelInfo->m_handle,
                 pChannelInfo->m_pBuffer,
-                iBufferSize,
-                iSampleRate,
-                pChannelInfo->m_features,
+                &pChannelInfo->m_features,
                 oldGain,
                 newGain,
-                fadeout);
-        SampleUtil::add(pOutput, pChannelInfo->m_pBuffer, iBufferSize);
+                fadeout});
+        channelBuffers.append(pChannelInfo->m_pBuffer);
+        unityGains.append(SampleUtil::ConstantGain{CSAMPLE_GAIN_ONE});
     }
+    pEngineEffectsManager->processPostFaderInPlace(postFaderChannels.constData(),
+            postFaderChannels.size(),
+            outputHandle,
+            iBufferSize,
+            iSampleRate,
+            pWorkerPool);
+    // Sum all channels in a single pass over pOutput. This also clears
+    // pOutput if there are no active channels.
+    SampleUtil::copyWithGains(pOutput,
+            channelBuffers.constData(),
+            unityGains.constData(),
+            channelBuffers.size(),
+            iBufferSize);
 }
@@ -6,6 +6,8 @@
 #include "engine/enginemaster.h"
 #include "effects/engineeffectsmanager.h"
 
+class EngineRealtimeWorkerPool;
+
 class ChannelMixer {
   public:
     // This does not modify the input channel buffers. All manipulation of the input
@@ -23,6 +25,8 @@ class ChannelMixer {
             unsigned int iSampleRate,
             EngineEffectsManager* pEngineEffectsManager);
     // This does modify the input channel buffers, then mixes them to make the output buffer.
+    // The effects of the channels are processed concurrently on pWorkerPool
+    // if it is set and they don't share an effect chain.
     static void applyEffectsInPlaceAndMixChannels(
             const EngineMaster::GainCalculator& gainCalculator,
             const QVarLengthArray<EngineMaster::ChannelInfo*,
@@ -33,5 +37,6 @@ class ChannelMixer {
             const ChannelHandle& outputHandle,
             unsigned int iBufferSize,
             unsigned int iSampleRate,
-            EngineEffectsManager* pEngineEffectsManager);
+            EngineEffectsManager* pEngineEffectsManager,
+            EngineRealtimeWorkerPool* pWorkerPool = nullptr);
 };
@@ -48,7 +48,8 @@ constexpr double kPastBeatMatchThreshold = 1 / 8.0;
 } // namespace
 
 BpmControl::BpmControl(const QString& group,
-        UserSettingsPointer pConfig)
+        UserSettingsPointer pConfig,
+        ControlSnapshot* pControlSnapshot)
         : EngineControl(group, pConfig),
           m_tapFilter(this, kBpmTapFilterLength, kBpmTapMaxInterval),
           m_dSyncInstantaneousBpm(0.0),
@@ -64,6 +65,11 @@ BpmControl::BpmControl(const QString& group,
 
     m_pQuantize = ControlObject::getControl(group, "quantize");
 
+    m_pQuantizeInput = std::make_unique<SnapshotControlProxy>(
+            pControlSnapshot, m_pQuantize->getKey());
+    m_pReverseInput = std::make_unique<SnapshotControlProxy>(
+            pControlSnapshot, m_pReverseButton->getKey());
+
     m_pPrevBeat.reset(new ControlProxy(group, "beat_prev"));
     m_pNextBeat.reset(new ControlProxy(group, "beat_next"));
 
@@ -311,7 +317,7 @@ double BpmControl::calcSyncedRate(double userTweak) {
 
     // If we are not quantized, or there are no beats, or we're leader,
     // or we're in reverse, just return the rate as-is.
-    if (!m_pQuantize->toBool() || !m_pBeats || m_pReverseButton->toBool()) {
+    if (!m_pQuantizeInput->toBool() || !m_pBeats || m_pReverseInput->toBool()) {
         m_resetSyncAdjustment = true;
         return rate + userTweak;
     }
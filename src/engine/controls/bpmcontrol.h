@@ -2,8 +2,11 @@
 
 #include <gtest/gtest_prod.h>
 
+#include <memory>
+
 #include "control/controlobject.h"
 #include "control/controlproxy.h"
+#include "control/controlsnapshot.h"
 #include "engine/controls/enginecontrol.h"
 #include "engine/sync/syncable.h"
 #include "track/beats.h"
@@ -22,7 +25,11 @@ class BpmControl : public EngineControl {
     Q_OBJECT
 
   public:
-    BpmControl(const QString& group, UserSettingsPointer pConfig);
+    /// The input controls that are read on every callback are registered in
+    /// pControlSnapshot, if provided.
+    BpmControl(const QString& group,
+            UserSettingsPointer pConfig,
+            ControlSnapshot* pControlSnapshot = nullptr);
     ~BpmControl() override;
 
     mixxx::Bpm getBpm() const;
@@ -128,6 +135,9 @@ class BpmControl : public EngineControl {
     ControlProxy* m_pReverseButton;
     ControlProxy* m_pRateRatio;
     ControlObject* m_pQuantize;
+    // Read by calcSyncedRate() on every callback
+    std::unique_ptr<SnapshotControlProxy> m_pQuantizeInput;
+    std::unique_ptr<SnapshotControlProxy> m_pReverseInput;
 
     // ControlObjects that come from QuantizeControl
     QScopedPointer<ControlProxy> m_pNextBeat;
@@ -90,7 +90,8 @@ void appendCueHint(gsl::not_null<HintVector*> pHintList, const double playPos, H
 } // namespace
 
 CueControl::CueControl(const QString& group,
-        UserSettingsPointer pConfig)
+        UserSettingsPointer pConfig,
+        ControlSnapshot* pControlSnapshot)
         : EngineControl(group, pConfig),
           m_pConfig(pConfig),
           m_colorPaletteSettings(ColorPaletteSettings(pConfig)),
@@ -125,6 +126,8 @@ CueControl::CueControl(const QString& group,
     m_pCuePoint->set(Cue::kNoPosition);
 
     m_pCueMode = new ControlObject(ConfigKey(group, "cue_mode"));
+    m_pCueModeInput = std::make_unique<SnapshotControlProxy>(
+            pControlSnapshot, m_pCueMode->getKey());
 
     m_pPassthrough = make_parented<ControlProxy>(group, "passthrough", this);
     m_pPassthrough->connectValueChanged(this,
@@ -2105,7 +2108,7 @@ bool CueControl::updateIndicatorsAndModifyPlay(
 // called from the engine thread
 void CueControl::updateIndicators() {
     // No need for mutex lock because we are only touching COs.
-    double cueMode = m_pCueMode->get();
+    double cueMode = m_pCueModeInput->get();
     TrackAt trackAt = getTrackAt();
 
     if (cueMode == CUE_MODE_DENON || cueMode == CUE_MODE_NUMARK) {
@@ -5,8 +5,10 @@
 #include <QAtomicInt>
 #include <QAtomicPointer>
 #include <QList>
+#include <memory>
 
 #include "control/controlproxy.h"
+#include "control/controlsnapshot.h"
 #include "engine/controls/enginecontrol.h"
 #include "preferences/colorpalettesettings.h"
 #include "preferences/usersettings.h"
@@ -190,8 +192,11 @@ class HotcueControl : public QObject {
 class CueControl : public EngineControl {
     Q_OBJECT
   public:
+    /// The input controls that are read on every callback are registered in
+    /// pControlSnapshot, if provided.
     CueControl(const QString& group,
-            UserSettingsPointer pConfig);
+            UserSettingsPointer pConfig,
+            ControlSnapshot* pControlSnapshot = nullptr);
     ~CueControl() override;
 
     void hintReader(gsl::not_null<HintVector*> pHintList) override;
@@ -309,6 +314,8 @@ class CueControl : public EngineControl {
     ControlObject* m_pTrackSamples;
     ControlObject* m_pCuePoint;
     ControlObject* m_pCueMode;
+    // Read by updateIndicators() on every callback
+    std::unique_ptr<SnapshotControlProxy> m_pCueModeInput;
     ControlPushButton* m_pCueSet;
     ControlPushButton* m_pCueClear;
     ControlPushButton* m_pCueCDJ;
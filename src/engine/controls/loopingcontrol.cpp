@@ -45,7 +45,8 @@ QList<double> LoopingControl::getBeatSizes() {
 }
 
 LoopingControl::LoopingControl(const QString& group,
-        UserSettingsPointer pConfig)
+        UserSettingsPointer pConfig,
+        ControlSnapshot* pControlSnapshot)
         : EngineControl(group, pConfig),
           m_bLoopingEnabled(false),
           m_bLoopRollActive(false),
@@ -124,6 +125,8 @@ LoopingControl::LoopingControl(const QString& group,
             Qt::DirectConnection);
 
     m_pQuantizeEnabled = ControlObject::getControl(ConfigKey(group, "quantize"));
+    m_pQuantizeInput = std::make_unique<SnapshotControlProxy>(
+            pControlSnapshot, ConfigKey(group, "quantize"));
     m_pNextBeat = ControlObject::getControl(ConfigKey(group, "beat_next"));
     m_pPreviousBeat = ControlObject::getControl(ConfigKey(group, "beat_prev"));
     m_pClosestBeat = ControlObject::getControl(ConfigKey(group, "beat_closest"));
@@ -410,7 +413,7 @@ mixxx::audio::FramePos LoopingControl::nextTrigger(bool reverse,
         // When the LoopIn button is released in reverse mode we jump to the end of the loop to not fall out and disable the active loop
         // This must not happen in quantized mode. The newly set start is always ahead (in time, but behind spacially) of the current position so we don't jump.
         // Jumping to the end is then handled when the loop's start is reached later in this function.
-        if (reverse && !m_bAdjustingLoopIn && !m_pQuantizeEnabled->toBool()) {
+        if (reverse && !m_bAdjustingLoopIn && !m_pQuantizeInput->toBool()) {
             m_oldLoopInfo = loopInfo;
             *pTargetPosition = loopInfo.endPosition;
             return currentPosition;
@@ -424,7 +427,7 @@ mixxx::audio::FramePos LoopingControl::nextTrigger(bool reverse,
         // When the LoopOut button is released in forward mode we jump to the start of the loop to not fall out and disable the active loop
         // This must not happen in quantized mode. The newly set end is always ahead of the current position so we don't jump.
         // Jumping to the start is then handled when the loop's end is reached later in this function.
-        if (!reverse && !m_bAdjustingLoopOut && !m_pQuantizeEnabled->toBool()) {
+        if (!reverse && !m_bAdjustingLoopOut && !m_pQuantizeInput->toBool()) {
             m_oldLoopInfo = loopInfo;
             *pTargetPosition = loopInfo.startPosition;
             return currentPosition;
@@ -2,7 +2,9 @@
 
 #include <QObject>
 #include <QStack>
+#include <memory>
 
+#include "control/controlsnapshot.h"
 #include "control/controlvalue.h"
 #include "engine/controls/enginecontrol.h"
 #include "engine/controls/ratecontrol.h"
@@ -23,7 +25,11 @@ class LoopingControl : public EngineControl {
   public:
     static QList<double> getBeatSizes();
 
-    LoopingControl(const QString& group, UserSettingsPointer pConfig);
+    /// The input controls that are read on every callback are registered in
+    /// pControlSnapshot, if provided.
+    LoopingControl(const QString& group,
+            UserSettingsPointer pConfig,
+            ControlSnapshot* pControlSnapshot = nullptr);
     ~LoopingControl() override;
 
     // process() updates the internal state of the LoopingControl to reflect the
@@ -172,6 +178,8 @@ class LoopingControl : public EngineControl {
     LoopInfo m_oldLoopInfo;
     ControlValueAtomic<mixxx::audio::FramePos> m_currentPosition;
     ControlObject* m_pQuantizeEnabled;
+    // Read by nextTrigger() on every callback
+    std::unique_ptr<SnapshotControlProxy> m_pQuantizeInput;
     ControlObject* m_pNextBeat;
     ControlObject* m_pPreviousBeat;
     ControlObject* m_pClosestBeat;
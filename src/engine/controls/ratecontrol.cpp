@@ -31,7 +31,8 @@ const double RateControl::kWheelMultiplier = 40.0;
 const double RateControl::kPausedJogMultiplier = 18.0;
 
 RateControl::RateControl(const QString& group,
-        UserSettingsPointer pConfig)
+        UserSettingsPointer pConfig,
+        ControlSnapshot* pControlSnapshot)
         : EngineControl(group, pConfig),
           m_pBpmControl(nullptr),
           m_bTempStarted(false),
@@ -172,6 +173,27 @@ RateControl::RateControl(const QString& group,
 //             getConfig()->getValueString(ConfigKey("[Controls]","RateRampSensitivity")).toInt();
 
     m_pSyncMode = new ControlProxy(group, "sync_mode", this);
+
+    m_pRateSearchInput = std::make_unique<SnapshotControlProxy>(
+            pControlSnapshot, m_pRateSearch->getKey());
+    m_pReverseInput = std::make_unique<SnapshotControlProxy>(
+            pControlSnapshot, m_pReverseButton->getKey());
+    m_pWheelInput = std::make_unique<SnapshotControlProxy>(
+            pControlSnapshot, m_pWheel->getKey());
+    m_pScratch2Input = std::make_unique<SnapshotControlProxy>(
+            pControlSnapshot, m_pScratch2->getKey());
+    m_pScratch2EnableInput = std::make_unique<SnapshotControlProxy>(
+            pControlSnapshot, m_pScratch2Enable->getKey());
+    m_pScratch2ScratchingInput = std::make_unique<SnapshotControlProxy>(
+            pControlSnapshot, m_pScratch2Scratching->getKey());
+    m_pRateTempDownInput = std::make_unique<SnapshotControlProxy>(
+            pControlSnapshot, m_pButtonRateTempDown->getKey());
+    m_pRateTempDownSmallInput = std::make_unique<SnapshotControlProxy>(
+            pControlSnapshot, m_pButtonRateTempDownSmall->getKey());
+    m_pRateTempUpInput = std::make_unique<SnapshotControlProxy>(
+            pControlSnapshot, m_pButtonRateTempUp->getKey());
+    m_pRateTempUpSmallInput = std::make_unique<SnapshotControlProxy>(
+            pControlSnapshot, m_pButtonRateTempUpSmall->getKey());
 }
 
 RateControl::~RateControl() {
@@ -359,7 +381,7 @@ void RateControl::slotControlRatePermUpSmall(double v) {
 }
 
 double RateControl::getWheelFactor() const {
-    return m_pWheel->get();
+    return m_pWheelInput->get();
 }
 
 double RateControl::getJogFactor() const {
@@ -396,7 +418,7 @@ double RateControl::calculateSpeed(double baserate, double speed, bool paused,
     processTempRate(iSamplesPerBuffer);
 
     double rate;
-    const double searching = m_pRateSearch->get();
+    const double searching = m_pRateSearchInput->get();
     if (searching != 0) {
         // If searching is in progress, it overrides everything else
         rate = searching;
@@ -404,13 +426,13 @@ double RateControl::calculateSpeed(double baserate, double speed, bool paused,
         double wheelFactor = getWheelFactor();
         double jogFactor = getJogFactor();
         bool bVinylControlEnabled = m_pVCEnabled && m_pVCEnabled->toBool();
-        bool useScratch2Value = m_pScratch2Enable->toBool();
+        bool useScratch2Value = m_pScratch2EnableInput->toBool();
 
         // By default scratch2_enable is enough to determine if the user is
         // scratching or not. Moving platter controllers have to disable
         // "scratch2_indicates_scratching" if they are not scratching,
         // to allow things like key-lock.
-        if (useScratch2Value && m_pScratch2Scratching->toBool()) {
+        if (useScratch2Value && m_pScratch2ScratchingInput->toBool()) {
             *pReportScratching = true;
         }
 
@@ -420,7 +442,7 @@ double RateControl::calculateSpeed(double baserate, double speed, bool paused,
             }
             rate = speed;
         } else {
-            double scratchFactor = m_pScratch2->get();
+            double scratchFactor = m_pScratch2Input->get();
             // Don't trust values from m_pScratch2
             if (util_isnan(scratchFactor)) {
                 scratchFactor = 0.0;
@@ -481,7 +503,7 @@ double RateControl::calculateSpeed(double baserate, double speed, bool paused,
             int vcmode = m_pVCMode ? static_cast<int>(m_pVCMode->get()) : MIXXX_VCMODE_ABSOLUTE;
             // TODO(owen): Instead of just ignoring reverse mode, should we
             // disable absolute mode instead?
-            if (m_pReverseButton->toBool() && !m_pScratch2Enable->toBool() &&
+            if (m_pReverseInput->toBool() && !useScratch2Value &&
                     (!bVinylControlEnabled ||
                             vcmode != MIXXX_VCMODE_ABSOLUTE)) {
                 rate = -rate;
@@ -498,13 +520,13 @@ void RateControl::processTempRate(const int bufferSamples) {
     // and pitch shift stepping, which is the old behavior.
 
     RampDirection rampDirection = RampDirection::None;
-    if (m_pButtonRateTempUp->toBool()) {
+    if (m_pRateTempUpInput->toBool()) {
         rampDirection = RampDirection::Up;
-    } else if (m_pButtonRateTempDown->toBool()) {
+    } else if (m_pRateTempDownInput->toBool()) {
         rampDirection = RampDirection::Down;
-    } else if (m_pButtonRateTempUpSmall->toBool()) {
+    } else if (m_pRateTempUpSmallInput->toBool()) {
         rampDirection = RampDirection::UpSmall;
-    } else if (m_pButtonRateTempDownSmall->toBool()) {
+    } else if (m_pRateTempDownSmallInput->toBool()) {
         rampDirection = RampDirection::DownSmall;
     }
 
@@ -1,7 +1,9 @@
 #pragma once
 
 #include <QObject>
+#include <memory>
 
+#include "control/controlsnapshot.h"
 #include "preferences/usersettings.h"
 #include "engine/controls/enginecontrol.h"
 #include "engine/sync/syncable.h"
@@ -22,7 +24,12 @@ class PositionScratchController;
 class RateControl : public EngineControl {
     Q_OBJECT
 public:
-  RateControl(const QString& group, UserSettingsPointer pConfig);
+  /// The input controls that are read on every callback are registered in
+  /// pControlSnapshot, if provided. The owner must publish it before calling
+  /// calculateSpeed().
+  RateControl(const QString& group,
+          UserSettingsPointer pConfig,
+          ControlSnapshot* pControlSnapshot = nullptr);
   ~RateControl() override;
 
   // Enumerations which hold the state of the pitchbend buttons.
@@ -142,6 +149,19 @@ private:
 
   ControlObject* m_pSampleRate;
 
+  // Snapshots of the user input controls above that are read by
+  // calculateSpeed() on every callback
+  std::unique_ptr<SnapshotControlProxy> m_pRateSearchInput;
+  std::unique_ptr<SnapshotControlProxy> m_pReverseInput;
+  std::unique_ptr<SnapshotControlProxy> m_pWheelInput;
+  std::unique_ptr<SnapshotControlProxy> m_pScratch2Input;
+  std::unique_ptr<SnapshotControlProxy> m_pScratch2EnableInput;
+  std::unique_ptr<SnapshotControlProxy> m_pScratch2ScratchingInput;
+  std::unique_ptr<SnapshotControlProxy> m_pRateTempDownInput;
+  std::unique_ptr<SnapshotControlProxy> m_pRateTempDownSmallInput;
+  std::unique_ptr<SnapshotControlProxy> m_pRateTempUpInput;
+  std::unique_ptr<SnapshotControlProxy> m_pRateTempUpSmallInput;
+
   // For Sync Lock
   BpmControl* m_pBpmControl;
 
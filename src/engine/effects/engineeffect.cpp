@@ -1,6 +1,7 @@
 #include "engine/effects/engineeffect.h"
 
 #include "engine/engine.h"
+#include "util/counter.h"
 #include "util/defs.h"
 #include "util/sample.h"
 
@@ -9,6 +10,12 @@ namespace {
 // Used during initialization where the SoundSevice is not set up
 constexpr auto kInitalSampleRate = mixxx::audio::SampleRate(96000);
 
+const QString kProcessedBuffersTag = QStringLiteral("EngineEffect: processed buffers");
+const QString kSkippedBuffersTag = QStringLiteral("EngineEffect: skipped buffers");
+
+// The counters are reported to the StatsManager in batches of buffers
+constexpr int kStatsReportBuffers = 1024;
+
 } // namespace
 
 EngineEffect::EngineEffect(EffectManifestPointer pManifest,
@@ -18,6 +25,9 @@ EngineEffect::EngineEffect(EffectManifestPointer pManifest,
         const QSet<ChannelHandleAndGroup>& registeredOutputChannels)
         : m_pManifest(pManifest),
           m_pProcessor(pBackendManager->createProcessor(pManifest)),
+          m_parameterRevision(0),
+          m_processedBuffers(0),
+          m_skippedBuffers(0),
           m_parameters(pManifest->parameters().size()) {
     const QList<EffectManifestParameterPointer>& parameters = m_pManifest->parameters();
     for (int i = 0; i < parameters.size(); ++i) {
@@ -33,6 +43,13 @@ EngineEffect::EngineEffect(EffectManifestPointer pManifest,
             outputChannelMap.insert(outputChannel.handle(), EffectEnableState::Disabled);
         }
         m_effectEnableStateForChannelMatrix.insert(inputChannel.handle(), outputChannelMap);
+
+        ChannelHandleMap<quint32> outputRevisionMap;
+        for (const ChannelHandleAndGroup& outputChannel : registeredOutputChannels) {
+            outputRevisionMap.insert(outputChannel.handle(), m_parameterRevision);
+        }
+        m_processedParameterRevisionForChannelMatrix.insert(
+                inputChannel.handle(), outputRevisionMap);
     }
 
     m_pProcessor->loadEngineEffectParameters(m_parametersById);
@@ -109,6 +126,7 @@ bool EngineEffect::processEffectsRequest(EffectsRequest& message,
                 message.SetParameterParameters.iParameter, EngineEffectParameterPointer());
         if (pParameter) {
             pParameter->setValue(message.value);
+            ++m_parameterRevision;
             response.success = true;
         } else {
             response.success = false;
@@ -122,6 +140,45 @@ bool EngineEffect::processEffectsRequest(EffectsRequest& message,
     return false;
 }
 
+bool EngineEffect::isEnableStateChanging(const ChannelHandle& inputHandle,
+        const ChannelHandle& outputHandle) const {
+    const EffectEnableState enableState =
+            m_effectEnableStateForChannelMatrix.at(inputHandle).at(outputHandle);
+    return enableState == EffectEnableState::Enabling ||
+            enableState == EffectEnableState::Disabling;
+}
+
+bool EngineEffect::isParameterChanging(const ChannelHandle& inputHandle,
+        const ChannelHandle& outputHandle) const {
+    return m_processedParameterRevisionForChannelMatrix.at(inputHandle).at(outputHandle) !=
+            m_parameterRevision;
+}
+
+bool EngineEffect::isIdle(const ChannelHandle& inputHandle,
+        const ChannelHandle& outputHandle) const {
+    switch (m_effectEnableStateForChannelMatrix.at(inputHandle).at(outputHandle)) {
+    case EffectEnableState::Disabled:
+        return true;
+    case EffectEnableState::Enabled:
+        return !isParameterChanging(inputHandle, outputHandle) &&
+                m_pProcessor->isIdle(inputHandle, outputHandle);
+    default:
+        // Fading in or out must not be skipped
+        return false;
+    }
+}
+
+void EngineEffect::skipProcessing() {
+    countBuffer(&m_skippedBuffers, kSkippedBuffersTag);
+}
+
+void EngineEffect::countBuffer(std::atomic<qint64>* pCounter, const QString& tag) {
+    // The effect may be processed for several channels concurrently
+    if ((pCounter->fetch_add(1, std::memory_order_relaxed) + 1) % kStatsReportBuffers == 0) {
+        Counter(tag) += kStatsReportBuffers;
+    }
+}
+
 bool EngineEffect::process(const ChannelHandle& inputHandle,
         const ChannelHandle& outputHandle,
         const CSAMPLE* pInput,
@@ -175,7 +232,14 @@ bool EngineEffect::process(const ChannelHandle& inputHandle,
 
     bool processingOccured = false;
 
-    if (effectiveEffectEnableState != EffectEnableState::Disabled) {
+    if (effectiveEffectEnableState == EffectEnableState::Enabled &&
+            isIdle(inputHandle, outputHandle) &&
+            SampleUtil::isSilent(pInput, numSamples)) {
+        // The tail of the effect has decayed, so it would only produce silence
+        SampleUtil::clear(pOutput, numSamples);
+        skipProcessing();
+        processingOccured = true;
+    } else if (effectiveEffectEnableState != EffectEnableState::Disabled) {
         //TODO: refactor rest of audio engine to use mixxx::AudioParameters
         const mixxx::EngineParameters engineParameters(
                 mixxx::audio::SampleRate(sampleRate),
@@ -190,6 +254,9 @@ bool EngineEffect::process(const ChannelHandle& inputHandle,
                 groupFeatures);
 
         processingOccured = true;
+        m_processedParameterRevisionForChannelMatrix[inputHandle][outputHandle] =
+                m_parameterRevision;
+        countBuffer(&m_processedBuffers, kProcessedBuffersTag);
 
         if (!m_effectRampsFromDry) {
             // the effect does not fade, so we care for it
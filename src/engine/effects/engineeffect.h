@@ -6,6 +6,7 @@
 #include <QString>
 #include <QVector>
 #include <QtDebug>
+#include <atomic>
 
 #include "effects/backends/effectmanifest.h"
 #include "effects/backends/effectprocessor.h"
@@ -50,6 +51,36 @@ class EngineEffect final : public EffectsRequestHandler {
             const EffectEnableState chainEnableState,
             const GroupFeatureState& groupFeatures);
 
+    /// Called in audio thread. Returns true if the next call of process()
+    /// fades the effect in or out for the given channels.
+    bool isEnableStateChanging(const ChannelHandle& inputHandle,
+            const ChannelHandle& outputHandle) const;
+
+    /// Called in audio thread. Returns true if a parameter has changed since
+    /// the effect was last processed for the given channels, so the next
+    /// call of process() ramps to the new value.
+    bool isParameterChanging(const ChannelHandle& inputHandle,
+            const ChannelHandle& outputHandle) const;
+
+    /// Called in audio thread. Returns true if the effect is disabled or only
+    /// produces silence from silent input for the given channels. process()
+    /// skips the EffectProcessor for silent input in that case.
+    bool isIdle(const ChannelHandle& inputHandle,
+            const ChannelHandle& outputHandle) const;
+
+    /// Called in audio thread instead of process() if the EngineEffectChain
+    /// does not need the output of the effect.
+    void skipProcessing();
+
+    /// The number of buffers the EffectProcessor has processed
+    qint64 processedBuffers() const {
+        return m_processedBuffers.load(std::memory_order_relaxed);
+    }
+    /// The number of buffers that have been skipped while the effect was enabled
+    qint64 skippedBuffers() const {
+        return m_skippedBuffers.load(std::memory_order_relaxed);
+    }
+
     const EffectManifestPointer getManifest() const {
         return m_pManifest;
     }
@@ -67,9 +98,17 @@ class EngineEffect final : public EffectsRequestHandler {
         return QString("EngineEffect(%1)").arg(m_pManifest->name());
     }
 
+    void countBuffer(std::atomic<qint64>* pCounter, const QString& tag);
+
     EffectManifestPointer m_pManifest;
     std::unique_ptr<EffectProcessor> m_pProcessor;
     ChannelHandleMap<ChannelHandleMap<EffectEnableState>> m_effectEnableStateForChannelMatrix;
+    // Incremented on every parameter change. An idle effect is only skipped
+    // if it has been processed after the last change.
+    quint32 m_parameterRevision;
+    ChannelHandleMap<ChannelHandleMap<quint32>> m_processedParameterRevisionForChannelMatrix;
+    std::atomic<qint64> m_processedBuffers;
+    std::atomic<qint64> m_skippedBuffers;
     bool m_effectRampsFromDry;
     // Must not be modified after construction.
     QVector<EngineEffectParameterPointer> m_parameters;
@@ -1,18 +1,25 @@
 #include "engine/effects/engineeffectchain.h"
 
 #include "engine/effects/engineeffect.h"
+#include "engine/engine.h"
+#include "util/audiocallbackprofiler.h"
 #include "util/defs.h"
+#include "util/math.h"
 #include "util/sample.h"
 
 EngineEffectChain::EngineEffectChain(const QString& group,
         const QSet<ChannelHandleAndGroup>& registeredInputChannels,
-        const QSet<ChannelHandleAndGroup>& registeredOutputChannels)
+        const QSet<ChannelHandleAndGroup>& registeredOutputChannels,
+        SINT blockFrames)
         : m_group(group),
           m_enableState(EffectEnableState::Enabled),
           m_mixMode(EffectChainMixMode::DrySlashWet),
           m_dMix(0),
           m_buffer1(MAX_BUFFER_LEN),
-          m_buffer2(MAX_BUFFER_LEN) {
+          m_buffer2(MAX_BUFFER_LEN),
+          m_profilerStageId(AudioCallbackProfiler::registerStage(
+                  QStringLiteral("Effects %1").arg(group))),
+          m_blockSamples(math_max(blockFrames, SINT(0)) * mixxx::kEngineChannelCount) {
     // Try to prevent memory allocation.
     m_effects.reserve(256);
 
@@ -208,100 +215,72 @@ bool EngineEffectChain::process(const ChannelHandle& inputHandle,
 
     CSAMPLE currentMixKnob = m_dMix;
     CSAMPLE lastCallbackMixKnob = channelStatus.oldMixKnob;
-
-    bool processingOccured = false;
-    if (effectiveChainEnableState != EffectEnableState::Disabled) {
-        // Ramping code inside the effects need to access the original samples
-        // after writing to the output buffer. This requires not to use the same buffer
-        // for in and output: Also, ChannelMixer::applyEffectsAndMixChannels
-        // requires that the input buffer does not get modified.
-        CSAMPLE* pIntermediateInput = pIn;
-        CSAMPLE* pIntermediateOutput;
-        SINT effectChainGroupDelayFrames = 0;
-        bool firstAddDryToWetEffectProcessed = false;
-
-        for (EngineEffect* pEffect : qAsConst(m_effects)) {
-            if (pEffect != nullptr) {
-                // Select an unused intermediate buffer for the next output
-                if (pIntermediateInput == m_buffer1.data()) {
-                    pIntermediateOutput = m_buffer2.data();
-                } else {
-                    pIntermediateOutput = m_buffer1.data();
-                }
-
-                if (pEffect->process(inputHandle,
-                            outputHandle,
-                            pIntermediateInput,
-                            pIntermediateOutput,
-                            numSamples,
-                            sampleRate,
-                            effectiveChainEnableState,
-                            groupFeatures)) {
-                    if (pEffect->getManifest()->addDryToWet()) {
-                        // Skip adding the dry signal to the effect's wet output
-                        // when it is the first addDryToWet type effect in
-                        // a DryPlusWet mode chain. This allows effects after
-                        // it to process only the wet output. For example,
-                        // when chaining Echo then Reverb in DryPlusWet mode,
-                        // the Reverb effect will get only the wet output of
-                        // Echo to process instead of the echoed signal mixed
-                        // with the input to Echo. The dry signal that entered
-                        // the first effect in the chain will be mixed back in
-                        // below after all effects in the chain have been processed.
-                        bool skipAddingDry = !firstAddDryToWetEffectProcessed &&
-                                m_mixMode == EffectChainMixMode::DryPlusWet;
-
-                        if (!skipAddingDry) {
-                            for (SINT i = 0; i <= static_cast<SINT>(numSamples); ++i) {
-                                pIntermediateOutput[i] += pIntermediateInput[i];
-                            }
-                        }
-
-                        firstAddDryToWetEffectProcessed = true;
-                    }
-
-                    processingOccured = true;
-                    effectChainGroupDelayFrames += pEffect->getGroupDelayFrames();
-
-                    // Output of this effect becomes the input of the next effect
-                    pIntermediateInput = pIntermediateOutput;
-                }
+    const double beatLengthSec =
+            groupFeatures.has_beat_length_sec ? groupFeatures.beat_length_sec : 0.0;
+
+    // The output of a fully dry chain is its input, so the effects are
+    // disabled like with the enable switch until the mix knob is turned up.
+    if (effectiveChainEnableState == EffectEnableState::Enabled ||
+            effectiveChainEnableState == EffectEnableState::Enabling) {
+        if (currentMixKnob == 0) {
+            if (lastCallbackMixKnob == 0) {
+                effectiveChainEnableState = EffectEnableState::Disabled;
+                skipEffects();
+            } else {
+                effectiveChainEnableState = EffectEnableState::Disabling;
             }
+        } else if (lastCallbackMixKnob == 0) {
+            effectiveChainEnableState = EffectEnableState::Enabling;
         }
+    }
 
-        m_effectsDelay.setDelayFrames(effectChainGroupDelayFrames);
-        m_effectsDelay.process(pIn, numSamples);
-
-        if (processingOccured) {
-            // pIntermediateInput is the output of the last processed effect. It would be the
-            // intermediate input of the next effect if there was one.
-            if (m_mixMode == EffectChainMixMode::DrySlashWet) {
-                // Dry/Wet mode: output = (input * (1-mix knob)) + (wet * mix knob)
-                SampleUtil::copy2WithRampingGain(
-                        pOut,
+    bool processingOccured = false;
+    if (effectiveChainEnableState == EffectEnableState::Enabled &&
+            areEffectsIdle(inputHandle, outputHandle) &&
+            SampleUtil::isSilent(pIn, numSamples)) {
+        // All effects would only produce silence, so the output is the
+        // silent input
+        skipEffects();
+    } else if (effectiveChainEnableState != EffectEnableState::Disabled) {
+        ScopedAudioCallbackStage effectsStage(m_profilerStageId);
+        if (canProcessInBlocks(inputHandle,
+                    outputHandle,
+                    effectiveChainEnableState,
+                    beatLengthSec != channelStatus.oldBeatLengthSec,
+                    numSamples)) {
+            for (SINT begin = 0; begin < static_cast<SINT>(numSamples); begin += m_blockSamples) {
+                const SINT end = math_min(begin + m_blockSamples, static_cast<SINT>(numSamples));
+                processingOccured |= processRange(inputHandle,
+                        outputHandle,
                         pIn,
-                        1.0f - lastCallbackMixKnob,
-                        1.0f - currentMixKnob,
-                        pIntermediateInput,
-                        lastCallbackMixKnob,
-                        currentMixKnob,
-                        numSamples);
-            } else {
-                // Dry+Wet mode: output = input + (wet * mix knob)
-                SampleUtil::copy2WithRampingGain(
                         pOut,
-                        pIn,
-                        1.0f,
-                        1.0f,
-                        pIntermediateInput,
+                        begin,
+                        end,
+                        numSamples,
+                        sampleRate,
+                        effectiveChainEnableState,
+                        groupFeatures,
                         lastCallbackMixKnob,
-                        currentMixKnob,
-                        numSamples);
+                        currentMixKnob);
             }
+        } else {
+            processingOccured = processRange(inputHandle,
+                    outputHandle,
+                    pIn,
+                    pOut,
+                    0,
+                    numSamples,
+                    numSamples,
+                    sampleRate,
+                    effectiveChainEnableState,
+                    groupFeatures,
+                    lastCallbackMixKnob,
+                    currentMixKnob);
         }
     }
 
     channelStatus.oldMixKnob = currentMixKnob;
+    channelStatus.oldBeatLengthSec = beatLengthSec;
 
     // If the EffectProcessors have been sent a signal for the intermediate
     // enabling/disabling state, set the channel state or chain state
@@ -318,11 +297,204 @@ bool EngineEffectChain::process(const ChannelHandle& inputHandle,
         channelStatus.enableState = EffectEnableState::Enabling;
     }
 
+    return processingOccured;
+}
+
+void EngineEffectChain::onCallbackStart() {
+    // The intermediate state of the chain enable switch has been sent to
+    // all channels processed in the previous callback.
     if (m_enableState == EffectEnableState::Disabling) {
         m_enableState = EffectEnableState::Disabled;
     } else if (m_enableState == EffectEnableState::Enabling) {
         m_enableState = EffectEnableState::Enabled;
     }
+}
+
+bool EngineEffectChain::isEnabledForInputChannel(const ChannelHandle& inputHandle,
+        const ChannelHandle& outputHandle) const {
+    if (inputHandle.handle() >= m_chainStatusForChannelMatrix.size()) {
+        return false;
+    }
+    const ChannelHandleMap<ChannelStatus>& outputChannelStatus =
+            m_chainStatusForChannelMatrix.at(inputHandle);
+    if (outputHandle.handle() >= outputChannelStatus.size()) {
+        return false;
+    }
+    return outputChannelStatus.at(outputHandle).enableState != EffectEnableState::Disabled;
+}
+
+bool EngineEffectChain::areEffectsIdle(const ChannelHandle& inputHandle,
+        const ChannelHandle& outputHandle) const {
+    for (EngineEffect* pEffect : m_effects) {
+        if (pEffect != nullptr && !pEffect->isIdle(inputHandle, outputHandle)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void EngineEffectChain::skipEffects() {
+    for (EngineEffect* pEffect : qAsConst(m_effects)) {
+        if (pEffect != nullptr) {
+            pEffect->skipProcessing();
+        }
+    }
+}
 
+bool EngineEffectChain::canProcessInBlocks(const ChannelHandle& inputHandle,
+        const ChannelHandle& outputHandle,
+        EffectEnableState chainEnableState,
+        bool beatLengthChanging,
+        SINT numSamples) const {
+    if (m_blockSamples <= 0 || numSamples <= m_blockSamples) {
+        return false;
+    }
+    // Fading in or out is always done across the whole buffer
+    if (chainEnableState != EffectEnableState::Enabled) {
+        return false;
+    }
+    // The effects ramp to a new delay time, e.g. the Echo, or to new
+    // parameter values within the buffer they are given. In a block they
+    // would reach the new value at the end of the first block.
+    if (beatLengthChanging) {
+        return false;
+    }
+    for (EngineEffect* pEffect : m_effects) {
+        if (pEffect == nullptr) {
+            continue;
+        }
+        if (!pEffect->getManifest()->blockProcessingSupported() ||
+                pEffect->isEnableStateChanging(inputHandle, outputHandle) ||
+                pEffect->isParameterChanging(inputHandle, outputHandle)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool EngineEffectChain::processRange(const ChannelHandle& inputHandle,
+        const ChannelHandle& outputHandle,
+        CSAMPLE* pIn,
+        CSAMPLE* pOut,
+        SINT begin,
+        SINT end,
+        SINT numSamples,
+        unsigned int sampleRate,
+        EffectEnableState chainEnableState,
+        const GroupFeatureState& groupFeatures,
+        CSAMPLE oldMixKnob,
+        CSAMPLE newMixKnob) {
+    const SINT numRangeSamples = end - begin;
+    CSAMPLE* const pRangeIn = pIn + begin;
+    CSAMPLE* const pBuffer1 = m_buffer1.data() + begin;
+    CSAMPLE* const pBuffer2 = m_buffer2.data() + begin;
+
+    // Ramping code inside the effects need to access the original samples
+    // after writing to the output buffer. This requires not to use the same buffer
+    // for in and output: Also, ChannelMixer::applyEffectsAndMixChannels
+    // requires that the input buffer does not get modified.
+    CSAMPLE* pIntermediateInput = pRangeIn;
+    CSAMPLE* pIntermediateOutput;
+    // The input of an addDryToWet effect that still needs to be added to its
+    // output. Adding it is deferred until the next effect needs the output,
+    // or fused into the final mix if there is no such effect.
+    const CSAMPLE* pPendingDry = nullptr;
+    SINT effectChainGroupDelayFrames = 0;
+    bool firstAddDryToWetEffectProcessed = false;
+    bool processingOccured = false;
+
+    for (EngineEffect* pEffect : qAsConst(m_effects)) {
+        if (pEffect != nullptr) {
+            if (pPendingDry) {
+                SampleUtil::add(pIntermediateInput, pPendingDry, numRangeSamples);
+                pPendingDry = nullptr;
+            }
+
+            // Select an unused intermediate buffer for the next output
+            if (pIntermediateInput == pBuffer1) {
+                pIntermediateOutput = pBuffer2;
+            } else {
+                pIntermediateOutput = pBuffer1;
+            }
+
+            if (pEffect->process(inputHandle,
+                        outputHandle,
+                        pIntermediateInput,
+                        pIntermediateOutput,
+                        numRangeSamples,
+                        sampleRate,
+                        chainEnableState,
+                        groupFeatures)) {
+                if (pEffect->getManifest()->addDryToWet()) {
+                    // Skip adding the dry signal to the effect's wet output
+                    // when it is the first addDryToWet type effect in
+                    // a DryPlusWet mode chain. This allows effects after
+                    // it to process only the wet output. For example,
+                    // when chaining Echo then Reverb in DryPlusWet mode,
+                    // the Reverb effect will get only the wet output of
+                    // Echo to process instead of the echoed signal mixed
+                    // with the input to Echo. The dry signal that entered
+                    // the first effect in the chain will be mixed back in
+                    // below after all effects in the chain have been processed.
+                    bool skipAddingDry = !firstAddDryToWetEffectProcessed &&
+                            m_mixMode == EffectChainMixMode::DryPlusWet;
+
+                    if (!skipAddingDry) {
+                        pPendingDry = pIntermediateInput;
+                    }
+
+                    firstAddDryToWetEffectProcessed = true;
+                }
+
+                processingOccured = true;
+                effectChainGroupDelayFrames += pEffect->getGroupDelayFrames();
+
+                // Output of this effect becomes the input of the next effect
+                pIntermediateInput = pIntermediateOutput;
+            }
+        }
+    }
+
+    if (pPendingDry == pRangeIn) {
+        // The dry signal is added before it gets delayed below
+        SampleUtil::add(pIntermediateInput, pPendingDry, numRangeSamples);
+        pPendingDry = nullptr;
+    }
+
+    m_effectsDelay.setDelayFrames(effectChainGroupDelayFrames);
+    m_effectsDelay.process(pRangeIn, numRangeSamples);
+
+    if (processingOccured) {
+        // The mix knob ramps across the whole buffer
+        const auto mixKnobAt = [=](SINT sample) {
+            if (sample == numSamples) {
+                return newMixKnob;
+            }
+            return oldMixKnob + (newMixKnob - oldMixKnob) * sample / numSamples;
+        };
+        const SampleUtil::RampingGain wetGain{mixKnobAt(begin), mixKnobAt(end)};
+        SampleUtil::RampingGain dryGain{CSAMPLE_GAIN_ONE, CSAMPLE_GAIN_ONE};
+        if (m_mixMode == EffectChainMixMode::DrySlashWet) {
+            // Dry/Wet mode: output = (input * (1-mix knob)) + (wet * mix knob)
+            dryGain = {CSAMPLE_GAIN_ONE - wetGain.oldGain, CSAMPLE_GAIN_ONE - wetGain.newGain};
+        }
+        // Otherwise Dry+Wet mode: output = input + (wet * mix knob)
+
+        // pIntermediateInput is the output of the last processed effect. It would be the
+        // intermediate input of the next effect if there was one.
+        CSAMPLE* const pRangeOut = pOut + begin;
+        if (pPendingDry) {
+            // The input of the last effect is part of its wet signal
+            SampleUtil::copyWithGains<SampleUtil::RampingGain>(pRangeOut,
+                    {pRangeIn, pIntermediateInput, pPendingDry},
+                    {dryGain, wetGain, wetGain},
+                    numRangeSamples);
+        } else {
+            SampleUtil::copyWithGains<SampleUtil::RampingGain>(pRangeOut,
+                    {pRangeIn, pIntermediateInput},
+                    {dryGain, wetGain},
+                    numRangeSamples);
+        }
+    }
     return processingOccured;
 }
@@ -22,12 +22,28 @@ class EngineEffect;
 /// EngineEffectChain processes a list of EngineEffects in series.
 /// EngineEffectChain manages the input channel routing switches,
 /// the mix knob, and the chain enable switch.
+///
+/// Processing is skipped while the mix knob is fully dry and while all
+/// effects are idle and the input is silent, see EngineEffect::isIdle().
+///
+/// If blockFrames is greater than 0, the buffer is processed in consecutive
+/// blocks of that size as long as all effects of the chain support it, see
+/// EffectManifest::blockProcessingSupported(). The intermediate buffers of
+/// a small block stay in the CPU cache while it passes through all effects.
+/// Buffers in which an effect ramps to a new parameter value or beat length
+/// are processed as a whole, so the ramps span the whole buffer.
+///
+/// process() may be called concurrently for different input channels as long
+/// as the chain is only enabled for one of them, see isEnabledForInputChannel().
+/// The intermediate buffers, the effects delay and the effects themselves are
+/// shared by all channels.
 class EngineEffectChain final : public EffectsRequestHandler {
   public:
     /// called from main thread
     EngineEffectChain(const QString& group,
             const QSet<ChannelHandleAndGroup>& registeredInputChannels,
-            const QSet<ChannelHandleAndGroup>& registeredOutputChannels);
+            const QSet<ChannelHandleAndGroup>& registeredOutputChannels,
+            SINT blockFrames);
     /// called from main thread
     ~EngineEffectChain();
 
@@ -46,13 +62,25 @@ class EngineEffectChain final : public EffectsRequestHandler {
             const GroupFeatureState& groupFeatures,
             bool fadeout);
 
+    /// called from audio thread at the beginning of each callback, before
+    /// any channel is processed
+    void onCallbackStart();
+
+    /// called from audio thread. Returns false if the chain is fully
+    /// disabled for the channel and process() leaves its buffer untouched.
+    bool isEnabledForInputChannel(const ChannelHandle& inputHandle,
+            const ChannelHandle& outputHandle) const;
+
   private:
     struct ChannelStatus {
         ChannelStatus()
                 : oldMixKnob(0),
+                  oldBeatLengthSec(0),
                   enableState(EffectEnableState::Disabled) {
         }
         CSAMPLE oldMixKnob;
+        // 0 if the channel had no beat length
+        double oldBeatLengthSec;
         EffectEnableState enableState;
     };
 
@@ -60,6 +88,29 @@ class EngineEffectChain final : public EffectsRequestHandler {
         return QString("EngineEffectChain(%1)").arg(m_group);
     }
 
+    bool areEffectsIdle(const ChannelHandle& inputHandle,
+            const ChannelHandle& outputHandle) const;
+    void skipEffects();
+    bool canProcessInBlocks(const ChannelHandle& inputHandle,
+            const ChannelHandle& outputHandle,
+            EffectEnableState chainEnableState,
+            bool beatLengthChanging,
+            SINT numSamples) const;
+    /// Processes the samples [begin, end) of the buffer. numSamples and the
+    /// mix knob values refer to the whole buffer.
+    bool processRange(const ChannelHandle& inputHandle,
+            const ChannelHandle& outputHandle,
+            CSAMPLE* pIn,
+            CSAMPLE* pOut,
+            SINT begin,
+            SINT end,
+            SINT numSamples,
+            unsigned int sampleRate,
+            EffectEnableState chainEnableState,
+            const GroupFeatureState& groupFeatures,
+            CSAMPLE oldMixKnob,
+            CSAMPLE newMixKnob);
+
     bool updateParameters(const EffectsRequest& message);
     bool addEffect(EngineEffect* pEffect, int iIndex);
     bool removeEffect(EngineEffect* pEffect, int iIndex);
@@ -75,6 +126,8 @@ class EngineEffectChain final : public EffectsRequestHandler {
     mixxx::SampleBuffer m_buffer2;
     ChannelHandleMap<ChannelHandleMap<ChannelStatus>> m_chainStatusForChannelMatrix;
     EngineEffectsDelay m_effectsDelay;
+    const int m_profilerStageId;
+    const SINT m_blockSamples;
 
     DISALLOW_COPY_AND_ASSIGN(EngineEffectChain);
 };
@@ -2,6 +2,7 @@
 
 #include "engine/effects/engineeffect.h"
 #include "engine/effects/engineeffectchain.h"
+#include "engine/enginerealtimeworkerpool.h"
 #include "util/defs.h"
 #include "util/sample.h"
 
@@ -17,6 +18,14 @@ EngineEffectsManager::~EngineEffectsManager() {
 }
 
 void EngineEffectsManager::onCallbackStart() {
+    for (const auto& chains : std::as_const(m_chainsByStage)) {
+        for (EngineEffectChain* pChain : chains) {
+            if (pChain) {
+                pChain->onCallbackStart();
+            }
+        }
+    }
+
     EffectsRequest* request = nullptr;
     while (m_pResponsePipe->readMessage(&request)) {
         EffectsResponse response(*request);
@@ -135,6 +144,64 @@ void EngineEffectsManager::processPostFaderInPlace(
             fadeout);
 }
 
+void EngineEffectsManager::processPostFaderInPlace(
+        const PostFaderChannel* pChannels,
+        int numChannels,
+        const ChannelHandle& outputHandle,
+        unsigned int numSamples,
+        unsigned int sampleRate,
+        EngineRealtimeWorkerPool* pWorkerPool) {
+    PostFaderTask task{this, pChannels, outputHandle, numSamples, sampleRate};
+    if (pWorkerPool && numChannels > 1 &&
+            canProcessPostFaderConcurrently(pChannels, numChannels, outputHandle)) {
+        pWorkerPool->run(&EngineEffectsManager::processPostFaderChannelTask,
+                &task,
+                numChannels);
+    } else {
+        for (int i = 0; i < numChannels; ++i) {
+            processPostFaderChannelTask(&task, i);
+        }
+    }
+}
+
+bool EngineEffectsManager::canProcessPostFaderConcurrently(
+        const PostFaderChannel* pChannels,
+        int numChannels,
+        const ChannelHandle& outputHandle) const {
+    // A chain is shared by all channels it is enabled for, e.g. its
+    // intermediate buffers and the state of LV2 effects.
+    const QList<EngineEffectChain*>& chains =
+            m_chainsByStage.value(SignalProcessingStage::Postfader);
+    for (EngineEffectChain* pChain : chains) {
+        if (!pChain) {
+            continue;
+        }
+        int numEnabledChannels = 0;
+        for (int i = 0; i < numChannels; ++i) {
+            if (pChain->isEnabledForInputChannel(pChannels[i].inputHandle, outputHandle) &&
+                    ++numEnabledChannels > 1) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+// static
+void EngineEffectsManager::processPostFaderChannelTask(void* pContext, int index) {
+    const PostFaderTask* pTask = static_cast<const PostFaderTask*>(pContext);
+    const PostFaderChannel& channel = pTask->pChannels[index];
+    pTask->pEffectsManager->processPostFaderInPlace(channel.inputHandle,
+            pTask->outputHandle,
+            channel.pInOut,
+            pTask->numSamples,
+            pTask->sampleRate,
+            *channel.pGroupFeatures,
+            channel.oldGain,
+            channel.newGain,
+            channel.fadeout);
+}
+
 void EngineEffectsManager::processPostFaderAndMix(
         const ChannelHandle& inputHandle,
         const ChannelHandle& outputHandle,
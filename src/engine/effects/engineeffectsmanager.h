@@ -11,6 +11,7 @@
 
 class EngineEffectChain;
 class EngineEffect;
+class EngineRealtimeWorkerPool;
 
 /// EngineEffectsManager is the entry point for processing effects in the audio
 /// thread. It also passes EffectsRequests from EffectsMessenger down to the
@@ -66,6 +67,37 @@ class EngineEffectsManager final : public EffectsRequestHandler {
             CSAMPLE_GAIN newGain = CSAMPLE_GAIN_ONE,
             bool fadeout = false);
 
+    /// The buffer of an input channel and its fader gain for
+    /// processPostFaderInPlace()
+    struct PostFaderChannel {
+        ChannelHandle inputHandle;
+        CSAMPLE* pInOut;
+        const GroupFeatureState* pGroupFeatures;
+        CSAMPLE_GAIN oldGain;
+        CSAMPLE_GAIN newGain;
+        bool fadeout;
+    };
+
+    /// Process the postfader EngineEffectChains on the buffers of several input
+    /// channels like processPostFaderInPlace() does for a single channel. If
+    /// pWorkerPool is set and no chain is enabled for more than one of the
+    /// channels, the channels are processed concurrently on the pool. The
+    /// output is identical to processing the channels serially.
+    void processPostFaderInPlace(
+            const PostFaderChannel* pChannels,
+            int numChannels,
+            const ChannelHandle& outputHandle,
+            unsigned int numSamples,
+            unsigned int sampleRate,
+            EngineRealtimeWorkerPool* pWorkerPool);
+
+    /// Returns true if none of the postfader EngineEffectChains is enabled for
+    /// more than one of the channels, so they can be processed concurrently.
+    bool canProcessPostFaderConcurrently(
+            const PostFaderChannel* pChannels,
+            int numChannels,
+            const ChannelHandle& outputHandle) const;
+
     bool processEffectsRequest(
             EffectsRequest& message,
             EffectsResponsePipe* pResponsePipe) override;
@@ -75,6 +107,19 @@ class EngineEffectsManager final : public EffectsRequestHandler {
         return QString("EngineEffectsManager");
     }
 
+    // Context of processPostFaderChannelTask()
+    struct PostFaderTask {
+        EngineEffectsManager* pEffectsManager;
+        const PostFaderChannel* pChannels;
+        ChannelHandle outputHandle;
+        unsigned int numSamples;
+        unsigned int sampleRate;
+    };
+
+    // Task function for EngineRealtimeWorkerPool that processes the postfader
+    // chains on a single PostFaderChannel.
+    static void processPostFaderChannelTask(void* pContext, int index);
+
     bool addEffectChain(EngineEffectChain* pChain, SignalProcessingStage stage);
     bool removeEffectChain(EngineEffectChain* pChain, SignalProcessingStage stage);
 
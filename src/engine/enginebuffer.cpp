@@ -97,6 +97,8 @@ EngineBuffer::EngineBuffer(const QString& group,
           m_iSeekPhaseQueued(0),
           m_iEnableSyncQueued(SYNC_REQUEST_NONE),
           m_iSyncModeQueued(static_cast<int>(SyncMode::Invalid)),
+          m_bConcurrentProcessPrepared(false),
+          m_pPreparedChannelToCloneFrom(nullptr),
           m_bPlayAfterLoading(false),
           m_pCrossfadeBuffer(SampleUtil::alloc(MAX_BUFFER_LEN)),
           m_bCrossfadeReady(false),
@@ -192,7 +194,7 @@ EngineBuffer::EngineBuffer(const QString& group,
     m_pQuantize = ControlObject::getControl(ConfigKey(group, "quantize"));
 
     // Create the Loop Controller
-    m_pLoopingControl = new LoopingControl(group, pConfig);
+    m_pLoopingControl = new LoopingControl(group, pConfig, &m_controlSnapshot);
     addControl(m_pLoopingControl);
 
     m_pEngineSync = pMixingEngine->getEngineSync();
@@ -205,14 +207,14 @@ EngineBuffer::EngineBuffer(const QString& group,
 #endif
 
     // Create the Rate Controller
-    m_pRateControl = new RateControl(group, pConfig);
+    m_pRateControl = new RateControl(group, pConfig, &m_controlSnapshot);
     // Add the Rate Controller
     addControl(m_pRateControl);
     // Looping Control needs Rate Control for Reverse Button
     m_pLoopingControl->setRateControl(m_pRateControl);
 
     // Create the BPM Controller
-    m_pBpmControl = new BpmControl(group, pConfig);
+    m_pBpmControl = new BpmControl(group, pConfig, &m_controlSnapshot);
     addControl(m_pBpmControl);
 
     // TODO(rryan) remove this dependence?
@@ -232,7 +234,7 @@ EngineBuffer::EngineBuffer(const QString& group,
     addControl(m_pClockControl);
 
     // Create the cue controller
-    m_pCueControl = new CueControl(group, pConfig);
+    m_pCueControl = new CueControl(group, pConfig, &m_controlSnapshot);
     addControl(m_pCueControl);
 
     connect(m_pLoopingControl,
@@ -831,7 +833,9 @@ void EngineBuffer::processTrackLocked(
     }
 
     // Sync requests can affect rate, so process those first.
-    processSyncRequests();
+    if (!m_bConcurrentProcessPrepared) {
+        processSyncRequests();
+    }
 
     // Note: play is also active during cue preview
     bool paused = !m_playButton->toBool();
@@ -1121,6 +1125,7 @@ void EngineBuffer::process(CSAMPLE* pOutput, const int iBufferSize) {
         return;
     }
     m_pReader->process();
+    m_controlSnapshot.publish();
     // Steps:
     // - Lookup new reader information
     // - Calculate current rate
@@ -1179,6 +1184,27 @@ void EngineBuffer::process(CSAMPLE* pOutput, const int iBufferSize) {
 
     m_iLastBufferSize = iBufferSize;
     m_bCrossfadeReady = false;
+
+    if (m_bConcurrentProcessPrepared) {
+        m_bConcurrentProcessPrepared = false;
+        // Defer a clone request that could not be processed while
+        // loading a track, unless it has been replaced in the meantime
+        if (m_pPreparedChannelToCloneFrom) {
+            m_pChannelToCloneFrom.testAndSetRelaxed(
+                    nullptr, m_pPreparedChannelToCloneFrom);
+            m_pPreparedChannelToCloneFrom = nullptr;
+        }
+    }
+}
+
+bool EngineBuffer::prepareConcurrentProcess() {
+    DEBUG_ASSERT(!m_bConcurrentProcessPrepared);
+    m_bConcurrentProcessPrepared = true;
+    processSyncRequests();
+    // Cloning reads the play position of the other channel
+    m_pPreparedChannelToCloneFrom = m_pChannelToCloneFrom.fetchAndStoreRelaxed(nullptr);
+    return !m_pPreparedChannelToCloneFrom &&
+            m_pSyncControl->getSyncMode() == SyncMode::None;
 }
 
 void EngineBuffer::processSlip(int iBufferSize) {
@@ -1241,7 +1267,13 @@ void EngineBuffer::processSyncRequests() {
 void EngineBuffer::processSeek(bool paused) {
     m_previousBufferSeek = false;
     // Check if we are cloning another channel before doing any seeking.
-    EngineChannel* pChannel = m_pChannelToCloneFrom.fetchAndStoreRelaxed(nullptr);
+    EngineChannel* pChannel;
+    if (m_bConcurrentProcessPrepared) {
+        pChannel = m_pPreparedChannelToCloneFrom;
+        m_pPreparedChannelToCloneFrom = nullptr;
+    } else {
+        pChannel = m_pChannelToCloneFrom.fetchAndStoreRelaxed(nullptr);
+    }
     if (pChannel) {
         seekCloneBuffer(pChannel->getEngineBuffer());
     }
@@ -1434,16 +1466,17 @@ void EngineBuffer::hintReader(const double dRate) {
     for (const auto& pControl: qAsConst(m_engineControls)) {
         pControl->hintReader(&m_hintList);
     }
-    m_pReader->hintAndMaybeWake(m_hintList);
+    m_pReader->hintAndMaybeWake(m_hintList,
+            static_cast<SINT>(m_playPosition.toLowerFrameBoundary().value()));
 }
 
 // WARNING: This method runs in the GUI thread
-void EngineBuffer::loadTrack(TrackPointer pTrack, bool play) {
+void EngineBuffer::loadTrack(TrackPointer pTrack, bool play, bool preloadFully) {
     if (pTrack) {
         // Signal to the reader to load the track. The reader will respond with
         // trackLoading and then either with trackLoaded or trackLoadFailed signals.
         m_bPlayAfterLoading = play;
-        m_pReader->newTrack(pTrack);
+        m_pReader->newTrack(pTrack, preloadFully);
     } else {
         // Loading a null track means "eject"
         ejectTrack();
@@ -8,6 +8,7 @@
 #include <initializer_list>
 
 #include "audio/frame.h"
+#include "control/controlsnapshot.h"
 #include "control/controlvalue.h"
 #include "engine/bufferscalers/enginebufferscalerubberband.h"
 #include "engine/cachingreader/cachingreader.h"
@@ -123,6 +124,12 @@ class EngineBuffer : public EngineObject {
 
     // The process methods all run in the audio callback.
     void process(CSAMPLE* pOut, const int iBufferSize) override;
+    /// Applies the pending sync and clone requests, which access the state
+    /// of other channels, before the channels are processed concurrently.
+    /// Returns false if the channel is synchronized with other channels
+    /// and must be processed serially. Requests that are queued after this
+    /// call are deferred to the next callback.
+    bool prepareConcurrentProcess();
     void processSlip(int iBufferSize);
     void postProcess(const int iBufferSize);
 
@@ -187,8 +194,9 @@ class EngineBuffer : public EngineObject {
 
     // Request that the EngineBuffer load a track. Since the process is
     // asynchronous, EngineBuffer will emit a trackLoaded signal when the load
-    // has completed.
-    void loadTrack(TrackPointer pTrack, bool play);
+    // has completed. If preloadFully is set the whole track is decoded into
+    // memory while loading.
+    void loadTrack(TrackPointer pTrack, bool play, bool preloadFully = false);
 
     void setChannelIndex(int channelIndex) {
         m_channelIndex = channelIndex;
@@ -301,6 +309,10 @@ class EngineBuffer : public EngineObject {
 
     QList<EngineControl*> m_engineControls;
 
+    // Input controls that are read by the EngineControls on every callback.
+    // Published at the beginning of process().
+    ControlSnapshot m_controlSnapshot;
+
     // The read ahead manager for EngineBufferScale's that need to read ahead
     ReadAheadManager* m_pReadAheadManager;
 
@@ -423,6 +435,9 @@ class EngineBuffer : public EngineObject {
     /// Indicates that no seek is queued
     static constexpr QueuedSeek kNoQueuedSeek = {mixxx::audio::kInvalidFramePos, SEEK_NONE};
     QAtomicPointer<EngineChannel> m_pChannelToCloneFrom;
+    // Set by prepareConcurrentProcess() until the end of process()
+    bool m_bConcurrentProcessPrepared;
+    EngineChannel* m_pPreparedChannelToCloneFrom;
 
     // Is true if the previous buffer was silent due to pausing
     QAtomicInt m_iTrackLoading;
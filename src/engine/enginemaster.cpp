@@ -14,6 +14,7 @@
 #include "engine/effects/engineeffectsmanager.h"
 #include "engine/enginebuffer.h"
 #include "engine/enginedelay.h"
+#include "engine/enginerealtimeworkerpool.h"
 #include "engine/enginetalkoverducking.h"
 #include "engine/enginevumeter.h"
 #include "engine/engineworkerscheduler.h"
@@ -23,6 +24,7 @@
 #include "mixer/playermanager.h"
 #include "moc_enginemaster.cpp"
 #include "preferences/usersettings.h"
+#include "util/audiocallbackprofiler.h"
 #include "util/defs.h"
 #include "util/sample.h"
 #include "util/timer.h"
@@ -48,7 +50,10 @@ EngineMaster::EngineMaster(
           m_busTalkoverHandle(registerChannelGroup("[BusTalkover]")),
           m_busCrossfaderLeftHandle(registerChannelGroup("[BusLeft]")),
           m_busCrossfaderCenterHandle(registerChannelGroup("[BusCenter]")),
-          m_busCrossfaderRightHandle(registerChannelGroup("[BusRight]")) {
+          m_busCrossfaderRightHandle(registerChannelGroup("[BusRight]")),
+          m_syncStageId(AudioCallbackProfiler::registerStage(QStringLiteral("Sync"))),
+          m_mixStageId(AudioCallbackProfiler::registerStage(QStringLiteral("Mix"))),
+          m_sidechainStageId(AudioCallbackProfiler::registerStage(QStringLiteral("Sidechain"))) {
     pEffectsManager->registerInputChannel(m_masterHandle);
     pEffectsManager->registerInputChannel(m_headphoneHandle);
     pEffectsManager->registerOutputChannel(m_masterHandle);
@@ -66,6 +71,24 @@ EngineMaster::EngineMaster(
     m_pWorkerScheduler = new EngineWorkerScheduler(this);
     m_pWorkerScheduler->start(QThread::HighPriority);
 
+    // The number of additional threads for processing the channels and
+    // their post-fader effects in parallel. By default all channels are
+    // processed serially in the audio callback thread.
+    const int numRealtimeWorkers = pConfig->getValue(
+            ConfigKey(group, "num_engine_workers"), 0);
+    if (numRealtimeWorkers > 0) {
+        qDebug() << "EngineMaster: Processing channels with"
+                 << numRealtimeWorkers << "additional realtime workers";
+        // Pinning the workers to dedicated cores only pays off if these
+        // cores are not shared with other busy threads.
+        const bool pinWorkers = pConfig->getValue(
+                ConfigKey(group, "engine_workers_pinned"), false);
+        m_pRealtimeWorkerPool = new EngineRealtimeWorkerPool(
+                numRealtimeWorkers, pinWorkers);
+    } else {
+        m_pRealtimeWorkerPool = nullptr;
+    }
+
     // Master sample rate
     m_pMasterSampleRate = new ControlObject(ConfigKey(group, "samplerate"), true, true);
     m_pMasterSampleRate->set(44100.);
@@ -240,6 +263,7 @@ EngineMaster::~EngineMaster() {
         SampleUtil::free(m_pOutputBusBuffers[o]);
     }
 
+    delete m_pRealtimeWorkerPool;
     delete m_pWorkerScheduler;
 
     for (int i = 0; i < m_channels.size(); ++i) {
@@ -270,7 +294,10 @@ const CSAMPLE* EngineMaster::getSidechainBuffer() const {
 
 void EngineMaster::processChannels(int iBufferSize) {
     // Update internal sync lock rate.
-    m_pEngineSync->onCallbackStart(m_sampleRate, m_iBufferSize);
+    {
+        ScopedAudioCallbackStage syncStage(m_syncStageId);
+        m_pEngineSync->onCallbackStart(m_sampleRate, m_iBufferSize);
+    }
 
     m_activeBusChannels[EngineChannel::LEFT].clear();
     m_activeBusChannels[EngineChannel::CENTER].clear();
@@ -357,17 +384,29 @@ void EngineMaster::processChannels(int iBufferSize) {
     }
 
     // Now that the list is built and ordered, do the processing.
-    for (int i = activeChannelsStartIndex;
-             i < m_activeChannels.size(); ++i) {
-        ChannelInfo* pChannelInfo = m_activeChannels[i];
-        EngineChannel* pChannel = pChannelInfo->m_pChannel;
-        pChannel->process(pChannelInfo->m_pBuffer, iBufferSize);
-
-        // Collect metadata for effects
-        if (m_pEngineEffectsManager) {
-            GroupFeatureState features;
-            pChannel->collectFeatures(&features);
-            pChannelInfo->m_features = features;
+    if (m_pRealtimeWorkerPool) {
+        // Synchronized channels and pending sync requests access EngineSync
+        // and the state of other channels. These channels are processed
+        // serially, starting with the sync leader, and only the remaining
+        // independent channels are processed concurrently.
+        m_concurrentChannels.clear();
+        for (int i = activeChannelsStartIndex; i < m_activeChannels.size(); ++i) {
+            ChannelInfo* pChannelInfo = m_activeChannels[i];
+            EngineBuffer* pBuffer = pChannelInfo->m_pChannel->getEngineBuffer();
+            if (pBuffer && !pBuffer->prepareConcurrentProcess()) {
+                processChannel(pChannelInfo, iBufferSize);
+            } else {
+                m_concurrentChannels.append(pChannelInfo);
+            }
+        }
+        m_pRealtimeWorkerPool->run(&EngineMaster::processConcurrentChannelTask,
+                this,
+                m_concurrentChannels.size());
+    } else {
+        for (int i = activeChannelsStartIndex;
+                i < m_activeChannels.size();
+                ++i) {
+            processChannel(m_activeChannels[i], iBufferSize);
         }
     }
 
@@ -376,7 +415,10 @@ void EngineMaster::processChannels(int iBufferSize) {
     // Note, because we call this on the internal clock first,
     // it will have an up-to-date beatDistance, whereas the other
     // Syncables will not.
-    m_pEngineSync->onCallbackEnd(m_sampleRate, m_iBufferSize);
+    {
+        ScopedAudioCallbackStage syncStage(m_syncStageId);
+        m_pEngineSync->onCallbackEnd(m_sampleRate, m_iBufferSize);
+    }
 
     // After all the engines have been processed, trigger post-processing
     // which ensures that all channels are updating certain values at the
@@ -388,6 +430,27 @@ void EngineMaster::processChannels(int iBufferSize) {
     }
 }
 
+void EngineMaster::processChannel(ChannelInfo* pChannelInfo, int iBufferSize) {
+    ScopedAudioCallbackStage channelStage(pChannelInfo->m_profilerStageId);
+    EngineChannel* pChannel = pChannelInfo->m_pChannel;
+    pChannel->process(pChannelInfo->m_pBuffer, iBufferSize);
+
+    // Collect metadata for effects
+    if (m_pEngineEffectsManager) {
+        GroupFeatureState features;
+        pChannel->collectFeatures(&features);
+        pChannelInfo->m_features = features;
+    }
+}
+
+// static
+void EngineMaster::processConcurrentChannelTask(void* pContext, int index) {
+    EngineMaster* pEngineMaster = static_cast<EngineMaster*>(pContext);
+    pEngineMaster->processChannel(
+            pEngineMaster->m_concurrentChannels[index],
+            static_cast<int>(pEngineMaster->m_iBufferSize));
+}
+
 void EngineMaster::process(const int iBufferSize) {
     static bool haveSetName = false;
     if (!haveSetName) {
@@ -413,6 +476,9 @@ void EngineMaster::process(const int iBufferSize) {
     // Prepare all channels for output
     processChannels(m_iBufferSize);
 
+    // Everything from here on, including effects and the sidechain
+    ScopedAudioCallbackStage mixStage(m_mixStageId);
+
     // Compute headphone mix
     // Head phone left/right mix
     CSAMPLE pflMixGainInHeadphones = 1;
@@ -474,7 +540,8 @@ void EngineMaster::process(const int iBufferSize) {
             m_masterHandle.handle(),
             m_iBufferSize,
             static_cast<int>(m_sampleRate.value()),
-            m_pEngineEffectsManager);
+            m_pEngineEffectsManager,
+            m_pRealtimeWorkerPool);
 
     // Process effects on all microphones mixed together
     // We have no metadata for mixed effect buses, so use an empty GroupFeatureState.
@@ -533,7 +600,8 @@ void EngineMaster::process(const int iBufferSize) {
                 m_masterHandle.handle(),
                 m_iBufferSize,
                 static_cast<int>(m_sampleRate.value()),
-                m_pEngineEffectsManager);
+                m_pEngineEffectsManager,
+                m_pRealtimeWorkerPool);
     }
 
     // Process crossfader orientation bus channel effects
@@ -572,11 +640,12 @@ void EngineMaster::process(const int iBufferSize) {
 
     if (masterEnabled) {
         // Mix the crossfader orientation buffers together into the master mix
-        SampleUtil::copy3WithGain(m_pMaster,
-            m_pOutputBusBuffers[EngineChannel::LEFT], 1.0,
-            m_pOutputBusBuffers[EngineChannel::CENTER], 1.0,
-            m_pOutputBusBuffers[EngineChannel::RIGHT], 1.0,
-            m_iBufferSize);
+        SampleUtil::copyWithGains<SampleUtil::ConstantGain>(m_pMaster,
+                {m_pOutputBusBuffers[EngineChannel::LEFT],
+                        m_pOutputBusBuffers[EngineChannel::CENTER],
+                        m_pOutputBusBuffers[EngineChannel::RIGHT]},
+                {{CSAMPLE_GAIN_ONE}, {CSAMPLE_GAIN_ONE}, {CSAMPLE_GAIN_ONE}},
+                m_iBufferSize);
 
         MicMonitorMode configuredMicMonitorMode = static_cast<MicMonitorMode>(
             static_cast<int>(m_pMicMonitorMode->get()));
@@ -724,6 +793,7 @@ void EngineMaster::process(const int iBufferSize) {
         // EngineSideChain::receiveBuffer has copied the input buffer to m_pSidechainMix
         // via before (called by SoundManager::pushInputBuffers())
         if (m_pEngineSideChain) {
+            ScopedAudioCallbackStage sidechainStage(m_sidechainStageId);
             m_pEngineSideChain->writeSamples(m_pSidechainMix, iFrames);
         }
 
@@ -836,6 +906,8 @@ void EngineMaster::addChannel(EngineChannel* pChannel) {
     pChannelInfo->m_pChannel = pChannel;
     const QString& group = pChannel->getGroup();
     pChannelInfo->m_handle = m_pChannelHandleFactory->getOrCreateHandle(group);
+    pChannelInfo->m_profilerStageId = AudioCallbackProfiler::registerStage(
+            QStringLiteral("Channel %1").arg(group));
     pChannelInfo->m_pVolumeControl = new ControlAudioTaperPot(
             ConfigKey(group, "volume"), -20, 0, 1);
     pChannelInfo->m_pVolumeControl->setDefaultValue(1.0);
@@ -855,6 +927,7 @@ void EngineMaster::addChannel(EngineChannel* pChannel) {
     // callback. QVarLengthArray does nothing if reserve is called with a size
     // smaller than its pre-allocation.
     m_activeChannels.reserve(m_channels.size());
+    m_concurrentChannels.reserve(m_channels.size());
     m_activeBusChannels[EngineChannel::LEFT].reserve(m_channels.size());
     m_activeBusChannels[EngineChannel::CENTER].reserve(m_channels.size());
     m_activeBusChannels[EngineChannel::RIGHT].reserve(m_channels.size());
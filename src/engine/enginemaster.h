@@ -15,6 +15,7 @@
 #include "soundio/soundmanagerutil.h"
 
 class EngineWorkerScheduler;
+class EngineRealtimeWorkerPool;
 class EngineBuffer;
 class EngineChannel;
 class EngineDeck;
@@ -114,7 +115,8 @@ class EngineMaster : public QObject, public AudioSource {
                   m_pBuffer(NULL),
                   m_pVolumeControl(NULL),
                   m_pMuteControl(NULL),
-                  m_index(index) {
+                  m_index(index),
+                  m_profilerStageId(-1) {
         }
         ChannelHandle m_handle;
         EngineChannel* m_pChannel;
@@ -123,6 +125,7 @@ class EngineMaster : public QObject, public AudioSource {
         ControlPushButton* m_pMuteControl;
         GroupFeatureState m_features;
         int m_index;
+        int m_profilerStageId;
     };
 
     struct GainCache {
@@ -261,6 +264,11 @@ class EngineMaster : public QObject, public AudioSource {
     // m_activeTalkoverChannels with each channel that is active for the
     // respective output.
     void processChannels(int iBufferSize);
+    // Processes a single channel and collects its features for effects.
+    void processChannel(ChannelInfo* pChannelInfo, int iBufferSize);
+    // Task function for m_pRealtimeWorkerPool that processes the channels
+    // in m_concurrentChannels.
+    static void processConcurrentChannelTask(void* pContext, int index);
 
     ChannelHandleFactoryPointer m_pChannelHandleFactory;
     void applyMasterEffects();
@@ -280,6 +288,8 @@ class EngineMaster : public QObject, public AudioSource {
 
     // Pre-allocated buffers for performing channel mixing in the callback.
     QVarLengthArray<ChannelInfo*, kPreallocatedChannels> m_activeChannels;
+    // The active channels that are processed on m_pRealtimeWorkerPool
+    QVarLengthArray<ChannelInfo*, kPreallocatedChannels> m_concurrentChannels;
     QVarLengthArray<ChannelInfo*, kPreallocatedChannels> m_activeBusChannels[3];
     QVarLengthArray<ChannelInfo*, kPreallocatedChannels> m_activeHeadphoneChannels;
     QVarLengthArray<ChannelInfo*, kPreallocatedChannels> m_activeTalkoverChannels;
@@ -296,8 +306,16 @@ class EngineMaster : public QObject, public AudioSource {
     CSAMPLE* m_pSidechainMix;
 
     EngineWorkerScheduler* m_pWorkerScheduler;
+    // Optional pool for processing the active channels and their post-fader
+    // effects in parallel. nullptr if the channels are processed serially.
+    EngineRealtimeWorkerPool* m_pRealtimeWorkerPool;
     EngineSync* m_pEngineSync;
 
+    // Stages of the AudioCallbackProfiler
+    int m_syncStageId;
+    int m_mixStageId;
+    int m_sidechainStageId;
+
     ControlObject* m_pMasterGain;
     ControlObject* m_pBoothGain;
     ControlObject* m_pHeadGain;
@@ -0,0 +1,246 @@
+#include "engine/enginerealtimeworkerpool.h"
+
+#include <QtDebug>
+
+#ifdef __LINUX__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+#ifdef __SSE__
+#include <xmmintrin.h>
+#endif
+
+#include "util/assert.h"
+
+namespace {
+
+// The number of polls of the shared state before an idle worker goes to
+// sleep. A few microseconds of spinning covers the gap between two engine
+// channel batches within the same callback.
+constexpr int kSpinIterations = 4000;
+
+// The number of polls before the caller stops spinning at the barrier and
+// goes to sleep until the workers have finished their items. The workers
+// usually finish within this time unless they have been preempted.
+constexpr int kBarrierSpinIterations = 2000;
+
+inline void cpuRelax() {
+#ifdef __SSE__
+    _mm_pause();
+#else
+    QThread::yieldCurrentThread();
+#endif
+}
+
+constexpr std::uint64_t makeState(std::uint32_t generation, int count) {
+    return (static_cast<std::uint64_t>(generation) << 32) |
+            (static_cast<std::uint64_t>(count) << 16);
+}
+
+} // anonymous namespace
+
+EngineRealtimeWorkerPool::EngineRealtimeWorkerPool(int numWorkers, bool pinWorkers)
+        : m_state(makeState(0, 0)),
+          m_pTask(nullptr),
+          m_pContext(nullptr),
+          m_remaining(0),
+          m_bQuit(false),
+          m_callerWaiting(false),
+          m_pinWorkers(pinWorkers),
+          m_callerPriority(0),
+          m_generation(0),
+          m_callerPriorityKnown(false) {
+    DEBUG_ASSERT(numWorkers >= 0);
+    m_workers.reserve(numWorkers);
+    for (int i = 0; i < numWorkers; ++i) {
+        WorkerThread* pWorker = new WorkerThread(this, i);
+        pWorker->start(QThread::TimeCriticalPriority);
+        m_workers.push_back(pWorker);
+    }
+}
+
+EngineRealtimeWorkerPool::~EngineRealtimeWorkerPool() {
+    m_bQuit.store(true);
+    for (const auto& pWorker : m_workers) {
+        pWorker->wake();
+    }
+    for (const auto& pWorker : m_workers) {
+        pWorker->wait();
+        delete pWorker;
+    }
+}
+
+void EngineRealtimeWorkerPool::run(TaskFunction pTask, void* pContext, int count) {
+    if (count <= 0) {
+        return;
+    }
+    VERIFY_OR_DEBUG_ASSERT(count <= kMaxCount) {
+        count = kMaxCount;
+    }
+    if (m_workers.empty() || count == 1) {
+        for (int i = 0; i < count; ++i) {
+            pTask(pContext, i);
+        }
+        return;
+    }
+
+#ifdef __LINUX__
+    if (!m_callerPriorityKnown) {
+        // Only queried once, the engine is always processed by the same
+        // audio callback thread.
+        m_callerPriorityKnown = true;
+        int policy;
+        struct sched_param param;
+        if (pthread_getschedparam(pthread_self(), &policy, &param) == 0 &&
+                (policy == SCHED_FIFO || policy == SCHED_RR)) {
+            m_callerPriority.store(param.sched_priority, std::memory_order_relaxed);
+        }
+    }
+#endif
+
+    m_pTask.store(pTask, std::memory_order_relaxed);
+    m_pContext.store(pContext, std::memory_order_relaxed);
+    m_remaining.store(count, std::memory_order_relaxed);
+    ++m_generation;
+    // Publishes all of the above to the workers
+    m_state.store(makeState(m_generation, count), std::memory_order_release);
+
+    for (const auto& pWorker : m_workers) {
+        pWorker->wake();
+    }
+
+    processGeneration(m_generation);
+    waitForRemainingItems();
+}
+
+void EngineRealtimeWorkerPool::waitForRemainingItems() {
+    // Barrier: Wait until the items claimed by the workers are done.
+    for (int i = 0; i < kBarrierSpinIterations; ++i) {
+        if (m_remaining.load(std::memory_order_acquire) == 0) {
+            return;
+        }
+        cpuRelax();
+    }
+    // A worker has been preempted or shares the core with the caller.
+    // Spinning any longer would only keep it from finishing. The same
+    // handshake as in wake() ensures that the semaphore is only released
+    // if the caller is going to acquire it.
+    m_callerWaiting.store(true);
+    if (m_remaining.load() == 0) {
+        if (m_callerWaiting.exchange(false)) {
+            return;
+        }
+        // The last worker has reset the flag concurrently and released
+        // the semaphore, consume it.
+    }
+    m_semaFinished.acquire();
+}
+
+void EngineRealtimeWorkerPool::processGeneration(std::uint32_t generation) {
+    const TaskFunction pTask = m_pTask.load(std::memory_order_relaxed);
+    void* const pContext = m_pContext.load(std::memory_order_relaxed);
+
+    std::uint64_t state = m_state.load(std::memory_order_acquire);
+    while (generationOf(state) == generation && indexOf(state) < countOf(state)) {
+        if (m_state.compare_exchange_weak(state,
+                    state + 1,
+                    std::memory_order_acq_rel,
+                    std::memory_order_acquire)) {
+            // The task and context read above belong to this generation,
+            // because it can't advance before the claimed item is finished.
+            pTask(pContext, indexOf(state));
+            if (m_remaining.fetch_sub(1) == 1 && m_callerWaiting.exchange(false)) {
+                m_semaFinished.release();
+            }
+            state = m_state.load(std::memory_order_acquire);
+        }
+    }
+}
+
+EngineRealtimeWorkerPool::WorkerThread::WorkerThread(
+        EngineRealtimeWorkerPool* pPool, int workerIndex)
+        : m_pPool(pPool),
+          m_workerIndex(workerIndex),
+          m_sleeping(false),
+          m_priority(0) {
+    setObjectName(QStringLiteral("EngineWorker %1").arg(workerIndex + 1));
+}
+
+void EngineRealtimeWorkerPool::WorkerThread::wake() {
+    // Exactly one of wake() and waitForNextGeneration() resets the flag,
+    // so the semaphore is only released if the worker is going to acquire
+    // it.
+    if (m_sleeping.exchange(false)) {
+        m_semaWake.release();
+    }
+}
+
+void EngineRealtimeWorkerPool::WorkerThread::waitForNextGeneration(
+        std::uint32_t lastGeneration) {
+    for (int i = 0; i < kSpinIterations; ++i) {
+        if (generationOf(m_pPool->m_state.load(std::memory_order_acquire)) !=
+                        lastGeneration ||
+                m_pPool->m_bQuit.load(std::memory_order_relaxed)) {
+            return;
+        }
+        cpuRelax();
+    }
+    m_sleeping.store(true);
+    if (generationOf(m_pPool->m_state.load(std::memory_order_acquire)) !=
+                    lastGeneration ||
+            m_pPool->m_bQuit.load()) {
+        if (m_sleeping.exchange(false)) {
+            return;
+        }
+        // wake() has reset the flag concurrently and released the
+        // semaphore, consume it.
+    }
+    m_semaWake.acquire();
+}
+
+void EngineRealtimeWorkerPool::WorkerThread::adoptCallerPriority() {
+#ifdef __LINUX__
+    const int priority = m_pPool->m_callerPriority.load(std::memory_order_relaxed);
+    if (priority == m_priority) {
+        return;
+    }
+    m_priority = priority;
+    struct sched_param spm = {0};
+    spm.sched_priority = priority;
+    if (pthread_setschedparam(pthread_self(), SCHED_FIFO, &spm)) {
+        qWarning() << objectName() << ": Failed bumping priority";
+    }
+#endif
+}
+
+void EngineRealtimeWorkerPool::WorkerThread::run() {
+#ifdef __LINUX__
+    // Pin each worker to its own core. The first core is skipped, because
+    // it is the one most likely used by the audio callback thread.
+    const int numCores = QThread::idealThreadCount();
+    if (m_pPool->m_pinWorkers && numCores > 1) {
+        cpu_set_t cpuSet;
+        CPU_ZERO(&cpuSet);
+        CPU_SET((m_workerIndex + 1) % numCores, &cpuSet);
+        if (pthread_setaffinity_np(pthread_self(), sizeof(cpuSet), &cpuSet)) {
+            qWarning() << objectName() << ": Failed to set CPU affinity";
+        }
+    }
+#endif
+
+    std::uint32_t lastGeneration =
+            generationOf(m_pPool->m_state.load(std::memory_order_acquire));
+    while (!m_pPool->m_bQuit.load()) {
+        waitForNextGeneration(lastGeneration);
+        const std::uint32_t generation =
+                generationOf(m_pPool->m_state.load(std::memory_order_acquire));
+        if (generation == lastGeneration) {
+            continue;
+        }
+        lastGeneration = generation;
+        // The priority is only known after the first run() call
+        adoptCallerPriority();
+        m_pPool->processGeneration(generation);
+    }
+}
@@ -0,0 +1,117 @@
+#pragma once
+
+#include <QSemaphore>
+#include <QString>
+#include <QThread>
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+#include "util/class.h"
+
+class EngineRealtimeWorkerPool;
+
+/// EngineRealtimeWorkerPool distributes independent pieces of work of a single
+/// audio callback over a set of pre-spawned worker threads.
+///
+/// The calling (engine) thread always participates in the processing, so
+/// in the worst case when no worker is awake in time all work is done
+/// serially by the caller, just like without the pool. Neither run() nor the
+/// workers allocate memory or take locks while processing. Idle workers spin
+/// briefly before going to sleep on a semaphore to keep the wake-up latency
+/// low when the engine is processing small buffers.
+///
+/// The workers adopt the realtime scheduling priority of the calling thread,
+/// so they are not preempted by threads the caller would preempt. If a
+/// worker still doesn't finish its items in time, e.g. because it shares a
+/// core with the caller, the caller stops spinning after a bounded time and
+/// sleeps until the last item is done.
+class EngineRealtimeWorkerPool {
+  public:
+    /// Signature of the work function. It is invoked once for each index
+    /// in [0, count) passed to run(), possibly concurrently.
+    typedef void (*TaskFunction)(void* pContext, int index);
+
+    static constexpr int kMaxCount = 0xFFFF;
+
+    /// Spawns numWorkers threads in addition to the calling thread. If
+    /// pinWorkers is set each worker is pinned to its own CPU core.
+    explicit EngineRealtimeWorkerPool(int numWorkers, bool pinWorkers = false);
+    ~EngineRealtimeWorkerPool();
+
+    int numWorkers() const {
+        return static_cast<int>(m_workers.size());
+    }
+
+    /// Invokes pTask(pContext, i) for all i in [0, count) and returns after
+    /// all invocations have finished. count must not exceed kMaxCount.
+    /// Must only be called from a single thread, usually the engine
+    /// callback thread.
+    void run(TaskFunction pTask, void* pContext, int count);
+
+  private:
+    class WorkerThread : public QThread {
+      public:
+        WorkerThread(EngineRealtimeWorkerPool* pPool, int workerIndex);
+
+        /// Wakes up the worker if it went to sleep. Returns immediately
+        /// if the worker is still spinning or busy.
+        void wake();
+
+      protected:
+        void run() override;
+
+      private:
+        void waitForNextGeneration(std::uint32_t lastGeneration);
+        void adoptCallerPriority();
+
+        EngineRealtimeWorkerPool* const m_pPool;
+        const int m_workerIndex;
+        std::atomic<bool> m_sleeping;
+        QSemaphore m_semaWake;
+        int m_priority;
+    };
+
+    static constexpr std::uint32_t generationOf(std::uint64_t state) {
+        return static_cast<std::uint32_t>(state >> 32);
+    }
+    static constexpr int countOf(std::uint64_t state) {
+        return static_cast<int>((state >> 16) & 0xFFFF);
+    }
+    static constexpr int indexOf(std::uint64_t state) {
+        return static_cast<int>(state & 0xFFFF);
+    }
+
+    /// Claims and processes items of the given generation until there
+    /// are none left.
+    void processGeneration(std::uint32_t generation);
+    /// Waits until all claimed items have been processed
+    void waitForRemainingItems();
+
+    std::vector<WorkerThread*> m_workers;
+
+    // The generation in the upper 32 bits followed by the item count and
+    // the next unclaimed index in 16 bits each. Tagging the index with the
+    // generation and count prevents late workers from claiming items of a
+    // subsequent run.
+    std::atomic<std::uint64_t> m_state;
+    std::atomic<TaskFunction> m_pTask;
+    std::atomic<void*> m_pContext;
+    std::atomic<int> m_remaining;
+    std::atomic<bool> m_bQuit;
+
+    // Set while the caller is sleeping on m_semaFinished
+    std::atomic<bool> m_callerWaiting;
+    QSemaphore m_semaFinished;
+
+    const bool m_pinWorkers;
+    // The SCHED_FIFO priority of the thread calling run(), 0 if the
+    // caller is not a realtime thread or if it is still unknown.
+    std::atomic<int> m_callerPriority;
+
+    // Only accessed from the thread calling run().
+    std::uint32_t m_generation;
+    bool m_callerPriorityKnown;
+
+    DISALLOW_COPY_AND_ASSIGN(EngineRealtimeWorkerPool);
+};
@@ -16,7 +16,6 @@ EngineFilterBessel4Low::EngineFilterBessel4Low(int sampleRate,
 
 void EngineFilterBessel4Low::setFrequencyCorners(int sampleRate,
                                                  double freqCorner1) {
-    // Copy the old coefficients into m_oldCoef
     setCoefs(kFidSpecLowPassBessel4, sizeof(kFidSpecLowPassBessel4), sampleRate, freqCorner1);
 }
 
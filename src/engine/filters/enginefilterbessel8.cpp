@@ -16,7 +16,6 @@ EngineFilterBessel8Low::EngineFilterBessel8Low(int sampleRate,
 
 void EngineFilterBessel8Low::setFrequencyCorners(int sampleRate,
                                                  double freqCorner1) {
-    // Copy the old coefficients into m_oldCoef
     setCoefs(kFidSpecLowPassBessel8, sizeof(kFidSpecLowPassBessel8), sampleRate, freqCorner1);
 }
 
@@ -14,7 +14,6 @@ EngineFilterButterworth4Low::EngineFilterButterworth4Low(int sampleRate, double
 
 void EngineFilterButterworth4Low::setFrequencyCorners(int sampleRate,
                                              double freqCorner1) {
-    // Copy the old coefficients into m_oldCoef
     setCoefs(kFidSpecLowPassButterworth4,
             sizeof(kFidSpecLowPassButterworth4),
             sampleRate,
@@ -7,6 +7,7 @@
 #include <fidlib.h>
 
 #include "engine/engineobject.h"
+#include "engine/filters/enginefilteriirbank.h"
 #include "util/sample.h"
 
 // set to 1 to print some analysis data using qDebug()
@@ -35,9 +36,31 @@ class EngineFilterIIRBase : public EngineObjectConstIn {
 // length of the 3rd argument to fid_design_coef
 #define FIDSPEC_LENGTH 40
 
+// The number of first or second order sections of the fidlib designs
+constexpr int iirSectionCount(unsigned int size, enum IIRPass pass) {
+    switch (pass) {
+    case IIR_LPMO:
+    case IIR_HPMO:
+    case IIR_LP2:
+    case IIR_HP2:
+        return static_cast<int>(size);
+    default:
+        // The two coefficients of a biquad or the five of a single
+        // shelving or peaking biquad
+        return size == 5 ? 1 : static_cast<int>(size / 2);
+    }
+}
+
+// The filter is designed by fidlib as a cascade of sections in direct form II
+// with the coefficients in m_coef. processSample() is the generated code for
+// one sample of a single channel. For processing, the coefficients are
+// converted into EngineFilterIIRSections and both channels are filtered side
+// by side in an EngineFilterIIRBank.
 template<unsigned int SIZE, enum IIRPass PASS>
 class EngineFilterIIR : public EngineFilterIIRBase {
   public:
+    static constexpr int kSections = iirSectionCount(SIZE, PASS);
+
     EngineFilterIIR()
             : m_doRamping(false),
               m_doStart(false),
@@ -82,12 +105,13 @@ class EngineFilterIIR : public EngineFilterIIRBase {
     }
 
     void initBuffers() {
-        // Copy the current buffers into the old buffers
-        memcpy(m_oldBuf1, m_buf1, sizeof(m_buf1));
-        memcpy(m_oldBuf2, m_buf2, sizeof(m_buf2));
-        // Set the current buffers to 0
-        memset(m_buf1, 0, sizeof(m_buf1));
-        memset(m_buf2, 0, sizeof(m_buf2));
+        // Keep the current filter with its state for ramping
+        m_oldBank = m_bank;
+        // Start the filter with the current coefficients from silence
+        EngineFilterIIRSection sections[kSections];
+        const double gain = designSections(m_coef, sections);
+        m_bank.setCoefs(gain, sections);
+        m_bank.clearState();
         m_doRamping = true;
     }
 
@@ -104,8 +128,6 @@ class EngineFilterIIR : public EngineFilterIIRBase {
         // Copy to dynamic-ish memory to prevent fidlib API breakage.
         std::strncpy(spec_d, spec, bufsize);
 
-        // Copy the old coefficients into m_oldCoef
-        memcpy(m_oldCoef, m_coef, sizeof(m_coef));
 
         m_coef[0] = fid_design_coef(m_coef + 1, SIZE, spec_d, sampleRate, freq0, freq1, adj);
 
@@ -164,8 +186,6 @@ class EngineFilterIIR : public EngineFilterIIRBase {
         spec1_d[FIDSPEC_LENGTH - 1] = '\0';
         spec2_d[FIDSPEC_LENGTH - 1] = '\0';
 
-        // Copy the old coefficients into m_oldCoef
-        memcpy(m_oldCoef, m_coef, sizeof(m_coef));
         m_coef[0] = fid_design_coef(m_coef + 1,
                             n_coef1,
                             spec1,
@@ -231,10 +251,7 @@ class EngineFilterIIR : public EngineFilterIIRBase {
     virtual void process(const CSAMPLE* pIn, CSAMPLE* pOutput,
                          const int iBufferSize) {
         if (!m_doRamping) {
-            for (int i = 0; i < iBufferSize; i += 2) {
-                pOutput[i] = static_cast<CSAMPLE>(processSample(m_coef, m_buf1, pIn[i]));
-                pOutput[i + 1] = static_cast<CSAMPLE>(processSample(m_coef, m_buf2, pIn[i + 1]));
-            }
+            m_bank.processStereo(pIn, pOutput, iBufferSize);
         } else {
             double cross_mix = 0.0;
             double cross_inc = 4.0 / static_cast<double>(iBufferSize);
@@ -254,8 +271,10 @@ class EngineFilterIIR : public EngineFilterIIRBase {
                 double old2;
                 if (!m_doStart) {
                     // Process old filter, but only if we do not do a fresh start
-                    old1 = static_cast<CSAMPLE>(processSample(m_oldCoef, m_oldBuf1, pIn[i]));
-                    old2 = static_cast<CSAMPLE>(processSample(m_oldCoef, m_oldBuf2, pIn[i + 1]));
+                    double frame[2] = {pIn[i], pIn[i + 1]};
+                    m_oldBank.processFrame(frame);
+                    old1 = static_cast<CSAMPLE>(frame[0]);
+                    old2 = static_cast<CSAMPLE>(frame[1]);
                 } else {
                     if (m_startFromDry) {
                         old1 = pIn[i];
@@ -265,8 +284,10 @@ class EngineFilterIIR : public EngineFilterIIRBase {
                         old2 = 0;
                     }
                 }
-                double new1 = static_cast<CSAMPLE>(processSample(m_coef, m_buf1, pIn[i]));
-                double new2 = static_cast<CSAMPLE>(processSample(m_coef, m_buf2, pIn[i + 1]));
+                double frame[2] = {pIn[i], pIn[i + 1]};
+                m_bank.processFrame(frame);
+                double new1 = static_cast<CSAMPLE>(frame[0]);
+                double new2 = static_cast<CSAMPLE>(frame[1]);
 
                 if (i < iBufferSize / 2) {
                     pOutput[i] = static_cast<CSAMPLE>(old1);
@@ -283,29 +304,61 @@ class EngineFilterIIR : public EngineFilterIIRBase {
         }
     }
 
+    // Processes this filter and another filter with the same number of
+    // sections in one pass, e.g. the low and the high pass of a crossover.
+    // The four channels are filtered side by side in one EngineFilterIIRBank
+    // if the build targets AVX. Otherwise, and while one of the filters is
+    // ramping to new coefficients, they are processed one after the other.
+    template<unsigned int OTHER_SIZE, enum IIRPass OTHER_PASS>
+    void processPair(const CSAMPLE* pIn,
+            CSAMPLE* pOutput,
+            EngineFilterIIR<OTHER_SIZE, OTHER_PASS>* pOther,
+            const CSAMPLE* pOtherIn,
+            CSAMPLE* pOtherOutput,
+            const int iBufferSize) {
+        static_assert(EngineFilterIIR<OTHER_SIZE, OTHER_PASS>::kSections == kSections,
+                "Only filters with the same number of sections can be paired");
+        // Without AVX, the four lanes are processed as two SSE2 vectors, the
+        // same work as processing both filters separately plus copying their
+        // state in and out of the shared bank.
+        constexpr bool kPairLanes = enginefilteriirbank::vectorWidth(4) == 4;
+        if (!kPairLanes || m_doRamping || pOther->m_doRamping) {
+            process(pIn, pOutput, iBufferSize);
+            pOther->process(pOtherIn, pOtherOutput, iBufferSize);
+            return;
+        }
+        EngineFilterIIRBank<kSections, 4> bank;
+        bank.copyLanes(0, m_bank, 0, 2);
+        bank.copyLanes(2, pOther->m_bank, 0, 2);
+        bank.processStereoPair(pIn, pOutput, pOtherIn, pOtherOutput, iBufferSize);
+        m_bank.copyLanes(0, bank, 0, 2);
+        pOther->m_bank.copyLanes(0, bank, 2, 2);
+    }
+
+    // The generated fidlib code for a single sample of one channel
+    static inline double processSample(double* coef, double* buf, double val);
+
   protected:
-    inline double processSample(double* coef, double* buf, double val);
+    template<unsigned int, enum IIRPass>
+    friend class EngineFilterIIR;
+
+    // Converts the fidlib coefficients into the sections of the cascade and
+    // returns its gain
+    static inline double designSections(const double* coef, EngineFilterIIRSection* pSections);
+
     inline void pauseFilterInner() {
-        // Set the current buffers to 0
-        memset(m_buf1, 0, sizeof(m_buf1));
-        memset(m_buf2, 0, sizeof(m_buf2));
+        // Settle the current filter for silence
+        m_bank.clearState();
         m_doRamping = true;
         m_doStart = true;
     }
 
     double m_coef[SIZE + 1];
-    // Old coefficients needed for ramping
-    double m_oldCoef[SIZE + 1];
 
-    // Channel 1 state
-    double m_buf1[SIZE];
-    // Old channel 1 buffer needed for ramping
-    double m_oldBuf1[SIZE];
-
-    // Channel 2 state
-    double m_buf2[SIZE];
-    // Old channel 2 buffer needed for ramping
-    double m_oldBuf2[SIZE];
+    // The filter of both channels
+    EngineFilterIIRBank<kSections, 2> m_bank;
+    // The old filter of both channels needed for ramping
+    EngineFilterIIRBank<kSections, 2> m_oldBank;
 
     // Flag set to true if ramping needs to be done
     bool m_doRamping;
@@ -643,3 +696,179 @@ inline double EngineFilterIIR<2, IIR_HP2>::processSample(double* coef,
 
     return val;
 }
+
+// The numerators of the sections designed by fidlib
+namespace enginefilteriir {
+
+constexpr EngineFilterIIRSection kLowPassSection = {2.0, 1.0, 0.0, 0.0};
+constexpr EngineFilterIIRSection kBandPassSection = {0.0, -1.0, 0.0, 0.0};
+constexpr EngineFilterIIRSection kHighPassSection = {-2.0, 1.0, 0.0, 0.0};
+constexpr EngineFilterIIRSection kFirstOrderLowPassSection = {1.0, 0.0, 0.0, 0.0};
+constexpr EngineFilterIIRSection kFirstOrderHighPassSection = {-1.0, 0.0, 0.0, 0.0};
+
+// Fills the sections from the fidlib coefficients and returns the gain.
+// coef[0] is the gain of the whole cascade, followed by the feedback
+// coefficients of each section, a2 before a1 for second order sections.
+inline double designSections(const double* coef,
+        const EngineFilterIIRSection* pNumerators,
+        int numSections,
+        bool secondOrder,
+        EngineFilterIIRSection* pSections) {
+    const double* pFeedback = coef + 1;
+    for (int i = 0; i < numSections; ++i) {
+        EngineFilterIIRSection section = pNumerators[i];
+        if (secondOrder) {
+            section.a2 = *pFeedback++;
+            section.a1 = *pFeedback++;
+        } else {
+            section.a1 = *pFeedback++;
+        }
+        pSections[i] = section;
+    }
+    return coef[0];
+}
+
+} // namespace enginefilteriir
+
+template<>
+inline double EngineFilterIIR<2, IIR_LP>::designSections(
+        const double* coef, EngineFilterIIRSection* pSections) {
+    const EngineFilterIIRSection numerators[] = {enginefilteriir::kLowPassSection};
+    return enginefilteriir::designSections(coef, numerators, kSections, true, pSections);
+}
+
+template<>
+inline double EngineFilterIIR<2, IIR_BP>::designSections(
+        const double* coef, EngineFilterIIRSection* pSections) {
+    const EngineFilterIIRSection numerators[] = {enginefilteriir::kBandPassSection};
+    return enginefilteriir::designSections(coef, numerators, kSections, true, pSections);
+}
+
+template<>
+inline double EngineFilterIIR<2, IIR_HP>::designSections(
+        const double* coef, EngineFilterIIRSection* pSections) {
+    const EngineFilterIIRSection numerators[] = {enginefilteriir::kHighPassSection};
+    return enginefilteriir::designSections(coef, numerators, kSections, true, pSections);
+}
+
+template<>
+inline double EngineFilterIIR<4, IIR_LP>::designSections(
+        const double* coef, EngineFilterIIRSection* pSections) {
+    const EngineFilterIIRSection numerators[] = {
+            enginefilteriir::kLowPassSection,
+            enginefilteriir::kLowPassSection};
+    return enginefilteriir::designSections(coef, numerators, kSections, true, pSections);
+}
+
+// The high pass sections are followed by the low pass sections
+template<>
+inline double EngineFilterIIR<8, IIR_BP>::designSections(
+        const double* coef, EngineFilterIIRSection* pSections) {
+    const EngineFilterIIRSection numerators[] = {
+            enginefilteriir::kHighPassSection,
+            enginefilteriir::kHighPassSection,
+            enginefilteriir::kLowPassSection,
+            enginefilteriir::kLowPassSection};
+    return enginefilteriir::designSections(coef, numerators, kSections, true, pSections);
+}
+
+template<>
+inline double EngineFilterIIR<4, IIR_HP>::designSections(
+        const double* coef, EngineFilterIIRSection* pSections) {
+    const EngineFilterIIRSection numerators[] = {
+            enginefilteriir::kHighPassSection,
+            enginefilteriir::kHighPassSection};
+    return enginefilteriir::designSections(coef, numerators, kSections, true, pSections);
+}
+
+template<>
+inline double EngineFilterIIR<8, IIR_LP>::designSections(
+        const double* coef, EngineFilterIIRSection* pSections) {
+    const EngineFilterIIRSection numerators[] = {
+            enginefilteriir::kLowPassSection,
+            enginefilteriir::kLowPassSection,
+            enginefilteriir::kLowPassSection,
+            enginefilteriir::kLowPassSection};
+    return enginefilteriir::designSections(coef, numerators, kSections, true, pSections);
+}
+
+// The high pass sections are followed by the low pass sections
+template<>
+inline double EngineFilterIIR<16, IIR_BP>::designSections(
+        const double* coef, EngineFilterIIRSection* pSections) {
+    const EngineFilterIIRSection numerators[] = {
+            enginefilteriir::kHighPassSection,
+            enginefilteriir::kHighPassSection,
+            enginefilteriir::kHighPassSection,
+            enginefilteriir::kHighPassSection,
+            enginefilteriir::kLowPassSection,
+            enginefilteriir::kLowPassSection,
+            enginefilteriir::kLowPassSection,
+            enginefilteriir::kLowPassSection};
+    return enginefilteriir::designSections(coef, numerators, kSections, true, pSections);
+}
+
+template<>
+inline double EngineFilterIIR<8, IIR_HP>::designSections(
+        const double* coef, EngineFilterIIRSection* pSections) {
+    const EngineFilterIIRSection numerators[] = {
+            enginefilteriir::kHighPassSection,
+            enginefilteriir::kHighPassSection,
+            enginefilteriir::kHighPassSection,
+            enginefilteriir::kHighPassSection};
+    return enginefilteriir::designSections(coef, numerators, kSections, true, pSections);
+}
+
+template<>
+inline double EngineFilterIIR<5, IIR_BP>::designSections(
+        const double* coef, EngineFilterIIRSection* pSections) {
+    // A single section with its own numerator: coef = {gain, a2, b2, a1, b1, b0}
+    if (coef[5] == 0.0) {
+        // Not designed yet
+        pSections[0] = {0.0, 0.0, 0.0, 0.0};
+        return 0.0;
+    }
+    pSections[0] = {coef[4] / coef[5], coef[2] / coef[5], coef[3], coef[1]};
+    return coef[0] * coef[5];
+}
+
+template<>
+inline double EngineFilterIIR<4, IIR_LPMO>::designSections(
+        const double* coef, EngineFilterIIRSection* pSections) {
+    const EngineFilterIIRSection numerators[] = {
+            enginefilteriir::kFirstOrderLowPassSection,
+            enginefilteriir::kFirstOrderLowPassSection,
+            enginefilteriir::kFirstOrderLowPassSection,
+            enginefilteriir::kFirstOrderLowPassSection};
+    return enginefilteriir::designSections(coef, numerators, kSections, false, pSections);
+}
+
+template<>
+inline double EngineFilterIIR<4, IIR_HPMO>::designSections(
+        const double* coef, EngineFilterIIRSection* pSections) {
+    const EngineFilterIIRSection numerators[] = {
+            enginefilteriir::kFirstOrderHighPassSection,
+            enginefilteriir::kFirstOrderHighPassSection,
+            enginefilteriir::kFirstOrderHighPassSection,
+            enginefilteriir::kFirstOrderHighPassSection};
+    return enginefilteriir::designSections(coef, numerators, kSections, false, pSections);
+}
+
+template<>
+inline double EngineFilterIIR<2, IIR_LP2>::designSections(
+        const double* coef, EngineFilterIIRSection* pSections) {
+    const EngineFilterIIRSection numerators[] = {
+            enginefilteriir::kFirstOrderLowPassSection,
+            enginefilteriir::kFirstOrderLowPassSection};
+    return enginefilteriir::designSections(coef, numerators, kSections, false, pSections);
+}
+
+// The gain is negated to be in phase with IIR_LP2
+template<>
+inline double EngineFilterIIR<2, IIR_HP2>::designSections(
+        const double* coef, EngineFilterIIRSection* pSections) {
+    const EngineFilterIIRSection numerators[] = {
+            enginefilteriir::kFirstOrderHighPassSection,
+            enginefilteriir::kFirstOrderHighPassSection};
+    return -enginefilteriir::designSections(coef, numerators, kSections, false, pSections);
+}
@@ -0,0 +1,338 @@
+#pragma once
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define ENGINEFILTERIIRBANK_SSE2
+#include <emmintrin.h>
+#endif
+#ifdef __AVX__
+#include <immintrin.h>
+#endif
+
+#include "util/assert.h"
+#include "util/types.h"
+
+/// The coefficients of a first or second order section of an IIR filter,
+/// normalized to a0 = b0 = 1:
+///
+///     H(z) = (1 + b1 z^-1 + b2 z^-2) / (1 + a1 z^-1 + a2 z^-2)
+///
+/// A first order section has b2 = a2 = 0. The gains of all sections are
+/// combined into the gain of the cascade, like fidlib does.
+struct EngineFilterIIRSection {
+    double b1;
+    double b2;
+    double a1;
+    double a2;
+};
+
+namespace enginefilteriirbank {
+
+// The operations on a SIMD register with WIDTH lanes of doubles
+template<int WIDTH>
+struct Vector;
+
+template<>
+struct Vector<1> {
+    using Type = double;
+    static Type load(const double* p) {
+        return *p;
+    }
+    static void store(double* p, Type v) {
+        *p = v;
+    }
+    static Type add(Type a, Type b) {
+        return a + b;
+    }
+    static Type sub(Type a, Type b) {
+        return a - b;
+    }
+    static Type mul(Type a, Type b) {
+        return a * b;
+    }
+};
+
+#ifdef ENGINEFILTERIIRBANK_SSE2
+template<>
+struct Vector<2> {
+    using Type = __m128d;
+    static Type load(const double* p) {
+        return _mm_load_pd(p);
+    }
+    static void store(double* p, Type v) {
+        _mm_store_pd(p, v);
+    }
+    static Type add(Type a, Type b) {
+        return _mm_add_pd(a, b);
+    }
+    static Type sub(Type a, Type b) {
+        return _mm_sub_pd(a, b);
+    }
+    static Type mul(Type a, Type b) {
+        return _mm_mul_pd(a, b);
+    }
+};
+#endif
+
+#ifdef __AVX__
+template<>
+struct Vector<4> {
+    using Type = __m256d;
+    static Type load(const double* p) {
+        return _mm256_load_pd(p);
+    }
+    static void store(double* p, Type v) {
+        _mm256_store_pd(p, v);
+    }
+    static Type add(Type a, Type b) {
+        return _mm256_add_pd(a, b);
+    }
+    static Type sub(Type a, Type b) {
+        return _mm256_sub_pd(a, b);
+    }
+    static Type mul(Type a, Type b) {
+        return _mm256_mul_pd(a, b);
+    }
+};
+#endif
+
+// The widest register for the lanes of a bank in the current build
+constexpr int vectorWidth(int lanes) {
+#ifdef __AVX__
+    if (lanes % 4 == 0) {
+        return 4;
+    }
+#endif
+#ifdef ENGINEFILTERIIRBANK_SSE2
+    if (lanes % 2 == 0) {
+        return 2;
+    }
+#endif
+    return 1;
+}
+
+} // namespace enginefilteriirbank
+
+/// A cascade of SECTIONS filter sections in direct form II that filters
+/// LANES independent signals side by side. Each lane has its own
+/// coefficients and state, e.g. the two channels of a stereo signal or the
+/// channels of two filters that run in the same callback.
+///
+/// The cascade itself is sequential, so batching lanes is the only way to
+/// vectorize an IIR filter without changing its output. The coefficients and
+/// the state of a section are stored contiguously for all lanes and processed
+/// with one SSE2 register per two lanes, or one AVX register per four lanes
+/// if the build targets AVX. Compilers do not reliably vectorize the lanes on
+/// their own, especially with -ffast-math, hence the intrinsics.
+///
+/// Each section adds only a subtraction to the recursion of the previous
+/// sample, and two subtractions and an addition to the path from the input to
+/// the output, which limits the speed more than the number of multiplications.
+template<int SECTIONS, int LANES>
+class EngineFilterIIRBank {
+  public:
+    static_assert(SECTIONS > 0);
+    static_assert(LANES > 0);
+
+    EngineFilterIIRBank() {
+        for (int l = 0; l < LANES; ++l) {
+            m_cascade.gain[l] = 0.0;
+        }
+        for (int s = 0; s < SECTIONS; ++s) {
+            for (int l = 0; l < LANES; ++l) {
+                m_cascade.b1[s][l] = 0.0;
+                m_cascade.b2[s][l] = 0.0;
+                m_cascade.a1[s][l] = 0.0;
+                m_cascade.a2[s][l] = 0.0;
+            }
+        }
+        clearState();
+    }
+
+    /// Sets the coefficients of one lane. The state is kept.
+    void setCoefs(int lane, double gain, const EngineFilterIIRSection* pSections) {
+        DEBUG_ASSERT(lane >= 0 && lane < LANES);
+        m_cascade.gain[lane] = gain;
+        for (int s = 0; s < SECTIONS; ++s) {
+            m_cascade.b1[s][lane] = pSections[s].b1;
+            m_cascade.b2[s][lane] = pSections[s].b2;
+            m_cascade.a1[s][lane] = pSections[s].a1;
+            m_cascade.a2[s][lane] = pSections[s].a2;
+        }
+    }
+
+    /// Sets the same coefficients for all lanes
+    void setCoefs(double gain, const EngineFilterIIRSection* pSections) {
+        for (int l = 0; l < LANES; ++l) {
+            setCoefs(l, gain, pSections);
+        }
+    }
+
+    /// Settles all lanes for silent input
+    void clearState() {
+        for (int s = 0; s < SECTIONS; ++s) {
+            for (int l = 0; l < LANES; ++l) {
+                m_cascade.w1[s][l] = 0.0;
+                m_cascade.w2[s][l] = 0.0;
+            }
+        }
+    }
+
+    /// Copies the coefficients and the state of numLanes lanes of another
+    /// bank with the same sections, starting at the lane otherLane, into
+    /// the lanes of this bank starting at lane.
+    template<int OTHER_LANES>
+    void copyLanes(int lane,
+            const EngineFilterIIRBank<SECTIONS, OTHER_LANES>& other,
+            int otherLane,
+            int numLanes) {
+        DEBUG_ASSERT(lane >= 0 && lane + numLanes <= LANES);
+        DEBUG_ASSERT(otherLane >= 0 && otherLane + numLanes <= OTHER_LANES);
+        const auto& otherCascade = other.m_cascade;
+        for (int l = 0; l < numLanes; ++l) {
+            m_cascade.gain[lane + l] = otherCascade.gain[otherLane + l];
+        }
+        for (int s = 0; s < SECTIONS; ++s) {
+            for (int l = 0; l < numLanes; ++l) {
+                m_cascade.b1[s][lane + l] = otherCascade.b1[s][otherLane + l];
+                m_cascade.b2[s][lane + l] = otherCascade.b2[s][otherLane + l];
+                m_cascade.a1[s][lane + l] = otherCascade.a1[s][otherLane + l];
+                m_cascade.a2[s][lane + l] = otherCascade.a2[s][otherLane + l];
+                m_cascade.w1[s][lane + l] = otherCascade.w1[s][otherLane + l];
+                m_cascade.w2[s][lane + l] = otherCascade.w2[s][otherLane + l];
+            }
+        }
+    }
+
+    /// Filters one sample of each lane in place
+    void processFrame(double (&frame)[LANES]) {
+        for (int l = 0; l < LANES; ++l) {
+            frame[l] *= m_cascade.gain[l];
+        }
+        for (int s = 0; s < SECTIONS; ++s) {
+            for (int l = 0; l < LANES; ++l) {
+                const double w1 = m_cascade.w1[s][l];
+                const double w2 = m_cascade.w2[s][l];
+                const double w = (frame[l] - m_cascade.a2[s][l] * w2) -
+                        m_cascade.a1[s][l] * w1;
+                frame[l] = w + (m_cascade.b1[s][l] * w1 + m_cascade.b2[s][l] * w2);
+                m_cascade.w2[s][l] = w1;
+                m_cascade.w1[s][l] = w;
+            }
+        }
+    }
+
+    /// Filters an interleaved stereo buffer with lane 0 for the left and
+    /// lane 1 for the right channel. The buffers may be the same.
+    void processStereo(const CSAMPLE* pIn, CSAMPLE* pOutput, int iBufferSize) {
+        static_assert(LANES == 2, "A stereo signal needs two lanes");
+        processFrames(
+                iBufferSize / 2,
+                [pIn](int frame, double* pSamples) {
+                    pSamples[0] = pIn[frame * 2];
+                    pSamples[1] = pIn[frame * 2 + 1];
+                },
+                [pOutput](int frame, const double* pSamples) {
+                    pOutput[frame * 2] = static_cast<CSAMPLE>(pSamples[0]);
+                    pOutput[frame * 2 + 1] = static_cast<CSAMPLE>(pSamples[1]);
+                });
+    }
+
+    /// Filters two interleaved stereo buffers of the same size at once, the
+    /// first one with the lanes 0 and 1 and the second one with the lanes
+    /// 2 and 3. Each frame of both inputs is read before the frame is written,
+    /// so any of the buffers may be the same.
+    void processStereoPair(const CSAMPLE* pIn1,
+            CSAMPLE* pOutput1,
+            const CSAMPLE* pIn2,
+            CSAMPLE* pOutput2,
+            int iBufferSize) {
+        static_assert(LANES == 4, "Two stereo signals need four lanes");
+        processFrames(
+                iBufferSize / 2,
+                [pIn1, pIn2](int frame, double* pSamples) {
+                    pSamples[0] = pIn1[frame * 2];
+                    pSamples[1] = pIn1[frame * 2 + 1];
+                    pSamples[2] = pIn2[frame * 2];
+                    pSamples[3] = pIn2[frame * 2 + 1];
+                },
+                [pOutput1, pOutput2](int frame, const double* pSamples) {
+                    pOutput1[frame * 2] = static_cast<CSAMPLE>(pSamples[0]);
+                    pOutput1[frame * 2 + 1] = static_cast<CSAMPLE>(pSamples[1]);
+                    pOutput2[frame * 2] = static_cast<CSAMPLE>(pSamples[2]);
+                    pOutput2[frame * 2 + 1] = static_cast<CSAMPLE>(pSamples[3]);
+                });
+    }
+
+  private:
+    template<int, int>
+    friend class EngineFilterIIRBank;
+
+    static constexpr int kWidth = enginefilteriirbank::vectorWidth(LANES);
+    static constexpr int kGroups = LANES / kWidth;
+    using Vector = enginefilteriirbank::Vector<kWidth>;
+    using V = typename Vector::Type;
+
+    struct Cascade {
+        alignas(32) double gain[LANES];
+        alignas(32) double b1[SECTIONS][LANES];
+        alignas(32) double b2[SECTIONS][LANES];
+        alignas(32) double a1[SECTIONS][LANES];
+        alignas(32) double a2[SECTIONS][LANES];
+        // The delayed intermediate values of the direct form II
+        alignas(32) double w1[SECTIONS][LANES];
+        alignas(32) double w2[SECTIONS][LANES];
+    };
+
+    // Same as processFrame() for numFrames frames, with the state kept in
+    // registers between the frames
+    template<typename ReadFrame, typename WriteFrame>
+    inline void processFrames(int numFrames, ReadFrame readFrame, WriteFrame writeFrame) {
+        const Cascade& c = m_cascade;
+        V w1[SECTIONS][kGroups];
+        V w2[SECTIONS][kGroups];
+        for (int s = 0; s < SECTIONS; ++s) {
+            for (int g = 0; g < kGroups; ++g) {
+                w1[s][g] = Vector::load(&c.w1[s][g * kWidth]);
+                w2[s][g] = Vector::load(&c.w2[s][g * kWidth]);
+            }
+        }
+        for (int frame = 0; frame < numFrames; ++frame) {
+            alignas(32) double samples[LANES];
+            readFrame(frame, samples);
+            V x[kGroups];
+            for (int g = 0; g < kGroups; ++g) {
+                x[g] = Vector::mul(Vector::load(&samples[g * kWidth]),
+                        Vector::load(&c.gain[g * kWidth]));
+            }
+            for (int s = 0; s < SECTIONS; ++s) {
+                for (int g = 0; g < kGroups; ++g) {
+                    const V w = Vector::sub(
+                            Vector::sub(x[g],
+                                    Vector::mul(Vector::load(&c.a2[s][g * kWidth]),
+                                            w2[s][g])),
+                            Vector::mul(Vector::load(&c.a1[s][g * kWidth]), w1[s][g]));
+                    x[g] = Vector::add(w,
+                            Vector::add(
+                                    Vector::mul(Vector::load(&c.b1[s][g * kWidth]),
+                                            w1[s][g]),
+                                    Vector::mul(Vector::load(&c.b2[s][g * kWidth]),
+                                            w2[s][g])));
+                    w2[s][g] = w1[s][g];
+                    w1[s][g] = w;
+                }
+            }
+            for (int g = 0; g < kGroups; ++g) {
+                Vector::store(&samples[g * kWidth], x[g]);
+            }
+            writeFrame(frame, samples);
+        }
+        for (int s = 0; s < SECTIONS; ++s) {
+            for (int g = 0; g < kGroups; ++g) {
+                Vector::store(&m_cascade.w1[s][g * kWidth], w1[s][g]);
+                Vector::store(&m_cascade.w2[s][g * kWidth], w2[s][g]);
+            }
+        }
+    }
+
+    Cascade m_cascade;
+};
@@ -13,7 +13,6 @@ EngineFilterLinkwitzRiley2Low::EngineFilterLinkwitzRiley2Low(int sampleRate, dou
 
 void EngineFilterLinkwitzRiley2Low::setFrequencyCorners(int sampleRate,
                                              double freqCorner1) {
-    // Copy the old coefficients into m_oldCoef
     setCoefs2(sampleRate,
             1,
             kFidSpecLowPassButterworth1,
@@ -13,7 +13,6 @@ EngineFilterLinkwitzRiley4Low::EngineFilterLinkwitzRiley4Low(int sampleRate, dou
 
 void EngineFilterLinkwitzRiley4Low::setFrequencyCorners(int sampleRate,
                                              double freqCorner1) {
-    // Copy the old coefficients into m_oldCoef
     setCoefs2(sampleRate,
             2,
             kFidSpecLowPassButterworth2,
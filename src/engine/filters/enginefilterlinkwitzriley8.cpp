@@ -13,7 +13,6 @@ EngineFilterLinkwitzRiley8Low::EngineFilterLinkwitzRiley8Low(int sampleRate, dou
 
 void EngineFilterLinkwitzRiley8Low::setFrequencyCorners(int sampleRate,
                                              double freqCorner1) {
-    // Copy the old coefficients into m_oldCoef
     setCoefs2(sampleRate,
             4,
             kFidSpecLowPassButterworth4,
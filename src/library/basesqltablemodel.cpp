@@ -31,6 +31,11 @@ const bool sDebug = false;
 constexpr int kIdColumn = 0;
 constexpr int kMaxSortColumns = 3;
 
+// Patching the rows of the changed tracks one by one only pays off
+// for a few tracks, e.g. while tracks are played or analyzed. Larger
+// batches of changes like library scans are reselected as a whole.
+constexpr int kMaxPatchedTracks = 100;
+
 // Constant for getModelSetting(name)
 const QString COLUMNS_SORTING = QStringLiteral("ColumnsSorting");
 
@@ -46,9 +51,21 @@ BaseSqlTableModel::BaseSqlTableModel(
           m_pTrackCollectionManager(pTrackCollectionManager),
           m_database(pTrackCollectionManager->internalCollection()->database()),
           m_bInitialized(false) {
+    TrackQueryExecutor* const pQueryExecutor = pTrackCollectionManager->queryExecutor();
+    if (pQueryExecutor) {
+        connect(pQueryExecutor,
+                &TrackQueryExecutor::rowsFetched,
+                this,
+                &BaseSqlTableModel::slotRowsFetched);
+        connect(pQueryExecutor,
+                &TrackQueryExecutor::requestFinished,
+                this,
+                &BaseSqlTableModel::slotRequestFinished);
+    }
 }
 
 BaseSqlTableModel::~BaseSqlTableModel() {
+    cancelSelectInBackground();
 }
 
 void BaseSqlTableModel::initHeaderProperties() {
@@ -211,12 +228,14 @@ void BaseSqlTableModel::select() {
         qDebug() << this << "select()";
     }
 
+    // The rows of a pending search would be outdated
+    const bool searchPending = cancelSelectInBackground();
+
     PerformanceTimer time;
     time.start();
 
     // Prepare query for id and all columns not in m_trackSource
-    QString queryString = QString("SELECT %1 FROM %2 %3")
-                                  .arg(m_tableColumns.join(","), m_tableName, m_tableOrderBy);
+    QString queryString = selectQueryString();
 
     if (sDebug) {
         qDebug() << this << "select() executing:" << queryString;
@@ -235,11 +254,6 @@ void BaseSqlTableModel::select() {
         return;
     }
 
-    // Remove all the rows from the table after(!) the query has been
-    // executed successfully. See Bug #1090888.
-    // TODO(rryan) we could edit the table in place instead of clearing it?
-    clearRows();
-
     // The size of the result set is not known in advance for a
     // forward-only query, so we cannot reserve memory for rows
     // in advance.
@@ -282,6 +296,30 @@ void BaseSqlTableModel::select() {
         qDebug() << "Rows actually received:" << rowInfos.size();
     }
 
+    // Remove all the rows from the table after(!) the query has been
+    // executed successfully. See Bug #1090888.
+    filterAndSortRows(std::move(rowInfos), trackIds, nullptr);
+
+    qDebug() << this << "select() took" << time.elapsed().debugMillisWithUnit()
+             << m_rowInfo.size();
+
+    if (searchPending) {
+        emit searchFinished();
+    }
+}
+
+QString BaseSqlTableModel::selectQueryString() const {
+    return QString("SELECT %1 FROM %2 %3")
+            .arg(m_tableColumns.join(","), m_tableName, m_tableOrderBy);
+}
+
+void BaseSqlTableModel::filterAndSortRows(
+        QVector<RowInfo>&& rowInfos,
+        const QSet<TrackId>& trackIds,
+        const QVector<TrackId>* pQueriedTrackIds) {
+    // TODO(rryan) we could edit the table in place instead of clearing it?
+    clearRows();
+
     if (m_trackSource) {
         m_trackSource->filterAndSort(trackIds,
                 m_currentSearch,
@@ -289,7 +327,8 @@ void BaseSqlTableModel::select() {
                 m_trackSourceOrderBy,
                 m_sortColumns,
                 m_tableColumns.size() - 1, // exclude the 1st column with the id
-                &m_trackSortOrder);
+                &m_trackSortOrder,
+                pQueriedTrackIds);
 
         // Re-sort the track IDs since filterAndSort can change their order or mark
         // them for removal (by setting their row to -1).
@@ -336,9 +375,104 @@ void BaseSqlTableModel::select() {
             std::move(trackIdToRows));
     // Both rowInfo and trackIdToRows (might) have been moved and
     // must not be used afterwards!
+}
 
-    qDebug() << this << "select() took" << time.elapsed().debugMillisWithUnit()
+bool BaseSqlTableModel::selectInBackground() {
+    TrackQueryExecutor* const pQueryExecutor = m_pTrackCollectionManager->queryExecutor();
+    if (!m_bInitialized || !pQueryExecutor) {
+        return false;
+    }
+    cancelSelectInBackground();
+
+    TrackQueryExecutor::Request request;
+    QStringList viewNames = {m_tableName};
+    request.queries.append(selectQueryString());
+    if (m_trackSource) {
+        // Only needed if the track source can't filter and sort the
+        // tracks with its cached values
+        const QString trackSourceQuery = m_trackSource->formatFilterAndSortQuery(
+                QString("SELECT %1 FROM %2").arg(m_idColumn, m_tableName),
+                m_currentSearch,
+                m_currentSearchFilter,
+                m_trackSourceOrderBy,
+                m_sortColumns,
+                m_tableColumns.size() - 1);
+        if (!trackSourceQuery.isEmpty()) {
+            viewNames.append(m_trackSource->tableName());
+            request.queries.append(trackSourceQuery);
+        }
+    }
+    request.views = TrackQueryExecutor::temporaryViews(m_database, viewNames);
+
+    if (sDebug) {
+        qDebug() << this << "selectInBackground() executing:" << request.queries;
+    }
+
+    m_pendingSelect.time.start();
+    m_pendingSelect.queriedTrackSource = request.queries.size() > 1;
+    m_pendingSelect.requestId = pQueryExecutor->submit(this, std::move(request));
+    return true;
+}
+
+bool BaseSqlTableModel::cancelSelectInBackground() {
+    if (m_pendingSelect.requestId == 0) {
+        return false;
+    }
+    m_pTrackCollectionManager->queryExecutor()->cancel(this);
+    m_pendingSelect = PendingSelect();
+    return true;
+}
+
+void BaseSqlTableModel::slotRowsFetched(
+        quint64 requestId,
+        int query,
+        const TrackQueryExecutor::Rows& rows) {
+    if (requestId != m_pendingSelect.requestId) {
+        return;
+    }
+    // Each batch is processed while the next batch is fetched
+    if (query == 0) {
+        m_pendingSelect.rowInfos.reserve(m_pendingSelect.rowInfos.size() + rows.size());
+        for (const auto& row : rows) {
+            RowInfo rowInfo;
+            rowInfo.trackId = TrackId(row.value(kIdColumn));
+            // current position defines the ordering
+            rowInfo.order = m_pendingSelect.rowInfos.size();
+            rowInfo.metadata = row;
+            m_pendingSelect.trackIds.insert(rowInfo.trackId);
+            m_pendingSelect.rowInfos.push_back(std::move(rowInfo));
+        }
+    } else {
+        m_pendingSelect.queriedTrackIds.reserve(
+                m_pendingSelect.queriedTrackIds.size() + rows.size());
+        for (const auto& row : rows) {
+            m_pendingSelect.queriedTrackIds.append(TrackId(row.value(0)));
+        }
+    }
+}
+
+void BaseSqlTableModel::slotRequestFinished(quint64 requestId, bool success) {
+    if (requestId != m_pendingSelect.requestId) {
+        return;
+    }
+    PendingSelect pendingSelect = std::move(m_pendingSelect);
+    m_pendingSelect = PendingSelect();
+    if (!success) {
+        qWarning() << this << "Failed to select rows in background";
+        select();
+        emit searchFinished();
+        return;
+    }
+
+    filterAndSortRows(std::move(pendingSelect.rowInfos),
+            pendingSelect.trackIds,
+            pendingSelect.queriedTrackSource ? &pendingSelect.queriedTrackIds : nullptr);
+
+    qDebug() << this << "selectInBackground() took"
+             << pendingSelect.time.elapsed().debugMillisWithUnit()
              << m_rowInfo.size();
+
+    emit searchFinished();
 }
 
 void BaseSqlTableModel::setTable(const QString& tableName,
@@ -348,6 +482,7 @@ void BaseSqlTableModel::setTable(const QString& tableName,
     if (sDebug) {
         qDebug() << this << "setTable" << tableName << tableColumns << idColumn;
     }
+    cancelSelectInBackground();
     m_tableName = tableName;
     m_idColumn = idColumn;
     m_tableColumns = tableColumns;
@@ -419,7 +554,9 @@ void BaseSqlTableModel::search(const QString& searchText, const QString& extraFi
         qDebug() << this << "search" << searchText;
     }
     setSearch(searchText, extraFilter);
-    select();
+    if (!selectInBackground()) {
+        select();
+    }
 }
 
 void BaseSqlTableModel::setSort(int column, Qt::SortOrder order) {
@@ -832,18 +969,237 @@ void BaseSqlTableModel::tracksChanged(const QSet<TrackId>& trackIds) {
         qDebug() << this << "trackChanged" << trackIds.size();
     }
 
+    // The rows of a pending search are filtered and sorted when
+    // they have been fetched
+    if (m_bInitialized && m_trackSource && !isSearchPending()) {
+        if (isAffectedByTracks(trackIds) &&
+                (trackIds.size() > kMaxPatchedTracks || !patchRows(trackIds))) {
+            if (!selectInBackground()) {
+                select();
+            }
+            return;
+        }
+    }
+
     const int numColumns = columnCount();
     for (const auto& trackId : trackIds) {
         const auto rows = getTrackRows(trackId);
         for (int row : rows) {
             //qDebug() << "Row in this result set was updated. Signalling update. track:" << trackId << "row:" << row;
             QModelIndex topLeft = index(row, 0);
-            QModelIndex bottomRight = index(row, numColumns);
+            QModelIndex bottomRight = index(row, numColumns - 1);
             emit dataChanged(topLeft, bottomRight);
         }
     }
 }
 
+bool BaseSqlTableModel::isAffectedByTracks(const QSet<TrackId>& trackIds) const {
+    // Without a search, the changed tracks can only affect the rows that
+    // are already shown. Like before patching, tracks that enter the table
+    // are picked up when it is selected again, e.g. after a library scan
+    // or when a crate or playlist changes.
+    if (!m_currentSearch.isEmpty() || !m_currentSearchFilter.isEmpty()) {
+        return true;
+    }
+    for (const auto& trackId : trackIds) {
+        if (m_trackIdToRows.contains(trackId)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool BaseSqlTableModel::patchRows(const QSet<TrackId>& trackIds) {
+    DEBUG_ASSERT(m_trackSource);
+    PerformanceTimer time;
+    time.start();
+
+    // The tracks might have been added to or removed from the table,
+    // e.g. when hiding tracks
+    QHash<TrackId, QVector<QVector<QVariant>>> tableRows;
+    if (!selectTrackRows(trackIds, &tableRows)) {
+        return false;
+    }
+
+    // Only the changed tracks are matched against the current search
+    QHash<TrackId, int> matchingTracks;
+    const bool filtered = !m_currentSearch.isEmpty() || !m_currentSearchFilter.isEmpty();
+    if (filtered && !tableRows.isEmpty()) {
+        QSet<TrackId> tableTrackIds;
+        tableTrackIds.reserve(tableRows.size());
+        for (auto it = tableRows.constBegin(); it != tableRows.constEnd(); ++it) {
+            tableTrackIds.insert(it.key());
+        }
+        m_trackSource->filterAndSort(tableTrackIds,
+                m_currentSearch,
+                m_currentSearchFilter,
+                QString(),
+                QList<SortColumn>(),
+                m_tableColumns.size() - 1, // exclude the 1st column with the id
+                &matchingTracks);
+    }
+    // Otherwise the rows are sorted by the database or by a table column
+    // that doesn't depend on the tracks
+    const bool sorted = m_trackSource->canCompareTracks(m_currentSearchFilter,
+            m_trackSourceOrderBy,
+            m_sortColumns,
+            m_tableColumns.size() - 1);
+    const auto isVisible = [&](TrackId trackId) {
+        return tableRows.contains(trackId) &&
+                (!filtered || matchingTracks.contains(trackId));
+    };
+    if (!sorted) {
+        for (const auto& trackId : trackIds) {
+            if (isVisible(trackId) && !m_trackIdToRows.contains(trackId)) {
+                // Only the database knows where to insert the rows
+                return false;
+            }
+        }
+    }
+
+    bool rowsChanged = false;
+    for (const auto& trackId : trackIds) {
+        QVector<int> rows;
+        if (rowsChanged) {
+            for (int row = 0; row < m_rowInfo.size(); ++row) {
+                if (m_rowInfo[row].trackId == trackId) {
+                    rows.append(row);
+                }
+            }
+        } else {
+            rows = m_trackIdToRows.value(trackId);
+        }
+
+        if (!isVisible(trackId)) {
+            // Remove the rows from the bottom to keep the other rows valid
+            for (auto it = rows.crbegin(); it != rows.crend(); ++it) {
+                beginRemoveRows(QModelIndex(), *it, *it);
+                m_rowInfo.remove(*it);
+                endRemoveRows();
+                rowsChanged = true;
+            }
+            continue;
+        }
+        if (!sorted) {
+            continue;
+        }
+        if (rows.isEmpty()) {
+            for (const auto& metadata : tableRows.value(trackId)) {
+                const int row = findSortedRow(trackId);
+                beginInsertRows(QModelIndex(), row, row);
+                m_rowInfo.insert(row, RowInfo{trackId, 0, metadata});
+                endInsertRows();
+                rowsChanged = true;
+            }
+            continue;
+        }
+        // The table columns don't depend on the track, so the rows are
+        // moved with their current metadata. Moving a row preserves the
+        // selection and the scroll position of the views.
+        for (int i = 0; i < rows.size(); ++i) {
+            const int row = rows[i];
+            if (isRowSorted(row)) {
+                continue;
+            }
+            const int sortedRow = findSortedRow(trackId, row);
+            // The destination is the row before which the moved row is inserted
+            const int destinationRow = sortedRow <= row ? sortedRow : sortedRow + 1;
+            if (!beginMoveRows(QModelIndex(), row, row, QModelIndex(), destinationRow)) {
+                continue;
+            }
+            m_rowInfo.move(row, sortedRow);
+            endMoveRows();
+            rowsChanged = true;
+            // Shift the remaining rows of the track between both positions
+            for (int j = i + 1; j < rows.size(); ++j) {
+                if (rows[j] > row && rows[j] <= sortedRow) {
+                    --rows[j];
+                } else if (rows[j] < row && rows[j] >= sortedRow) {
+                    ++rows[j];
+                }
+            }
+        }
+    }
+
+    if (rowsChanged) {
+        updateTrackIdToRows();
+    }
+    if (sDebug) {
+        qDebug() << this << "patchRows() took" << time.elapsed().debugMillisWithUnit()
+                 << m_rowInfo.size();
+    }
+    return true;
+}
+
+bool BaseSqlTableModel::selectTrackRows(const QSet<TrackId>& trackIds,
+        QHash<TrackId, QVector<QVector<QVariant>>>* pRowsByTrackId) const {
+    QStringList idStrings;
+    idStrings.reserve(trackIds.size());
+    for (const auto& trackId : trackIds) {
+        idStrings << trackId.toString();
+    }
+    QSqlQuery query(m_database);
+    query.setForwardOnly(true);
+    if (!query.prepare(QString("SELECT %1 FROM %2 WHERE %3 IN (%4) %5")
+                               .arg(m_tableColumns.join(","),
+                                       m_tableName,
+                                       m_idColumn,
+                                       idStrings.join(","),
+                                       m_tableOrderBy)) ||
+            !query.exec()) {
+        LOG_FAILED_QUERY(query);
+        return false;
+    }
+    while (query.next()) {
+        QVector<QVariant> metadata;
+        metadata.reserve(m_tableColumns.size());
+        for (int i = 0; i < m_tableColumns.size(); ++i) {
+            metadata.push_back(query.value(i));
+        }
+        (*pRowsByTrackId)[TrackId(metadata.value(kIdColumn))].append(std::move(metadata));
+    }
+    return true;
+}
+
+int BaseSqlTableModel::compareRowTracks(TrackId trackId1, TrackId trackId2) const {
+    return m_trackSource->compareTracks(
+            trackId1, trackId2, m_sortColumns, m_tableColumns.size() - 1);
+}
+
+bool BaseSqlTableModel::isRowSorted(int row) const {
+    const TrackId trackId = m_rowInfo[row].trackId;
+    return (row == 0 ||
+                   compareRowTracks(m_rowInfo[row - 1].trackId, trackId) <= 0) &&
+            (row == m_rowInfo.size() - 1 ||
+                    compareRowTracks(trackId, m_rowInfo[row + 1].trackId) <= 0);
+}
+
+int BaseSqlTableModel::findSortedRow(TrackId trackId, int excludedRow) const {
+    // Binary search for the first row that is not sorted before the track
+    int first = 0;
+    int count = m_rowInfo.size() - (excludedRow >= 0 ? 1 : 0);
+    while (count > 0) {
+        const int step = count / 2;
+        const int mid = first + step;
+        const int row = (excludedRow >= 0 && mid >= excludedRow) ? mid + 1 : mid;
+        if (compareRowTracks(m_rowInfo[row].trackId, trackId) < 0) {
+            first = mid + 1;
+            count -= step + 1;
+        } else {
+            count = step;
+        }
+    }
+    return first;
+}
+
+void BaseSqlTableModel::updateTrackIdToRows() {
+    m_trackIdToRows.clear();
+    m_trackIdToRows.reserve(m_rowInfo.size());
+    for (int row = 0; row < m_rowInfo.size(); ++row) {
+        m_trackIdToRows[m_rowInfo[row].trackId].push_back(row);
+    }
+}
+
 void BaseSqlTableModel::hideTracks(const QModelIndexList& indices) {
     QList<TrackId> trackIds;
     foreach (QModelIndex index, indices) {
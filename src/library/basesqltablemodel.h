@@ -7,7 +7,9 @@
 #include "library/dao/trackdao.h"
 #include "library/basetracktablemodel.h"
 #include "library/columncache.h"
+#include "library/trackqueryexecutor.h"
 #include "util/class.h"
+#include "util/performancetimer.h"
 
 class TrackCollectionManager;
 
@@ -67,6 +69,12 @@ class BaseSqlTableModel : public BaseTrackTableModel {
 
     void select() override;
 
+    /// Returns true while the rows of a search are selected in the
+    /// background, see searchFinished()
+    bool isSearchPending() const {
+        return m_pendingSelect.requestId != 0;
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     // Inherited from BaseTrackTableModel
     ///////////////////////////////////////////////////////////////////////////
@@ -106,9 +114,18 @@ class BaseSqlTableModel : public BaseTrackTableModel {
     int m_columnIndexBySortColumnId[static_cast<int>(TrackModel::SortColumnId::IdMax)];
     QMap<int, TrackModel::SortColumnId> m_sortColumnIdByColumnIndex;
 
+  signals:
+    /// Emitted when the rows of a pending search have been replaced
+    void searchFinished();
+
   private slots:
     void tracksChanged(const QSet<TrackId>& trackIds);
 
+    void slotRowsFetched(quint64 requestId,
+            int query,
+            const TrackQueryExecutor::Rows& rows);
+    void slotRequestFinished(quint64 requestId, bool success);
+
   private:
     void setTrackValueForColumn(
             TrackPointer pTrack, int column, QVariant value);
@@ -141,6 +158,38 @@ class BaseSqlTableModel : public BaseTrackTableModel {
             QVector<RowInfo>&& rows,
             TrackId2Rows&& trackIdToRows);
 
+    /// Returns true if the changed tracks might be shown in or hidden from
+    /// the current rows, i.e. if the rows need to be patched
+    bool isAffectedByTracks(const QSet<TrackId>& trackIds) const;
+    /// Moves, inserts or removes the rows of the changed tracks according
+    /// to the current search and sort order instead of selecting all rows
+    /// again. Returns false if the rows must be selected.
+    bool patchRows(const QSet<TrackId>& trackIds);
+    /// Selects the rows of the tracks from the table by track id
+    bool selectTrackRows(const QSet<TrackId>& trackIds,
+            QHash<TrackId, QVector<QVector<QVariant>>>* pRowsByTrackId) const;
+    int compareRowTracks(TrackId trackId1, TrackId trackId2) const;
+    bool isRowSorted(int row) const;
+    /// Returns the row before which the track is inserted when
+    /// excludedRow has been removed from the sorted rows
+    int findSortedRow(TrackId trackId, int excludedRow = -1) const;
+    void updateTrackIdToRows();
+
+    QString selectQueryString() const;
+    /// Filters and sorts the selected rows with the track source and
+    /// replaces the rows of the model
+    void filterAndSortRows(
+            QVector<RowInfo>&& rowInfos,
+            const QSet<TrackId>& trackIds,
+            const QVector<TrackId>* pQueriedTrackIds);
+
+    /// Selects the rows with the query executor of the track collection
+    /// without blocking. Returns false if the rows must be selected
+    /// synchronously.
+    bool selectInBackground();
+    /// Returns true if a pending select has been cancelled
+    bool cancelSelectInBackground();
+
     QVector<RowInfo> m_rowInfo;
 
     QString m_idColumn;
@@ -155,5 +204,17 @@ class BaseSqlTableModel : public BaseTrackTableModel {
     QVector<QHash<int, QVariant>> m_headerInfo;
     QString m_trackSourceOrderBy;
 
+    // The rows that are fetched by the query executor
+    struct PendingSelect {
+        quint64 requestId = 0;
+        PerformanceTimer time;
+        QVector<RowInfo> rowInfos;
+        QSet<TrackId> trackIds;
+        // The result of BaseTrackCache::formatFilterAndSortQuery()
+        bool queriedTrackSource = false;
+        QVector<TrackId> queriedTrackIds;
+    };
+    PendingSelect m_pendingSelect;
+
     DISALLOW_COPY_AND_ASSIGN(BaseSqlTableModel);
 };
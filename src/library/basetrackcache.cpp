@@ -1,6 +1,8 @@
 #include "library/basetrackcache.h"
 
+#include "library/dao/tracksearchindex.h"
 #include "library/queryutil.h"
+#include "library/searchquery.h"
 #include "library/searchqueryparser.h"
 #include "library/trackcollection.h"
 #include "moc_basetrackcache.cpp"
@@ -25,9 +27,13 @@ BaseTrackCache::BaseTrackCache(TrackCollection* pTrackCollection,
           m_columnCount(columns.size()),
           m_columnsJoined(columns.join(",")),
           m_columnCache(columns),
-          m_pQueryParser(new SearchQueryParser(pTrackCollection)),
+          m_pSearchIndex(isCaching
+                          ? &pTrackCollection->getTrackDAO().searchIndex()
+                          : nullptr),
+          m_pQueryParser(new SearchQueryParser(pTrackCollection, m_pSearchIndex)),
           m_bIndexBuilt(false),
           m_bIsCaching(isCaching),
+          m_columnIndex(&m_trackInfo, &m_columnCache, &m_collator),
           m_database(pTrackCollection->database()) {
     m_searchColumns << "artist"
                     << "album"
@@ -92,6 +98,7 @@ void BaseTrackCache::slotTracksRemoved(const QSet<TrackId>& trackIds) {
     }
     for (const auto& trackId : qAsConst(trackIds)) {
         m_trackInfo.remove(trackId);
+        m_columnIndex.removeRow(trackId);
         m_dirtyTracks.remove(trackId);
     }
 }
@@ -226,6 +233,7 @@ bool BaseTrackCache::updateTrackInIndex(
         for (int i = 0; i < numColumns; ++i) {
             getTrackValueForColumn(pTrack, i, record[i]);
         }
+        m_columnIndex.updateRow(trackId);
         if (m_bIsCaching) {
             replaceRecentTrack(std::move(trackId), std::move(pTrack));
         }
@@ -281,6 +289,7 @@ bool BaseTrackCache::updateIndexWithQuery(const QString& queryString) {
                 record[i] = query.value(i);
             }
         }
+        m_columnIndex.updateRow(trackId);
     }
 
     qDebug() << this << "updateIndexWithQuery took" << timer.elapsed().debugMillisWithUnit();
@@ -303,6 +312,7 @@ void BaseTrackCache::buildIndex() {
     // clear the table, and keep track of what IDs we see, then delete the ones
     // we don't see.
     m_trackInfo.clear();
+    m_columnIndex.clear();
 
     if (!updateIndexWithQuery(queryString)) {
         qDebug() << "buildIndex failed!";
@@ -460,7 +470,8 @@ void BaseTrackCache::filterAndSort(const QSet<TrackId>& trackIds,
                                    const QString& orderByClause,
                                    const QList<SortColumn>& sortColumns,
                                    const int columnOffset,
-                                   QHash<TrackId, int>* trackToIndex) {
+                                   QHash<TrackId, int>* trackToIndex,
+                                   const QVector<TrackId>* pQueriedTrackIds) {
     // Skip processing if there are no tracks to filter or sort.
     if (trackIds.size() == 0) {
         return;
@@ -470,72 +481,51 @@ void BaseTrackCache::filterAndSort(const QSet<TrackId>& trackIds,
         buildIndex();
     }
 
-    QStringList idStrings;
     // TODO(rryan) consider making this the data passed in and a separate
     // QVector for output
     QSet<TrackId> dirtyTracks;
     for (const auto& trackId: trackIds) {
-        idStrings << trackId.toString();
         if (m_dirtyTracks.contains(trackId)) {
             dirtyTracks.insert(trackId);
         }
     }
 
-    QStringList queryFragments;
-    if (!extraFilter.isNull() && extraFilter != "") {
-        queryFragments << QString("(%1)").arg(extraFilter);
-    }
-    if (idStrings.size() > 0) {
-        queryFragments << QString("%1 in (%2)")
-                .arg(m_idColumn, idStrings.join(","));
-    }
-
-    const std::unique_ptr<QueryNode> pQuery =
-            m_pQueryParser->parseQuery(
-                    searchQuery,
-                    m_searchColumns,
-                    queryFragments.join(" AND "));
-
-    QString filter = pQuery->toSql();
-    if (!filter.isEmpty()) {
-        filter.prepend("WHERE ");
-    }
-
-    QString queryString = QString("SELECT %1 FROM %2 %3 %4")
-            .arg(m_idColumn, m_tableName, filter, orderByClause);
-
-    if (sDebug) {
-        qDebug() << this << "select() executing:" << queryString;
-    }
-
-    QSqlQuery query(m_database);
-    // This causes a memory savings since QSqlCachedResult (what QtSQLite uses)
-    // won't allocate a giant in-memory table that we won't use at all.
-    query.setForwardOnly(true);
-    query.prepare(queryString);
-
-    if (!query.exec()) {
-        LOG_FAILED_QUERY(query);
-    }
-
-    int idColumn = query.record().indexOf(m_idColumn);
-    int rows = query.size();
-
-    if (sDebug) {
-        qDebug() << "Rows returned:" << rows;
+    // Searching and sorting the cached values is much faster than querying
+    // the database.
+    std::unique_ptr<QueryNode> pQuery;
+    if (canFilterAndSortInIndex(extraFilter, orderByClause, sortColumns, columnOffset)) {
+        pQuery = m_pQueryParser->parseQuery(
+                searchQuery,
+                m_searchColumns,
+                QString());
+        if (!filterAndSortInIndex(*pQuery,
+                    trackIds,
+                    // Without an order the tracks are sorted by id
+                    orderByClause.isEmpty() ? QList<SortColumn>() : sortColumns,
+                    columnOffset,
+                    trackToIndex)) {
+            pQuery.reset();
+        }
     }
-
-    m_trackOrder.resize(0); // keeps allocated memory
-    trackToIndex->clear();
-    if (rows > 0) {
-        trackToIndex->reserve(rows);
-        m_trackOrder.reserve(rows);
+    if (!pQuery && pQueriedTrackIds) {
+        pQuery = parseQuery(QString(), searchQuery, extraFilter);
+        m_trackOrder.resize(0); // keeps allocated memory
+        trackToIndex->clear();
+        for (const auto& trackId : *pQueriedTrackIds) {
+            // The database might have been modified after the tracks
+            // of the table have been queried
+            if (trackIds.contains(trackId)) {
+                (*trackToIndex)[trackId] = m_trackOrder.size();
+                m_trackOrder.append(trackId);
+            }
+        }
     }
-
-    while (query.next()) {
-        TrackId trackId(query.value(idColumn));
-        (*trackToIndex)[trackId] = m_trackOrder.size();
-        m_trackOrder.append(trackId);
+    if (!pQuery) {
+        pQuery = filterAndSortInDatabase(trackIds,
+                searchQuery,
+                extraFilter,
+                orderByClause,
+                trackToIndex);
     }
 
     // At this point, the original set of tracks have been divided into two
@@ -613,6 +603,269 @@ void BaseTrackCache::filterAndSort(const QSet<TrackId>& trackIds,
     }
 }
 
+void BaseTrackCache::synchronizeSearchIndex() const {
+    if (!m_pSearchIndex || !m_pSearchIndex->isAvailable()) {
+        return;
+    }
+    if (!m_pSearchIndex->synchronize() && sDebug) {
+        // The text filters fall back to LIKE expressions until the index
+        // has caught up with a large number of modified tracks
+        qDebug() << this << "Search index is not synchronized";
+    }
+}
+
+std::unique_ptr<QueryNode> BaseTrackCache::filterAndSortInDatabase(
+        const QSet<TrackId>& trackIds,
+        const QString& searchQuery,
+        const QString& extraFilter,
+        const QString& orderByClause,
+        QHash<TrackId, int>* trackToIndex) {
+    synchronizeSearchIndex();
+
+    QStringList idStrings;
+    for (const auto& trackId: trackIds) {
+        idStrings << trackId.toString();
+    }
+
+    std::unique_ptr<QueryNode> pQuery = parseQuery(
+            idStrings.isEmpty()
+                    ? QString()
+                    : QString("%1 in (%2)").arg(m_idColumn, idStrings.join(",")),
+            searchQuery,
+            extraFilter);
+    const QString queryString = formatSelectQuery(*pQuery, orderByClause);
+
+    if (sDebug) {
+        qDebug() << this << "select() executing:" << queryString;
+    }
+
+    QSqlQuery query(m_database);
+    // This causes a memory savings since QSqlCachedResult (what QtSQLite uses)
+    // won't allocate a giant in-memory table that we won't use at all.
+    query.setForwardOnly(true);
+    query.prepare(queryString);
+
+    if (!query.exec()) {
+        LOG_FAILED_QUERY(query);
+    }
+
+    int idColumn = query.record().indexOf(m_idColumn);
+    int rows = query.size();
+
+    if (sDebug) {
+        qDebug() << "Rows returned:" << rows;
+    }
+
+    m_trackOrder.resize(0); // keeps allocated memory
+    trackToIndex->clear();
+    if (rows > 0) {
+        trackToIndex->reserve(rows);
+        m_trackOrder.reserve(rows);
+    }
+
+    while (query.next()) {
+        TrackId trackId(query.value(idColumn));
+        (*trackToIndex)[trackId] = m_trackOrder.size();
+        m_trackOrder.append(trackId);
+    }
+    return pQuery;
+}
+
+QString BaseTrackCache::formatFilterAndSortQuery(const QString& trackIdQuery,
+        const QString& searchQuery,
+        const QString& extraFilter,
+        const QString& orderByClause,
+        const QList<SortColumn>& sortColumns,
+        int columnOffset) const {
+    if (canFilterAndSortInIndex(extraFilter, orderByClause, sortColumns, columnOffset)) {
+        return QString();
+    }
+    synchronizeSearchIndex();
+    const std::unique_ptr<QueryNode> pQuery = parseQuery(
+            QString("%1 IN (%2)").arg(m_idColumn, trackIdQuery),
+            searchQuery,
+            extraFilter);
+    return formatSelectQuery(*pQuery, orderByClause);
+}
+
+bool BaseTrackCache::canCompareTracks(const QString& extraFilter,
+        const QString& orderByClause,
+        const QList<SortColumn>& sortColumns,
+        int columnOffset) const {
+    // Without an order the tracks are sorted by the database
+    return !orderByClause.isEmpty() &&
+            canFilterAndSortInIndex(extraFilter, orderByClause, sortColumns, columnOffset);
+}
+
+int BaseTrackCache::compareTracks(TrackId trackId1,
+        TrackId trackId2,
+        const QList<SortColumn>& sortColumns,
+        int columnOffset) const {
+    QList<TrackColumnIndex::SortSpec> sortSpecs;
+    VERIFY_OR_DEBUG_ASSERT(sortSpecsForColumns(sortColumns, columnOffset, &sortSpecs)) {
+        return 0;
+    }
+    const int row1 = m_columnIndex.row(trackId1);
+    const int row2 = m_columnIndex.row(trackId2);
+    if (row1 < 0 || row2 < 0) {
+        // Tracks that are not cached are sorted last
+        return (row1 < 0) - (row2 < 0);
+    }
+    return m_columnIndex.compareRows(row1, row2, sortSpecs);
+}
+
+std::unique_ptr<QueryNode> BaseTrackCache::parseQuery(const QString& trackIdFilter,
+        const QString& searchQuery,
+        const QString& extraFilter) const {
+    QStringList queryFragments;
+    if (!extraFilter.isNull() && extraFilter != "") {
+        queryFragments << QString("(%1)").arg(extraFilter);
+    }
+    if (!trackIdFilter.isEmpty()) {
+        queryFragments << trackIdFilter;
+    }
+    return m_pQueryParser->parseQuery(
+            searchQuery,
+            m_searchColumns,
+            queryFragments.join(" AND "));
+}
+
+QString BaseTrackCache::formatSelectQuery(
+        const QueryNode& query, const QString& orderByClause) const {
+    QString filter = query.toSql();
+    if (!filter.isEmpty()) {
+        filter.prepend("WHERE ");
+    }
+    return QString("SELECT %1 FROM %2 %3 %4")
+            .arg(m_idColumn, m_tableName, filter, orderByClause);
+}
+
+bool BaseTrackCache::canFilterAndSortInIndex(const QString& extraFilter,
+        const QString& orderByClause,
+        const QList<SortColumn>& sortColumns,
+        int columnOffset) const {
+    // Additional SQL filters and the random sort order of the
+    // preview column are left to the database.
+    if (!extraFilter.isEmpty() || orderByClause.contains(QLatin1String("RANDOM()"))) {
+        return false;
+    }
+    QList<TrackColumnIndex::SortSpec> sortSpecs;
+    return orderByClause.isEmpty() ||
+            sortSpecsForColumns(sortColumns, columnOffset, &sortSpecs);
+}
+
+bool BaseTrackCache::sortSpecsForColumns(const QList<SortColumn>& sortColumns,
+        int columnOffset,
+        QList<TrackColumnIndex::SortSpec>* pSortSpecs) const {
+    for (const auto& sc : sortColumns) {
+        int column;
+        if (sc.m_column == 0) {
+            // The id column, see BaseSqlTableModel::setSort()
+            column = fieldIndex(m_idColumn);
+        } else if (sc.m_column <= columnOffset) {
+            // Other columns of the table are not sorted by the track source
+            continue;
+        } else {
+            column = sc.m_column - columnOffset;
+        }
+        TrackColumnIndex::SortSpec sortSpec;
+        if (!sortSpecForColumn(column, sc.m_order, &sortSpec)) {
+            return false;
+        }
+        pSortSpecs->append(sortSpec);
+    }
+    return true;
+}
+
+bool BaseTrackCache::filterAndSortInIndex(const QueryNode& query,
+        const QSet<TrackId>& trackIds,
+        const QList<SortColumn>& sortColumns,
+        int columnOffset,
+        QHash<TrackId, int>* trackToIndex) {
+    QList<TrackColumnIndex::SortSpec> sortSpecs;
+    if (!sortSpecsForColumns(sortColumns, columnOffset, &sortSpecs)) {
+        return false;
+    }
+
+    TrackColumnIndex::RowMask rows(m_columnIndex.rowCount(), 0);
+    for (const auto& trackId : trackIds) {
+        const int row = m_columnIndex.row(trackId);
+        if (row < 0) {
+            // Only the database knows if the track matches
+            return false;
+        }
+        rows[row] = 1;
+    }
+    if (!query.filterRows(m_columnIndex, &rows)) {
+        return false;
+    }
+
+    std::vector<int> matchingRows;
+    matchingRows.reserve(static_cast<std::size_t>(trackIds.size()));
+    for (int row = 0; row < m_columnIndex.rowCount(); ++row) {
+        if (rows[row]) {
+            matchingRows.push_back(row);
+        }
+    }
+    m_columnIndex.sortRows(&matchingRows, sortSpecs);
+
+    m_trackOrder.resize(0); // keeps allocated memory
+    m_trackOrder.reserve(static_cast<int>(matchingRows.size()));
+    trackToIndex->clear();
+    trackToIndex->reserve(static_cast<int>(matchingRows.size()));
+    for (const int row : matchingRows) {
+        const TrackId trackId = m_columnIndex.trackId(row);
+        (*trackToIndex)[trackId] = m_trackOrder.size();
+        m_trackOrder.append(trackId);
+    }
+
+    if (sDebug) {
+        qDebug() << this << "filterAndSortInIndex() matched" << m_trackOrder.size()
+                 << "of" << trackIds.size() << "tracks";
+    }
+    return true;
+}
+
+bool BaseTrackCache::sortSpecForColumn(int column,
+        Qt::SortOrder sortOrder,
+        TrackColumnIndex::SortSpec* pSortSpec) const {
+    // The sort order must be the same as for the SQL expressions
+    // of ColumnCache::columnSortForFieldIndex()
+    pSortSpec->column = column;
+    pSortSpec->order = sortOrder;
+    if (column == fieldIndex(m_idColumn) ||
+            column == fieldIndex(ColumnCache::COLUMN_LIBRARYTABLE_DURATION) ||
+            column == fieldIndex(ColumnCache::COLUMN_LIBRARYTABLE_BITRATE) ||
+            column == fieldIndex(ColumnCache::COLUMN_LIBRARYTABLE_BPM) ||
+            column == fieldIndex(ColumnCache::COLUMN_LIBRARYTABLE_REPLAYGAIN) ||
+            column == fieldIndex(ColumnCache::COLUMN_LIBRARYTABLE_SAMPLERATE) ||
+            column == fieldIndex(ColumnCache::COLUMN_LIBRARYTABLE_CHANNELS) ||
+            column == fieldIndex(ColumnCache::COLUMN_LIBRARYTABLE_PLAYED) ||
+            column == fieldIndex(ColumnCache::COLUMN_LIBRARYTABLE_TIMESPLAYED) ||
+            column == fieldIndex(ColumnCache::COLUMN_LIBRARYTABLE_RATING) ||
+            column == fieldIndex(ColumnCache::COLUMN_LIBRARYTABLE_BPM_LOCK)) {
+        pSortSpec->type = TrackColumnIndex::SortType::Number;
+    } else if (column == fieldIndex(ColumnCache::COLUMN_LIBRARYTABLE_ARTIST) ||
+            column == fieldIndex(ColumnCache::COLUMN_LIBRARYTABLE_TITLE) ||
+            column == fieldIndex(ColumnCache::COLUMN_LIBRARYTABLE_ALBUM) ||
+            column == fieldIndex(ColumnCache::COLUMN_LIBRARYTABLE_ALBUMARTIST) ||
+            column == fieldIndex(ColumnCache::COLUMN_LIBRARYTABLE_GENRE) ||
+            column == fieldIndex(ColumnCache::COLUMN_LIBRARYTABLE_COMPOSER) ||
+            column == fieldIndex(ColumnCache::COLUMN_LIBRARYTABLE_GROUPING) ||
+            column == fieldIndex(ColumnCache::COLUMN_LIBRARYTABLE_COMMENT)) {
+        pSortSpec->type = TrackColumnIndex::SortType::Text;
+    } else if (column == fieldIndex(ColumnCache::COLUMN_LIBRARYTABLE_KEY)) {
+        // The database sorts by key id
+        pSortSpec->column = fieldIndex(ColumnCache::COLUMN_LIBRARYTABLE_KEY_ID);
+        pSortSpec->type = TrackColumnIndex::SortType::Key;
+    } else {
+        // Text compared case-insensitive but not locale aware, or values
+        // of different types.
+        return false;
+    }
+    return column >= 0 && pSortSpec->column >= 0;
+}
+
 int BaseTrackCache::findSortInsertionPoint(TrackPointer pTrack,
         const QList<SortColumn>& sortColumns,
         const int columnOffset,
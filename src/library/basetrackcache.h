@@ -11,13 +11,16 @@
 #include <memory>
 
 #include "library/columncache.h"
+#include "library/trackcolumnindex.h"
 #include "track/track_decl.h"
 #include "track/trackid.h"
 #include "util/class.h"
 #include "util/string.h"
 
+class QueryNode;
 class SearchQueryParser;
 class TrackCollection;
+class TrackSearchIndex;
 
 class SortColumn {
   public:
@@ -63,13 +66,43 @@ class BaseTrackCache : public QObject {
     QString columnNameForFieldIndex(int index) const;
     QString columnSortForFieldIndex(int index) const;
     int fieldIndex(ColumnCache::Column column) const;
+    const QString& tableName() const {
+        return m_tableName;
+    }
+
+    /// Filters and sorts the tracks. The optional pQueriedTrackIds are the
+    /// result of the query from formatFilterAndSortQuery() if it has already
+    /// been executed, e.g. on another thread.
     virtual void filterAndSort(const QSet<TrackId>& trackIds,
                                const QString& query,
                                const QString& extraFilter,
                                const QString& orderByClause,
                                const QList<SortColumn>& sortColumns,
                                const int columnOffset,
-                               QHash<TrackId, int>* trackToIndex);
+                               QHash<TrackId, int>* trackToIndex,
+                               const QVector<TrackId>* pQueriedTrackIds = nullptr);
+    /// Returns the query that filters and sorts the tracks selected by
+    /// trackIdQuery in the database. Returns an empty string if the tracks
+    /// can be filtered and sorted with the cached values instead.
+    QString formatFilterAndSortQuery(const QString& trackIdQuery,
+            const QString& searchQuery,
+            const QString& extraFilter,
+            const QString& orderByClause,
+            const QList<SortColumn>& sortColumns,
+            int columnOffset) const;
+    /// Returns true if filterAndSort() sorts the tracks by their cached
+    /// values, i.e. if tracks can be compared with compareTracks().
+    bool canCompareTracks(const QString& extraFilter,
+            const QString& orderByClause,
+            const QList<SortColumn>& sortColumns,
+            int columnOffset) const;
+    /// Compares two tracks in the order of filterAndSort(). Returns a
+    /// negative number if the first track is sorted before the second
+    /// track and a positive number if it is sorted after it.
+    int compareTracks(TrackId trackId1,
+            TrackId trackId2,
+            const QList<SortColumn>& sortColumns,
+            int columnOffset) const;
     virtual bool isCached(TrackId trackId) const;
     virtual void ensureCached(TrackId trackId);
     virtual void ensureCached(const QSet<TrackId>& trackIds);
@@ -99,6 +132,40 @@ class BaseTrackCache : public QObject {
     void getTrackValueForColumn(TrackPointer pTrack, int column,
                                 QVariant& trackValue) const;
 
+    std::unique_ptr<QueryNode> parseQuery(const QString& trackIdFilter,
+            const QString& searchQuery,
+            const QString& extraFilter) const;
+    QString formatSelectQuery(
+            const QueryNode& query, const QString& orderByClause) const;
+    bool canFilterAndSortInIndex(const QString& extraFilter,
+            const QString& orderByClause,
+            const QList<SortColumn>& sortColumns,
+            int columnOffset) const;
+    bool sortSpecsForColumns(const QList<SortColumn>& sortColumns,
+            int columnOffset,
+            QList<TrackColumnIndex::SortSpec>* pSortSpecs) const;
+
+    /// Reindexes the tracks that have been modified since the last query,
+    /// so that the SQL queries of the text filters can use the index
+    void synchronizeSearchIndex() const;
+    /// Returns the parsed query
+    std::unique_ptr<QueryNode> filterAndSortInDatabase(const QSet<TrackId>& trackIds,
+            const QString& searchQuery,
+            const QString& extraFilter,
+            const QString& orderByClause,
+            QHash<TrackId, int>* trackToIndex);
+    /// Filters and sorts the tracks with m_columnIndex instead of the
+    /// database. Returns false if the index can't evaluate the query
+    /// or the sort order like the database does.
+    bool filterAndSortInIndex(const QueryNode& query,
+            const QSet<TrackId>& trackIds,
+            const QList<SortColumn>& sortColumns,
+            int columnOffset,
+            QHash<TrackId, int>* trackToIndex);
+    bool sortSpecForColumn(int column,
+            Qt::SortOrder sortOrder,
+            TrackColumnIndex::SortSpec* pSortSpec) const;
+
     int findSortInsertionPoint(TrackPointer pTrack,
                                const QList<SortColumn>& sortColumns,
                                const int columnOffset,
@@ -122,6 +189,9 @@ class BaseTrackCache : public QObject {
 
     const ColumnCache m_columnCache;
 
+    // Only set for the caching source, which contains the tracks of the
+    // internal library that are covered by the index
+    TrackSearchIndex* const m_pSearchIndex;
     const std::unique_ptr<SearchQueryParser> m_pQueryParser;
 
     const mixxx::StringCollator m_collator;
@@ -148,6 +218,8 @@ class BaseTrackCache : public QObject {
     bool m_bIndexBuilt;
     bool m_bIsCaching;
     QHash<TrackId, QVector<QVariant>> m_trackInfo;
+    // The values of m_trackInfo column by column for searching and sorting
+    TrackColumnIndex m_columnIndex;
     QSqlDatabase m_database;
 
     DISALLOW_COPY_AND_ASSIGN(BaseTrackCache);
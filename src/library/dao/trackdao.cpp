@@ -5,6 +5,7 @@
 #include <QDirIterator>
 #include <QFileInfo>
 #include <QImage>
+#include <QTimer>
 #include <QtDebug>
 #include <QtSql>
 
@@ -48,6 +49,10 @@ mixxx::Logger kLogger("TrackDAO");
 
 enum { UndefinedRecordIndex = -2 };
 
+// Leaves time for the event loop between batches of tracks that
+// are added to the search index
+constexpr int kSearchIndexSynchronizeIntervalMillis = 10;
+
 void markTrackLocationsAsDeleted(const QSqlDatabase& database, const QString& directory) {
     //qDebug() << "TrackDAO::markTrackLocationsAsDeleted" << QThread::currentThread() << m_database.connectionName();
     QSqlQuery query(database);
@@ -114,6 +119,28 @@ TrackDAO::~TrackDAO() {
     addTracksFinish(true);
 }
 
+void TrackDAO::initialize(const QSqlDatabase& database) {
+    DAO::initialize(database);
+    if (m_searchIndex.initialize(database)) {
+        // Indexing a whole library takes a while, so it is done in batches
+        // after startup. Searches don't use the index until then.
+        QTimer::singleShot(0, this, &TrackDAO::slotSynchronizeSearchIndex);
+    }
+}
+
+void TrackDAO::slotSynchronizeSearchIndex() {
+    // The tracks of the pending transaction are indexed afterwards
+    if (!m_pTransaction &&
+            m_searchIndex.synchronize(TrackSearchIndex::kMaxSynchronousUpdates)) {
+        return;
+    }
+    if (m_searchIndex.isAvailable()) {
+        QTimer::singleShot(kSearchIndexSynchronizeIntervalMillis,
+                this,
+                &TrackDAO::slotSynchronizeSearchIndex);
+    }
+}
+
 void TrackDAO::finish() {
     qDebug() << "TrackDAO::finish()";
 
@@ -827,7 +854,8 @@ TrackId TrackDAO::addTracksAddTrack(const TrackPointer& pTrack, bool unremove) {
 
 TrackPointer TrackDAO::addTracksAddFile(
         const mixxx::FileAccess& fileAccess,
-        bool unremove) {
+        bool unremove,
+        const ImportedTrackMetadataAndCoverImage* pImported) {
     // Check that track is a supported extension.
     // TODO(uklotzde): The following check can be skipped if
     // the track is already in the library. A refactoring is
@@ -877,7 +905,8 @@ TrackPointer TrackDAO::addTracksAddFile(
     // from the file.
     SoundSourceProxy(pTrack).updateTrackFromSource(
             SoundSourceProxy::UpdateTrackFromSourceMode::Once,
-            SyncTrackMetadataParams::readFromUserSettings(*m_pConfig));
+            SyncTrackMetadataParams::readFromUserSettings(*m_pConfig),
+            pImported);
     if (!pTrack->checkSourceSynchronized()) {
         qWarning() << "TrackDAO::addTracksAddFile:"
                 << "Failed to parse track metadata from file"
@@ -8,6 +8,7 @@
 #include <QString>
 
 #include "library/dao/dao.h"
+#include "library/dao/tracksearchindex.h"
 #include "library/relocatedtrack.h"
 #include "preferences/usersettings.h"
 #include "track/globaltrackcache.h"
@@ -20,6 +21,7 @@ class PlaylistDAO;
 class AnalysisDao;
 class CueDAO;
 class LibraryHashDAO;
+struct ImportedTrackMetadataAndCoverImage;
 
 namespace mixxx {
 
@@ -49,8 +51,14 @@ class TrackDAO : public QObject, public virtual DAO, public virtual GlobalTrackC
             UserSettingsPointer pConfig);
     ~TrackDAO() override;
 
+    void initialize(const QSqlDatabase& database) override;
+
     void finish();
 
+    TrackSearchIndex& searchIndex() {
+        return m_searchIndex;
+    }
+
     QList<TrackId> resolveTrackIds(
             const QList<mixxx::FileInfo>& fileInfos,
             ResolveTrackIdFlags flags = ResolveTrackIdFlag::ResolveOnly);
@@ -128,6 +136,9 @@ class TrackDAO : public QObject, public virtual DAO, public virtual GlobalTrackC
     void slotDatabaseTracksRelocated(
             const QList<RelocatedTrack>& relocatedTracks);
 
+  private slots:
+    void slotSynchronizeSearchIndex();
+
   private:
     friend class LibraryScanner;
     friend class TrackCollection;
@@ -151,9 +162,12 @@ class TrackDAO : public QObject, public virtual DAO, public virtual GlobalTrackC
     TrackId addTracksAddTrack(
             const TrackPointer& pTrack,
             bool unremove);
+    /// The optional pImported metadata has been imported from the file
+    /// in advance, e.g. by a worker thread of the library scanner.
     TrackPointer addTracksAddFile(
             const mixxx::FileAccess& fileAccess,
-            bool unremove);
+            bool unremove,
+            const ImportedTrackMetadataAndCoverImage* pImported = nullptr);
     TrackPointer addTracksAddFile(
             const QString& filePath,
             bool unremove) {
@@ -219,6 +233,8 @@ class TrackDAO : public QObject, public virtual DAO, public virtual GlobalTrackC
 
     QSet<TrackId> m_tracksAddedSet;
 
+    TrackSearchIndex m_searchIndex;
+
     DISALLOW_COPY_AND_ASSIGN(TrackDAO);
 };
 
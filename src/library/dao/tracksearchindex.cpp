@@ -0,0 +1,289 @@
+#include "library/dao/tracksearchindex.h"
+
+#include <QSqlError>
+#include <QSqlQuery>
+
+#include "library/dao/trackschema.h"
+#include "library/queryutil.h"
+#include "util/db/dbconnection.h"
+#include "util/db/fwdsqlquery.h"
+#include "util/db/sqltransaction.h"
+#include "util/logger.h"
+
+namespace {
+
+const mixxx::Logger kLogger("TrackSearchIndex");
+
+const QString kTableName = QStringLiteral("library_search");
+
+// The ids of the tracks that need to be reindexed, recorded by triggers
+const QString kPendingTableName = QStringLiteral("library_search_pending");
+
+// The indexed columns with the same names as in the library view.
+// The rowid of the index is the id of the track.
+const QStringList kColumns = {
+        LIBRARYTABLE_ARTIST,
+        LIBRARYTABLE_ALBUMARTIST,
+        LIBRARYTABLE_ALBUM,
+        LIBRARYTABLE_TITLE,
+        LIBRARYTABLE_GENRE,
+        LIBRARYTABLE_COMPOSER,
+        LIBRARYTABLE_GROUPING,
+        LIBRARYTABLE_COMMENT,
+        TRACKLOCATIONSTABLE_LOCATION,
+};
+
+// The columns of the library table that affect the index. The location
+// of the library table is the id of the track location.
+const QStringList kLibraryColumns = {
+        LIBRARYTABLE_ARTIST,
+        LIBRARYTABLE_ALBUMARTIST,
+        LIBRARYTABLE_ALBUM,
+        LIBRARYTABLE_TITLE,
+        LIBRARYTABLE_GENRE,
+        LIBRARYTABLE_COMPOSER,
+        LIBRARYTABLE_GROUPING,
+        LIBRARYTABLE_COMMENT,
+        LIBRARYTABLE_LOCATION,
+};
+
+bool execQuery(const QSqlDatabase& database, const QString& statement) {
+    FwdSqlQuery query(database, statement);
+    return !query.hasError() && query.execPrepared();
+}
+
+} // anonymous namespace
+
+bool TrackSearchIndex::initialize(const QSqlDatabase& database) {
+    m_database = database;
+    m_available = false;
+    m_synchronized = false;
+    if (!isTrigramTokenizerSupported()) {
+        return false;
+    }
+    m_available = createTables();
+    return m_available;
+}
+
+bool TrackSearchIndex::isTrigramTokenizerSupported() const {
+    // The version of the SQLite library that Qt uses may differ from the
+    // one Mixxx is linked against, so the connection itself is probed. The
+    // trigram tokenizer is supported beginning in SQLite 3.34.0 with FTS5.
+    QSqlQuery query(m_database);
+    if (!query.exec(QStringLiteral(
+                "CREATE VIRTUAL TABLE temp.%1_probe "
+                "USING fts5(value, tokenize='trigram')")
+                        .arg(kTableName))) {
+        kLogger.info()
+                << "Full-text search is not supported:"
+                << query.lastError();
+        return false;
+    }
+    if (!query.exec(QStringLiteral("DROP TABLE temp.%1_probe").arg(kTableName))) {
+        LOG_FAILED_QUERY(query);
+    }
+    return true;
+}
+
+bool TrackSearchIndex::createTables() {
+    SqlTransaction transaction(m_database);
+
+    // A missing table of pending tracks or a missing trigger, e.g. after the
+    // library table has been recreated, means that the index has never been
+    // filled or that it might have missed modifications.
+    bool rebuild = false;
+    {
+        FwdSqlQuery query(m_database,
+                QStringLiteral(
+                        "SELECT COUNT(*) FROM sqlite_master "
+                        "WHERE (type='table' AND name='%1') "
+                        "OR (type='trigger' AND name IN ('%2_library_insert',"
+                        "'%2_library_update','%2_library_delete',"
+                        "'%2_track_locations_update'))")
+                        .arg(kPendingTableName, kTableName));
+        if (query.hasError() || !query.execPrepared() || !query.next()) {
+            return false;
+        }
+        // The table and all 4 triggers
+        rebuild = query.fieldValue(0).toInt() < 5;
+    }
+
+    const auto recordTrack = [](const QString& row) {
+        return QStringLiteral("INSERT OR IGNORE INTO %1(id) VALUES(%2.id)")
+                .arg(kPendingTableName, row);
+    };
+    const QStringList statements = {
+            QStringLiteral(
+                    "CREATE VIRTUAL TABLE IF NOT EXISTS %1 "
+                    "USING fts5(%2, tokenize='trigram')")
+                    .arg(kTableName, kColumns.join(QChar(','))),
+            QStringLiteral(
+                    "CREATE TABLE IF NOT EXISTS %1 (id INTEGER PRIMARY KEY)")
+                    .arg(kPendingTableName),
+            // The triggers only modify a plain table, so they don't fail
+            // if a different SQLite library without FTS5 opens the database.
+            QStringLiteral(
+                    "CREATE TRIGGER IF NOT EXISTS %1_library_insert "
+                    "AFTER INSERT ON library BEGIN %2; END")
+                    .arg(kTableName, recordTrack(QStringLiteral("NEW"))),
+            QStringLiteral(
+                    "CREATE TRIGGER IF NOT EXISTS %1_library_update "
+                    "AFTER UPDATE OF %2 ON library BEGIN %3; END")
+                    .arg(kTableName,
+                            kLibraryColumns.join(QChar(',')),
+                            recordTrack(QStringLiteral("NEW"))),
+            QStringLiteral(
+                    "CREATE TRIGGER IF NOT EXISTS %1_library_delete "
+                    "AFTER DELETE ON library BEGIN %2; END")
+                    .arg(kTableName, recordTrack(QStringLiteral("OLD"))),
+            QStringLiteral(
+                    "CREATE TRIGGER IF NOT EXISTS %1_track_locations_update "
+                    "AFTER UPDATE OF %2 ON track_locations BEGIN "
+                    "INSERT OR IGNORE INTO %3(id) "
+                    "SELECT id FROM library WHERE location=NEW.id; END")
+                    .arg(kTableName, TRACKLOCATIONSTABLE_LOCATION, kPendingTableName),
+    };
+    for (const auto& statement : statements) {
+        if (!execQuery(m_database, statement)) {
+            return false;
+        }
+    }
+
+    if (rebuild) {
+        kLogger.info() << "Scheduling a rebuild of the full-text index";
+        if (!execQuery(m_database, QStringLiteral("DELETE FROM %1").arg(kTableName)) ||
+                !execQuery(m_database,
+                        QStringLiteral("INSERT INTO %1(id) SELECT id FROM library")
+                                .arg(kPendingTableName))) {
+            return false;
+        }
+    }
+    return transaction.commit();
+}
+
+//static
+bool TrackSearchIndex::isIndexedColumn(const QString& column) {
+    return kColumns.contains(column);
+}
+
+QString TrackSearchIndex::formatQueryForTrackIdsContaining(
+        const QStringList& columns,
+        const QString& foldedSearchTerm) const {
+    if (!isSynchronized() || columns.isEmpty() ||
+            foldedSearchTerm.size() < kMinSearchTermLength) {
+        return QString();
+    }
+    for (const auto& column : columns) {
+        if (!isIndexedColumn(column)) {
+            return QString();
+        }
+    }
+    // The search term is matched as a phrase, i.e. a substring
+    // for the trigram tokenizer. Double quotes are escaped by
+    // doubling them.
+    QString phrase = foldedSearchTerm;
+    phrase.replace(QChar('"'), QStringLiteral("\"\""));
+    const QString match = QStringLiteral("{%1} : \"%2\"")
+                                  .arg(columns.join(QChar(' ')), phrase);
+    FieldEscaper escaper(m_database);
+    return QStringLiteral("SELECT rowid FROM %1 WHERE %1 MATCH %2")
+            .arg(kTableName, escaper.escapeString(match));
+}
+
+bool TrackSearchIndex::synchronize(int maxTracks) {
+    if (!m_available) {
+        return false;
+    }
+    QStringList trackIds;
+    {
+        FwdSqlQuery query(m_database,
+                QStringLiteral("SELECT id FROM %1 LIMIT %2")
+                        .arg(kPendingTableName, QString::number(maxTracks + 1)));
+        if (query.hasError() || !query.execPrepared()) {
+            m_synchronized = false;
+            return false;
+        }
+        while (query.next()) {
+            trackIds.append(query.fieldValue(0).toString());
+        }
+    }
+    if (trackIds.isEmpty()) {
+        m_synchronized = true;
+        return true;
+    }
+    const bool complete = trackIds.size() <= maxTracks;
+    if (!complete) {
+        trackIds.removeLast();
+    }
+
+    // The index and the pending tracks are modified together, even if
+    // this is part of an enclosing transaction
+    SqlTransaction transaction(m_database);
+    const QString trackIdList = trackIds.join(QChar(','));
+    if (!reindexTracks(trackIdList) ||
+            !execQuery(m_database,
+                    QStringLiteral("DELETE FROM %1 WHERE id IN (%2)")
+                            .arg(kPendingTableName, trackIdList)) ||
+            (transaction && !transaction.commit())) {
+        m_synchronized = false;
+        return false;
+    }
+    m_synchronized = complete;
+    return complete;
+}
+
+bool TrackSearchIndex::reindexTracks(const QString& trackIdList) const {
+    if (!execQuery(m_database,
+                QStringLiteral("DELETE FROM %1 WHERE rowid IN (%2)")
+                        .arg(kTableName, trackIdList))) {
+        return false;
+    }
+
+    // Deleted tracks are not found in the library
+    QStringList selectColumns;
+    selectColumns.reserve(kColumns.size() + 1);
+    selectColumns.append(QStringLiteral("library.id"));
+    for (const auto& column : kColumns) {
+        if (column == TRACKLOCATIONSTABLE_LOCATION) {
+            selectColumns.append(QStringLiteral("track_locations.") + column);
+        } else {
+            selectColumns.append(QStringLiteral("library.") + column);
+        }
+    }
+    FwdSqlQuery select(m_database,
+            QStringLiteral(
+                    "SELECT %1 FROM library "
+                    "INNER JOIN track_locations ON library.location=track_locations.id "
+                    "WHERE library.id IN (%2)")
+                    .arg(selectColumns.join(QChar(',')), trackIdList));
+    if (select.hasError() || !select.execPrepared()) {
+        return false;
+    }
+
+    QStringList placeholders;
+    placeholders.reserve(selectColumns.size());
+    for (int i = 0; i < selectColumns.size(); ++i) {
+        placeholders.append(QStringLiteral("?"));
+    }
+    QSqlQuery insert(m_database);
+    if (!insert.prepare(QStringLiteral("INSERT INTO %1(rowid,%2) VALUES(%3)")
+                                .arg(kTableName,
+                                        kColumns.join(QChar(',')),
+                                        placeholders.join(QChar(','))))) {
+        LOG_FAILED_QUERY(insert);
+        return false;
+    }
+    while (select.next()) {
+        insert.bindValue(0, select.fieldValue(0));
+        for (int i = 1; i < selectColumns.size(); ++i) {
+            QString value = select.fieldValue(i).toString();
+            mixxx::DbConnection::makeStringLatinLow(&value);
+            insert.bindValue(i, value);
+        }
+        if (!insert.exec()) {
+            LOG_FAILED_QUERY(insert);
+            return false;
+        }
+    }
+    return true;
+}
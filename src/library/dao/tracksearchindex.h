@@ -0,0 +1,74 @@
+#pragma once
+
+#include <QSqlDatabase>
+#include <QString>
+#include <QStringList>
+
+/// TrackSearchIndex maintains a full-text index of the text columns of
+/// the library in an SQLite FTS5 table with the trigram tokenizer. The
+/// index finds all tracks that contain a search term without evaluating
+/// a LIKE expression for every row of the library.
+///
+/// Most searches of the internal library are evaluated in memory by
+/// TrackColumnIndex. Only the SQL queries of BaseTrackCache use this index,
+/// i.e. the queries of track models with an extra filter, e.g. for the
+/// tracks that are not in a crate, and the random sort of the preview column.
+///
+/// The index stores the values folded by DbConnection::makeStringLatinLow()
+/// and is matched against the folded search term, so it finds the same
+/// tracks as the like() function of the database. If the SQLite library of
+/// the connection doesn't support the trigram tokenizer, the index is not
+/// available and searches fall back to LIKE expressions.
+///
+/// The index is not part of the database schema, because it depends on the
+/// capabilities of the SQLite library. It is created on demand. Triggers on
+/// the library and track_locations tables record the ids of all tracks that
+/// are inserted, modified or deleted, regardless of the code or connection
+/// that modifies them. These tracks are reindexed by synchronize().
+class TrackSearchIndex {
+  public:
+    /// The trigram tokenizer can only match terms with at least 3 characters
+    static constexpr int kMinSearchTermLength = 3;
+
+    /// The number of modified tracks that are reindexed synchronously
+    /// before a query
+    static constexpr int kMaxSynchronousUpdates = 1000;
+
+    /// Creates the index if needed and returns true if it is available.
+    /// A new index is filled by subsequent calls of synchronize().
+    bool initialize(const QSqlDatabase& database);
+
+    bool isAvailable() const {
+        return m_available;
+    }
+
+    /// Reindexes up to maxTracks of the tracks that have been modified since
+    /// the last call. Returns true if all tracks are indexed afterwards.
+    /// Until then the index is not used for queries.
+    bool synchronize(int maxTracks = kMaxSynchronousUpdates);
+
+    /// Returns true if the index has been synchronized after the last
+    /// modification that has been recorded
+    bool isSynchronized() const {
+        return m_available && m_synchronized;
+    }
+
+    static bool isIndexedColumn(const QString& column);
+
+    /// Returns a query that selects the ids of all tracks that contain the
+    /// folded search term in one of the columns. Returns an empty string if
+    /// the index is not synchronized, the search term is too short, or one
+    /// of the columns is not indexed.
+    QString formatQueryForTrackIdsContaining(
+            const QStringList& columns,
+            const QString& foldedSearchTerm) const;
+
+  private:
+    bool isTrigramTokenizerSupported() const;
+    bool createTables();
+    bool reindexTracks(const QString& trackIdList) const;
+
+    QSqlDatabase m_database;
+    bool m_available = false;
+    bool m_synchronized = false;
+};
@@ -2,8 +2,20 @@
 
 #include "library/scanner/libraryscanner.h"
 #include "moc_importfilestask.cpp"
+#include "util/fileaccess.h"
+#include "util/performancetimer.h"
 #include "util/timer.h"
 
+namespace {
+
+// The number of new tracks that are handed over to the scanner thread
+// at once. Must be considerably smaller than the number of pending new
+// tracks divided by the number of worker threads, otherwise the workers
+// would block each other while waiting for a full batch.
+constexpr int kNewTracksBatchSize = 8;
+
+} // anonymous namespace
+
 ImportFilesTask::ImportFilesTask(LibraryScanner* pScanner,
         const ScannerGlobalPointer scannerGlobal,
         const QString& dirPath,
@@ -23,9 +35,11 @@ ImportFilesTask::ImportFilesTask(LibraryScanner* pScanner,
 
 void ImportFilesTask::run() {
     ScopedTimer timer("ImportFilesTask::run");
+    QList<NewTrackFile> newTracks;
     for (const QFileInfo& fileInfo: m_filesToImport) {
         // If a flag was raised telling us to cancel the library scan then stop.
         if (m_scannerGlobal->shouldCancel()) {
+            m_scannerGlobal->releasePendingNewTracks(newTracks.size());
             setSuccess(false);
             return;
         }
@@ -50,9 +64,34 @@ void ImportFilesTask::run() {
             }
             qDebug() << "Importing track" << trackLocation;
 
-            emit addNewTrack(trackLocation);
+            // Wait until the scanner thread has caught up with adding
+            // the previously parsed tracks
+            if (!m_scannerGlobal->acquirePendingNewTrack()) {
+                m_scannerGlobal->releasePendingNewTracks(newTracks.size());
+                setSuccess(false);
+                return;
+            }
+            // Parse the file on this worker thread instead of the
+            // scanner thread that adds the tracks to the database
+            NewTrackFile newTrack;
+            newTrack.location = trackLocation;
+            PerformanceTimer parseTimer;
+            parseTimer.start();
+            newTrack.metadataImported = SoundSourceProxy::importNewTrackMetadataAndCoverImage(
+                    mixxx::FileAccess(mixxx::FileInfo(fileInfo), m_pToken),
+                    m_scannerGlobal->resetMissingTagMetadataOnImport(),
+                    &newTrack.importedMetadata);
+            m_scannerGlobal->newTrackParsed(parseTimer.elapsed());
+            newTracks.append(std::move(newTrack));
+            if (newTracks.size() >= kNewTracksBatchSize) {
+                emit addNewTracks(newTracks);
+                newTracks.clear();
+            }
         }
     }
+    if (!newTracks.isEmpty()) {
+        emit addNewTracks(newTracks);
+    }
     // Insert or update the hash in the database.
     emit directoryHashedAndScanned(m_dirPath, !m_prevHashExists, m_newHash);
     setSuccess(true);
@@ -19,8 +19,10 @@
 
 namespace {
 
-// TODO(rryan) make configurable
-constexpr int kScannerThreadPoolSize = 1;
+// The maximum number of worker threads that parse new tracks. The
+// scanner thread that adds the tracks to the database becomes the
+// bottleneck with more threads.
+constexpr int kMaxScannerThreadPoolSize = 4;
 
 mixxx::Logger kLogger("LibraryScanner");
 
@@ -98,6 +100,7 @@ LibraryScanner::LibraryScanner(
         mixxx::DbConnectionPoolPtr pDbConnectionPool,
         const UserSettingsPointer& pConfig)
         : m_pDbConnectionPool(std::move(pDbConnectionPool)),
+          m_pConfig(pConfig),
           m_analysisDao(pConfig),
           m_trackDao(m_cueDao, m_playlistDao,
                   m_analysisDao, m_libraryHashDao,
@@ -112,7 +115,10 @@ LibraryScanner::LibraryScanner(
     const int instanceId = s_instanceCounter.fetchAndAddAcquire(1) + 1;
     setObjectName(QString("LibraryScanner %1").arg(instanceId));
 
-    m_pool.setMaxThreadCount(kScannerThreadPoolSize);
+    m_pool.setMaxThreadCount(
+            qBound(1, QThread::idealThreadCount(), kMaxScannerThreadPoolSize));
+
+    qRegisterMetaType<QList<NewTrackFile>>();
 
     // Listen to signals from our public methods (invoked by other threads) and
     // connect them to our slots to run the command on the scanner thread.
@@ -207,8 +213,13 @@ void LibraryScanner::slotStartScan() {
     QStringList directoryBlacklist = ScannerUtil::getDirectoryBlacklist();
 
     m_scannerGlobal = ScannerGlobalPointer(
-            new ScannerGlobal(trackLocations, directoryHashes, extensionFilter,
-                              coverExtensionFilter, directoryBlacklist));
+            new ScannerGlobal(trackLocations,
+                    directoryHashes,
+                    extensionFilter,
+                    coverExtensionFilter,
+                    directoryBlacklist,
+                    SyncTrackMetadataParams::readFromUserSettings(*m_pConfig)
+                            .resetMissingTagMetadataOnImport));
 
     m_scannerGlobal->startTimer();
 
@@ -433,6 +444,18 @@ void LibraryScanner::slotFinishUnhashedScan() {
             m_scannerGlobal->numScannedDirectories(),
             static_cast<int>(m_scannerGlobal->verifiedTracks().size()),
             static_cast<int>(m_scannerGlobal->addedTracks().size()));
+    const int numInsertedNewTracks = m_scannerGlobal->numInsertedNewTracks();
+    if (numInsertedNewTracks > 0) {
+        // The parsing duration is the sum over all worker threads
+        kLogger.info()
+                << "Parsed" << m_scannerGlobal->numParsedNewTracks()
+                << "new tracks in"
+                << m_scannerGlobal->parsingNewTracksDuration().debugMillisWithUnit()
+                << "on up to" << m_pool.maxThreadCount() << "threads and added"
+                << numInsertedNewTracks << "new tracks in"
+                << m_scannerGlobal->insertingNewTracksDuration().debugMillisWithUnit()
+                << "of" << m_scannerGlobal->timerElapsed().debugMillisWithUnit();
+    }
 
     m_scannerGlobal.clear();
     changeScannerState(FINISHED);
@@ -511,9 +534,9 @@ void LibraryScanner::queueTask(ScannerTask* pTask) {
             this,
             &LibraryScanner::slotTrackExists);
     connect(pTask,
-            &ScannerTask::addNewTrack,
+            &ScannerTask::addNewTracks,
             this,
-            &LibraryScanner::slotAddNewTrack);
+            &LibraryScanner::slotAddNewTracks);
 
     // Progress signals.
     // Pass directly to the main thread
@@ -566,36 +589,47 @@ void LibraryScanner::slotTrackExists(const QString& trackPath) {
     }
 }
 
-void LibraryScanner::slotAddNewTrack(const QString& trackPath) {
-    //kLogger.debug() << "slotAddNewTrack" << trackPath;
-    ScopedTimer timer("LibraryScanner::addNewTrack");
-    // For statistics tracking and to detect moved tracks
-    TrackPointer pTrack = m_trackDao.addTracksAddFile(
-            trackPath,
-            false);
-    if (pTrack) {
-        DEBUG_ASSERT(!pTrack->isDirty());
-        // The track's actual location might differ from the
-        // given trackPath
-        const QString trackLocation(pTrack->getLocation());
-        // Acknowledge successful track addition
-        if (m_scannerGlobal) {
-            m_scannerGlobal->trackAdded(trackLocation);
-        }
-        // Signal the main instance of TrackDAO, that there is
-        // a new track in the database.
-        emit trackAdded(pTrack);
-        emit progressLoading(trackLocation);
-    } else {
-        // Acknowledge failed track addition
-        // TODO(XXX): Is it really intended to acknowledge a failed
-        // track addition with a trackAdded() signal??
-        if (m_scannerGlobal) {
-            m_scannerGlobal->trackAdded(trackPath);
+void LibraryScanner::slotAddNewTracks(const QList<NewTrackFile>& newTracks) {
+    //kLogger.debug() << "slotAddNewTracks" << newTracks.size();
+    ScopedTimer timer("LibraryScanner::addNewTracks");
+    PerformanceTimer insertTimer;
+    insertTimer.start();
+    for (const auto& newTrack : newTracks) {
+        const QString& trackPath = newTrack.location;
+        // For statistics tracking and to detect moved tracks
+        TrackPointer pTrack = m_trackDao.addTracksAddFile(
+                mixxx::FileAccess(mixxx::FileInfo(trackPath)),
+                false,
+                newTrack.metadataImported ? &newTrack.importedMetadata : nullptr);
+        if (pTrack) {
+            DEBUG_ASSERT(!pTrack->isDirty());
+            // The track's actual location might differ from the
+            // given trackPath
+            const QString trackLocation(pTrack->getLocation());
+            // Acknowledge successful track addition
+            if (m_scannerGlobal) {
+                m_scannerGlobal->trackAdded(trackLocation);
+            }
+            // Signal the main instance of TrackDAO, that there is
+            // a new track in the database.
+            emit trackAdded(pTrack);
+            emit progressLoading(trackLocation);
+        } else {
+            // Acknowledge failed track addition
+            // TODO(XXX): Is it really intended to acknowledge a failed
+            // track addition with a trackAdded() signal??
+            if (m_scannerGlobal) {
+                m_scannerGlobal->trackAdded(trackPath);
+            }
+            kLogger.warning()
+                    << "Failed to add track to library:"
+                    << trackPath;
         }
-        kLogger.warning()
-                << "Failed to add track to library:"
-                << trackPath;
+    }
+    if (m_scannerGlobal) {
+        m_scannerGlobal->newTracksInserted(newTracks.size(), insertTimer.elapsed());
+        // Allow the worker threads to parse the next tracks
+        m_scannerGlobal->releasePendingNewTracks(newTracks.size());
     }
 }
 
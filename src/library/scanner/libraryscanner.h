@@ -16,15 +16,17 @@
 #include "library/dao/playlistdao.h"
 #include "library/dao/trackdao.h"
 #include "library/scanner/scannerglobal.h"
+#include "library/scanner/scannertask.h"
 #include "track/track_decl.h"
 #include "track/trackid.h"
 #include "util/db/dbconnectionpool.h"
 
-class ScannerTask;
 class LibraryScannerDlg;
 
 class LibraryScanner : public QThread {
     FRIEND_TEST(LibraryScannerTest, ScannerRoundtrip);
+    FRIEND_TEST(LibraryScannerTest, ParallelScanMatchesSerialScan);
+    FRIEND_TEST(LibraryScannerTest, CancelWhileWaitingForPendingNewTracks);
     Q_OBJECT
   public:
     LibraryScanner(
@@ -70,7 +72,7 @@ class LibraryScanner : public QThread {
                                    bool newDirectory, mixxx::cache_key_t hash);
     void slotDirectoryUnchanged(const QString& directoryPath);
     void slotTrackExists(const QString& trackPath);
-    void slotAddNewTrack(const QString& trackPath);
+    void slotAddNewTracks(const QList<NewTrackFile>& newTracks);
 
   private:
     enum ScannerState {
@@ -97,6 +99,7 @@ class LibraryScanner : public QThread {
     void cleanUpScan();
 
     mixxx::DbConnectionPoolPtr m_pDbConnectionPool;
+    const UserSettingsPointer m_pConfig;
 
     // The pool of threads used for worker tasks.
     QThreadPool m_pool;
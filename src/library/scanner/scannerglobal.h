@@ -4,11 +4,13 @@
 #include <QHash>
 #include <QMutex>
 #include <QRegularExpression>
+#include <QSemaphore>
 #include <QSet>
 #include <QSharedPointer>
 #include <QStringList>
 
 #include "util/cache.h"
+#include "util/compatibility/qatomic.h"
 #include "util/compatibility/qmutex.h"
 #include "util/fileaccess.h"
 #include "util/performancetimer.h"
@@ -16,20 +18,33 @@
 
 class ScannerGlobal {
   public:
+    /// The maximum number of new tracks that have been parsed by the
+    /// worker threads but not yet been added by the scanner thread.
+    /// Bounds the memory for the parsed metadata and cover images if
+    /// the database is slower than parsing the files.
+    static constexpr int kMaxPendingNewTracks = 64;
+
     ScannerGlobal(const QSet<QString>& trackLocations,
             const QHash<QString, mixxx::cache_key_t>& directoryHashes,
             const QRegularExpression& supportedExtensionsMatcher,
             const QRegularExpression& supportedCoverExtensionsMatcher,
-            const QStringList& directoriesBlacklist)
+            const QStringList& directoriesBlacklist,
+            bool resetMissingTagMetadataOnImport)
             : m_trackLocations(trackLocations),
               m_directoryHashes(directoryHashes),
               m_supportedExtensionsMatcher(supportedExtensionsMatcher),
               m_supportedCoverExtensionsMatcher(supportedCoverExtensionsMatcher),
               m_directoriesBlacklist(directoriesBlacklist),
+              m_resetMissingTagMetadataOnImport(resetMissingTagMetadataOnImport),
+              m_pendingNewTracks(kMaxPendingNewTracks),
               // Unless marked un-clean, we assume it will finish cleanly.
               m_scanFinishedCleanly(true),
               m_shouldCancel(false),
-              m_numScannedDirectories(0) {
+              m_numScannedDirectories(0),
+              m_numParsedNewTracks(0),
+              m_parsingNewTracksNanos(0),
+              m_numInsertedNewTracks(0),
+              m_insertingNewTracksNanos(0) {
     }
 
     TaskWatcher& getTaskWatcher() {
@@ -94,6 +109,26 @@ class ScannerGlobal {
         return match.hasMatch();
     }
 
+    bool resetMissingTagMetadataOnImport() const {
+        return m_resetMissingTagMetadataOnImport;
+    }
+
+    // Blocks until less than kMaxPendingNewTracks new tracks are pending
+    // and reserves one of them. Returns false if the scan has been
+    // cancelled while waiting.
+    bool acquirePendingNewTrack() {
+        while (!m_pendingNewTracks.tryAcquire(1, 100)) {
+            if (shouldCancel()) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void releasePendingNewTracks(int count) {
+        m_pendingNewTracks.release(count);
+    }
+
     bool shouldCancel() const {
         return m_shouldCancel;
     }
@@ -153,6 +188,30 @@ class ScannerGlobal {
         m_numScannedDirectories++;
     }
 
+    // Throughput statistics of the worker threads
+    int numParsedNewTracks() const {
+        return atomicLoadRelaxed(m_numParsedNewTracks);
+    }
+    mixxx::Duration parsingNewTracksDuration() const {
+        return mixxx::Duration::fromNanos(atomicLoadRelaxed(m_parsingNewTracksNanos));
+    }
+    void newTrackParsed(mixxx::Duration duration) {
+        m_numParsedNewTracks.fetchAndAddRelaxed(1);
+        m_parsingNewTracksNanos.fetchAndAddRelaxed(duration.toIntegerNanos());
+    }
+
+    // Throughput statistics of the scanner thread
+    int numInsertedNewTracks() const {
+        return m_numInsertedNewTracks;
+    }
+    mixxx::Duration insertingNewTracksDuration() const {
+        return mixxx::Duration::fromNanos(m_insertingNewTracksNanos);
+    }
+    void newTracksInserted(int count, mixxx::Duration duration) {
+        m_numInsertedNewTracks += count;
+        m_insertingNewTracksNanos += duration.toIntegerNanos();
+    }
+
   private:
     TaskWatcher m_watcher;
 
@@ -182,6 +241,11 @@ class ScannerGlobal {
     // this has never been investigated.
     QStringList m_directoriesBlacklist;
 
+    const bool m_resetMissingTagMetadataOnImport;
+
+    // The permits for new tracks that are parsed but not added yet
+    QSemaphore m_pendingNewTracks;
+
     // The list of directories verified by the scan.
     QStringList m_verifiedDirectories;
 
@@ -197,6 +261,10 @@ class ScannerGlobal {
     // Stats tracking.
     PerformanceTimer m_timer;
     int m_numScannedDirectories;
+    QAtomicInteger<int> m_numParsedNewTracks;
+    QAtomicInteger<qint64> m_parsingNewTracksNanos;
+    int m_numInsertedNewTracks;
+    qint64 m_insertingNewTracksNanos;
 };
 
 typedef QSharedPointer<ScannerGlobal> ScannerGlobalPointer;
@@ -1,12 +1,26 @@
 #pragma once
 
+#include <QList>
+#include <QMetaType>
 #include <QObject>
 #include <QRunnable>
 
 #include "library/scanner/scannerglobal.h"
+#include "sources/soundsourceproxy.h"
 
 class LibraryScanner;
 
+/// A file that is not in the library yet
+struct NewTrackFile {
+    QString location;
+    /// False if the metadata must be imported when adding the track
+    bool metadataImported = false;
+    ImportedTrackMetadataAndCoverImage importedMetadata;
+};
+
+Q_DECLARE_METATYPE(NewTrackFile);
+Q_DECLARE_METATYPE(QList<NewTrackFile>);
+
 class ScannerTask : public QObject, public QRunnable {
     Q_OBJECT
   public:
@@ -23,7 +37,7 @@ class ScannerTask : public QObject, public QRunnable {
                                    bool newDirectory, mixxx::cache_key_t hash);
     void directoryUnchanged(const QString& directoryPath);
     void trackExists(const QString& filePath);
-    void addNewTrack(const QString& filePath);
+    void addNewTracks(const QList<NewTrackFile>& newTracks);
 
     // Feedback to GUI
     void progressLoading(const QString& fileName);
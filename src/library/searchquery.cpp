@@ -4,6 +4,7 @@
 #include <QtDebug>
 
 #include "library/dao/trackschema.h"
+#include "library/dao/tracksearchindex.h"
 #include "library/queryutil.h"
 #include "library/trackset/crate/crateschema.h"
 #include "track/keyutils.h"
@@ -22,6 +23,27 @@ const QRegularExpression kDurationRegex(QStringLiteral("^(\\d+)(m|:)?([0-5]?\\d)
 // > the entire expression matches, is the one that is chosen. This means that alternatives
 // > are not necessarily greedy.
 const QRegularExpression kNumericOperatorRegex(QStringLiteral("^(<=|>=|=|<|>)(.*)$"));
+
+// Clears the selected rows for which none of the columns matches
+template<typename Predicate>
+void filterNumberRows(const std::vector<const TrackColumnIndex::NumberColumn*>& columns,
+        TrackColumnIndex::RowMask* pRows,
+        Predicate predicate) {
+    for (std::size_t row = 0; row < pRows->size(); ++row) {
+        if (!(*pRows)[row]) {
+            continue;
+        }
+        bool matches = false;
+        for (const auto* pColumn : columns) {
+            if (pColumn->valid[row] && predicate(pColumn->values[row])) {
+                matches = true;
+                break;
+            }
+        }
+        (*pRows)[row] = matches;
+    }
+}
+
 } // namespace
 
 QVariant getTrackValueForColumn(const TrackPointer& pTrack, const QString& column) {
@@ -115,6 +137,16 @@ QString AndNode::toSql() const {
     return concatSqlClauses(queryFragments, "AND");
 }
 
+bool AndNode::filterRows(const TrackColumnIndex& index,
+        TrackColumnIndex::RowMask* pRows) const {
+    for (const auto& pNode : m_nodes) {
+        if (!pNode->filterRows(index, pRows)) {
+            return false;
+        }
+    }
+    return true;
+}
+
 bool OrNode::match(const TrackPointer& pTrack) const {
     // An empty OR node would always evaluate to false
     // which is inconsistent with the generated SQL query!
@@ -144,6 +176,32 @@ QString OrNode::toSql() const {
     return concatSqlClauses(queryFragments, "OR");
 }
 
+bool OrNode::filterRows(const TrackColumnIndex& index,
+        TrackColumnIndex::RowMask* pRows) const {
+    // See match()
+    VERIFY_OR_DEBUG_ASSERT(!m_nodes.empty()) {
+        return true;
+    }
+    // Each node only evaluates the rows that no previous node matched
+    TrackColumnIndex::RowMask unmatchedRows;
+    unmatchedRows.swap(*pRows);
+    pRows->assign(unmatchedRows.size(), 0);
+    TrackColumnIndex::RowMask nodeRows;
+    for (const auto& pNode : m_nodes) {
+        nodeRows = unmatchedRows;
+        if (!pNode->filterRows(index, &nodeRows)) {
+            return false;
+        }
+        for (std::size_t row = 0; row < nodeRows.size(); ++row) {
+            if (nodeRows[row]) {
+                (*pRows)[row] = 1;
+                unmatchedRows[row] = 0;
+            }
+        }
+    }
+    return true;
+}
+
 bool NotNode::match(const TrackPointer& pTrack) const {
     return !m_pNode->match(pTrack);
 }
@@ -160,12 +218,28 @@ QString NotNode::toSql() const {
     }
 }
 
+bool NotNode::filterRows(const TrackColumnIndex& index,
+        TrackColumnIndex::RowMask* pRows) const {
+    TrackColumnIndex::RowMask matchingRows = *pRows;
+    if (!m_pNode->filterRows(index, &matchingRows)) {
+        return false;
+    }
+    for (std::size_t row = 0; row < matchingRows.size(); ++row) {
+        if (matchingRows[row]) {
+            (*pRows)[row] = 0;
+        }
+    }
+    return true;
+}
+
 TextFilterNode::TextFilterNode(const QSqlDatabase& database,
         const QStringList& sqlColumns,
-        const QString& argument)
+        const QString& argument,
+        const TrackSearchIndex* pSearchIndex)
         : m_database(database),
           m_sqlColumns(sqlColumns),
-          m_argument(argument) {
+          m_argument(argument),
+          m_pSearchIndex(pSearchIndex) {
     mixxx::DbConnection::makeStringLatinLow(&m_argument);
 }
 
@@ -186,6 +260,31 @@ bool TextFilterNode::match(const TrackPointer& pTrack) const {
 }
 
 QString TextFilterNode::toSql() const {
+    QStringList searchClauses;
+    QStringList likeColumns = m_sqlColumns;
+    // The index matches substrings literally, while the argument may
+    // contain wildcards for LIKE
+    if (m_pSearchIndex &&
+            !m_argument.contains(kSqlLikeMatchAll) &&
+            !m_argument.contains(kSqlLikeMatchOne)) {
+        QStringList indexedColumns;
+        QStringList otherColumns;
+        for (const auto& sqlColumn : m_sqlColumns) {
+            if (TrackSearchIndex::isIndexedColumn(sqlColumn)) {
+                indexedColumns << sqlColumn;
+            } else {
+                otherColumns << sqlColumn;
+            }
+        }
+        const QString indexQuery = m_pSearchIndex->formatQueryForTrackIdsContaining(
+                indexedColumns, m_argument);
+        if (!indexQuery.isEmpty()) {
+            // Only the columns that are not indexed need to be scanned
+            searchClauses << QString("id IN (%1)").arg(indexQuery);
+            likeColumns = otherColumns;
+        }
+    }
+
     FieldEscaper escaper(m_database);
     QString argument = m_argument;
     if (argument.size() > 0) {
@@ -197,13 +296,43 @@ QString TextFilterNode::toSql() const {
     }
     QString escapedArgument = escaper.escapeString(
             kSqlLikeMatchAll + argument + kSqlLikeMatchAll);
-    QStringList searchClauses;
-    for (const auto& sqlColumn : m_sqlColumns) {
+    for (const auto& sqlColumn : qAsConst(likeColumns)) {
         searchClauses << QString("%1 LIKE %2").arg(sqlColumn, escapedArgument);
     }
     return concatSqlClauses(searchClauses, "OR");
 }
 
+bool TextFilterNode::filterRows(const TrackColumnIndex& index,
+        TrackColumnIndex::RowMask* pRows) const {
+    std::vector<const std::vector<QString>*> columns;
+    columns.reserve(m_sqlColumns.size());
+    for (const auto& sqlColumn : m_sqlColumns) {
+        const auto* pColumn = index.textColumn(sqlColumn);
+        if (!pColumn) {
+            return false;
+        }
+        columns.push_back(pColumn);
+    }
+    if (columns.empty()) {
+        // Consistent with the empty SQL query
+        return true;
+    }
+    for (std::size_t row = 0; row < pRows->size(); ++row) {
+        if (!(*pRows)[row]) {
+            continue;
+        }
+        bool matches = false;
+        for (const auto* pColumn : columns) {
+            if ((*pColumn)[row].contains(m_argument)) {
+                matches = true;
+                break;
+            }
+        }
+        (*pRows)[row] = matches;
+    }
+    return true;
+}
+
 bool NullOrEmptyTextFilterNode::match(const TrackPointer& pTrack) const {
     if (!m_sqlColumns.isEmpty()) {
         // only use the major column
@@ -224,6 +353,22 @@ QString NullOrEmptyTextFilterNode::toSql() const {
     return QString();
 }
 
+bool NullOrEmptyTextFilterNode::filterRows(const TrackColumnIndex& index,
+        TrackColumnIndex::RowMask* pRows) const {
+    if (m_sqlColumns.isEmpty()) {
+        return true;
+    }
+    // only use the major column
+    const auto* pColumn = index.textColumn(m_sqlColumns.first());
+    if (!pColumn) {
+        return false;
+    }
+    for (std::size_t row = 0; row < pRows->size(); ++row) {
+        (*pRows)[row] = (*pRows)[row] && (*pColumn)[row].isEmpty();
+    }
+    return true;
+}
+
 CrateFilterNode::CrateFilterNode(const CrateStorage* pCrateStorage,
         const QString& crateNameLike)
         : m_pCrateStorage(pCrateStorage),
@@ -231,7 +376,7 @@ CrateFilterNode::CrateFilterNode(const CrateStorage* pCrateStorage,
           m_matchInitialized(false) {
 }
 
-bool CrateFilterNode::match(const TrackPointer& pTrack) const {
+bool CrateFilterNode::containsTrackId(TrackId trackId) const {
     if (!m_matchInitialized) {
         CrateTrackSelectResult crateTracks(
                 m_pCrateStorage->selectTracksSortedByCrateNameLike(m_crateNameLike));
@@ -243,7 +388,19 @@ bool CrateFilterNode::match(const TrackPointer& pTrack) const {
         m_matchInitialized = true;
     }
 
-    return std::binary_search(m_matchingTrackIds.begin(), m_matchingTrackIds.end(), pTrack->getId());
+    return std::binary_search(m_matchingTrackIds.begin(), m_matchingTrackIds.end(), trackId);
+}
+
+bool CrateFilterNode::match(const TrackPointer& pTrack) const {
+    return containsTrackId(pTrack->getId());
+}
+
+bool CrateFilterNode::filterRows(const TrackColumnIndex& index,
+        TrackColumnIndex::RowMask* pRows) const {
+    for (std::size_t row = 0; row < pRows->size(); ++row) {
+        (*pRows)[row] = (*pRows)[row] && containsTrackId(index.trackId(static_cast<int>(row)));
+    }
+    return true;
 }
 
 QString CrateFilterNode::toSql() const {
@@ -257,7 +414,7 @@ NoCrateFilterNode::NoCrateFilterNode(const CrateStorage* pCrateStorage)
           m_matchInitialized(false) {
 }
 
-bool NoCrateFilterNode::match(const TrackPointer& pTrack) const {
+bool NoCrateFilterNode::containsTrackId(TrackId trackId) const {
     if (!m_matchInitialized) {
         TrackSelectResult tracks(
                 m_pCrateStorage->selectAllTracksSorted());
@@ -269,7 +426,19 @@ bool NoCrateFilterNode::match(const TrackPointer& pTrack) const {
         m_matchInitialized = true;
     }
 
-    return !std::binary_search(m_matchingTrackIds.begin(), m_matchingTrackIds.end(), pTrack->getId());
+    return std::binary_search(m_matchingTrackIds.begin(), m_matchingTrackIds.end(), trackId);
+}
+
+bool NoCrateFilterNode::match(const TrackPointer& pTrack) const {
+    return !containsTrackId(pTrack->getId());
+}
+
+bool NoCrateFilterNode::filterRows(const TrackColumnIndex& index,
+        TrackColumnIndex::RowMask* pRows) const {
+    for (std::size_t row = 0; row < pRows->size(); ++row) {
+        (*pRows)[row] = (*pRows)[row] && !containsTrackId(index.trackId(static_cast<int>(row)));
+    }
+    return true;
 }
 
 QString NoCrateFilterNode::toSql() const {
@@ -393,6 +562,64 @@ QString NumericFilterNode::toSql() const {
     return QString();
 }
 
+bool NumericFilterNode::filterRows(const TrackColumnIndex& index,
+        TrackColumnIndex::RowMask* pRows) const {
+    if (m_sqlColumns.isEmpty() || !(m_bNullQuery || m_bOperatorQuery || m_bRangeQuery)) {
+        // Consistent with the empty SQL query
+        return true;
+    }
+    std::vector<const TrackColumnIndex::NumberColumn*> columns;
+    columns.reserve(m_sqlColumns.size());
+    for (const auto& sqlColumn : m_sqlColumns) {
+        const auto* pColumn = index.numberColumn(sqlColumn);
+        if (!pColumn) {
+            return false;
+        }
+        columns.push_back(pColumn);
+    }
+
+    if (m_bNullQuery) {
+        // only use the major column
+        const auto& valid = columns.front()->valid;
+        for (std::size_t row = 0; row < pRows->size(); ++row) {
+            (*pRows)[row] = (*pRows)[row] && !valid[row];
+        }
+    } else if (m_bOperatorQuery) {
+        // Resolve the operator once instead of for each value
+        const double argument = m_dOperatorArgument;
+        if (m_operator == "=") {
+            filterNumberRows(columns, pRows, [argument](double value) {
+                return value == argument;
+            });
+        } else if (m_operator == "<") {
+            filterNumberRows(columns, pRows, [argument](double value) {
+                return value < argument;
+            });
+        } else if (m_operator == ">") {
+            filterNumberRows(columns, pRows, [argument](double value) {
+                return value > argument;
+            });
+        } else if (m_operator == "<=") {
+            filterNumberRows(columns, pRows, [argument](double value) {
+                return value <= argument;
+            });
+        } else if (m_operator == ">=") {
+            filterNumberRows(columns, pRows, [argument](double value) {
+                return value >= argument;
+            });
+        } else {
+            return false;
+        }
+    } else {
+        const double low = m_dRangeLow;
+        const double high = m_dRangeHigh;
+        filterNumberRows(columns, pRows, [low, high](double value) {
+            return value >= low && value <= high;
+        });
+    }
+    return true;
+}
+
 NullNumericFilterNode::NullNumericFilterNode(const QStringList& sqlColumns)
         : m_sqlColumns(sqlColumns) {
 }
@@ -416,6 +643,22 @@ QString NullNumericFilterNode::toSql() const {
     return QString();
 }
 
+bool NullNumericFilterNode::filterRows(const TrackColumnIndex& index,
+        TrackColumnIndex::RowMask* pRows) const {
+    if (m_sqlColumns.isEmpty()) {
+        return true;
+    }
+    // only use the major column
+    const auto* pColumn = index.numberColumn(m_sqlColumns.first());
+    if (!pColumn) {
+        return false;
+    }
+    for (std::size_t row = 0; row < pRows->size(); ++row) {
+        (*pRows)[row] = (*pRows)[row] && !pColumn->valid[row];
+    }
+    return true;
+}
+
 DurationFilterNode::DurationFilterNode(
         const QStringList& sqlColumns, const QString& argument)
         : NumericFilterNode(sqlColumns) {
@@ -473,3 +716,16 @@ QString KeyFilterNode::toSql() const {
     }
     return concatSqlClauses(searchClauses, "OR");
 }
+
+bool KeyFilterNode::filterRows(const TrackColumnIndex& index,
+        TrackColumnIndex::RowMask* pRows) const {
+    const auto* pColumn = index.numberColumn(LIBRARYTABLE_KEY_ID);
+    if (!pColumn) {
+        return false;
+    }
+    filterNumberRows({pColumn}, pRows, [this](double value) {
+        return m_matchKeys.contains(
+                static_cast<mixxx::track::io::key::ChromaticKey>(static_cast<int>(value)));
+    });
+    return true;
+}
@@ -8,12 +8,15 @@
 #include <utility>
 #include <vector>
 
+#include "library/trackcolumnindex.h"
 #include "library/trackset/crate/cratestorage.h"
 #include "proto/keys.pb.h"
 #include "track/track_decl.h"
 #include "util/assert.h"
 #include "util/memory.h"
 
+class TrackSearchIndex;
+
 const QString kMissingFieldSearchTerm = "\"\""; // "" searches for an empty string
 
 QVariant getTrackValueForColumn(const TrackPointer& pTrack, const QString& column);
@@ -26,6 +29,17 @@ class QueryNode {
     virtual bool match(const TrackPointer& pTrack) const = 0;
     virtual QString toSql() const = 0;
 
+    /// Evaluates the node for the rows of the index that are set in *pRows
+    /// and clears the rows that don't match, consistent with the SQL query.
+    /// *pRows has one entry for each row of the index.
+    /// Returns false if the node can only be evaluated by the database.
+    virtual bool filterRows(const TrackColumnIndex& index,
+            TrackColumnIndex::RowMask* pRows) const {
+        Q_UNUSED(index);
+        Q_UNUSED(pRows);
+        return false;
+    }
+
   protected:
     QueryNode() = default;
 
@@ -50,12 +64,16 @@ class OrNode : public GroupNode {
   public:
     bool match(const TrackPointer& pTrack) const override;
     QString toSql() const override;
+    bool filterRows(const TrackColumnIndex& index,
+            TrackColumnIndex::RowMask* pRows) const override;
 };
 
 class AndNode : public GroupNode {
   public:
     bool match(const TrackPointer& pTrack) const override;
     QString toSql() const override;
+    bool filterRows(const TrackColumnIndex& index,
+            TrackColumnIndex::RowMask* pRows) const override;
 };
 
 class NotNode : public QueryNode {
@@ -67,6 +85,8 @@ class NotNode : public QueryNode {
 
     bool match(const TrackPointer& pTrack) const override;
     QString toSql() const override;
+    bool filterRows(const TrackColumnIndex& index,
+            TrackColumnIndex::RowMask* pRows) const override;
 
   private:
     std::unique_ptr<QueryNode> m_pNode;
@@ -74,17 +94,23 @@ class NotNode : public QueryNode {
 
 class TextFilterNode : public QueryNode {
   public:
+    /// The columns covered by the optional search index are searched
+    /// with the index instead of LIKE expressions.
     TextFilterNode(const QSqlDatabase& database,
             const QStringList& sqlColumns,
-            const QString& argument);
+            const QString& argument,
+            const TrackSearchIndex* pSearchIndex = nullptr);
 
     bool match(const TrackPointer& pTrack) const override;
     QString toSql() const override;
+    bool filterRows(const TrackColumnIndex& index,
+            TrackColumnIndex::RowMask* pRows) const override;
 
   private:
     QSqlDatabase m_database;
     QStringList m_sqlColumns;
     QString m_argument;
+    const TrackSearchIndex* m_pSearchIndex;
 };
 
 class NullOrEmptyTextFilterNode : public QueryNode {
@@ -97,6 +123,8 @@ class NullOrEmptyTextFilterNode : public QueryNode {
 
     bool match(const TrackPointer& pTrack) const override;
     QString toSql() const override;
+    bool filterRows(const TrackColumnIndex& index,
+            TrackColumnIndex::RowMask* pRows) const override;
 
   private:
     QSqlDatabase m_database;
@@ -110,8 +138,12 @@ class CrateFilterNode : public QueryNode {
 
     bool match(const TrackPointer& pTrack) const override;
     QString toSql() const override;
+    bool filterRows(const TrackColumnIndex& index,
+            TrackColumnIndex::RowMask* pRows) const override;
 
   private:
+    bool containsTrackId(TrackId trackId) const;
+
     const CrateStorage* m_pCrateStorage;
     QString m_crateNameLike;
     mutable bool m_matchInitialized;
@@ -124,8 +156,12 @@ class NoCrateFilterNode : public QueryNode {
 
     bool match(const TrackPointer& pTrack) const override;
     QString toSql() const override;
+    bool filterRows(const TrackColumnIndex& index,
+            TrackColumnIndex::RowMask* pRows) const override;
 
   private:
+    bool containsTrackId(TrackId trackId) const;
+
     const CrateStorage* m_pCrateStorage;
     QString m_crateNameLike;
     mutable bool m_matchInitialized;
@@ -138,6 +174,8 @@ class NumericFilterNode : public QueryNode {
 
     bool match(const TrackPointer& pTrack) const override;
     QString toSql() const override;
+    bool filterRows(const TrackColumnIndex& index,
+            TrackColumnIndex::RowMask* pRows) const override;
 
   protected:
     // Single argument constructor for that does not call init()
@@ -168,6 +206,8 @@ class NullNumericFilterNode : public QueryNode {
 
     bool match(const TrackPointer& pTrack) const override;
     QString toSql() const override;
+    bool filterRows(const TrackColumnIndex& index,
+            TrackColumnIndex::RowMask* pRows) const override;
 
     QStringList m_sqlColumns;
 };
@@ -186,6 +226,8 @@ class KeyFilterNode : public QueryNode {
 
     bool match(const TrackPointer& pTrack) const override;
     QString toSql() const override;
+    bool filterRows(const TrackColumnIndex& index,
+            TrackColumnIndex::RowMask* pRows) const override;
 
   private:
     QList<mixxx::track::io::key::ChromaticKey> m_matchKeys;
@@ -10,8 +10,10 @@ constexpr char kFuzzyPrefix[] = "~";
 const QRegularExpression kSplitIntoWordsRegexp = QRegularExpression(
         QStringLiteral(" (?=[^\"]*(\"[^\"]*\"[^\"]*)*$)"));
 
-SearchQueryParser::SearchQueryParser(TrackCollection* pTrackCollection)
-    : m_pTrackCollection(pTrackCollection) {
+SearchQueryParser::SearchQueryParser(TrackCollection* pTrackCollection,
+        const TrackSearchIndex* pSearchIndex)
+    : m_pTrackCollection(pTrackCollection),
+      m_pSearchIndex(pSearchIndex) {
     m_textFilters << "artist"
                   << "album_artist"
                   << "album"
@@ -174,7 +176,9 @@ void SearchQueryParser::parseTokens(QStringList tokens,
                 } else {
                     pNode = std::make_unique<TextFilterNode>(
                             m_pTrackCollection->database(),
-                            m_fieldToSqlColumns[field], argument);
+                            m_fieldToSqlColumns[field],
+                            argument,
+                            m_pSearchIndex);
                 }
             }
         } else if (numericFilterMatch.hasMatch()) {
@@ -242,12 +246,18 @@ void SearchQueryParser::parseTokens(QStringList tokens,
                     gNode->addNode(std::make_unique<CrateFilterNode>(
                                     &m_pTrackCollection->crates(), argument));
                     gNode->addNode(std::make_unique<TextFilterNode>(
-                                    m_pTrackCollection->database(), queryColumns, argument));
+                                    m_pTrackCollection->database(),
+                                    queryColumns,
+                                    argument,
+                                    m_pSearchIndex));
 
                     pNode = std::move(gNode);
                 } else {
                     pNode = std::make_unique<TextFilterNode>(
-                             m_pTrackCollection->database(), queryColumns, argument);
+                             m_pTrackCollection->database(),
+                             queryColumns,
+                             argument,
+                             m_pSearchIndex);
                 }
             }
         }
@@ -10,7 +10,11 @@
 
 class SearchQueryParser {
   public:
-    explicit SearchQueryParser(TrackCollection* pTrackCollection);
+    /// Free-text searches use the optional search index for the columns
+    /// it covers. It must only be passed for queries on the tracks of the
+    /// internal library.
+    explicit SearchQueryParser(TrackCollection* pTrackCollection,
+            const TrackSearchIndex* pSearchIndex = nullptr);
 
     virtual ~SearchQueryParser();
 
@@ -33,6 +37,7 @@ class SearchQueryParser {
                             QStringList* tokens) const;
 
     TrackCollection* m_pTrackCollection;
+    const TrackSearchIndex* m_pSearchIndex;
     QStringList m_textFilters;
     QStringList m_numericFilters;
     QStringList m_specialFilters;
@@ -6,6 +6,7 @@
 #include "library/library_prefs.h"
 #include "library/scanner/libraryscanner.h"
 #include "library/trackcollection.h"
+#include "library/trackqueryexecutor.h"
 #include "moc_trackcollectionmanager.cpp"
 #include "sources/soundsourceproxy.h"
 #include "track/track.h"
@@ -126,6 +127,9 @@ TrackCollectionManager::TrackCollectionManager(
         kLogger.info() << "Starting library scanner thread";
         m_pScanner->start();
     }
+
+    m_pQueryExecutor = std::make_unique<TrackQueryExecutor>(pDbConnectionPool);
+    m_pQueryExecutor->start();
 }
 
 TrackCollectionManager::~TrackCollectionManager() {
@@ -141,6 +145,9 @@ TrackCollectionManager::~TrackCollectionManager() {
         m_pScanner.reset();
     }
 
+    // Waits until the current query has been aborted
+    m_pQueryExecutor.reset();
+
     const auto pWeakTrackSource = m_pInternalCollection->disconnectTrackSource();
     VERIFY_OR_DEBUG_ASSERT(pWeakTrackSource.isNull()) {
         kLogger.warning() << "BaseTrackCache is still in use";
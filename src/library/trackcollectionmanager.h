@@ -15,6 +15,7 @@
 
 class LibraryScanner;
 class TrackCollection;
+class TrackQueryExecutor;
 class ExternalTrackCollection;
 
 // Manages Mixxx's internal database of tracks as well as external track collections.
@@ -47,6 +48,11 @@ class TrackCollectionManager: public QObject,
         return m_externalCollections;
     }
 
+    /// Executes the queries of the track table models in the background
+    TrackQueryExecutor* queryExecutor() const {
+        return m_pQueryExecutor.get();
+    }
+
     TrackPointer getTrackById(
             TrackId trackId) const;
     TrackPointer getTrackByRef(
@@ -127,4 +133,6 @@ class TrackCollectionManager: public QObject,
 
     // TODO: Extract and decouple LibraryScanner from TrackCollectionManager
     std::unique_ptr<LibraryScanner> m_pScanner;
+
+    std::unique_ptr<TrackQueryExecutor> m_pQueryExecutor;
 };
@@ -0,0 +1,275 @@
+#include "library/trackcolumnindex.h"
+
+#include <algorithm>
+
+#include "library/columncache.h"
+#include "util/assert.h"
+#include "util/db/dbconnection.h"
+#include "util/string.h"
+
+namespace {
+
+QString foldedText(const QVariant& value) {
+    QString text = value.toString();
+    // Folding detaches the implicitly shared string. Values that are
+    // already folded keep sharing the data of the record.
+    const bool folded = std::none_of(text.cbegin(), text.cend(), [](QChar c) {
+        return c.isUpper() || c.decompositionTag() != QChar::NoDecomposition;
+    });
+    if (!folded) {
+        mixxx::DbConnection::makeStringLatinLow(&text);
+    }
+    return text;
+}
+
+void setNumber(const QVariant& value, TrackColumnIndex::NumberColumn* pColumn, int row) {
+    bool ok = false;
+    const double number = value.isNull() ? 0.0 : value.toDouble(&ok);
+    pColumn->values[row] = ok ? number : 0.0;
+    pColumn->valid[row] = ok ? 1 : 0;
+}
+
+template<typename T>
+void removeRowFromColumn(std::vector<T>* pValues, int row) {
+    if (row != static_cast<int>(pValues->size()) - 1) {
+        (*pValues)[row] = std::move(pValues->back());
+    }
+    pValues->pop_back();
+}
+
+} // namespace
+
+TrackColumnIndex::TrackColumnIndex(const QHash<TrackId, QVector<QVariant>>* pRecords,
+        const ColumnCache* pColumnCache,
+        const mixxx::StringCollator* pCollator)
+        : m_pRecords(pRecords),
+          m_pColumnCache(pColumnCache),
+          m_pCollator(pCollator),
+          m_keyOrderNotation(KeyUtils::KeyNotation::Invalid) {
+}
+
+void TrackColumnIndex::clear() {
+    m_trackIds.clear();
+    m_rowByTrackId.clear();
+    m_textColumns.clear();
+    m_numberColumns.clear();
+    m_sortKeyColumns.clear();
+    m_keyOrderColumns.clear();
+}
+
+void TrackColumnIndex::updateRow(TrackId trackId) {
+    const auto recordIt = m_pRecords->constFind(trackId);
+    if (recordIt == m_pRecords->constEnd()) {
+        removeRow(trackId);
+        return;
+    }
+    const QVector<QVariant>& record = recordIt.value();
+
+    int row = this->row(trackId);
+    if (row < 0) {
+        row = rowCount();
+        m_trackIds.push_back(trackId);
+        m_rowByTrackId.insert(trackId, row);
+        for (auto& [column, values] : m_textColumns) {
+            values.emplace_back();
+        }
+        for (auto& [column, values] : m_numberColumns) {
+            values.values.push_back(0.0);
+            values.valid.push_back(0);
+        }
+        for (auto& [column, values] : m_sortKeyColumns) {
+            values.push_back(sortKey(QVariant()));
+        }
+        for (auto& [column, values] : m_keyOrderColumns) {
+            values.push_back(0);
+        }
+    }
+
+    for (auto& [column, values] : m_textColumns) {
+        values[row] = foldedText(record.value(column));
+    }
+    for (auto& [column, values] : m_numberColumns) {
+        setNumber(record.value(column), &values, row);
+    }
+    for (auto& [column, values] : m_sortKeyColumns) {
+        values[row] = sortKey(record.value(column));
+    }
+    for (auto& [column, values] : m_keyOrderColumns) {
+        values[row] = keyOrder(record.value(column));
+    }
+}
+
+void TrackColumnIndex::removeRow(TrackId trackId) {
+    const int row = m_rowByTrackId.value(trackId, -1);
+    if (row < 0) {
+        return;
+    }
+    m_rowByTrackId.remove(trackId);
+
+    // Move the last row into the gap to keep the columns packed
+    if (row != rowCount() - 1) {
+        m_rowByTrackId[m_trackIds.back()] = row;
+    }
+    removeRowFromColumn(&m_trackIds, row);
+    for (auto& [column, values] : m_textColumns) {
+        removeRowFromColumn(&values, row);
+    }
+    for (auto& [column, values] : m_numberColumns) {
+        removeRowFromColumn(&values.values, row);
+        removeRowFromColumn(&values.valid, row);
+    }
+    for (auto& [column, values] : m_sortKeyColumns) {
+        removeRowFromColumn(&values, row);
+    }
+    for (auto& [column, values] : m_keyOrderColumns) {
+        removeRowFromColumn(&values, row);
+    }
+}
+
+const std::vector<QString>* TrackColumnIndex::textColumn(const QString& columnName) const {
+    const int column = m_pColumnCache->fieldIndex(columnName);
+    if (column < 0) {
+        return nullptr;
+    }
+    return &ensureTextColumn(column);
+}
+
+const TrackColumnIndex::NumberColumn* TrackColumnIndex::numberColumn(
+        const QString& columnName) const {
+    const int column = m_pColumnCache->fieldIndex(columnName);
+    if (column < 0) {
+        return nullptr;
+    }
+    return &ensureNumberColumn(column);
+}
+
+void TrackColumnIndex::sortRows(std::vector<int>* pRows,
+        const QList<SortSpec>& sortSpecs) const {
+    const std::vector<ResolvedSort> sorts = resolveSortSpecs(sortSpecs);
+    std::sort(pRows->begin(), pRows->end(), [this, &sorts](int lhs, int rhs) {
+        return compareRows(sorts, lhs, rhs) < 0;
+    });
+}
+
+int TrackColumnIndex::compareRows(int lhs, int rhs, const QList<SortSpec>& sortSpecs) const {
+    DEBUG_ASSERT(lhs >= 0 && lhs < rowCount());
+    DEBUG_ASSERT(rhs >= 0 && rhs < rowCount());
+    return compareRows(resolveSortSpecs(sortSpecs), lhs, rhs);
+}
+
+std::vector<TrackColumnIndex::ResolvedSort> TrackColumnIndex::resolveSortSpecs(
+        const QList<SortSpec>& sortSpecs) const {
+    const KeyUtils::KeyNotation keyNotation = m_pColumnCache->keyNotation();
+    if (keyNotation != m_keyOrderNotation) {
+        m_keyOrderColumns.clear();
+        m_keyOrderNotation = keyNotation;
+    }
+
+    // Resolve the columns once, so the comparisons only access packed arrays
+    std::vector<ResolvedSort> sorts;
+    sorts.reserve(sortSpecs.size());
+    for (const auto& sortSpec : sortSpecs) {
+        ResolvedSort sort{nullptr, nullptr, nullptr, sortSpec.order == Qt::DescendingOrder};
+        switch (sortSpec.type) {
+        case SortType::Text:
+            sort.pSortKeys = &ensureSortKeyColumn(sortSpec.column);
+            break;
+        case SortType::Number:
+            sort.pNumbers = &ensureNumberColumn(sortSpec.column).values;
+            break;
+        case SortType::Key:
+            sort.pKeyOrders = &ensureKeyOrderColumn(sortSpec.column);
+            break;
+        }
+        sorts.push_back(sort);
+    }
+    return sorts;
+}
+
+int TrackColumnIndex::compareRows(
+        const std::vector<ResolvedSort>& sorts, int lhs, int rhs) const {
+    for (const auto& sort : sorts) {
+        int result;
+        if (sort.pSortKeys) {
+            result = (*sort.pSortKeys)[lhs].compare((*sort.pSortKeys)[rhs]);
+        } else if (sort.pNumbers) {
+            const double lhsValue = (*sort.pNumbers)[lhs];
+            const double rhsValue = (*sort.pNumbers)[rhs];
+            result = (lhsValue > rhsValue) - (lhsValue < rhsValue);
+        } else {
+            result = (*sort.pKeyOrders)[lhs] - (*sort.pKeyOrders)[rhs];
+        }
+        if (result != 0) {
+            return sort.descending ? -result : result;
+        }
+    }
+    return (m_trackIds[rhs] < m_trackIds[lhs]) - (m_trackIds[lhs] < m_trackIds[rhs]);
+}
+
+const std::vector<QString>& TrackColumnIndex::ensureTextColumn(int column) const {
+    auto [it, inserted] = m_textColumns.try_emplace(column);
+    std::vector<QString>& values = it->second;
+    if (inserted) {
+        values.reserve(m_trackIds.size());
+        for (const auto& trackId : m_trackIds) {
+            values.push_back(foldedText(recordValue(trackId, column)));
+        }
+    }
+    return values;
+}
+
+const TrackColumnIndex::NumberColumn& TrackColumnIndex::ensureNumberColumn(int column) const {
+    auto [it, inserted] = m_numberColumns.try_emplace(column);
+    NumberColumn& values = it->second;
+    if (inserted) {
+        values.values.resize(m_trackIds.size());
+        values.valid.resize(m_trackIds.size());
+        for (int row = 0; row < rowCount(); ++row) {
+            setNumber(recordValue(m_trackIds[row], column), &values, row);
+        }
+    }
+    return values;
+}
+
+const std::vector<QCollatorSortKey>& TrackColumnIndex::ensureSortKeyColumn(int column) const {
+    auto [it, inserted] = m_sortKeyColumns.try_emplace(column);
+    std::vector<QCollatorSortKey>& values = it->second;
+    if (inserted) {
+        values.reserve(m_trackIds.size());
+        for (const auto& trackId : m_trackIds) {
+            values.push_back(sortKey(recordValue(trackId, column)));
+        }
+    }
+    return values;
+}
+
+const std::vector<int>& TrackColumnIndex::ensureKeyOrderColumn(int column) const {
+    auto [it, inserted] = m_keyOrderColumns.try_emplace(column);
+    std::vector<int>& values = it->second;
+    if (inserted) {
+        values.reserve(m_trackIds.size());
+        for (const auto& trackId : m_trackIds) {
+            values.push_back(keyOrder(recordValue(trackId, column)));
+        }
+    }
+    return values;
+}
+
+QVariant TrackColumnIndex::recordValue(TrackId trackId, int column) const {
+    const auto it = m_pRecords->constFind(trackId);
+    VERIFY_OR_DEBUG_ASSERT(it != m_pRecords->constEnd()) {
+        return QVariant();
+    }
+    return it.value().value(column);
+}
+
+QCollatorSortKey TrackColumnIndex::sortKey(const QVariant& value) const {
+    return m_pCollator->sortKey(value.toString());
+}
+
+int TrackColumnIndex::keyOrder(const QVariant& value) const {
+    // Same order as the SQL expression of ColumnCache::slotSetKeySortOrder()
+    return KeyUtils::keyToCircleOfFifthsOrder(
+            static_cast<mixxx::track::io::key::ChromaticKey>(value.toInt()),
+            m_keyOrderNotation);
+}
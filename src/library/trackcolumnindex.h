@@ -0,0 +1,135 @@
+#pragma once
+
+#include <QCollatorSortKey>
+#include <QHash>
+#include <QString>
+#include <QVariant>
+#include <QVector>
+#include <unordered_map>
+#include <vector>
+
+#include "track/keyutils.h"
+#include "track/trackid.h"
+#include "util/class.h"
+
+class ColumnCache;
+
+namespace mixxx {
+class StringCollator;
+} // namespace mixxx
+
+/// TrackColumnIndex stores the records of a BaseTrackCache column by column
+/// with typed values, so a QueryNode tree can be evaluated and the matching
+/// tracks can be sorted without querying the database and without comparing
+/// QVariants.
+///
+/// Each track occupies one row in all columns. Columns are only built when
+/// a search or sort needs them for the first time, because most columns are
+/// never searched and every column costs memory for each track of the library.
+/// Once built, a column is kept up to date when tracks are added, changed or
+/// removed.
+///
+/// Text columns contain the values folded by DbConnection::makeStringLatinLow(),
+/// like the like() function of the database does for each comparison.
+/// Number columns are packed arrays of doubles.
+class TrackColumnIndex {
+  public:
+    /// One entry per row that is non-zero if the row is selected
+    typedef std::vector<char> RowMask;
+
+    struct NumberColumn {
+        /// Values that are missing or not a number are stored as 0
+        std::vector<double> values;
+        /// Non-zero if the value is a number
+        RowMask valid;
+    };
+
+    enum class SortType {
+        /// Case insensitive and locale aware
+        Text,
+        Number,
+        /// Circle of fifths order of the key ids in the column
+        Key,
+    };
+
+    struct SortSpec {
+        int column;
+        SortType type;
+        Qt::SortOrder order;
+    };
+
+    /// The index reads the records of the tracks from pRecords when building
+    /// or updating a column. The pointers must outlive the index.
+    TrackColumnIndex(const QHash<TrackId, QVector<QVariant>>* pRecords,
+            const ColumnCache* pColumnCache,
+            const mixxx::StringCollator* pCollator);
+
+    void clear();
+    /// Inserts the track or updates its row from the record. The track is
+    /// removed if it has no record.
+    void updateRow(TrackId trackId);
+    void removeRow(TrackId trackId);
+
+    int rowCount() const {
+        return static_cast<int>(m_trackIds.size());
+    }
+    /// Returns -1 for tracks that are not indexed
+    int row(TrackId trackId) const {
+        return m_rowByTrackId.value(trackId, -1);
+    }
+    TrackId trackId(int row) const {
+        return m_trackIds[row];
+    }
+
+    /// Returns nullptr if the column is unknown
+    const std::vector<QString>* textColumn(const QString& columnName) const;
+    /// Returns nullptr if the column is unknown
+    const NumberColumn* numberColumn(const QString& columnName) const;
+
+    /// Sorts the rows by the given columns. Rows that compare equal are
+    /// sorted by track id.
+    void sortRows(std::vector<int>* pRows, const QList<SortSpec>& sortSpecs) const;
+    /// Compares two rows in the order of sortRows(). Returns a negative
+    /// number if lhs is sorted before rhs, a positive number if lhs is
+    /// sorted after rhs, and 0 if both are the same row.
+    int compareRows(int lhs, int rhs, const QList<SortSpec>& sortSpecs) const;
+
+  private:
+    // The columns of a SortSpec
+    struct ResolvedSort {
+        const std::vector<QCollatorSortKey>* pSortKeys;
+        const std::vector<double>* pNumbers;
+        const std::vector<int>* pKeyOrders;
+        bool descending;
+    };
+
+    std::vector<ResolvedSort> resolveSortSpecs(const QList<SortSpec>& sortSpecs) const;
+    int compareRows(const std::vector<ResolvedSort>& sorts, int lhs, int rhs) const;
+
+    const std::vector<QString>& ensureTextColumn(int column) const;
+    const NumberColumn& ensureNumberColumn(int column) const;
+    const std::vector<QCollatorSortKey>& ensureSortKeyColumn(int column) const;
+    const std::vector<int>& ensureKeyOrderColumn(int column) const;
+
+    QVariant recordValue(TrackId trackId, int column) const;
+    QCollatorSortKey sortKey(const QVariant& value) const;
+    int keyOrder(const QVariant& value) const;
+
+    const QHash<TrackId, QVector<QVariant>>* const m_pRecords;
+    const ColumnCache* const m_pColumnCache;
+    const mixxx::StringCollator* const m_pCollator;
+
+    std::vector<TrackId> m_trackIds;
+    QHash<TrackId, int> m_rowByTrackId;
+
+    // The built columns by field index. The references returned for
+    // a column must stay valid while other columns are built.
+    mutable std::unordered_map<int, std::vector<QString>> m_textColumns;
+    mutable std::unordered_map<int, NumberColumn> m_numberColumns;
+    mutable std::unordered_map<int, std::vector<QCollatorSortKey>> m_sortKeyColumns;
+    mutable std::unordered_map<int, std::vector<int>> m_keyOrderColumns;
+    // The key order depends on the key notation
+    mutable KeyUtils::KeyNotation m_keyOrderNotation;
+
+    DISALLOW_COPY_AND_ASSIGN(TrackColumnIndex);
+};
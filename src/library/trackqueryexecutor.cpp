@@ -0,0 +1,244 @@
+#include "library/trackqueryexecutor.h"
+
+#include <QSqlDriver>
+#include <QSqlError>
+#include <QSqlQuery>
+#include <QSqlRecord>
+#include <cstring>
+
+#ifdef __SQLITE3__
+#include <sqlite3.h>
+#endif // __SQLITE3__
+
+#include "library/queryutil.h"
+#include "moc_trackqueryexecutor.cpp"
+#include "util/assert.h"
+#include "util/db/dbconnectionpooled.h"
+#include "util/db/dbconnectionpooler.h"
+#include "util/logger.h"
+#include "util/trace.h"
+
+namespace {
+
+const mixxx::Logger kLogger("TrackQueryExecutor");
+
+// SQLite stores the SQL of temporary views without the TEMP keyword
+const QString kCreateView = QStringLiteral("CREATE VIEW ");
+
+} // anonymous namespace
+
+TrackQueryExecutor::TrackQueryExecutor(mixxx::DbConnectionPoolPtr pDbConnectionPool)
+        : m_pDbConnectionPool(std::move(pDbConnectionPool)),
+          m_stop(false),
+          m_lastRequestId(0),
+          m_executingRequestId(0)
+#ifdef __SQLITE3__
+          ,
+          m_pConnectionHandle(nullptr)
+#endif // __SQLITE3__
+{
+    qRegisterMetaType<TrackQueryExecutor::Rows>();
+    setObjectName(QStringLiteral("TrackQueryExecutor"));
+}
+
+TrackQueryExecutor::~TrackQueryExecutor() {
+    {
+        const QMutexLocker locker(&m_mutex);
+        m_stop = true;
+        m_pendingRequests.clear();
+        m_currentRequestIds.clear();
+#ifdef __SQLITE3__
+        if (m_executingRequestId != 0 && m_pConnectionHandle) {
+            sqlite3_interrupt(m_pConnectionHandle);
+        }
+#endif // __SQLITE3__
+        m_requestSubmitted.wakeAll();
+    }
+    wait();
+}
+
+//static
+QMap<QString, QString> TrackQueryExecutor::temporaryViews(
+        const QSqlDatabase& database,
+        const QStringList& viewNames) {
+    QMap<QString, QString> views;
+    FieldEscaper escaper(database);
+    QSqlQuery query(database);
+    if (!query.exec(QStringLiteral(
+                "SELECT name,sql FROM sqlite_temp_master "
+                "WHERE type='view' AND name IN (%1)")
+                        .arg(escaper.escapeStrings(viewNames).join(QChar(','))))) {
+        LOG_FAILED_QUERY(query);
+        return views;
+    }
+    while (query.next()) {
+        views.insert(query.value(0).toString(), query.value(1).toString());
+    }
+    return views;
+}
+
+quint64 TrackQueryExecutor::submit(const void* pClient, Request request) {
+    const QMutexLocker locker(&m_mutex);
+    cancelLocked(pClient);
+    const quint64 requestId = ++m_lastRequestId;
+    m_currentRequestIds.insert(pClient, requestId);
+    m_pendingRequests.append(PendingRequest{pClient, requestId, std::move(request)});
+    m_requestSubmitted.wakeOne();
+    return requestId;
+}
+
+void TrackQueryExecutor::cancel(const void* pClient) {
+    const QMutexLocker locker(&m_mutex);
+    cancelLocked(pClient);
+}
+
+void TrackQueryExecutor::cancelLocked(const void* pClient) {
+    const quint64 requestId = m_currentRequestIds.take(pClient);
+    if (requestId == 0) {
+        return;
+    }
+    for (auto it = m_pendingRequests.begin(); it != m_pendingRequests.end(); ++it) {
+        if (it->id == requestId) {
+            m_pendingRequests.erase(it);
+            return;
+        }
+    }
+#ifdef __SQLITE3__
+    // Abort the running query instead of waiting until it has finished
+    if (m_executingRequestId == requestId && m_pConnectionHandle) {
+        sqlite3_interrupt(m_pConnectionHandle);
+    }
+#endif // __SQLITE3__
+}
+
+bool TrackQueryExecutor::isCancelled(const PendingRequest& request) const {
+    const QMutexLocker locker(&m_mutex);
+    return m_currentRequestIds.value(request.pClient) != request.id;
+}
+
+void TrackQueryExecutor::run() {
+    kLogger.debug() << "Entering thread";
+    const mixxx::DbConnectionPooler dbConnectionPooler(m_pDbConnectionPool);
+    const QSqlDatabase database = mixxx::DbConnectionPooled(m_pDbConnectionPool);
+    if (!database.isOpen()) {
+        // All requests will fail and the clients fall back to
+        // querying the database on their own thread
+        kLogger.warning()
+                << "Failed to open database connection for executing queries";
+    }
+
+    QMutexLocker locker(&m_mutex);
+#ifdef __SQLITE3__
+    if (database.isOpen()) {
+        const QVariant handle = database.driver()->handle();
+        if (handle.isValid() && strcmp(handle.typeName(), "sqlite3*") == 0) {
+            m_pConnectionHandle = *static_cast<sqlite3* const*>(handle.constData());
+        }
+    }
+#endif // __SQLITE3__
+    while (!m_stop) {
+        if (m_pendingRequests.isEmpty()) {
+            m_requestSubmitted.wait(&m_mutex);
+            continue;
+        }
+        const PendingRequest request = m_pendingRequests.takeFirst();
+        m_executingRequestId = request.id;
+        locker.unlock();
+
+        const bool success = execute(database, request);
+
+        locker.relock();
+        m_executingRequestId = 0;
+        if (m_currentRequestIds.value(request.pClient) == request.id) {
+            m_currentRequestIds.remove(request.pClient);
+            emit requestFinished(request.id, success);
+        }
+    }
+#ifdef __SQLITE3__
+    m_pConnectionHandle = nullptr;
+#endif // __SQLITE3__
+    locker.unlock();
+    kLogger.debug() << "Exiting thread";
+}
+
+bool TrackQueryExecutor::execute(
+        const QSqlDatabase& database,
+        const PendingRequest& request) {
+    Trace trace("TrackQueryExecutor");
+    if (!database.isOpen() || !createViews(database, request.request.views)) {
+        return false;
+    }
+    for (int i = 0; i < request.request.queries.size(); ++i) {
+        if (isCancelled(request)) {
+            return false;
+        }
+        QSqlQuery query(database);
+        // This causes a memory savings since QSqlCachedResult (what QtSQLite uses)
+        // won't allocate a giant in-memory table that we won't use at all.
+        query.setForwardOnly(true);
+        if (!query.prepare(request.request.queries[i]) || !query.exec()) {
+            if (!isCancelled(request)) {
+                LOG_FAILED_QUERY(query);
+            }
+            return false;
+        }
+        const int columnCount = query.record().count();
+        Rows rows;
+        rows.reserve(kBatchSize);
+        while (query.next()) {
+            QVector<QVariant> row;
+            row.reserve(columnCount);
+            for (int column = 0; column < columnCount; ++column) {
+                row.append(query.value(column));
+            }
+            rows.append(std::move(row));
+            if (rows.size() >= kBatchSize) {
+                if (isCancelled(request)) {
+                    return false;
+                }
+                emit rowsFetched(request.id, i, rows);
+                rows.clear();
+                rows.reserve(kBatchSize);
+            }
+        }
+        if (query.lastError().isValid()) {
+            if (!isCancelled(request)) {
+                LOG_FAILED_QUERY(query);
+            }
+            return false;
+        }
+        if (!rows.isEmpty()) {
+            emit rowsFetched(request.id, i, rows);
+        }
+    }
+    return true;
+}
+
+bool TrackQueryExecutor::createViews(
+        const QSqlDatabase& database,
+        const QMap<QString, QString>& views) {
+    for (auto it = views.constBegin(); it != views.constEnd(); ++it) {
+        const QString& name = it.key();
+        const QString& sql = it.value();
+        if (m_createdViews.value(name) == sql) {
+            continue;
+        }
+        VERIFY_OR_DEBUG_ASSERT(sql.startsWith(kCreateView, Qt::CaseInsensitive)) {
+            return false;
+        }
+        // The view might have been recreated with another definition
+        QSqlQuery query(database);
+        if (!query.exec(QStringLiteral("DROP VIEW IF EXISTS temp.%1").arg(name))) {
+            LOG_FAILED_QUERY(query);
+            return false;
+        }
+        m_createdViews.remove(name);
+        if (!query.exec(QStringLiteral("CREATE TEMPORARY VIEW ") +
+                    sql.mid(kCreateView.size()))) {
+            LOG_FAILED_QUERY(query);
+            return false;
+        }
+        m_createdViews.insert(name, sql);
+    }
+    return true;
+}
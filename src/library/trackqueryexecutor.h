@@ -0,0 +1,106 @@
+#pragma once
+
+#include <QList>
+#include <QMap>
+#include <QMetaType>
+#include <QMutex>
+#include <QSqlDatabase>
+#include <QString>
+#include <QStringList>
+#include <QThread>
+#include <QVariant>
+#include <QVector>
+#include <QWaitCondition>
+
+#include "util/db/dbconnectionpool.h"
+
+#ifdef __SQLITE3__
+struct sqlite3;
+#endif // __SQLITE3__
+
+/// TrackQueryExecutor executes the database queries of the track table
+/// models on its own thread with its own database connection, so searching
+/// a large library doesn't block the GUI thread.
+///
+/// Each client has at most one active request. Submitting a new request
+/// cancels the previous request of the same client, e.g. when the search
+/// text has been changed while the previous search is still running. The
+/// rows of each query are delivered in batches while the query is running.
+///
+/// The table models query temporary views that only exist on the database
+/// connection of the GUI thread. The views of a request are created on the
+/// connection of the executor before the queries are executed.
+class TrackQueryExecutor : public QThread {
+    Q_OBJECT
+  public:
+    typedef QVector<QVector<QVariant>> Rows;
+
+    /// The maximum number of rows in a batch
+    static constexpr int kBatchSize = 1000;
+
+    struct Request {
+        /// The SQL of the temporary views by name, see temporaryViews()
+        QMap<QString, QString> views;
+        QStringList queries;
+    };
+
+    explicit TrackQueryExecutor(mixxx::DbConnectionPoolPtr pDbConnectionPool);
+    ~TrackQueryExecutor() override;
+
+    /// Returns the SQL of the given temporary views of the database by
+    /// name. Views that are not temporary are omitted.
+    static QMap<QString, QString> temporaryViews(
+            const QSqlDatabase& database,
+            const QStringList& viewNames);
+
+    /// Submits a request and returns its id. The previous request of
+    /// the client is cancelled. Thread-safe.
+    quint64 submit(const void* pClient, Request request);
+    /// Cancels the current request of the client. Thread-safe.
+    void cancel(const void* pClient);
+
+  signals:
+    void rowsFetched(quint64 requestId, int query, const TrackQueryExecutor::Rows& rows);
+    /// Emitted once for each request that has not been cancelled
+    void requestFinished(quint64 requestId, bool success);
+
+  protected:
+    void run() override;
+
+  private:
+    struct PendingRequest {
+        const void* pClient;
+        quint64 id;
+        Request request;
+    };
+
+    bool isCancelled(const PendingRequest& request) const;
+    // Requires a lock of m_mutex
+    void cancelLocked(const void* pClient);
+
+    bool execute(const QSqlDatabase& database, const PendingRequest& request);
+    bool createViews(const QSqlDatabase& database, const QMap<QString, QString>& views);
+
+    const mixxx::DbConnectionPoolPtr m_pDbConnectionPool;
+
+    mutable QMutex m_mutex;
+    QWaitCondition m_requestSubmitted;
+    bool m_stop;
+    quint64 m_lastRequestId;
+    // The id of the current request of each client
+    QMap<const void*, quint64> m_currentRequestIds;
+    // The requests that have not been started yet
+    QList<PendingRequest> m_pendingRequests;
+    // The id of the request that is currently executed
+    quint64 m_executingRequestId;
+#ifdef __SQLITE3__
+    // The connection of the executor for interrupting queries
+    sqlite3* m_pConnectionHandle;
+#endif // __SQLITE3__
+
+    // The SQL of the views that have been created on the connection
+    // of the executor by name. Only accessed by the executor thread.
+    QMap<QString, QString> m_createdViews;
+};
+
+Q_DECLARE_METATYPE(TrackQueryExecutor::Rows);
@@ -8,6 +8,7 @@
 #include <cstdio>
 #include <stdexcept>
 
+#include "analyzer/batchanalysis.h"
 #include "config.h"
 #include "coreservices.h"
 #include "errordialoghandler.h"
@@ -40,6 +41,13 @@ int runMixxx(MixxxApplication* pApp, const CmdlineArgs& args) {
 
     CmdlineArgs::Instance().parseForUserFeedback();
 
+    if (args.getAnalyzeLibrary()) {
+        // Headless mode: Only settings and logging of CoreServices are
+        // needed, no engine, sound or controller devices, and no GUI.
+        BatchAnalysis batchAnalysis(pCoreServices->getSettings(), args.getAnalyzerThreads());
+        return batchAnalysis.run();
+    }
+
     int exitCode;
 #if QT_VERSION >= QT_VERSION_CHECK(6, 0, 0)
     mixxx::qml::QmlApplication qmlApplication(pApp, pCoreServices);
@@ -163,6 +171,12 @@ int main(int argc, char * argv[]) {
 
     adjustScaleFactor(&args);
 
+    // The batch analysis doesn't show any windows and must also run
+    // on machines without a display server
+    if (args.getAnalyzeLibrary() && !qEnvironmentVariableIsSet("QT_QPA_PLATFORM")) {
+        qputenv("QT_QPA_PLATFORM", QByteArrayLiteral("offscreen"));
+    }
+
     MixxxApplication app(argc, argv);
 
 #ifdef __APPLE__
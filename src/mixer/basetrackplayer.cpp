@@ -91,6 +91,13 @@ BaseTrackPlayerImpl::BaseTrackPlayerImpl(
             &BaseTrackPlayerImpl::slotEjectTrack,
             Qt::DirectConnection);
 
+    // Takes effect when the next track is loaded. Samplers that should play
+    // without any disk access can opt in, within the global preload budget.
+    m_pPreloadFully = std::make_unique<ControlPushButton>(
+            ConfigKey(getGroup(), "preload_fully"),
+            /*bPersist*/ true);
+    m_pPreloadFully->setButtonMode(ControlPushButton::TOGGLE);
+
     // Get loop point control objects
     m_pLoopInPoint = make_parented<ControlProxy>(
             getGroup(), "loop_start_position", this);
@@ -446,7 +453,7 @@ void BaseTrackPlayerImpl::slotLoadTrack(TrackPointer pNewTrack, bool bPlay) {
 
     // Request a new track from EngineBuffer
     EngineBuffer* pEngineBuffer = m_pChannel->getEngineBuffer();
-    pEngineBuffer->loadTrack(pNewTrack, bPlay);
+    pEngineBuffer->loadTrack(pNewTrack, bPlay, m_pPreloadFully->toBool());
 }
 
 void BaseTrackPlayerImpl::slotLoadFailed(TrackPointer pTrack, const QString& reason) {
@@ -125,6 +125,9 @@ class BaseTrackPlayerImpl : public BaseTrackPlayer {
 
     std::unique_ptr<ControlPushButton> m_pEject;
 
+    // Decode loaded tracks completely into memory, off by default
+    std::unique_ptr<ControlPushButton> m_pPreloadFully;
+
     // Deck clone control
     std::unique_ptr<ControlObject> m_pCloneFromDeck;
     std::unique_ptr<ControlObject> m_pCloneFromSampler;
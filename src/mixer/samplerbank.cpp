@@ -116,6 +116,10 @@ bool SamplerBank::saveSamplerBankToPath(const QString& samplerBankPath) {
         QDomElement samplerNode = doc.createElement(QString("sampler"));
 
         samplerNode.setAttribute("group", pSampler->getGroup());
+        samplerNode.setAttribute("preload_fully",
+                ControlObject::toBool(ConfigKey(pSampler->getGroup(), "preload_fully"))
+                        ? QStringLiteral("1")
+                        : QStringLiteral("0"));
 
         TrackPointer pTrack = pSampler->getLoadedTrack();
         if (pTrack) {
@@ -213,6 +217,14 @@ bool SamplerBank::loadSamplerBankFromPath(const QString& samplerBankPath) {
                         m_pCONumSamplers->set(samplerNum);
                     }
 
+                    // Missing in sampler banks of older versions
+                    if (e.hasAttribute("preload_fully")) {
+                        ControlObject::set(ConfigKey(group, "preload_fully"),
+                                e.attribute("preload_fully") == QStringLiteral("1")
+                                        ? 1.0
+                                        : 0.0);
+                    }
+
                     if (location.isEmpty()) {
                         m_pPlayerManager->slotLoadTrackToPlayer(TrackPointer(), group, false);
                     } else {
@@ -67,6 +67,43 @@ inline qhash_seed_t qHash(
             qHash(key.item, seed);
 }
 
+// Interned handle of a ConfigKey, see ControlDoublePrivate::internKey().
+// Looking up a control by its id does not need to hash or compare strings.
+// Ids stay valid and refer to the same key for the lifetime of the process,
+// even if the control is deleted and created again.
+class ConfigKeyId final {
+  public:
+    constexpr ConfigKeyId()
+            : m_value(-1) {
+    }
+    constexpr explicit ConfigKeyId(int value)
+            : m_value(value) {
+    }
+
+    constexpr bool isValid() const {
+        return m_value >= 0;
+    }
+
+    constexpr int value() const {
+        return m_value;
+    }
+
+    friend constexpr bool operator==(ConfigKeyId lhs, ConfigKeyId rhs) {
+        return lhs.m_value == rhs.m_value;
+    }
+
+    friend constexpr bool operator!=(ConfigKeyId lhs, ConfigKeyId rhs) {
+        return !(lhs == rhs);
+    }
+
+  private:
+    int m_value;
+};
+
+inline qhash_seed_t qHash(ConfigKeyId id, qhash_seed_t seed = 0) {
+    return qHash(id.value(), seed);
+}
+
 // The value corresponding to a key. The basic value is a string, but can be
 // subclassed to more specific needs.
 class ConfigValue {
@@ -11,6 +11,7 @@
 #include "soundio/sounddevice.h"
 #include "soundio/soundmanager.h"
 #include "soundio/soundmanagerutil.h"
+#include "util/audiocallbackprofiler.h"
 #include "util/denormalsarezero.h"
 #include "util/fifo.h"
 #include "util/math.h"
@@ -91,7 +92,13 @@ SoundDevicePortAudio::SoundDevicePortAudio(UserSettingsPointer config,
           m_framesSinceAudioLatencyUsageUpdate(0),
           m_syncBuffers(2),
           m_invalidTimeInfoCount(0),
-          m_lastCallbackEntrytoDacSecs(0) {
+          m_lastCallbackEntrytoDacSecs(0),
+          m_inputStageId(AudioCallbackProfiler::registerStage(
+                  QStringLiteral("Sound device input"))),
+          m_engineStageId(AudioCallbackProfiler::registerStage(
+                  QStringLiteral("Engine"))),
+          m_outputStageId(AudioCallbackProfiler::registerStage(
+                  QStringLiteral("Sound device output"))) {
     // Setting parent class members:
     m_hostAPI = Pa_GetHostApiInfo(deviceInfo->hostApi)->name;
     m_dSampleRate = deviceInfo->defaultSampleRate;
@@ -936,10 +943,15 @@ int SoundDevicePortAudio::callbackProcessClkRef(
 #endif
 #endif
 
-    if (statusFlags & (paOutputUnderflow | paInputOverflow)) {
+    const bool xrunReported = statusFlags & (paOutputUnderflow | paInputOverflow);
+    if (xrunReported) {
         m_pSoundManager->underflowHappened(6);
     }
 
+    AudioCallbackProfiler::beginCallback(
+            mixxx::Duration::fromSeconds(framesPerBuffer / m_dSampleRate),
+            xrunReported);
+
     m_pSoundManager->processUnderflowHappened();
 
     //Note: Input is processed first so that any ControlObject changes made in
@@ -950,6 +962,7 @@ int SoundDevicePortAudio::callbackProcessClkRef(
     if (in) {
         ScopedTimer t("SoundDevicePortAudio::callbackProcess input %1",
                 m_deviceId.debugName());
+        ScopedAudioCallbackStage inputStage(m_inputStageId);
         composeInputBuffer(in, framesPerBuffer, 0, m_inputParams.channelCount);
         m_pSoundManager->pushInputBuffers(m_audioInputs, m_framesPerBuffer);
     }
@@ -959,6 +972,7 @@ int SoundDevicePortAudio::callbackProcessClkRef(
     {
         ScopedTimer t("SoundDevicePortAudio::callbackProcess prepare %1",
                 m_deviceId.debugName());
+        ScopedAudioCallbackStage engineStage(m_engineStageId);
         m_pSoundManager->onDeviceOutputCallback(framesPerBuffer);
     }
 
@@ -970,10 +984,12 @@ int SoundDevicePortAudio::callbackProcessClkRef(
             qWarning()
                     << "SoundDevicePortAudio::callbackProcess m_outputParams channel count is zero or less:"
                     << m_outputParams.channelCount;
+            AudioCallbackProfiler::endCallback();
             // Bail out.
             return paContinue;
         }
 
+        ScopedAudioCallbackStage outputStage(m_outputStageId);
         composeOutputBuffer(out, framesPerBuffer, 0, m_outputParams.channelCount);
     }
 
@@ -981,6 +997,8 @@ int SoundDevicePortAudio::callbackProcessClkRef(
 
     updateAudioLatencyUsage(framesPerBuffer);
 
+    AudioCallbackProfiler::endCallback();
+
     return paContinue;
 }
 
@@ -80,4 +80,8 @@ class SoundDevicePortAudio : public SoundDevice {
     int m_invalidTimeInfoCount;
     PerformanceTimer m_clkRefTimer;
     PaTime m_lastCallbackEntrytoDacSecs;
+    // Stages of the AudioCallbackProfiler
+    const int m_inputStageId;
+    const int m_engineStageId;
+    const int m_outputStageId;
 };
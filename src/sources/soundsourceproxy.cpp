@@ -5,6 +5,7 @@
 #include <QMimeType>
 #include <QRegularExpression>
 #include <QStandardPaths>
+#include <tuple>
 
 #include "sources/audiosourcetrackproxy.h"
 
@@ -572,6 +573,43 @@ SoundSourceProxy::importTrackMetadataAndCoverImageFromFile(
             resetMissingTagMetadata);
 }
 
+//static
+bool SoundSourceProxy::importNewTrackMetadataAndCoverImage(
+        mixxx::FileAccess trackFileAccess,
+        bool resetMissingTagMetadata,
+        ImportedTrackMetadataAndCoverImage* pImported) {
+    DEBUG_ASSERT(pImported);
+    const auto trackRef = TrackRef::fromFileInfo(trackFileAccess.info());
+    {
+        GlobalTrackCacheLocker locker;
+        if (locker.lookupTrackByRef(trackRef)) {
+            // The metadata of the cached track object might be exported
+            // into the file while reading it
+            return false;
+        }
+    }
+    // Only track objects in the library export their metadata into the
+    // file. Reading the file of a new track doesn't need to block all
+    // other threads that access GlobalTrackCache.
+    const auto pTrack = Track::newTemporary(std::move(trackFileAccess));
+    // Start with the same default values as a new track object
+    pImported->trackMetadata = pTrack->getMetadata();
+    pImported->coverImage = QImage();
+    std::tie(pImported->importResult, pImported->sourceSynchronizedAt) =
+            SoundSourceProxy(pTrack).importTrackMetadataAndCoverImage(
+                    &pImported->trackMetadata,
+                    &pImported->coverImage,
+                    resetMissingTagMetadata);
+    // A track object for the file might have been created and exported
+    // its metadata into the file while reading it
+    GlobalTrackCacheLocker locker;
+    if (locker.lookupTrackByRef(trackRef)) {
+        *pImported = ImportedTrackMetadataAndCoverImage();
+        return false;
+    }
+    return true;
+}
+
 std::pair<mixxx::MetadataSource::ImportResult, QDateTime>
 SoundSourceProxy::importTrackMetadataAndCoverImage(
         mixxx::TrackMetadata* pTrackMetadata,
@@ -617,7 +655,8 @@ inline bool shouldImportSeratoTagsFromSource(
 
 SoundSourceProxy::UpdateTrackFromSourceResult SoundSourceProxy::updateTrackFromSource(
         UpdateTrackFromSourceMode mode,
-        const SyncTrackMetadataParams& syncParams) {
+        const SyncTrackMetadataParams& syncParams,
+        const ImportedTrackMetadataAndCoverImage* pImported) {
     DEBUG_ASSERT(m_pTrack);
 
     if (getUrl().isEmpty()) {
@@ -689,11 +728,22 @@ SoundSourceProxy::UpdateTrackFromSourceResult SoundSourceProxy::updateTrackFromS
 
     // Parse the tags stored in the audio file and the date and time when the
     // file has been last modified to detect future changes of the tags.
-    auto [metadataImportResult, sourceSynchronizedAt] =
-            importTrackMetadataAndCoverImage(
-                    &trackMetadata,
-                    pCoverImg,
-                    syncParams.resetMissingTagMetadataOnImport);
+    mixxx::MetadataSource::ImportResult metadataImportResult;
+    QDateTime sourceSynchronizedAt;
+    if (pImported && pCoverImg &&
+            sourceSyncStatus == mixxx::TrackRecord::SourceSyncStatus::Void) {
+        // The file of the new track has already been parsed
+        metadataImportResult = pImported->importResult;
+        sourceSynchronizedAt = pImported->sourceSynchronizedAt;
+        trackMetadata = pImported->trackMetadata;
+        coverImg = pImported->coverImage;
+    } else {
+        std::tie(metadataImportResult, sourceSynchronizedAt) =
+                importTrackMetadataAndCoverImage(
+                        &trackMetadata,
+                        pCoverImg,
+                        syncParams.resetMissingTagMetadataOnImport);
+    }
     VERIFY_OR_DEBUG_ASSERT(!sourceSynchronizedAt.isValid() ||
             sourceSynchronizedAt.timeSpec() == Qt::UTC) {
         qWarning() << "Converting source synchronization time to UTC:" << sourceSynchronizedAt;
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <QDateTime>
+#include <QImage>
 #include <QMimeType>
 
 #include "sources/soundsourceproviderregistry.h"
@@ -12,6 +14,17 @@ class FileAccess;
 
 } // namespace mixxx
 
+/// Track metadata and embedded cover image that have been imported from
+/// the file of a new track in advance, e.g. on a worker thread of the
+/// library scanner. See SoundSourceProxy::importNewTrackMetadataAndCoverImage().
+struct ImportedTrackMetadataAndCoverImage {
+    mixxx::MetadataSource::ImportResult importResult =
+            mixxx::MetadataSource::ImportResult::Unavailable;
+    QDateTime sourceSynchronizedAt;
+    mixxx::TrackMetadata trackMetadata;
+    QImage coverImage;
+};
+
 /// Creates sound sources for tracks. Only intended to be used
 /// in a narrow scope and not shareable between multiple threads!
 class SoundSourceProxy {
@@ -105,6 +118,21 @@ class SoundSourceProxy {
             QImage* pCoverImage,
             bool resetMissingTagMetadata);
 
+    /// Import both track metadata and the cover image from the file of a
+    /// track that has not been added to the library yet. The result can be
+    /// passed to updateTrackFromSource() when adding the track later.
+    ///
+    /// This function is thread-safe and can be invoked from any thread.
+    /// Unlike importTrackMetadataAndCoverImageFromFile() it doesn't keep
+    /// GlobalTrackCache locked while reading, so multiple files can be
+    /// imported in parallel. Returns false if the track object is cached
+    /// before or after reading the file, i.e. if the file might have been
+    /// written concurrently. The imported data is discarded in this case.
+    static bool importNewTrackMetadataAndCoverImage(
+            mixxx::FileAccess trackFileAccess,
+            bool resetMissingTagMetadata,
+            ImportedTrackMetadataAndCoverImage* pImported);
+
     /// Import both track metadata and/or the cover image of the
     /// captured track object from the corresponding file.
     ///
@@ -172,10 +200,15 @@ class SoundSourceProxy {
     /// properly. The application log will contain warning messages for a detailed
     /// analysis in case unexpected behavior has been reported.
     ///
+    /// The optional pImported data is used instead of reading the file
+    /// if the metadata of a new track object is imported for the first
+    /// time.
+    ///
     /// Returns true if the track has been modified and false otherwise.
     UpdateTrackFromSourceResult updateTrackFromSource(
             UpdateTrackFromSourceMode mode,
-            const SyncTrackMetadataParams& syncParams);
+            const SyncTrackMetadataParams& syncParams,
+            const ImportedTrackMetadataAndCoverImage* pImported = nullptr);
 
     /// Opening the audio source through the proxy will update the
     /// audio properties of the corresponding track object. Returns
@@ -0,0 +1,338 @@
+#include <benchmark/benchmark.h>
+
+#include <QSqlDatabase>
+#include <QThread>
+#include <atomic>
+#include <cmath>
+#include <memory>
+#include <vector>
+
+#include "analyzer/analyzerbeats.h"
+#include "analyzer/analyzerebur128.h"
+#include "analyzer/analyzergain.h"
+#include "analyzer/analyzerkey.h"
+#include "analyzer/analyzerthread.h"
+#include "analyzer/analyzerwaveform.h"
+#include "analyzer/constants.h"
+#include "analyzer/plugins/analyzerqueenmarybeats.h"
+#include "analyzer/plugins/analyzerqueenmarykey.h"
+#include "analyzer/plugins/analyzersoundtouchbeats.h"
+#ifdef __KEYFINDER__
+#include "analyzer/plugins/analyzerkeyfinder.h"
+#endif
+#include "sources/audiosourcestereoproxy.h"
+#include "test/mixxxtest.h"
+#include "test/soundsourceproviderregistration.h"
+#include "track/track.h"
+#include "util/math.h"
+#include "util/samplebuffer.h"
+
+// Throughput of the analyzers in frames per second of decoded audio. Run
+// them with the mixxx-analyzer-benchmark target or with
+// mixxx-test --benchmark --benchmark_filter=BM_Analyzer
+//
+// Each benchmark processes either synthetic audio (range 0 = 0) or the
+// bundled sine-30.wav (range 0 = 1).
+
+namespace {
+
+const auto kSampleRate = mixxx::audio::SampleRate(44100);
+constexpr SINT kSyntheticFrames = 30 * 44100;
+const QString kBundledTrack = QStringLiteral("sine-30.wav");
+
+class ProviderRegistration : public SoundSourceProviderRegistration {
+};
+
+QString bundledTrackLocation() {
+    return MixxxTest::getOrInitTestDir().filePath(kBundledTrack);
+}
+
+// A 128 BPM pattern of decaying kicks on top of a chord, which gives the
+// beat and key detectors something to work on
+mixxx::SampleBuffer generateSyntheticAudio() {
+    constexpr double kBpm = 128.0;
+    constexpr double kChordHz[] = {220.0, 261.63, 329.63}; // A minor
+    const double beatFrames = 60.0 * kSampleRate.value() / kBpm;
+    mixxx::SampleBuffer samples(kSyntheticFrames * mixxx::kAnalysisChannels);
+    for (SINT frame = 0; frame < kSyntheticFrames; ++frame) {
+        const double t = static_cast<double>(frame) / kSampleRate.value();
+        double value = 0.0;
+        for (double hz : kChordHz) {
+            value += 0.15 * std::sin(2 * M_PI * hz * t);
+        }
+        const double beatPhase = std::fmod(frame, beatFrames) / kSampleRate.value();
+        value += 0.5 * std::exp(-beatPhase * 30.0) * std::sin(2 * M_PI * 55.0 * beatPhase);
+        for (int channel = 0; channel < mixxx::kAnalysisChannels; ++channel) {
+            samples[frame * mixxx::kAnalysisChannels + channel] =
+                    static_cast<CSAMPLE>(value);
+        }
+    }
+    return samples;
+}
+
+mixxx::SampleBuffer decodeBundledAudio() {
+    ProviderRegistration providerRegistration;
+    mixxx::AudioSource::OpenParams openParams;
+    openParams.setChannelCount(mixxx::kAnalysisChannels);
+    const auto pAudioSource =
+            SoundSourceProxy(Track::newTemporary(bundledTrackLocation()))
+                    .openAudioSource(openParams);
+    if (!pAudioSource) {
+        return mixxx::SampleBuffer();
+    }
+    mixxx::AudioSourceStereoProxy audioSourceProxy(
+            pAudioSource, mixxx::kAnalysisFramesPerChunk);
+    const auto frameIndexRange = audioSourceProxy.frameIndexRange();
+    mixxx::SampleBuffer samples(frameIndexRange.length() * mixxx::kAnalysisChannels);
+    auto remainingFrameRange = frameIndexRange;
+    while (!remainingFrameRange.empty()) {
+        const auto chunkFrameRange = remainingFrameRange.splitAndShrinkFront(
+                math_min(mixxx::kAnalysisFramesPerChunk, remainingFrameRange.length()));
+        audioSourceProxy.readSampleFrames(mixxx::WritableSampleFrames(
+                chunkFrameRange,
+                mixxx::SampleBuffer::WritableSlice(samples,
+                        (chunkFrameRange.start() - frameIndexRange.start()) *
+                                mixxx::kAnalysisChannels,
+                        chunkFrameRange.length() * mixxx::kAnalysisChannels)));
+    }
+    return samples;
+}
+
+// The samples are generated or decoded once and reused by all benchmarks
+const mixxx::SampleBuffer& benchmarkAudio(const benchmark::State& state) {
+    static const mixxx::SampleBuffer syntheticAudio = generateSyntheticAudio();
+    static const mixxx::SampleBuffer bundledAudio = decodeBundledAudio();
+    return state.range(0) == 0 ? syntheticAudio : bundledAudio;
+}
+
+// Passes the samples to the analyzer in the same chunks as AnalyzerThread
+template<typename ProcessSamples>
+void processChunks(const mixxx::SampleBuffer& samples, ProcessSamples processSamples) {
+    for (SINT offset = 0; offset < samples.size(); offset += mixxx::kAnalysisSamplesPerChunk) {
+        processSamples(samples.data(offset),
+                math_min(mixxx::kAnalysisSamplesPerChunk, samples.size() - offset));
+    }
+}
+
+void setFramesProcessed(benchmark::State& state, SINT framesPerIteration) {
+    const auto frames = static_cast<double>(framesPerIteration) * state.iterations();
+    state.SetItemsProcessed(static_cast<int64_t>(frames));
+    state.counters["frames/s"] = benchmark::Counter(frames, benchmark::Counter::kIsRate);
+}
+
+template<typename Plugin>
+void BM_AnalyzerPlugin(benchmark::State& state) {
+    const mixxx::SampleBuffer& samples = benchmarkAudio(state);
+    if (samples.size() == 0) {
+        state.SkipWithError("Failed to decode the test track");
+        return;
+    }
+    for (auto _ : state) {
+        Plugin plugin;
+        if (!plugin.initialize(kSampleRate)) {
+            state.SkipWithError("Failed to initialize the plugin");
+            return;
+        }
+        processChunks(samples, [&plugin](const CSAMPLE* pIn, SINT length) {
+            plugin.processSamples(pIn, length);
+        });
+        plugin.finalize();
+    }
+    setFramesProcessed(state, samples.size() / mixxx::kAnalysisChannels);
+}
+BENCHMARK_TEMPLATE(BM_AnalyzerPlugin, mixxx::AnalyzerQueenMaryBeats)
+        ->Arg(0)
+        ->Arg(1)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_AnalyzerPlugin, mixxx::AnalyzerSoundTouchBeats)
+        ->Arg(0)
+        ->Arg(1)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_AnalyzerPlugin, mixxx::AnalyzerQueenMaryKey)
+        ->Arg(0)
+        ->Arg(1)
+        ->Unit(benchmark::kMillisecond);
+#ifdef __KEYFINDER__
+BENCHMARK_TEMPLATE(BM_AnalyzerPlugin, mixxx::AnalyzerKeyFinder)
+        ->Arg(0)
+        ->Arg(1)
+        ->Unit(benchmark::kMillisecond);
+#endif
+
+typedef AnalyzerPtr (*AnalyzerFactory)(UserSettingsPointer pConfig);
+
+UserSettingsPointer newAnalyzerConfig() {
+    auto pConfig = UserSettingsPointer(new UserSettings(QString()));
+    // Enable the analyzers that are disabled by default
+    pConfig->setValue(ConfigKey("[BPM]", "BPMDetectionEnabled"), true);
+    pConfig->setValue(ConfigKey("[Key]", "KeyDetectionEnabled"), true);
+    pConfig->setValue(ConfigKey("[ReplayGain]", "ReplayGainAnalyzerEnabled"), true);
+    return pConfig;
+}
+
+AnalyzerPtr newAnalyzerWaveform(UserSettingsPointer pConfig) {
+    return std::make_unique<AnalyzerWaveform>(pConfig, QSqlDatabase());
+}
+
+AnalyzerPtr newAnalyzerGain(UserSettingsPointer pConfig) {
+    pConfig->setValue(ConfigKey("[ReplayGain]", "ReplayGainAnalyzerVersion"), 1);
+    return std::make_unique<AnalyzerGain>(pConfig);
+}
+
+AnalyzerPtr newAnalyzerEbur128(UserSettingsPointer pConfig) {
+    pConfig->setValue(ConfigKey("[ReplayGain]", "ReplayGainAnalyzerVersion"), 2);
+    return std::make_unique<AnalyzerEbur128>(pConfig);
+}
+
+AnalyzerPtr newAnalyzerBeats(UserSettingsPointer pConfig) {
+    return std::make_unique<AnalyzerBeats>(pConfig, true);
+}
+
+AnalyzerPtr newAnalyzerKey(UserSettingsPointer pConfig) {
+    return std::make_unique<AnalyzerKey>(KeyDetectionSettings(pConfig));
+}
+
+// Runs a whole analysis of a temporary track including storing the results
+void BM_Analyzer(benchmark::State& state, AnalyzerFactory newAnalyzer) {
+    const mixxx::SampleBuffer& samples = benchmarkAudio(state);
+    if (samples.size() == 0) {
+        state.SkipWithError("Failed to decode the test track");
+        return;
+    }
+    const SINT frames = samples.size() / mixxx::kAnalysisChannels;
+    const auto pConfig = newAnalyzerConfig();
+    for (auto _ : state) {
+        state.PauseTiming();
+        const auto pTrack = Track::newTemporary();
+        pTrack->setAudioProperties(
+                mixxx::audio::ChannelCount(mixxx::kAnalysisChannels),
+                kSampleRate,
+                mixxx::audio::Bitrate(),
+                mixxx::Duration::fromSeconds(
+                        static_cast<double>(frames) / kSampleRate.value()));
+        const auto pAnalyzer = newAnalyzer(pConfig);
+        state.ResumeTiming();
+        if (!pAnalyzer->initialize(pTrack, kSampleRate, samples.size())) {
+            state.SkipWithError("Failed to initialize the analyzer");
+            return;
+        }
+        processChunks(samples, [&pAnalyzer](const CSAMPLE* pIn, SINT length) {
+            pAnalyzer->processSamples(pIn, length);
+        });
+        pAnalyzer->storeResults(pTrack);
+        pAnalyzer->cleanup();
+    }
+    setFramesProcessed(state, frames);
+}
+BENCHMARK_CAPTURE(BM_Analyzer, Waveform, &newAnalyzerWaveform)
+        ->Arg(0)
+        ->Arg(1)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_Analyzer, Gain, &newAnalyzerGain)
+        ->Arg(0)
+        ->Arg(1)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_Analyzer, Ebur128, &newAnalyzerEbur128)
+        ->Arg(0)
+        ->Arg(1)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_Analyzer, Beats, &newAnalyzerBeats)
+        ->Arg(0)
+        ->Arg(1)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_Analyzer, Key, &newAnalyzerKey)
+        ->Arg(0)
+        ->Arg(1)
+        ->Unit(benchmark::kMillisecond);
+
+// Analyzes copies of the bundled track with state.range(0) AnalyzerThreads
+// as in batch analysis. With state.range(1) the analyzers run concurrently
+// on a shared AnalyzerWorkerPool. The waveform analyzer is not included,
+// because it needs a database connection.
+void BM_AnalyzerThreadPipeline(benchmark::State& state) {
+    constexpr int kTracksPerIteration = 8;
+    const int numThreads = static_cast<int>(state.range(0));
+    ProviderRegistration providerRegistration;
+    const auto pConfig = newAnalyzerConfig();
+    const SINT framesPerTrack = decodeBundledAudio().size() / mixxx::kAnalysisChannels;
+    if (framesPerTrack == 0) {
+        state.SkipWithError("Failed to decode the test track");
+        return;
+    }
+
+    int modeFlags = AnalyzerModeFlags::WithBeats;
+    std::shared_ptr<AnalyzerWorkerPool> pWorkerPool;
+    if (state.range(1) != 0) {
+        modeFlags |= AnalyzerModeFlags::ParallelAnalyzers;
+        pWorkerPool = std::make_shared<AnalyzerWorkerPool>(
+                math_max(1, QThread::idealThreadCount()), QThread::InheritPriority);
+    }
+
+    // The progress signals are received directly in the analyzer threads,
+    // the benchmark thread doesn't run an event loop
+    std::vector<AnalyzerThread::Pointer> threads;
+    std::vector<std::unique_ptr<std::atomic<bool>>> idle;
+    std::atomic<int> finishedTracks(0);
+    for (int threadId = 0; threadId < numThreads; ++threadId) {
+        threads.push_back(AnalyzerThread::createInstance(threadId,
+                mixxx::DbConnectionPoolPtr(),
+                pConfig,
+                static_cast<AnalyzerModeFlags>(modeFlags),
+                pWorkerPool));
+        idle.push_back(std::make_unique<std::atomic<bool>>(false));
+        std::atomic<bool>* pIdle = idle.back().get();
+        QObject::connect(
+                threads.back().get(),
+                &AnalyzerThread::progress,
+                [pIdle, &finishedTracks](int,
+                        AnalyzerThreadState threadState,
+                        TrackId,
+                        AnalyzerProgress) {
+                    if (threadState == AnalyzerThreadState::Done) {
+                        finishedTracks.fetch_add(1);
+                    } else if (threadState == AnalyzerThreadState::Idle) {
+                        pIdle->store(true);
+                    }
+                },
+                Qt::DirectConnection);
+        threads.back()->start();
+    }
+
+    int nextTrackId = 1;
+    for (auto _ : state) {
+        finishedTracks.store(0);
+        int submittedTracks = 0;
+        while (finishedTracks.load() < kTracksPerIteration) {
+            for (int i = 0; i < numThreads && submittedTracks < kTracksPerIteration; ++i) {
+                if (!idle[i]->exchange(false)) {
+                    continue;
+                }
+                // Fresh tracks without any analysis results
+                threads[i]->submitNextTrack(AnalyzerTrack(Track::newDummy(
+                        bundledTrackLocation(), TrackId(nextTrackId++))));
+                ++submittedTracks;
+            }
+            QThread::msleep(1);
+        }
+    }
+    setFramesProcessed(state, kTracksPerIteration * framesPerTrack);
+
+    for (const auto& pThread : threads) {
+        pThread->stop();
+    }
+    for (const auto& pThread : threads) {
+        pThread->wait();
+    }
+    threads.clear();
+    // Delete the finished threads
+    QCoreApplication::sendPostedEvents(nullptr, QEvent::DeferredDelete);
+}
+BENCHMARK(BM_AnalyzerThreadPipeline)
+        ->Args({1, 0})
+        ->Args({1, 1})
+        ->Args({4, 0})
+        ->Args({4, 1})
+        ->Unit(benchmark::kMillisecond)
+        ->UseRealTime();
+
+} // namespace
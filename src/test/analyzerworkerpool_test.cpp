@@ -0,0 +1,102 @@
+#include "analyzer/analyzerworkerpool.h"
+
+#include <gtest/gtest.h>
+
+#include <QThread>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace {
+
+constexpr int kNumWorkers = 4;
+
+TEST(AnalyzerWorkerPoolTest, RunInlineWithoutWorkers) {
+    AnalyzerWorkerPool pool(0, QThread::InheritPriority);
+    AnalyzerWorkerPool::TaskGroup tasks;
+    int count = 0;
+    pool.submit(&tasks, [&count] {
+        ++count;
+    });
+    EXPECT_EQ(1, count);
+    EXPECT_FALSE(tasks.isPending());
+    pool.wait(&tasks);
+}
+
+TEST(AnalyzerWorkerPoolTest, WaitForAllTasksOfGroup) {
+    AnalyzerWorkerPool pool(kNumWorkers, QThread::InheritPriority);
+    constexpr int kNumTasks = 1000;
+    std::atomic<int> count(0);
+    AnalyzerWorkerPool::TaskGroup tasks;
+    for (int i = 0; i < kNumTasks; ++i) {
+        pool.submit(&tasks, [&count] {
+            count.fetch_add(1);
+        });
+    }
+    pool.wait(&tasks);
+    EXPECT_FALSE(tasks.isPending());
+    EXPECT_EQ(kNumTasks, count.load());
+}
+
+// Each submitting thread processes its "chunks" in order: The tasks of a
+// batch are only submitted after the previous batch has been finished.
+// A single slow task per batch must not stall the other threads.
+TEST(AnalyzerWorkerPoolTest, ConcurrentSubmitters) {
+    AnalyzerWorkerPool pool(kNumWorkers, QThread::InheritPriority);
+    constexpr int kNumSubmitters = 3;
+    constexpr int kNumBatches = 50;
+    constexpr int kTasksPerBatch = 6;
+
+    std::vector<std::vector<int>> processedBatches(
+            kNumSubmitters, std::vector<int>(kTasksPerBatch, 0));
+    std::atomic<int> outOfOrder(0);
+    std::vector<std::thread> submitters;
+    for (int s = 0; s < kNumSubmitters; ++s) {
+        submitters.emplace_back([&, s] {
+            AnalyzerWorkerPool::TaskGroup tasks;
+            for (int batch = 0; batch < kNumBatches; ++batch) {
+                for (int t = 0; t < kTasksPerBatch; ++t) {
+                    int* pProcessed = &processedBatches[s][t];
+                    pool.submit(&tasks, [&outOfOrder, pProcessed, batch, t] {
+                        if (t == 0) {
+                            // The dominating analyzer
+                            QThread::usleep(200);
+                        }
+                        if (*pProcessed != batch) {
+                            outOfOrder.fetch_add(1);
+                        }
+                        *pProcessed = batch + 1;
+                    });
+                }
+                pool.wait(&tasks);
+            }
+        });
+    }
+    for (auto& submitter : submitters) {
+        submitter.join();
+    }
+
+    EXPECT_EQ(0, outOfOrder.load());
+    for (const auto& processed : processedBatches) {
+        for (int batches : processed) {
+            EXPECT_EQ(kNumBatches, batches);
+        }
+    }
+}
+
+TEST(AnalyzerWorkerPoolTest, RunQueuedTasksOnDestruction) {
+    std::atomic<int> count(0);
+    AnalyzerWorkerPool::TaskGroup tasks;
+    {
+        AnalyzerWorkerPool pool(1, QThread::InheritPriority);
+        for (int i = 0; i < 100; ++i) {
+            pool.submit(&tasks, [&count] {
+                count.fetch_add(1);
+            });
+        }
+    }
+    EXPECT_EQ(100, count.load());
+    EXPECT_FALSE(tasks.isPending());
+}
+
+} // namespace
@@ -0,0 +1,126 @@
+#include "util/audiocallbackprofiler.h"
+
+#include <gtest/gtest.h>
+
+#include "test/mixxxtest.h"
+#include "util/time.h"
+
+namespace {
+
+class AudioCallbackProfilerTest : public MixxxTest {
+  protected:
+    void SetUp() override {
+        mixxx::Time::setTestMode(true);
+        mixxx::Time::setTestElapsedTime(mixxx::Duration::fromSeconds(1));
+        AudioCallbackProfiler::setEnabled(true);
+        // Discard profiles of previous tests
+        AudioCallbackProfile profile;
+        while (AudioCallbackProfiler::takeProfile(&profile)) {
+        }
+    }
+
+    void TearDown() override {
+        AudioCallbackProfiler::setEnabled(false);
+        mixxx::Time::setTestMode(false);
+    }
+
+    void elapse(mixxx::Duration duration) {
+        mixxx::Time::setTestElapsedTime(mixxx::Time::elapsed() + duration);
+    }
+};
+
+TEST_F(AudioCallbackProfilerTest, RegisterStage) {
+    const int stageId = AudioCallbackProfiler::registerStage("Test stage");
+    EXPECT_LE(0, stageId);
+    EXPECT_EQ(stageId, AudioCallbackProfiler::registerStage("Test stage"));
+    EXPECT_NE(stageId, AudioCallbackProfiler::registerStage("Other test stage"));
+    EXPECT_EQ("Test stage", AudioCallbackProfiler::stageName(stageId));
+}
+
+TEST_F(AudioCallbackProfilerTest, RecordCallback) {
+    const int stageId1 = AudioCallbackProfiler::registerStage("Test stage 1");
+    const int stageId2 = AudioCallbackProfiler::registerStage("Test stage 2");
+    const int unusedStageId = AudioCallbackProfiler::registerStage("Unused test stage");
+
+    AudioCallbackProfiler::beginCallback(mixxx::Duration::fromMillis(2), false);
+    {
+        ScopedAudioCallbackStage stage(stageId1);
+        elapse(mixxx::Duration::fromMillis(1));
+    }
+    {
+        // Stages accumulate within a callback
+        ScopedAudioCallbackStage stage(stageId2);
+        elapse(mixxx::Duration::fromMillis(1));
+    }
+    AudioCallbackProfiler::addStageTime(stageId2, mixxx::Duration::fromMillis(1));
+    elapse(mixxx::Duration::fromMillis(1));
+    AudioCallbackProfiler::endCallback();
+
+    AudioCallbackProfile profile;
+    ASSERT_TRUE(AudioCallbackProfiler::takeProfile(&profile));
+    EXPECT_EQ(mixxx::Duration::fromSeconds(1).toIntegerNanos(), profile.startNanos);
+    EXPECT_EQ(mixxx::Duration::fromMillis(3).toIntegerNanos(), profile.durationNanos);
+    EXPECT_EQ(mixxx::Duration::fromMillis(2).toIntegerNanos(), profile.budgetNanos);
+    EXPECT_TRUE(profile.isOverrun());
+    EXPECT_FALSE(profile.xrunReported);
+    ASSERT_EQ(2, profile.numStages);
+    EXPECT_EQ(stageId1, profile.stages[0].stageId);
+    EXPECT_EQ(mixxx::Duration::fromMillis(1).toIntegerNanos(), profile.stages[0].nanos);
+    EXPECT_EQ(stageId2, profile.stages[1].stageId);
+    EXPECT_EQ(mixxx::Duration::fromMillis(2).toIntegerNanos(), profile.stages[1].nanos);
+    EXPECT_NE(unusedStageId, profile.stages[1].stageId);
+
+    EXPECT_FALSE(AudioCallbackProfiler::takeProfile(&profile));
+}
+
+TEST_F(AudioCallbackProfilerTest, StagesAreResetAfterCallback) {
+    const int stageId = AudioCallbackProfiler::registerStage("Test stage 1");
+
+    AudioCallbackProfiler::beginCallback(mixxx::Duration::fromMillis(2), false);
+    AudioCallbackProfiler::addStageTime(stageId, mixxx::Duration::fromMillis(1));
+    AudioCallbackProfiler::endCallback();
+    AudioCallbackProfiler::beginCallback(mixxx::Duration::fromMillis(2), true);
+    AudioCallbackProfiler::endCallback();
+
+    AudioCallbackProfile profile;
+    ASSERT_TRUE(AudioCallbackProfiler::takeProfile(&profile));
+    EXPECT_EQ(1, profile.numStages);
+    ASSERT_TRUE(AudioCallbackProfiler::takeProfile(&profile));
+    EXPECT_EQ(0, profile.numStages);
+    EXPECT_TRUE(profile.xrunReported);
+    EXPECT_FALSE(profile.isOverrun());
+}
+
+TEST_F(AudioCallbackProfilerTest, CountDroppedStages) {
+    constexpr int kNumStages = AudioCallbackProfile::kMaxStagesPerCallback + 3;
+    AudioCallbackProfiler::beginCallback(mixxx::Duration::fromMillis(2), false);
+    for (int i = 0; i < kNumStages; ++i) {
+        const int stageId = AudioCallbackProfiler::registerStage(
+                QStringLiteral("Dropped test stage %1").arg(i));
+        ASSERT_LE(0, stageId);
+        AudioCallbackProfiler::addStageTime(stageId, mixxx::Duration::fromMicros(1));
+    }
+    AudioCallbackProfiler::endCallback();
+
+    AudioCallbackProfile profile;
+    ASSERT_TRUE(AudioCallbackProfiler::takeProfile(&profile));
+    EXPECT_EQ(AudioCallbackProfile::kMaxStagesPerCallback, profile.numStages);
+    EXPECT_EQ(3, profile.numDroppedStages);
+}
+
+TEST_F(AudioCallbackProfilerTest, Disabled) {
+    const int stageId = AudioCallbackProfiler::registerStage("Test stage 1");
+    AudioCallbackProfiler::setEnabled(false);
+
+    AudioCallbackProfiler::beginCallback(mixxx::Duration::fromMillis(2), false);
+    {
+        ScopedAudioCallbackStage stage(stageId);
+        elapse(mixxx::Duration::fromMillis(1));
+    }
+    AudioCallbackProfiler::endCallback();
+
+    AudioCallbackProfile profile;
+    EXPECT_FALSE(AudioCallbackProfiler::takeProfile(&profile));
+}
+
+} // namespace
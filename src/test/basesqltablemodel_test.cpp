@@ -0,0 +1,236 @@
+#include <gtest/gtest.h>
+
+#include <QAbstractItemModelTester>
+#include <QSqlQuery>
+#include <memory>
+
+#include "library/basetrackcache.h"
+#include "library/dao/playlistdao.h"
+#include "library/librarytablemodel.h"
+#include "library/playlisttablemodel.h"
+#include "library/queryutil.h"
+#include "test/librarytest.h"
+#include "track/track.h"
+
+namespace {
+
+const QStringList kTrackLocations = {
+        QStringLiteral("id3-test-data/cover-test-jpg.mp3"),
+        QStringLiteral("id3-test-data/cover-test-png.mp3"),
+        QStringLiteral("id3-test-data/cover-test.flac"),
+        QStringLiteral("id3-test-data/cover-test.ogg"),
+        QStringLiteral("id3-test-data/cover-test.wav"),
+};
+
+} // namespace
+
+/// Verifies that the rows of the changed tracks are patched in place
+/// with the same result as selecting all rows again. QAbstractItemModelTester
+/// checks the consistency of the signals that are emitted while patching.
+class BaseSqlTableModelTest : public LibraryTest {
+  protected:
+    void SetUp() override {
+        for (const auto& location : kTrackLocations) {
+            const TrackPointer pTrack =
+                    getOrAddTrackByLocation(getTestDir().filePath(location));
+            ASSERT_TRUE(pTrack);
+            m_trackIds.append(pTrack->getId());
+        }
+    }
+
+    void setArtist(TrackId trackId, const QString& artist) {
+        QSqlQuery query(dbConnection());
+        query.prepare(QStringLiteral("UPDATE library SET artist=:artist WHERE id=:id"));
+        query.bindValue(":artist", artist);
+        query.bindValue(":id", trackId.toVariant());
+        if (!query.exec()) {
+            LOG_FAILED_QUERY(query);
+        }
+    }
+
+    /// Modifies the tracks in the database and notifies the track source
+    /// like TrackDAO does after saving the tracks
+    void setArtists(const QHash<TrackId, QString>& artists) {
+        QSet<TrackId> trackIds;
+        for (auto it = artists.constBegin(); it != artists.constEnd(); ++it) {
+            setArtist(it.key(), it.value());
+            trackIds.insert(it.key());
+        }
+        internalCollection()->getTrackSource()->slotTracksAddedOrChanged(trackIds);
+    }
+
+    static QList<TrackId> rowTrackIds(const BaseSqlTableModel& model) {
+        QList<TrackId> trackIds;
+        for (int row = 0; row < model.rowCount(); ++row) {
+            trackIds.append(model.getTrackId(model.index(row, 0)));
+        }
+        return trackIds;
+    }
+
+    /// Returns the rows of the patched model and compares them with
+    /// the rows after selecting them again
+    static QList<TrackId> expectSelectedRows(BaseSqlTableModel* pModel) {
+        const QList<TrackId> patchedTrackIds = rowTrackIds(*pModel);
+        pModel->select();
+        EXPECT_EQ(rowTrackIds(*pModel), patchedTrackIds);
+        return patchedTrackIds;
+    }
+
+    static void sortByArtist(BaseSqlTableModel* pModel) {
+        pModel->sort(pModel->fieldIndex(ColumnCache::COLUMN_LIBRARYTABLE_ARTIST),
+                Qt::AscendingOrder);
+    }
+
+    QList<TrackId> m_trackIds;
+};
+
+TEST_F(BaseSqlTableModelTest, SortedRowsMoveUpAndDown) {
+    setArtists({
+            {m_trackIds[0], QStringLiteral("Artist A")},
+            {m_trackIds[1], QStringLiteral("Artist B")},
+            {m_trackIds[2], QStringLiteral("Artist C")},
+            {m_trackIds[3], QStringLiteral("Artist D")},
+            {m_trackIds[4], QStringLiteral("Artist E")},
+    });
+    LibraryTableModel model(nullptr, trackCollectionManager(), "mixxx.db.model.test");
+    QAbstractItemModelTester tester(&model,
+            QAbstractItemModelTester::FailureReportingMode::Fatal);
+    sortByArtist(&model);
+    ASSERT_EQ(m_trackIds, rowTrackIds(model));
+
+    // Down
+    setArtists({{m_trackIds[1], QStringLiteral("Artist F")}});
+    EXPECT_EQ(QList<TrackId>({
+                      m_trackIds[0],
+                      m_trackIds[2],
+                      m_trackIds[3],
+                      m_trackIds[4],
+                      m_trackIds[1],
+              }),
+            expectSelectedRows(&model));
+
+    // Up
+    setArtists({{m_trackIds[3], QStringLiteral("Artist 0")}});
+    EXPECT_EQ(QList<TrackId>({
+                      m_trackIds[3],
+                      m_trackIds[0],
+                      m_trackIds[2],
+                      m_trackIds[4],
+                      m_trackIds[1],
+              }),
+            expectSelectedRows(&model));
+
+    // Both directions at once
+    setArtists({
+            {m_trackIds[3], QStringLiteral("Artist G")},
+            {m_trackIds[1], QStringLiteral("Artist 1")},
+    });
+    EXPECT_EQ(QList<TrackId>({
+                      m_trackIds[1],
+                      m_trackIds[0],
+                      m_trackIds[2],
+                      m_trackIds[4],
+                      m_trackIds[3],
+              }),
+            expectSelectedRows(&model));
+}
+
+TEST_F(BaseSqlTableModelTest, RowsFollowTheSearch) {
+    setArtists({
+            {m_trackIds[0], QStringLiteral("Alpha A")},
+            {m_trackIds[1], QStringLiteral("Alpha B")},
+            {m_trackIds[2], QStringLiteral("Beta C")},
+            {m_trackIds[3], QStringLiteral("Alpha D")},
+            {m_trackIds[4], QStringLiteral("Beta E")},
+    });
+    LibraryTableModel model(nullptr, trackCollectionManager(), "mixxx.db.model.test");
+    QAbstractItemModelTester tester(&model,
+            QAbstractItemModelTester::FailureReportingMode::Fatal);
+    sortByArtist(&model);
+    model.setSearch(QStringLiteral("alpha"));
+    model.select();
+    ASSERT_EQ(QList<TrackId>({m_trackIds[0], m_trackIds[1], m_trackIds[3]}),
+            rowTrackIds(model));
+
+    // Stops matching
+    setArtists({{m_trackIds[1], QStringLiteral("Beta B")}});
+    EXPECT_EQ(QList<TrackId>({m_trackIds[0], m_trackIds[3]}),
+            expectSelectedRows(&model));
+
+    // Starts matching
+    setArtists({{m_trackIds[4], QStringLiteral("Alpha 0")}});
+    EXPECT_EQ(QList<TrackId>({m_trackIds[4], m_trackIds[0], m_trackIds[3]}),
+            expectSelectedRows(&model));
+
+    // Starts and stops matching at once
+    setArtists({
+            {m_trackIds[2], QStringLiteral("Alpha C")},
+            {m_trackIds[0], QStringLiteral("Beta A")},
+    });
+    EXPECT_EQ(QList<TrackId>({m_trackIds[4], m_trackIds[2], m_trackIds[3]}),
+            expectSelectedRows(&model));
+}
+
+TEST_F(BaseSqlTableModelTest, DuplicateRowsMoveTogether) {
+    setArtists({
+            {m_trackIds[0], QStringLiteral("Artist A")},
+            {m_trackIds[1], QStringLiteral("Artist B")},
+            {m_trackIds[2], QStringLiteral("Artist C")},
+    });
+    PlaylistDAO& playlistDao = internalCollection()->getPlaylistDAO();
+    const int playlistId = playlistDao.createPlaylist(QStringLiteral("Duplicates"));
+    ASSERT_LE(0, playlistId);
+    ASSERT_TRUE(playlistDao.appendTracksToPlaylist(
+            {m_trackIds[1], m_trackIds[0], m_trackIds[2], m_trackIds[1]},
+            playlistId));
+
+    PlaylistTableModel model(nullptr, trackCollectionManager(), "mixxx.db.model.test");
+    QAbstractItemModelTester tester(&model,
+            QAbstractItemModelTester::FailureReportingMode::Fatal);
+    model.setTableModel(playlistId);
+    sortByArtist(&model);
+    ASSERT_EQ(QList<TrackId>({
+                      m_trackIds[0],
+                      m_trackIds[1],
+                      m_trackIds[1],
+                      m_trackIds[2],
+              }),
+            rowTrackIds(model));
+
+    // Down
+    setArtists({{m_trackIds[1], QStringLiteral("Artist D")}});
+    EXPECT_EQ(QList<TrackId>({
+                      m_trackIds[0],
+                      m_trackIds[2],
+                      m_trackIds[1],
+                      m_trackIds[1],
+              }),
+            expectSelectedRows(&model));
+
+    // Up
+    setArtists({{m_trackIds[1], QStringLiteral("Artist 0")}});
+    EXPECT_EQ(QList<TrackId>({
+                      m_trackIds[1],
+                      m_trackIds[1],
+                      m_trackIds[0],
+                      m_trackIds[2],
+              }),
+            expectSelectedRows(&model));
+
+    // Both rows are removed when the track stops matching the search
+    model.setSearch(QStringLiteral("artist"));
+    model.select();
+    setArtists({{m_trackIds[1], QStringLiteral("Other")}});
+    EXPECT_EQ(QList<TrackId>({m_trackIds[0], m_trackIds[2]}),
+            expectSelectedRows(&model));
+
+    // ...and inserted again when it starts matching
+    setArtists({{m_trackIds[1], QStringLiteral("Artist B")}});
+    EXPECT_EQ(QList<TrackId>({
+                      m_trackIds[0],
+                      m_trackIds[1],
+                      m_trackIds[1],
+                      m_trackIds[2],
+              }),
+            expectSelectedRows(&model));
+}
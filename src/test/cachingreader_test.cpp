@@ -0,0 +1,281 @@
+#include "engine/cachingreader/cachingreader.h"
+
+#include <gtest/gtest.h>
+
+#include <QDeadlineTimer>
+#include <QThread>
+#include <atomic>
+
+#include "engine/engineworkerscheduler.h"
+#include "test/mixxxtest.h"
+#include "test/soundsourceproviderregistration.h"
+#include "track/track.h"
+#include "util/samplebuffer.h"
+
+namespace {
+
+class CachingReaderTest : public MixxxTest, SoundSourceProviderRegistration {
+  protected:
+    CachingReaderTest()
+            : m_trackLocation(getTestDir().filePath(QStringLiteral("sine-30.wav"))),
+              m_chunkReader(QStringLiteral("[Channel1]"), UserSettingsPointer()),
+              m_preloadedReader(QStringLiteral("[Channel2]"), UserSettingsPointer()) {
+        m_scheduler.start(QThread::HighPriority);
+        m_chunkReader.setScheduler(&m_scheduler);
+        m_preloadedReader.setScheduler(&m_scheduler);
+    }
+
+    // Loads the test track and returns its number of frames or 0 on failure.
+    SINT loadTrack(CachingReader* pReader, bool preloadFully) {
+        std::atomic<int> numSamples(0);
+        const auto connection = QObject::connect(pReader,
+                &CachingReader::trackLoaded,
+                [&numSamples](TrackPointer, int, int iNumSamples) {
+                    numSamples.store(iNumSamples);
+                });
+        pReader->newTrack(Track::newTemporary(m_trackLocation), preloadFully);
+        for (int i = 0; numSamples.load() == 0 && i < 1000; ++i) {
+            m_scheduler.runWorkers();
+            QThread::msleep(5);
+        }
+        QObject::disconnect(connection);
+        // Receive the TRACK_LOADED update
+        pReader->process();
+        return numSamples.load() / mixxx::kEngineChannelCount;
+    }
+
+    // Returns true after the worker has preloaded the track in the
+    // background.
+    bool waitUntilPreloaded(CachingReader* pReader) {
+        for (int i = 0; !pReader->isPreloadedFully() && i < 1000; ++i) {
+            m_scheduler.runWorkers();
+            QThread::msleep(5);
+            pReader->process();
+        }
+        return pReader->isPreloadedFully();
+    }
+
+    // Hints and reads until the samples have been decoded by the worker.
+    CachingReader::ReadResult readWhenAvailable(CachingReader* pReader,
+            SINT startFrame,
+            SINT numFrames,
+            bool reverse,
+            CSAMPLE* pBuffer) {
+        HintVector hints;
+        hints.append(Hint{reverse ? startFrame - numFrames : startFrame,
+                numFrames,
+                Hint::Type::CurrentPosition});
+        auto result = CachingReader::ReadResult::UNAVAILABLE;
+        for (int i = 0; result == CachingReader::ReadResult::UNAVAILABLE && i < 1000; ++i) {
+            pReader->hintAndMaybeWake(hints, startFrame);
+            m_scheduler.runWorkers();
+            QThread::msleep(1);
+            result = pReader->read(startFrame * mixxx::kEngineChannelCount,
+                    numFrames * mixxx::kEngineChannelCount,
+                    reverse,
+                    pBuffer);
+        }
+        return result;
+    }
+
+    // Returns the stats after all pending requests have been returned
+    // by the worker
+    CachingReader::ReadRequestStats drainReadRequests(CachingReader* pReader) {
+        QDeadlineTimer deadline(5000);
+        while (pReader->hasPendingReadRequests() && !deadline.hasExpired()) {
+            // Wakes the worker again if the scheduler has missed it
+            m_scheduler.workerReady();
+            m_scheduler.runWorkers();
+            QThread::usleep(100);
+            pReader->process();
+        }
+        EXPECT_FALSE(pReader->hasPendingReadRequests());
+        return pReader->readRequestStats();
+    }
+
+    const QString m_trackLocation;
+    CachingReader m_chunkReader;
+    CachingReader m_preloadedReader;
+    // Destroyed before the readers that own the registered workers
+    EngineWorkerScheduler m_scheduler;
+};
+
+TEST_F(CachingReaderTest, PreloadFully) {
+    constexpr SINT kNumFrames = 1000;
+    const SINT trackFrames = loadTrack(&m_chunkReader, false);
+    ASSERT_GT(trackFrames, 2 * CachingReaderChunk::kFrames);
+    EXPECT_FALSE(m_chunkReader.isPreloadedFully());
+    ASSERT_EQ(trackFrames, loadTrack(&m_preloadedReader, true));
+    EXPECT_TRUE(waitUntilPreloaded(&m_preloadedReader));
+
+    mixxx::SampleBuffer expected(kNumFrames * mixxx::kEngineChannelCount);
+    mixxx::SampleBuffer actual(kNumFrames * mixxx::kEngineChannelCount);
+    const SINT startFrames[] = {
+            // Preroll
+            -kNumFrames / 2,
+            0,
+            // Across the chunk boundary
+            CachingReaderChunk::kFrames - kNumFrames / 2,
+            2 * CachingReaderChunk::kFrames + 123,
+            // After the end of the track
+            trackFrames - kNumFrames / 2,
+    };
+    for (const bool reverse : {false, true}) {
+        for (SINT startFrame : startFrames) {
+            if (reverse) {
+                // Reverse reads end at the start position
+                startFrame += kNumFrames;
+            }
+            const auto expectedResult = readWhenAvailable(&m_chunkReader,
+                    startFrame,
+                    kNumFrames,
+                    reverse,
+                    expected.data());
+            ASSERT_NE(CachingReader::ReadResult::UNAVAILABLE, expectedResult);
+            // Never waits for the worker
+            EXPECT_EQ(expectedResult,
+                    m_preloadedReader.read(startFrame * mixxx::kEngineChannelCount,
+                            actual.size(),
+                            reverse,
+                            actual.data()));
+            for (SINT i = 0; i < actual.size(); ++i) {
+                ASSERT_EQ(expected[i], actual[i])
+                        << "startFrame = " << startFrame
+                        << ", reverse = " << reverse
+                        << ", i = " << i;
+            }
+        }
+    }
+
+    // The samples are released after unloading the track
+    m_preloadedReader.newTrack(TrackPointer());
+    for (int i = 0; m_preloadedReader.isPreloadedFully() && i < 1000; ++i) {
+        m_scheduler.runWorkers();
+        QThread::msleep(5);
+        m_preloadedReader.process();
+    }
+    EXPECT_FALSE(m_preloadedReader.isPreloadedFully());
+}
+
+TEST_F(CachingReaderTest, PreloadBudgetExceeded) {
+    auto pConfig = UserSettingsPointer(new UserSettings(QString()));
+    // Less than the 30 s test track
+    pConfig->setValue(ConfigKey("[Master]", "preload_budget_mb"), 1);
+    CachingReader reader(QStringLiteral("[Channel3]"), pConfig);
+    reader.setScheduler(&m_scheduler);
+    ASSERT_GT(loadTrack(&reader, true), 0);
+    for (int i = 0; i < 20; ++i) {
+        m_scheduler.runWorkers();
+        QThread::msleep(5);
+        reader.process();
+    }
+    EXPECT_FALSE(reader.isPreloadedFully());
+
+    // The track is read chunk by chunk instead
+    mixxx::SampleBuffer buffer(1000 * mixxx::kEngineChannelCount);
+    EXPECT_EQ(CachingReader::ReadResult::AVAILABLE,
+            readWhenAvailable(&reader, 0, 1000, false, buffer.data()));
+}
+
+TEST_F(CachingReaderTest, CoalesceHints) {
+    ASSERT_GT(loadTrack(&m_chunkReader, false), 0);
+    const auto statsBefore = m_chunkReader.readRequestStats();
+
+    // Hints for the same chunks are only requested once
+    const SINT frame = 10 * CachingReaderChunk::kFrames;
+    HintVector hints;
+    hints.append(Hint{frame, 2 * CachingReaderChunk::kFrames, Hint::Type::CurrentPosition});
+    hints.append(Hint{frame, Hint::kFrameCountForward, Hint::Type::HotCue});
+    hints.append(Hint{frame + 100, Hint::kFrameCountForward, Hint::Type::LoopStart});
+    m_chunkReader.hintAndMaybeWake(hints, frame);
+
+    const auto stats = m_chunkReader.readRequestStats();
+    EXPECT_EQ(statsBefore.coalesced + 2, stats.coalesced);
+    EXPECT_EQ(statsBefore.submitted + 2, stats.submitted);
+    EXPECT_EQ(statsBefore.deferred, stats.deferred);
+    EXPECT_EQ(statsBefore.superseded, stats.superseded);
+
+    // Hinting pending chunks again doesn't request them again
+    m_chunkReader.hintAndMaybeWake(hints, frame);
+    EXPECT_EQ(stats.submitted, m_chunkReader.readRequestStats().submitted);
+
+    EXPECT_EQ(stats.submitted, drainReadRequests(&m_chunkReader).served);
+}
+
+TEST_F(CachingReaderTest, SupersedePendingRequests) {
+    ASSERT_GT(loadTrack(&m_chunkReader, false), 0);
+    const auto statsBefore = m_chunkReader.readRequestStats();
+
+    // The worker is not woken up while hinting
+    HintVector scratchHints;
+    scratchHints.append(Hint{20 * CachingReaderChunk::kFrames,
+            Hint::kFrameCountForward,
+            Hint::Type::CurrentPosition});
+    m_chunkReader.hintAndMaybeWake(scratchHints, scratchHints[0].frame);
+    HintVector playHints;
+    playHints.append(Hint{30 * CachingReaderChunk::kFrames,
+            Hint::kFrameCountForward,
+            Hint::Type::CurrentPosition});
+    m_chunkReader.hintAndMaybeWake(playHints, playHints[0].frame);
+    EXPECT_EQ(statsBefore.superseded, m_chunkReader.readRequestStats().superseded);
+    m_chunkReader.hintAndMaybeWake(playHints, playHints[0].frame);
+
+    // The first request has not been hinted by the last 2 calls
+    const auto stats = m_chunkReader.readRequestStats();
+    EXPECT_EQ(statsBefore.submitted + 2, stats.submitted);
+    EXPECT_EQ(statsBefore.superseded + 1, stats.superseded);
+
+    // The worker discards the superseded request, unless it has already
+    // been decoded
+    EXPECT_GE(drainReadRequests(&m_chunkReader).served, statsBefore.served + 1);
+    mixxx::SampleBuffer buffer(1000 * mixxx::kEngineChannelCount);
+    EXPECT_EQ(CachingReader::ReadResult::AVAILABLE,
+            m_chunkReader.read(playHints[0].frame * mixxx::kEngineChannelCount,
+                    buffer.size(),
+                    false,
+                    buffer.data()));
+    EXPECT_NE(CachingReader::ReadResult::UNAVAILABLE,
+            readWhenAvailable(&m_chunkReader,
+                    scratchHints[0].frame,
+                    1000,
+                    false,
+                    buffer.data()));
+}
+
+TEST_F(CachingReaderTest, ChunkPoolShrinksAfterEject) {
+    constexpr int kInitialChunks = 4;
+    auto pConfig = UserSettingsPointer(new UserSettings(QString()));
+    pConfig->setValue(ConfigKey("[Master]", "cached_chunks_per_deck"),
+            kInitialChunks);
+    pConfig->setValue(ConfigKey("[Master]", "cached_chunks_per_deck_max"),
+            4 * kInitialChunks);
+    CachingReader reader(QStringLiteral("[Channel3]"), pConfig);
+    reader.setScheduler(&m_scheduler);
+    ASSERT_GT(loadTrack(&reader, false), 0);
+    ASSERT_EQ(kInitialChunks, reader.numAvailableChunks());
+
+    // Cycling through more chunks than fit into the pool evicts a chunk
+    // on almost every lookup
+    HintVector hints;
+    for (int i = 0; reader.numAvailableChunks() == kInitialChunks && i < 2000; ++i) {
+        hints.clear();
+        hints.append(Hint{(i % 4) * kInitialChunks * CachingReaderChunk::kFrames,
+                kInitialChunks * CachingReaderChunk::kFrames,
+                Hint::Type::CurrentPosition});
+        reader.hintAndMaybeWake(hints, hints[0].frame);
+        m_scheduler.runWorkers();
+        QThread::msleep(1);
+        reader.process();
+    }
+    ASSERT_GT(reader.numAvailableChunks(), kInitialChunks);
+
+    reader.newTrack(TrackPointer());
+    for (int i = 0; reader.numAvailableChunks() > kInitialChunks && i < 1000; ++i) {
+        m_scheduler.runWorkers();
+        QThread::msleep(5);
+        reader.process();
+    }
+    EXPECT_EQ(kInitialChunks, reader.numAvailableChunks());
+}
+
+} // namespace
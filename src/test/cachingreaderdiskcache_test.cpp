@@ -0,0 +1,186 @@
+#include "engine/cachingreader/cachingreaderdiskcache.h"
+
+#include <gtest/gtest.h>
+
+#include <QDir>
+
+#include "engine/cachingreader/cachingreaderchunk.h"
+#include "sources/soundsourceproxy.h"
+#include "test/mixxxtest.h"
+#include "test/soundsourceproviderregistration.h"
+#include "track/track.h"
+#include "util/samplebuffer.h"
+
+namespace {
+
+const QString kCacheDirectory = QStringLiteral("decoded_cache");
+
+class CachingReaderDiskCacheTest : public MixxxTest, SoundSourceProviderRegistration {
+  protected:
+    CachingReaderDiskCacheTest()
+            : m_cacheDirectory(getTestDataDir().filePath(kCacheDirectory)),
+              m_trackFileInfo(getTestDir().filePath(QStringLiteral("sine-30.wav"))) {
+    }
+
+    mixxx::AudioSourcePointer openAudioSource() {
+        mixxx::AudioSource::OpenParams openParams;
+        openParams.setChannelCount(CachingReaderChunk::kChannels);
+        return SoundSourceProxy(Track::newTemporary(m_trackFileInfo.location()))
+                .openAudioSource(openParams);
+    }
+
+    int numCacheFiles() const {
+        // Without the lock files of open cache files
+        return QDir(m_cacheDirectory)
+                .entryList(QStringList{QStringLiteral("*.pcm")}, QDir::Files)
+                .size();
+    }
+
+    const QString m_cacheDirectory;
+    const mixxx::FileInfo m_trackFileInfo;
+};
+
+TEST_F(CachingReaderDiskCacheTest, Disabled) {
+    CachingReaderDiskCache cache(m_cacheDirectory, 0);
+    EXPECT_FALSE(cache.isEnabled());
+    EXPECT_FALSE(cache.open(m_trackFileInfo,
+            mixxx::audio::SampleRate(44100),
+            mixxx::IndexRange::forward(0, 44100)));
+    EXPECT_FALSE(cache.isOpen());
+    EXPECT_EQ(nullptr, cache.lookupChunk(0));
+}
+
+TEST_F(CachingReaderDiskCacheTest, StoreAndReopen) {
+    const auto pAudioSource = openAudioSource();
+    ASSERT_TRUE(pAudioSource);
+    const auto sampleRate = pAudioSource->getSignalInfo().getSampleRate();
+    const auto frameIndexRange = pAudioSource->frameIndexRange();
+    ASSERT_GT(frameIndexRange.length(), CachingReaderChunk::kFrames);
+
+    mixxx::SampleBuffer chunkBuffer(CachingReaderChunk::kSamples);
+    CachingReaderChunkForOwner chunk(mixxx::SampleBuffer::WritableSlice(chunkBuffer));
+    chunk.init(1);
+    mixxx::SampleBuffer tempBuffer(CachingReaderChunk::kSamples);
+    const auto chunkFrameIndexRange = chunk.frameIndexRange(pAudioSource);
+    ASSERT_EQ(chunkFrameIndexRange,
+            chunk.bufferSampleFrames(pAudioSource,
+                    mixxx::SampleBuffer::WritableSlice(tempBuffer)));
+
+    CachingReaderDiskCache cache(m_cacheDirectory, 1024 * 1024 * 1024);
+    ASSERT_TRUE(cache.open(m_trackFileInfo, sampleRate, frameIndexRange));
+    EXPECT_EQ(nullptr, cache.lookupChunk(1));
+    cache.storeChunk(chunk);
+    EXPECT_NE(nullptr, cache.lookupChunk(1));
+    EXPECT_EQ(nullptr, cache.lookupChunk(0));
+    cache.close();
+
+    // The stored chunk survives reopening the cache file
+    ASSERT_TRUE(cache.open(m_trackFileInfo, sampleRate, frameIndexRange));
+    const CSAMPLE* pCachedSamples = cache.lookupChunk(1);
+    ASSERT_NE(nullptr, pCachedSamples);
+
+    mixxx::SampleBuffer cachedChunkBuffer(CachingReaderChunk::kSamples);
+    CachingReaderChunkForOwner cachedChunk(
+            mixxx::SampleBuffer::WritableSlice(cachedChunkBuffer));
+    cachedChunk.init(1);
+    EXPECT_EQ(chunkFrameIndexRange,
+            cachedChunk.bufferSampleFrames(pAudioSource, pCachedSamples));
+    for (SINT i = 0; i < CachingReaderChunk::frames2samples(
+                             chunkFrameIndexRange.length());
+            ++i) {
+        ASSERT_EQ(chunkBuffer[i], cachedChunkBuffer[i]) << i;
+    }
+    cache.close();
+
+    // A different decoder result invalidates all cached chunks
+    ASSERT_TRUE(cache.open(m_trackFileInfo,
+            sampleRate,
+            mixxx::IndexRange::forward(
+                    frameIndexRange.start(), frameIndexRange.length() - 1)));
+    EXPECT_EQ(nullptr, cache.lookupChunk(1));
+}
+
+TEST_F(CachingReaderDiskCacheTest, CorruptChunkIsDiscarded) {
+    const auto pAudioSource = openAudioSource();
+    ASSERT_TRUE(pAudioSource);
+    const auto sampleRate = pAudioSource->getSignalInfo().getSampleRate();
+    const auto frameIndexRange = pAudioSource->frameIndexRange();
+
+    mixxx::SampleBuffer chunkBuffer(CachingReaderChunk::kSamples);
+    CachingReaderChunkForOwner chunk(mixxx::SampleBuffer::WritableSlice(chunkBuffer));
+    chunk.init(0);
+    mixxx::SampleBuffer tempBuffer(CachingReaderChunk::kSamples);
+    ASSERT_FALSE(chunk.bufferSampleFrames(pAudioSource,
+                              mixxx::SampleBuffer::WritableSlice(tempBuffer))
+                         .empty());
+
+    CachingReaderDiskCache cache(m_cacheDirectory, 1024 * 1024 * 1024);
+    ASSERT_TRUE(cache.open(m_trackFileInfo, sampleRate, frameIndexRange));
+    cache.storeChunk(chunk);
+    CSAMPLE* pCachedSamples = const_cast<CSAMPLE*>(cache.lookupChunk(0));
+    ASSERT_NE(nullptr, pCachedSamples);
+
+    // Simulate a page that has not been written back before a crash
+    pCachedSamples[CachingReaderChunk::kSamples / 2] += 1.0f;
+    EXPECT_EQ(nullptr, cache.lookupChunk(0));
+    cache.close();
+
+    ASSERT_TRUE(cache.open(m_trackFileInfo, sampleRate, frameIndexRange));
+    EXPECT_EQ(nullptr, cache.lookupChunk(0));
+    // Storing the chunk again repairs it
+    cache.storeChunk(chunk);
+    EXPECT_NE(nullptr, cache.lookupChunk(0));
+}
+
+TEST_F(CachingReaderDiskCacheTest, FileInUseByOtherDeck) {
+    const auto sampleRate = mixxx::audio::SampleRate(44100);
+    const auto frameIndexRange = mixxx::IndexRange::forward(0, 44100 * 10);
+
+    CachingReaderDiskCache cache1(m_cacheDirectory, 1024 * 1024 * 1024);
+    CachingReaderDiskCache cache2(m_cacheDirectory, 1024 * 1024 * 1024);
+    ASSERT_TRUE(cache1.open(m_trackFileInfo, sampleRate, frameIndexRange));
+
+    // The second deck must neither truncate nor map the same file, even
+    // if the decoder reports a different frame index range.
+    EXPECT_FALSE(cache2.open(m_trackFileInfo,
+            sampleRate,
+            mixxx::IndexRange::forward(0, 44100 * 5)));
+    EXPECT_FALSE(cache2.isOpen());
+    EXPECT_TRUE(cache2.isEnabled());
+    EXPECT_TRUE(cache1.isOpen());
+    EXPECT_EQ(1, numCacheFiles());
+
+    cache1.close();
+    EXPECT_TRUE(cache2.open(m_trackFileInfo, sampleRate, frameIndexRange));
+}
+
+TEST_F(CachingReaderDiskCacheTest, EvictLeastRecentlyOpened) {
+    const auto sampleRate = mixxx::audio::SampleRate(44100);
+    const auto frameIndexRange = mixxx::IndexRange::forward(0, 44100 * 10);
+    const QString otherTrackLocation =
+            getTestDataDir().filePath(QStringLiteral("other.wav"));
+    mixxxtest::copyFile(m_trackFileInfo.location(), otherTrackLocation);
+    const mixxx::FileInfo otherTrackFileInfo(otherTrackLocation);
+
+    // Room for a single track
+    const qint64 maxSizeBytes = CachingReaderChunk::frames2samples(
+                                        frameIndexRange.length()) *
+                    sizeof(CSAMPLE) +
+            64 * 1024;
+    CachingReaderDiskCache cache(m_cacheDirectory, maxSizeBytes);
+    ASSERT_TRUE(cache.open(m_trackFileInfo, sampleRate, frameIndexRange));
+    EXPECT_EQ(1, numCacheFiles());
+    ASSERT_TRUE(cache.open(otherTrackFileInfo, sampleRate, frameIndexRange));
+    EXPECT_EQ(1, numCacheFiles());
+    EXPECT_TRUE(QFile::exists(QDir(m_cacheDirectory)
+                                      .filePath(CachingReaderDiskCache::cacheFileName(
+                                              otherTrackFileInfo))));
+
+    // Tracks that don't fit at all are not cached
+    EXPECT_FALSE(cache.open(m_trackFileInfo,
+            sampleRate,
+            mixxx::IndexRange::forward(0, 44100 * 20)));
+    EXPECT_EQ(1, numCacheFiles());
+}
+
+} // namespace
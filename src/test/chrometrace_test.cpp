@@ -0,0 +1,131 @@
+#include "util/chrometrace.h"
+
+#include <gtest/gtest.h>
+
+#include <QBuffer>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+
+namespace {
+
+Event makeEvent(const QString& tag,
+        Stat::StatType type,
+        qint64 micros,
+        int threadId,
+        quint64 flowId = 0) {
+    Event event;
+    event.m_tag = tag;
+    event.m_type = type;
+    event.m_time = mixxx::Duration::fromMicros(micros);
+    event.m_threadId = threadId;
+    event.m_flowId = flowId;
+    return event;
+}
+
+class ChromeTraceTest : public testing::Test {
+  protected:
+    QJsonArray writeTrace(const QList<Event>& events,
+            const QHash<int, QString>& threadNames) {
+        QBuffer buffer;
+        buffer.open(QIODevice::WriteOnly);
+        EXPECT_TRUE(ChromeTrace::write(&buffer, events, threadNames));
+        QJsonParseError error;
+        const auto document = QJsonDocument::fromJson(buffer.data(), &error);
+        EXPECT_EQ(QJsonParseError::NoError, error.error) << error.errorString().toStdString();
+        return document.object().value(QStringLiteral("traceEvents")).toArray();
+    }
+
+    // Returns all trace events with the given phase
+    QList<QJsonObject> filterPhase(const QJsonArray& traceEvents, const QString& phase) {
+        QList<QJsonObject> result;
+        for (const auto& value : traceEvents) {
+            const auto object = value.toObject();
+            if (object.value(QStringLiteral("ph")).toString() == phase) {
+                result.append(object);
+            }
+        }
+        return result;
+    }
+};
+
+TEST_F(ChromeTraceTest, Empty) {
+    const auto traceEvents = writeTrace({}, {});
+    // Only the process name
+    ASSERT_EQ(1, traceEvents.size());
+    EXPECT_EQ(QStringLiteral("process_name"),
+            traceEvents[0].toObject().value(QStringLiteral("name")).toString());
+}
+
+TEST_F(ChromeTraceTest, ThreadNames) {
+    const auto traceEvents = writeTrace({},
+            {{0, QStringLiteral("Engine")}, {1, QStringLiteral("CachingReaderWorker 1")}});
+    const auto metadata = filterPhase(traceEvents, QStringLiteral("M"));
+    QHash<int, QString> threadNames;
+    for (const auto& object : metadata) {
+        if (object.value(QStringLiteral("name")).toString() == QStringLiteral("thread_name")) {
+            threadNames.insert(object.value(QStringLiteral("tid")).toInt(),
+                    object.value(QStringLiteral("args"))
+                            .toObject()
+                            .value(QStringLiteral("name"))
+                            .toString());
+        }
+    }
+    EXPECT_EQ(2, threadNames.size());
+    EXPECT_EQ(QStringLiteral("Engine"), threadNames.value(0));
+    EXPECT_EQ(QStringLiteral("CachingReaderWorker 1"), threadNames.value(1));
+}
+
+TEST_F(ChromeTraceTest, Slices) {
+    const QString tag = QStringLiteral("process");
+    // Unsorted, like the events from different StatsPipes
+    const auto traceEvents = writeTrace(
+            {
+                    makeEvent(tag, Stat::EVENT_END, 30, 1),
+                    makeEvent(tag, Stat::EVENT_START, 10, 1),
+                    makeEvent(tag, Stat::EVENT, 20, 2),
+            },
+            {});
+    ASSERT_EQ(4, traceEvents.size());
+    const auto begin = traceEvents[1].toObject();
+    EXPECT_EQ(QStringLiteral("B"), begin.value(QStringLiteral("ph")).toString());
+    EXPECT_EQ(tag, begin.value(QStringLiteral("name")).toString());
+    EXPECT_DOUBLE_EQ(10.0, begin.value(QStringLiteral("ts")).toDouble());
+    EXPECT_EQ(1, begin.value(QStringLiteral("tid")).toInt());
+    const auto instant = traceEvents[2].toObject();
+    EXPECT_EQ(QStringLiteral("i"), instant.value(QStringLiteral("ph")).toString());
+    EXPECT_EQ(QStringLiteral("t"), instant.value(QStringLiteral("s")).toString());
+    EXPECT_EQ(2, instant.value(QStringLiteral("tid")).toInt());
+    const auto end = traceEvents[3].toObject();
+    EXPECT_EQ(QStringLiteral("E"), end.value(QStringLiteral("ph")).toString());
+    EXPECT_DOUBLE_EQ(30.0, end.value(QStringLiteral("ts")).toDouble());
+}
+
+TEST_F(ChromeTraceTest, Flows) {
+    const QString tag = QStringLiteral("chunk read");
+    const quint64 flowId = 0x7fff12345678;
+    const auto traceEvents = writeTrace(
+            {
+                    makeEvent(tag, Stat::FLOW_START, 10, 0, flowId),
+                    makeEvent(tag, Stat::FLOW_STEP, 20, 1, flowId),
+                    makeEvent(tag, Stat::FLOW_END, 30, 0, flowId),
+            },
+            {});
+    const auto starts = filterPhase(traceEvents, QStringLiteral("s"));
+    const auto steps = filterPhase(traceEvents, QStringLiteral("t"));
+    const auto ends = filterPhase(traceEvents, QStringLiteral("f"));
+    ASSERT_EQ(1, starts.size());
+    ASSERT_EQ(1, steps.size());
+    ASSERT_EQ(1, ends.size());
+    const QString id = QString::number(flowId);
+    EXPECT_EQ(id, starts[0].value(QStringLiteral("id")).toString());
+    EXPECT_EQ(id, steps[0].value(QStringLiteral("id")).toString());
+    EXPECT_EQ(id, ends[0].value(QStringLiteral("id")).toString());
+    EXPECT_EQ(1, steps[0].value(QStringLiteral("tid")).toInt());
+    // Bound to the enclosing slice
+    EXPECT_EQ(QStringLiteral("e"), ends[0].value(QStringLiteral("bp")).toString());
+    // Flows are only matched within the same category
+    EXPECT_EQ(starts[0].value(QStringLiteral("cat")), ends[0].value(QStringLiteral("cat")));
+}
+
+} // namespace
@@ -0,0 +1,131 @@
+#include "control/controlchangedispatcher.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <QVector>
+#include <memory>
+
+#include "control/controlobject.h"
+#include "control/controlobjectscript.h"
+#include "control/controlproxy.h"
+#include "test/mixxxtest.h"
+
+using ::testing::_;
+using ::testing::Return;
+
+namespace {
+
+const RuntimeLoggingCategory k_logger(QString("test").toLocal8Bit());
+
+class MockControlObjectScript : public ControlObjectScript {
+  public:
+    MockControlObjectScript(const ConfigKey& key,
+            const RuntimeLoggingCategory& logger,
+            QObject* pParent)
+            : ControlObjectScript(key, logger, pParent) {
+    }
+    ~MockControlObjectScript() override = default;
+    MOCK_METHOD2(slotValueChanged, void(double value, QObject*));
+};
+
+class ControlChangeDispatcherTest : public MixxxTest {
+  protected:
+    void SetUp() override {
+        m_key = ConfigKey("[Test]", "co1");
+        m_pControl = std::make_unique<ControlObject>(m_key);
+        ControlChangeDispatcher::setEnabled(true);
+    }
+
+    void TearDown() override {
+        ControlChangeDispatcher::setEnabled(false);
+    }
+
+    std::unique_ptr<ControlProxy> connectProxy() {
+        auto pProxy = std::make_unique<ControlProxy>(m_key);
+        pProxy->connectValueChangedCoalesced(&m_receiver, [this](double value) {
+            m_receivedValues.append(value);
+        });
+        return pProxy;
+    }
+
+    ConfigKey m_key;
+    std::unique_ptr<ControlObject> m_pControl;
+    QObject m_receiver;
+    QVector<double> m_receivedValues;
+};
+
+TEST_F(ControlChangeDispatcherTest, DeliverOnlyOnDispatch) {
+    auto pProxy = connectProxy();
+    m_pControl->set(1.0);
+    application()->processEvents();
+    EXPECT_TRUE(m_receivedValues.isEmpty());
+
+    ControlChangeDispatcher::dispatch();
+    EXPECT_EQ(QVector<double>{1.0}, m_receivedValues);
+
+    // Nothing has changed since the last dispatch
+    ControlChangeDispatcher::dispatch();
+    EXPECT_EQ(QVector<double>{1.0}, m_receivedValues);
+}
+
+TEST_F(ControlChangeDispatcherTest, CoalesceChanges) {
+    auto pProxy1 = connectProxy();
+    auto pProxy2 = connectProxy();
+    m_pControl->set(1.0);
+    m_pControl->set(2.0);
+    m_pControl->set(3.0);
+    ControlChangeDispatcher::dispatch();
+    EXPECT_EQ((QVector<double>{3.0, 3.0}), m_receivedValues);
+}
+
+TEST_F(ControlChangeDispatcherTest, IgnoreOwnChanges) {
+    auto pProxy1 = connectProxy();
+    auto pProxy2 = connectProxy();
+    pProxy1->set(1.0);
+    ControlChangeDispatcher::dispatch();
+    // Only the other proxy is notified
+    EXPECT_EQ(QVector<double>{1.0}, m_receivedValues);
+}
+
+TEST_F(ControlChangeDispatcherTest, UnsubscribeOnDestruction) {
+    auto pProxy = connectProxy();
+    m_pControl->set(1.0);
+    pProxy.reset();
+    ControlChangeDispatcher::dispatch();
+    EXPECT_TRUE(m_receivedValues.isEmpty());
+}
+
+TEST_F(ControlChangeDispatcherTest, ConnectDirectlyIfDisabled) {
+    ControlChangeDispatcher::setEnabled(false);
+    auto pProxy = connectProxy();
+    m_pControl->set(1.0);
+    m_pControl->set(2.0);
+    application()->processEvents();
+    EXPECT_EQ((QVector<double>{1.0, 2.0}), m_receivedValues);
+}
+
+TEST_F(ControlChangeDispatcherTest, ScriptConnectionSkipSuperseded) {
+    MockControlObjectScript coScript(m_key, k_logger, nullptr);
+    ScriptConnection conn;
+    conn.key = m_key;
+    conn.engineJSProxy = nullptr;
+    conn.controllerEngine = nullptr;
+    conn.callback = "mock_callback";
+    conn.id = QUuid::createUuid();
+    conn.skipSuperseded = true;
+    coScript.addScriptConnection(conn);
+
+    EXPECT_CALL(coScript, slotValueChanged(3.0, _))
+            .Times(1)
+            .WillOnce(Return());
+    m_pControl->set(1.0);
+    m_pControl->set(2.0);
+    coScript.set(3.0);
+    ControlChangeDispatcher::dispatch();
+    application()->processEvents();
+
+    coScript.removeScriptConnection(conn);
+}
+
+} // namespace
@@ -1,5 +1,8 @@
+#include <benchmark/benchmark.h>
 #include <gtest/gtest.h>
+
 #include <QtDebug>
+#include <vector>
 
 #include "control/controlobject.h"
 #include "util/memory.h"
@@ -36,6 +39,41 @@ TEST_F(ControlObjectTest, getControl) {
             (ControlObject*)nullptr);
 }
 
+TEST_F(ControlObjectTest, getControlByKeyId) {
+    const ConfigKeyId id1 = ControlDoublePrivate::internKey(ck1);
+    const ConfigKeyId id2 = ControlDoublePrivate::internKey(ck2);
+    ASSERT_TRUE(id1.isValid());
+    ASSERT_TRUE(id2.isValid());
+    EXPECT_NE(id1, id2);
+    EXPECT_EQ(id1, ControlDoublePrivate::internKey(ck1));
+    EXPECT_EQ(ControlObject::getControl(id1), co1.get());
+    EXPECT_EQ(ControlObject::getControl(id2), co2.get());
+
+    // The id outlives the control
+    co2.reset();
+    EXPECT_EQ(ControlObject::getControl(id2, ControlFlag::NoAssertIfMissing),
+            (ControlObject*)nullptr);
+    co2 = std::make_unique<ControlObject>(ck2);
+    EXPECT_EQ(id2, ControlDoublePrivate::internKey(ck2));
+    EXPECT_EQ(ControlObject::getControl(id2), co2.get());
+}
+
+TEST_F(ControlObjectTest, getControlByInvalidKeyId) {
+    const ConfigKeyId id = ControlDoublePrivate::internKey(ConfigKey());
+    EXPECT_FALSE(id.isValid());
+    EXPECT_EQ(ControlObject::getControl(id, ControlFlag::AllowMissingOrInvalid),
+            (ControlObject*)nullptr);
+}
+
+TEST_F(ControlObjectTest, getControlByKeyIdBeforeCreation) {
+    ConfigKey ck("[Test]", "interned");
+    const ConfigKeyId id = ControlDoublePrivate::internKey(ck);
+    EXPECT_EQ(ControlObject::getControl(id, ControlFlag::NoAssertIfMissing),
+            (ControlObject*)nullptr);
+    ControlObject co(ck);
+    EXPECT_EQ(ControlObject::getControl(id), &co);
+}
+
 TEST_F(ControlObjectTest, AliasRetrieval) {
     ConfigKey ck("[Microphone1]", "volume");
     ConfigKey ckAlias("[Microphone]", "volume");
@@ -48,6 +86,8 @@ TEST_F(ControlObjectTest, AliasRetrieval) {
 
     // Check if getControl on alias returns us the original ControlObject
     EXPECT_EQ(ControlObject::getControl(ckAlias), co.get());
+    EXPECT_EQ(ControlObject::getControl(ControlDoublePrivate::internKey(ckAlias)),
+            co.get());
 }
 
 TEST_F(ControlObjectTest, Persistence_NotPresent) {
@@ -85,4 +125,52 @@ TEST_F(ControlObjectTest, Persistence_ValidValue) {
     EXPECT_DOUBLE_EQ(5.0, co.get());
 }
 
+// Roughly the number of controls of a 4 deck skin
+constexpr int kNumBenchmarkGroups = 4;
+constexpr int kNumBenchmarkItems = 200;
+
+std::vector<ConfigKey> benchmarkKeys() {
+    std::vector<ConfigKey> keys;
+    keys.reserve(kNumBenchmarkGroups * kNumBenchmarkItems);
+    for (int group = 1; group <= kNumBenchmarkGroups; ++group) {
+        for (int item = 0; item < kNumBenchmarkItems; ++item) {
+            keys.emplace_back(QStringLiteral("[Channel%1]").arg(group),
+                    QStringLiteral("control_%1").arg(item));
+        }
+    }
+    return keys;
+}
+
+static void BM_GetControlByKey(benchmark::State& state) {
+    const std::vector<ConfigKey> keys = benchmarkKeys();
+    std::vector<std::unique_ptr<ControlObject>> controls;
+    for (const auto& key : keys) {
+        controls.push_back(std::make_unique<ControlObject>(key));
+    }
+    for (auto _ : state) {
+        for (const auto& key : keys) {
+            benchmark::DoNotOptimize(ControlObject::getControl(key));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * keys.size());
+}
+BENCHMARK(BM_GetControlByKey);
+
+static void BM_GetControlByKeyId(benchmark::State& state) {
+    const std::vector<ConfigKey> keys = benchmarkKeys();
+    std::vector<std::unique_ptr<ControlObject>> controls;
+    std::vector<ConfigKeyId> keyIds;
+    for (const auto& key : keys) {
+        controls.push_back(std::make_unique<ControlObject>(key));
+        keyIds.push_back(ControlDoublePrivate::internKey(key));
+    }
+    for (auto _ : state) {
+        for (const auto keyId : keyIds) {
+            benchmark::DoNotOptimize(ControlObject::getControl(keyId));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * keyIds.size());
+}
+BENCHMARK(BM_GetControlByKeyId);
+
 } // namespace
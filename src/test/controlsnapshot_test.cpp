@@ -0,0 +1,208 @@
+#include "control/controlsnapshot.h"
+
+#include <benchmark/benchmark.h>
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "control/controlobject.h"
+#include "control/pollingcontrolproxy.h"
+#include "test/mixxxtest.h"
+
+namespace {
+
+const QString kGroup = QStringLiteral("[Test]");
+
+ConfigKey testKey(int index) {
+    return ConfigKey(kGroup, QStringLiteral("co%1").arg(index));
+}
+
+class ControlSnapshotTest : public MixxxTest {
+  protected:
+    void SetUp() override {
+        m_pControl = std::make_unique<ControlObject>(testKey(0));
+    }
+
+    std::unique_ptr<ControlObject> m_pControl;
+};
+
+TEST_F(ControlSnapshotTest, RegisterCurrentValue) {
+    m_pControl->set(1.0);
+    ControlSnapshot snapshot;
+    SnapshotControlProxy proxy(&snapshot, m_pControl->getKey());
+    EXPECT_EQ(1, snapshot.size());
+    EXPECT_DOUBLE_EQ(1.0, proxy.get());
+}
+
+TEST_F(ControlSnapshotTest, ValueChangesOnlyVisibleAfterPublish) {
+    ControlSnapshot snapshot;
+    SnapshotControlProxy proxy(&snapshot, m_pControl->getKey());
+    m_pControl->set(1.0);
+    EXPECT_DOUBLE_EQ(0.0, proxy.get());
+    snapshot.publish();
+    EXPECT_DOUBLE_EQ(1.0, proxy.get());
+    EXPECT_TRUE(proxy.toBool());
+}
+
+TEST_F(ControlSnapshotTest, CoalesceValueChanges) {
+    ControlSnapshot snapshot;
+    SnapshotControlProxy proxy(&snapshot, m_pControl->getKey());
+    m_pControl->set(1.0);
+    m_pControl->set(2.0);
+    m_pControl->set(3.0);
+    snapshot.publish();
+    EXPECT_DOUBLE_EQ(3.0, proxy.get());
+    snapshot.publish();
+    EXPECT_DOUBLE_EQ(3.0, proxy.get());
+}
+
+TEST_F(ControlSnapshotTest, ReadControlWithoutSnapshot) {
+    SnapshotControlProxy proxy(nullptr, m_pControl->getKey());
+    m_pControl->set(1.0);
+    EXPECT_DOUBLE_EQ(1.0, proxy.get());
+}
+
+TEST_F(ControlSnapshotTest, ShareControlRegisteredTwice) {
+    ControlSnapshot snapshot;
+    SnapshotControlProxy proxy1(&snapshot, m_pControl->getKey());
+    SnapshotControlProxy proxy2(&snapshot, m_pControl->getKey());
+    EXPECT_EQ(1, snapshot.size());
+    m_pControl->set(1.0);
+    snapshot.publish();
+    EXPECT_DOUBLE_EQ(1.0, proxy1.get());
+    EXPECT_DOUBLE_EQ(1.0, proxy2.get());
+}
+
+TEST_F(ControlSnapshotTest, PublishMultipleBlocks) {
+    constexpr int kNumControls = 150;
+    std::vector<std::unique_ptr<ControlObject>> controls;
+    std::vector<std::unique_ptr<SnapshotControlProxy>> proxies;
+    ControlSnapshot snapshot;
+    for (int i = 1; i <= kNumControls; ++i) {
+        controls.push_back(std::make_unique<ControlObject>(testKey(i)));
+        proxies.push_back(std::make_unique<SnapshotControlProxy>(&snapshot, testKey(i)));
+    }
+    EXPECT_EQ(kNumControls, snapshot.size());
+
+    // Only every third control changes
+    for (int i = 0; i < kNumControls; i += 3) {
+        controls[i]->set(i);
+    }
+    snapshot.publish();
+    for (int i = 0; i < kNumControls; ++i) {
+        EXPECT_DOUBLE_EQ(i % 3 == 0 ? i : 0.0, proxies[i]->get());
+    }
+}
+
+TEST_F(ControlSnapshotTest, ReattachAfterSnapshotDestroyed) {
+    {
+        ControlSnapshot snapshot;
+        SnapshotControlProxy proxy(&snapshot, m_pControl->getKey());
+        m_pControl->set(1.0);
+    }
+    // Must not touch the destroyed snapshot
+    m_pControl->set(2.0);
+
+    ControlSnapshot snapshot;
+    SnapshotControlProxy proxy(&snapshot, m_pControl->getKey());
+    EXPECT_EQ(1, snapshot.size());
+    EXPECT_DOUBLE_EQ(2.0, proxy.get());
+}
+
+TEST_F(ControlSnapshotTest, ConcurrentSettersPublishStoredValue) {
+    constexpr int kNumIterations = 10000;
+    ControlSnapshot snapshot;
+    SnapshotControlProxy proxy(&snapshot, m_pControl->getKey());
+    for (int i = 0; i < 10; ++i) {
+        std::thread setter1([this] {
+            for (int j = 0; j < kNumIterations; ++j) {
+                m_pControl->set(1.0);
+            }
+        });
+        std::thread setter2([this] {
+            for (int j = 0; j < kNumIterations; ++j) {
+                m_pControl->set(2.0);
+            }
+        });
+        setter1.join();
+        setter2.join();
+        snapshot.publish();
+        // Whichever setter won, the snapshot must agree with the control
+        EXPECT_DOUBLE_EQ(m_pControl->get(), proxy.get());
+    }
+}
+
+TEST_F(ControlSnapshotTest, DestroySnapshotWhileSetting) {
+    // The slots of a destroyed snapshot must not be written by setters
+    // that are still running, e.g. on a controller thread while the deck
+    // is destroyed. Detected reliably when built with AddressSanitizer.
+    std::atomic<bool> stop{false};
+    std::thread setter([this, &stop] {
+        double value = 0.0;
+        while (!stop.load(std::memory_order_relaxed)) {
+            m_pControl->set(value);
+            value += 1.0;
+        }
+    });
+    constexpr int kNumSnapshots = 1000;
+    for (int i = 0; i < kNumSnapshots; ++i) {
+        auto pSnapshot = std::make_unique<ControlSnapshot>();
+        SnapshotControlProxy proxy(pSnapshot.get(), m_pControl->getKey());
+        pSnapshot->publish();
+    }
+    stop.store(true, std::memory_order_relaxed);
+    setter.join();
+
+    // The control can still be attached to a new snapshot
+    ControlSnapshot snapshot;
+    SnapshotControlProxy proxy(&snapshot, m_pControl->getKey());
+    EXPECT_EQ(1, snapshot.size());
+    EXPECT_DOUBLE_EQ(m_pControl->get(), proxy.get());
+}
+
+// The number of input controls that a deck reads per callback
+constexpr int kNumBenchmarkControls = 32;
+
+static void BM_PollingControlProxyGet(benchmark::State& state) {
+    std::vector<std::unique_ptr<ControlObject>> controls;
+    std::vector<PollingControlProxy> proxies;
+    for (int i = 0; i < kNumBenchmarkControls; ++i) {
+        controls.push_back(std::make_unique<ControlObject>(testKey(i)));
+        proxies.emplace_back(testKey(i));
+    }
+    for (auto _ : state) {
+        double sum = 0.0;
+        for (const auto& proxy : proxies) {
+            sum += proxy.get();
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * kNumBenchmarkControls);
+}
+BENCHMARK(BM_PollingControlProxyGet);
+
+static void BM_SnapshotControlProxyGet(benchmark::State& state) {
+    std::vector<std::unique_ptr<ControlObject>> controls;
+    std::vector<std::unique_ptr<SnapshotControlProxy>> proxies;
+    ControlSnapshot snapshot;
+    for (int i = 0; i < kNumBenchmarkControls; ++i) {
+        controls.push_back(std::make_unique<ControlObject>(testKey(i)));
+        proxies.push_back(std::make_unique<SnapshotControlProxy>(&snapshot, testKey(i)));
+    }
+    for (auto _ : state) {
+        // Publishing is part of the per-callback costs
+        snapshot.publish();
+        double sum = 0.0;
+        for (const auto& pProxy : proxies) {
+            sum += pProxy->get();
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * kNumBenchmarkControls);
+}
+BENCHMARK(BM_SnapshotControlProxyGet);
+
+} // namespace
@@ -0,0 +1,52 @@
+#include <gtest/gtest.h>
+
+#include "effects/backends/effectprocessor.h"
+
+namespace {
+
+constexpr SINT kFramesPerBuffer = 8;
+
+class EffectParameterRampTest : public testing::Test {
+  protected:
+    EffectParameterRampTest()
+            : m_engineParameters(mixxx::audio::SampleRate(44100), kFramesPerBuffer) {
+    }
+
+    const mixxx::EngineParameters m_engineParameters;
+    EffectParameterRamp m_ramp;
+};
+
+TEST_F(EffectParameterRampTest, RampsToValue) {
+    CSAMPLE_GAIN previous = 0.0f;
+    const CSAMPLE_GAIN* pRamp = m_ramp.process(&previous, 1.0f, m_engineParameters);
+    EXPECT_EQ(1.0f, previous);
+    for (SINT i = 0; i < kFramesPerBuffer; ++i) {
+        EXPECT_FLOAT_EQ(static_cast<CSAMPLE_GAIN>(i + 1) / kFramesPerBuffer, pRamp[i]);
+    }
+    EXPECT_EQ(1.0f, pRamp[kFramesPerBuffer - 1]);
+}
+
+TEST_F(EffectParameterRampTest, ConstantAfterRamp) {
+    CSAMPLE_GAIN previous = 0.5f;
+    m_ramp.process(&previous, 0.25f, m_engineParameters);
+    const CSAMPLE_GAIN* pRamp = m_ramp.process(&previous, 0.25f, m_engineParameters);
+    for (SINT i = 0; i < kFramesPerBuffer; ++i) {
+        EXPECT_EQ(0.25f, pRamp[i]);
+    }
+}
+
+TEST_F(EffectParameterRampTest, ChannelsRampIndependently) {
+    CSAMPLE_GAIN previousLeft = 0.0f;
+    CSAMPLE_GAIN previousRight = 1.0f;
+    m_ramp.process(&previousLeft, 1.0f, m_engineParameters);
+    // The other channel reuses the array with its own previous value
+    const CSAMPLE_GAIN* pRamp = m_ramp.process(&previousRight, 1.0f, m_engineParameters);
+    for (SINT i = 0; i < kFramesPerBuffer; ++i) {
+        EXPECT_EQ(1.0f, pRamp[i]);
+    }
+    pRamp = m_ramp.process(&previousLeft, 0.0f, m_engineParameters);
+    EXPECT_FLOAT_EQ(1.0f - 1.0f / kFramesPerBuffer, pRamp[0]);
+    EXPECT_EQ(0.0f, pRamp[kFramesPerBuffer - 1]);
+}
+
+} // namespace
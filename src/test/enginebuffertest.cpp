@@ -1,5 +1,6 @@
 // Tests for enginebuffer.cpp
 
+#include <benchmark/benchmark.h>
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
 #include <QtDebug>
@@ -12,6 +13,7 @@
 #include "test/mixxxtest.h"
 #include "test/signalpathtest.h"
 #include "engine/controls/ratecontrol.h"
+#include "util/samplebuffer.h"
 
 // In case any of the test in this file fail. You can use the audioplot.py tool
 // in the tools folder to visually compare the results of the enginebuffer
@@ -526,3 +528,38 @@ TEST_F(EngineBufferTest, RatePermTest) {
     ControlObject::set(ConfigKey(m_sGroup1, "rate_perm_up_small"), 0);
     EXPECT_EQ(1.06, m_pChannel1->getEngineBuffer()->m_speed_old);
 }
+
+namespace {
+
+class EngineBufferBenchmark : public SignalPathTest {
+  public:
+    EngineBufferBenchmark()
+            : m_buffer(kProcessBufferSize) {
+        ControlObject::set(ConfigKey(m_sGroup1, "play"), 1.0);
+    }
+
+    void TestBody() override {
+    }
+
+    // Processes a single deck without the mixing in EngineMaster
+    void processDeck() {
+        EngineBuffer* pEngineBuffer = m_pChannel1->getEngineBuffer();
+        pEngineBuffer->process(m_buffer.data(), kProcessBufferSize);
+        pEngineBuffer->postProcess(kProcessBufferSize);
+        benchmark::DoNotOptimize(m_buffer.data());
+    }
+
+  private:
+    mixxx::SampleBuffer m_buffer;
+};
+
+} // namespace
+
+static void BM_EngineBufferProcess(benchmark::State& state) {
+    EngineBufferBenchmark fixture;
+    for (auto _ : state) {
+        fixture.processDeck();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_EngineBufferProcess);
@@ -0,0 +1,280 @@
+#include "engine/effects/engineeffectchain.h"
+
+#include <gtest/gtest.h>
+
+#include "effects/backends/builtin/echoeffect.h"
+#include "effects/backends/builtin/filtereffect.h"
+#include "effects/backends/builtin/metronomeeffect.h"
+#include "effects/backends/builtin/reverbeffect.h"
+#include "engine/engine.h"
+#include "test/engineeffectchaintest.h"
+#include "test/mixxxtest.h"
+#include "test/whitenoise.h"
+#include "util/sample.h"
+#include "util/samplebuffer.h"
+
+namespace {
+
+constexpr SINT kFramesPerBuffer = 1024;
+constexpr SINT kSamplesPerBuffer = kFramesPerBuffer * mixxx::kEngineChannelCount;
+constexpr SINT kBlockFrames = 64;
+constexpr unsigned int kSampleRate = 44100;
+
+class EngineEffectChainTest : public MixxxTest {
+  protected:
+    EngineEffectChainTest()
+            : m_context(1),
+              m_input(kSamplesPerBuffer),
+              m_wholeBufferInput(kSamplesPerBuffer),
+              m_wholeBufferOutput(kSamplesPerBuffer),
+              m_blockInput(kSamplesPerBuffer),
+              m_blockOutput(kSamplesPerBuffer) {
+    }
+
+    void configureFilterEchoReverb(EngineEffectChain* pChain) {
+        const QList<EngineEffect*> effects = m_context.effects(pChain);
+        ASSERT_EQ(3, effects.size());
+        m_context.setParameter(effects[0], QStringLiteral("lpf"), 2000);
+        // Short enough to get echoes within a few buffers
+        m_context.setParameter(effects[1], QStringLiteral("delay_time"), 0.125);
+        m_context.setParameter(effects[2], QStringLiteral("send_amount"), 0.5);
+    }
+
+    // Processes the same noise with both chains and expects the same output
+    void processAndCompare(EngineEffectChain* pWholeBufferChain,
+            EngineEffectChain* pBlockChain,
+            const GroupFeatureState& groupFeatures = GroupFeatureState()) {
+        const ChannelHandle deck = m_context.decks().first().handle();
+        const ChannelHandle master = m_context.master().handle();
+
+        fillNoise(m_input.data(), kSamplesPerBuffer, &m_seed);
+        SampleUtil::copy(m_wholeBufferInput.data(), m_input.data(), kSamplesPerBuffer);
+        SampleUtil::copy(m_blockInput.data(), m_input.data(), kSamplesPerBuffer);
+
+        EXPECT_TRUE(pWholeBufferChain->process(deck,
+                master,
+                m_wholeBufferInput.data(),
+                m_wholeBufferOutput.data(),
+                kSamplesPerBuffer,
+                kSampleRate,
+                groupFeatures,
+                false));
+        EXPECT_TRUE(pBlockChain->process(deck,
+                master,
+                m_blockInput.data(),
+                m_blockOutput.data(),
+                kSamplesPerBuffer,
+                kSampleRate,
+                groupFeatures,
+                false));
+
+        for (SINT i = 0; i < kSamplesPerBuffer; ++i) {
+            ASSERT_NEAR(m_wholeBufferOutput[i], m_blockOutput[i], 1e-5f) << "sample " << i;
+        }
+    }
+
+    void testBlockProcessingMatchesWholeBuffer(EffectChainMixMode::Type mixMode) {
+        const QStringList effectIds{
+                FilterEffect::getId(), EchoEffect::getId(), ReverbEffect::getId()};
+        EngineEffectChain* pWholeBufferChain = m_context.addChain(
+                QStringLiteral("[EffectRack1_EffectUnit1]"), effectIds, 0, mixMode, 0.5);
+        EngineEffectChain* pBlockChain = m_context.addChain(
+                QStringLiteral("[EffectRack1_EffectUnit2]"), effectIds, kBlockFrames, mixMode, 0.5);
+        configureFilterEchoReverb(pWholeBufferChain);
+        configureFilterEchoReverb(pBlockChain);
+
+        for (int callback = 0; callback < 16; ++callback) {
+            if (callback == 8) {
+                // The mix knob ramps across the next buffer
+                m_context.setChainParameters(pWholeBufferChain, mixMode, 1.0);
+                m_context.setChainParameters(pBlockChain, mixMode, 1.0);
+            }
+            SCOPED_TRACE(QStringLiteral("callback %1").arg(callback).toStdString());
+            processAndCompare(pWholeBufferChain, pBlockChain);
+        }
+    }
+
+    // Processes noise or silence and returns whether the chain wrote the output
+    bool process(EngineEffectChain* pChain, bool silent) {
+        if (silent) {
+            SampleUtil::clear(m_input.data(), kSamplesPerBuffer);
+        } else {
+            fillNoise(m_input.data(), kSamplesPerBuffer, &m_seed);
+        }
+        return pChain->process(m_context.decks().first().handle(),
+                m_context.master().handle(),
+                m_input.data(),
+                m_blockOutput.data(),
+                kSamplesPerBuffer,
+                kSampleRate,
+                GroupFeatureState(),
+                false);
+    }
+
+    EngineEffectChainTestContext m_context;
+    quint32 m_seed = 1;
+    mixxx::SampleBuffer m_input;
+    mixxx::SampleBuffer m_wholeBufferInput;
+    mixxx::SampleBuffer m_wholeBufferOutput;
+    mixxx::SampleBuffer m_blockInput;
+    mixxx::SampleBuffer m_blockOutput;
+};
+
+TEST_F(EngineEffectChainTest, BlockProcessingMatchesWholeBufferDrySlashWet) {
+    testBlockProcessingMatchesWholeBuffer(EffectChainMixMode::DrySlashWet);
+}
+
+TEST_F(EngineEffectChainTest, BlockProcessingMatchesWholeBufferDryPlusWet) {
+    testBlockProcessingMatchesWholeBuffer(EffectChainMixMode::DryPlusWet);
+}
+
+TEST_F(EngineEffectChainTest, ParameterChangeIsRampedAcrossWholeBuffer) {
+    constexpr qint64 kBlocksPerBuffer = kFramesPerBuffer / kBlockFrames;
+    const QStringList effectIds{
+            FilterEffect::getId(), EchoEffect::getId(), ReverbEffect::getId()};
+    EngineEffectChain* pWholeBufferChain = m_context.addChain(
+            QStringLiteral("[EffectRack1_EffectUnit1]"), effectIds, 0);
+    EngineEffectChain* pBlockChain = m_context.addChain(
+            QStringLiteral("[EffectRack1_EffectUnit2]"), effectIds, kBlockFrames);
+    configureFilterEchoReverb(pWholeBufferChain);
+    configureFilterEchoReverb(pBlockChain);
+    const EngineEffect* pBlockFilter = m_context.effects(pBlockChain).first();
+
+    for (int callback = 0; callback < 12; ++callback) {
+        if (callback % 4 == 2) {
+            // Every effect of the chain ramps to the new values
+            for (EngineEffectChain* pChain : {pWholeBufferChain, pBlockChain}) {
+                const QList<EngineEffect*> effects = m_context.effects(pChain);
+                m_context.setParameter(effects[0], QStringLiteral("lpf"), 500 * callback);
+                m_context.setParameter(effects[1], QStringLiteral("send_amount"), 0.1 * callback);
+                m_context.setParameter(effects[1], QStringLiteral("delay_time"), 0.05 * callback);
+                m_context.setParameter(effects[2], QStringLiteral("send_amount"), 0.1 * callback);
+            }
+        }
+        SCOPED_TRACE(QStringLiteral("callback %1").arg(callback).toStdString());
+        const qint64 processedBuffers = pBlockFilter->processedBuffers();
+        processAndCompare(pWholeBufferChain, pBlockChain);
+        // Only buffers without ramps are split into blocks
+        EXPECT_EQ(callback == 0 || callback % 4 == 2 ? 1 : kBlocksPerBuffer,
+                pBlockFilter->processedBuffers() - processedBuffers);
+    }
+}
+
+TEST_F(EngineEffectChainTest, BeatLengthChangeIsRampedAcrossWholeBuffer) {
+    const QStringList effectIds{EchoEffect::getId()};
+    EngineEffectChain* pWholeBufferChain = m_context.addChain(
+            QStringLiteral("[EffectRack1_EffectUnit1]"), effectIds, 0);
+    EngineEffectChain* pBlockChain = m_context.addChain(
+            QStringLiteral("[EffectRack1_EffectUnit2]"), effectIds, kBlockFrames);
+    for (EngineEffectChain* pChain : {pWholeBufferChain, pBlockChain}) {
+        // An eighth of a beat, which is about one buffer at 120 BPM
+        m_context.setParameter(m_context.effects(pChain).first(),
+                QStringLiteral("delay_time"),
+                0.125);
+    }
+
+    const EngineEffect* pBlockEcho = m_context.effects(pBlockChain).first();
+
+    GroupFeatureState groupFeatures;
+    groupFeatures.has_beat_length_sec = true;
+    for (int callback = 0; callback < 12; ++callback) {
+        // The tempo is changed every few buffers, like when moving the
+        // rate slider, which crossfades the delay time of the Echo
+        groupFeatures.beat_length_sec = 0.5 - 0.01 * (callback / 3);
+        SCOPED_TRACE(QStringLiteral("callback %1").arg(callback).toStdString());
+        const qint64 processedBuffers = pBlockEcho->processedBuffers();
+        processAndCompare(pWholeBufferChain, pBlockChain, groupFeatures);
+        EXPECT_EQ(callback % 3 == 0 ? 1 : kFramesPerBuffer / kBlockFrames,
+                pBlockEcho->processedBuffers() - processedBuffers);
+    }
+}
+
+TEST_F(EngineEffectChainTest, UnsupportedEffectFallsBackToWholeBuffer) {
+    // The metronome syncs to the beat once per buffer
+    const QStringList effectIds{FilterEffect::getId(), MetronomeEffect::getId()};
+    EngineEffectChain* pWholeBufferChain = m_context.addChain(
+            QStringLiteral("[EffectRack1_EffectUnit1]"), effectIds, 0);
+    EngineEffectChain* pBlockChain = m_context.addChain(
+            QStringLiteral("[EffectRack1_EffectUnit2]"), effectIds, kBlockFrames);
+
+    for (int callback = 0; callback < 4; ++callback) {
+        SCOPED_TRACE(QStringLiteral("callback %1").arg(callback).toStdString());
+        processAndCompare(pWholeBufferChain, pBlockChain);
+    }
+}
+
+TEST_F(EngineEffectChainTest, IdleChainIsSkipped) {
+    EngineEffectChain* pChain = m_context.addChain(
+            QStringLiteral("[EffectRack1_EffectUnit1]"), {FilterEffect::getId()}, 0);
+    EngineEffect* pEffect = m_context.effects(pChain).first();
+    m_context.setParameter(pEffect, QStringLiteral("lpf"), 2000);
+
+    EXPECT_TRUE(process(pChain, false));
+    EXPECT_TRUE(process(pChain, false));
+    EXPECT_EQ(2, pEffect->processedBuffers());
+    EXPECT_EQ(0, pEffect->skippedBuffers());
+
+    // The filter rings out for a few buffers after the input became silent
+    int silentBuffers = 0;
+    while (process(pChain, true)) {
+        ++silentBuffers;
+        ASSERT_GT(20, silentBuffers) << "The filter did not become idle";
+    }
+    EXPECT_LT(1, silentBuffers);
+    EXPECT_EQ(2 + silentBuffers, pEffect->processedBuffers());
+    EXPECT_EQ(1, pEffect->skippedBuffers());
+    EXPECT_FALSE(process(pChain, true));
+    EXPECT_EQ(2, pEffect->skippedBuffers());
+
+    // Audible input wakes up the effect
+    EXPECT_TRUE(process(pChain, false));
+    EXPECT_FALSE(SampleUtil::isSilent(m_blockOutput.data(), kSamplesPerBuffer));
+    EXPECT_EQ(3 + silentBuffers, pEffect->processedBuffers());
+    EXPECT_EQ(2, pEffect->skippedBuffers());
+}
+
+TEST_F(EngineEffectChainTest, ParameterChangeWakesIdleEffect) {
+    EngineEffectChain* pChain = m_context.addChain(
+            QStringLiteral("[EffectRack1_EffectUnit1]"), {FilterEffect::getId()}, 0);
+    EngineEffect* pEffect = m_context.effects(pChain).first();
+
+    EXPECT_TRUE(process(pChain, false));
+    for (int i = 0; i < 20 && process(pChain, true); ++i) {
+    }
+    ASSERT_FALSE(process(pChain, true));
+    const qint64 processedBuffers = pEffect->processedBuffers();
+
+    m_context.setParameter(pEffect, QStringLiteral("lpf"), 2000);
+    EXPECT_TRUE(process(pChain, true));
+    EXPECT_EQ(processedBuffers + 1, pEffect->processedBuffers());
+    EXPECT_TRUE(SampleUtil::isSilent(m_blockOutput.data(), kSamplesPerBuffer));
+    EXPECT_FALSE(process(pChain, true));
+    EXPECT_EQ(processedBuffers + 1, pEffect->processedBuffers());
+}
+
+TEST_F(EngineEffectChainTest, DryChainIsSkipped) {
+    EngineEffectChain* pChain = m_context.addChain(
+            QStringLiteral("[EffectRack1_EffectUnit1]"),
+            {FilterEffect::getId(), EchoEffect::getId()},
+            0);
+    const QList<EngineEffect*> effects = m_context.effects(pChain);
+
+    EXPECT_TRUE(process(pChain, false));
+    // The wet signal is faded out during the next buffer
+    m_context.setChainParameters(pChain, EffectChainMixMode::DrySlashWet, 0.0);
+    EXPECT_TRUE(process(pChain, false));
+    EXPECT_FALSE(process(pChain, false));
+    EXPECT_FALSE(process(pChain, false));
+    for (EngineEffect* pEffect : effects) {
+        EXPECT_EQ(2, pEffect->processedBuffers());
+        EXPECT_EQ(2, pEffect->skippedBuffers());
+    }
+
+    m_context.setChainParameters(pChain, EffectChainMixMode::DrySlashWet, 1.0);
+    EXPECT_TRUE(process(pChain, false));
+    for (EngineEffect* pEffect : effects) {
+        EXPECT_EQ(3, pEffect->processedBuffers());
+    }
+}
+
+} // namespace
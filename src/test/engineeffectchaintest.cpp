@@ -0,0 +1,157 @@
+#include "test/engineeffectchaintest.h"
+
+#include "util/assert.h"
+#include "util/messagepipe.h"
+
+namespace {
+
+constexpr int kPipeSize = 64;
+
+} // namespace
+
+EngineEffectChainTestContext::EngineEffectChainTestContext(int numDecks)
+        : m_master(m_channelHandleFactory.getOrCreateHandle(QStringLiteral("[Master]")),
+                  QStringLiteral("[Master]")),
+          m_pBackendManager(new EffectsBackendManager()) {
+    for (int i = 1; i <= numDecks; ++i) {
+        const QString group = QStringLiteral("[Channel%1]").arg(i);
+        const ChannelHandleAndGroup deck(m_channelHandleFactory.getOrCreateHandle(group), group);
+        m_decks.append(deck);
+        m_inputChannels.insert(deck);
+    }
+    m_outputChannels.insert(m_master);
+
+    const auto pipes = TwoWayMessagePipe<EffectsRequest*, EffectsResponse>::makeTwoWayMessagePipe(
+            kPipeSize, kPipeSize);
+    m_pRequestPipe.reset(pipes.first);
+    m_pResponsePipe.reset(pipes.second);
+
+    // The EngineEffectsManager takes ownership of its response pipe
+    const auto effectsManagerPipes =
+            TwoWayMessagePipe<EffectsRequest*, EffectsResponse>::makeTwoWayMessagePipe(
+                    kPipeSize, kPipeSize);
+    m_pEffectsManagerRequestPipe.reset(effectsManagerPipes.first);
+    m_pEffectsManager = std::make_unique<EngineEffectsManager>(effectsManagerPipes.second);
+}
+
+EngineEffectChainTestContext::~EngineEffectChainTestContext() {
+    // The chains refer to the effects
+    m_chains.clear();
+    m_effects.clear();
+}
+
+EngineEffectChain* EngineEffectChainTestContext::addChain(const QString& group,
+        const QStringList& effectIds,
+        SINT blockFrames,
+        EffectChainMixMode::Type mixMode,
+        double mix) {
+    auto pChain = std::make_unique<EngineEffectChain>(
+            group, m_inputChannels, m_outputChannels, blockFrames);
+    EngineEffectChain* pChainRaw = pChain.get();
+    m_chains.push_back(std::move(pChain));
+
+    EffectsRequest request;
+    request.type = EffectsRequest::ADD_EFFECT_CHAIN;
+    request.AddEffectChain.pChain = pChainRaw;
+    request.AddEffectChain.signalProcessingStage = SignalProcessingStage::Postfader;
+    processRequest(m_pEffectsManager.get(), &request);
+
+    request.pTargetChain = pChainRaw;
+    for (int i = 0; i < effectIds.size(); ++i) {
+        const EffectManifestPointer pManifest =
+                m_pBackendManager->getManifest(effectIds[i], EffectBackendType::BuiltIn);
+        VERIFY_OR_DEBUG_ASSERT(pManifest) {
+            continue;
+        }
+        auto pEffect = std::make_unique<EngineEffect>(pManifest,
+                m_pBackendManager,
+                m_inputChannels,
+                m_inputChannels,
+                m_outputChannels);
+        EngineEffect* pEffectRaw = pEffect.get();
+        m_effects.push_back(std::move(pEffect));
+        m_effectsByChain[pChainRaw].append(pEffectRaw);
+
+        request.type = EffectsRequest::ADD_EFFECT_TO_CHAIN;
+        request.AddEffectToChain.pEffect = pEffectRaw;
+        request.AddEffectToChain.iIndex = i;
+        processRequest(pChainRaw, &request);
+        setEffectEnabled(pEffectRaw, true);
+    }
+
+    setChainParameters(pChainRaw, mixMode, mix);
+
+    for (const auto& deck : qAsConst(m_decks)) {
+        request.type = EffectsRequest::ENABLE_EFFECT_CHAIN_FOR_INPUT_CHANNEL;
+        request.EnableInputChannelForChain.channelHandle = deck.handle();
+        processRequest(pChainRaw, &request);
+    }
+    return pChainRaw;
+}
+
+QList<EngineEffect*> EngineEffectChainTestContext::effects(EngineEffectChain* pChain) const {
+    return m_effectsByChain.value(pChain);
+}
+
+void EngineEffectChainTestContext::setChainParameters(EngineEffectChain* pChain,
+        EffectChainMixMode::Type mixMode,
+        double mix) {
+    EffectsRequest request;
+    request.type = EffectsRequest::SET_EFFECT_CHAIN_PARAMETERS;
+    request.pTargetChain = pChain;
+    request.SetEffectChainParameters.enabled = true;
+    request.SetEffectChainParameters.mix_mode = mixMode;
+    request.SetEffectChainParameters.mix = mix;
+    processRequest(pChain, &request);
+}
+
+void EngineEffectChainTestContext::setInputChannelEnabled(EngineEffectChain* pChain,
+        const ChannelHandleAndGroup& inputChannel,
+        bool enabled) {
+    EffectsRequest request;
+    request.pTargetChain = pChain;
+    if (enabled) {
+        request.type = EffectsRequest::ENABLE_EFFECT_CHAIN_FOR_INPUT_CHANNEL;
+        request.EnableInputChannelForChain.channelHandle = inputChannel.handle();
+    } else {
+        request.type = EffectsRequest::DISABLE_EFFECT_CHAIN_FOR_INPUT_CHANNEL;
+        request.DisableInputChannelForChain.channelHandle = inputChannel.handle();
+    }
+    processRequest(pChain, &request);
+}
+
+void EngineEffectChainTestContext::setEffectEnabled(EngineEffect* pEffect, bool enabled) {
+    EffectsRequest request;
+    request.type = EffectsRequest::SET_EFFECT_PARAMETERS;
+    request.pTargetEffect = pEffect;
+    request.SetEffectParameters.enabled = enabled;
+    processRequest(pEffect, &request);
+}
+
+void EngineEffectChainTestContext::setParameter(
+        EngineEffect* pEffect, const QString& parameterId, double value) {
+    const auto& parameters = pEffect->getManifest()->parameters();
+    for (int i = 0; i < parameters.size(); ++i) {
+        if (parameters[i]->id() == parameterId) {
+            EffectsRequest request;
+            request.type = EffectsRequest::SET_PARAMETER_PARAMETERS;
+            request.pTargetEffect = pEffect;
+            request.SetParameterParameters.iParameter = i;
+            request.value = value;
+            processRequest(pEffect, &request);
+            return;
+        }
+    }
+    DEBUG_ASSERT(!"Unknown effect parameter");
+}
+
+void EngineEffectChainTestContext::processRequest(
+        EffectsRequestHandler* pHandler, EffectsRequest* pRequest) {
+    const bool handled = pHandler->processEffectsRequest(*pRequest, m_pResponsePipe.get());
+    DEBUG_ASSERT(handled);
+    Q_UNUSED(handled);
+    // Discard the response
+    EffectsResponse response;
+    while (m_pRequestPipe->readMessage(&response)) {
+    }
+}
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <QHash>
+#include <QList>
+#include <QString>
+#include <QStringList>
+#include <memory>
+#include <vector>
+
+#include "effects/backends/effectsbackendmanager.h"
+#include "engine/channelhandle.h"
+#include "engine/effects/engineeffect.h"
+#include "engine/effects/engineeffectchain.h"
+#include "engine/effects/engineeffectsmanager.h"
+#include "engine/effects/message.h"
+#include "util/types.h"
+
+/// Sets up EngineEffectChains with built-in effects without the EffectsManager
+/// and the GUI thread counterparts of the chains. The EffectsRequests are
+/// handled immediately, like the EngineEffectsManager does at the start of
+/// a callback. The chains are also added as postfader chains to an
+/// EngineEffectsManager.
+class EngineEffectChainTestContext {
+  public:
+    explicit EngineEffectChainTestContext(int numDecks);
+    ~EngineEffectChainTestContext();
+
+    const QList<ChannelHandleAndGroup>& decks() const {
+        return m_decks;
+    }
+    const ChannelHandleAndGroup& master() const {
+        return m_master;
+    }
+
+    /// Creates an enabled chain with the given built-in effects that is
+    /// enabled for all decks. The chain and its effects are owned by
+    /// the context.
+    EngineEffectChain* addChain(const QString& group,
+            const QStringList& effectIds,
+            SINT blockFrames,
+            EffectChainMixMode::Type mixMode = EffectChainMixMode::DrySlashWet,
+            double mix = 1.0);
+    /// The effects of the chain in the order they are processed
+    QList<EngineEffect*> effects(EngineEffectChain* pChain) const;
+
+    /// Processes the postfader chains in the order they have been added
+    EngineEffectsManager* effectsManager() const {
+        return m_pEffectsManager.get();
+    }
+
+    void setChainParameters(EngineEffectChain* pChain,
+            EffectChainMixMode::Type mixMode,
+            double mix);
+    void setInputChannelEnabled(EngineEffectChain* pChain,
+            const ChannelHandleAndGroup& inputChannel,
+            bool enabled);
+    void setEffectEnabled(EngineEffect* pEffect, bool enabled);
+    void setParameter(EngineEffect* pEffect, const QString& parameterId, double value);
+
+  private:
+    void processRequest(EffectsRequestHandler* pHandler, EffectsRequest* pRequest);
+
+    ChannelHandleFactory m_channelHandleFactory;
+    QList<ChannelHandleAndGroup> m_decks;
+    ChannelHandleAndGroup m_master;
+    QSet<ChannelHandleAndGroup> m_inputChannels;
+    QSet<ChannelHandleAndGroup> m_outputChannels;
+    EffectsBackendManagerPointer m_pBackendManager;
+    std::unique_ptr<EffectsRequestPipe> m_pRequestPipe;
+    std::unique_ptr<EffectsResponsePipe> m_pResponsePipe;
+    std::unique_ptr<EffectsRequestPipe> m_pEffectsManagerRequestPipe;
+    std::unique_ptr<EngineEffectsManager> m_pEffectsManager;
+    std::vector<std::unique_ptr<EngineEffectChain>> m_chains;
+    std::vector<std::unique_ptr<EngineEffect>> m_effects;
+    QHash<EngineEffectChain*, QList<EngineEffect*>> m_effectsByChain;
+};
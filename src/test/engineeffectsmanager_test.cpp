@@ -0,0 +1,186 @@
+#include "engine/effects/engineeffectsmanager.h"
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "effects/backends/builtin/echoeffect.h"
+#include "effects/backends/builtin/filtereffect.h"
+#include "effects/backends/builtin/reverbeffect.h"
+#include "engine/engine.h"
+#include "engine/enginerealtimeworkerpool.h"
+#include "test/engineeffectchaintest.h"
+#include "test/mixxxtest.h"
+#include "test/whitenoise.h"
+#include "util/sample.h"
+#include "util/samplebuffer.h"
+
+namespace {
+
+constexpr int kNumDecks = 4;
+constexpr int kNumWorkers = 3;
+constexpr SINT kFramesPerBuffer = 1024;
+constexpr SINT kSamplesPerBuffer = kFramesPerBuffer * mixxx::kEngineChannelCount;
+constexpr unsigned int kSampleRate = 44100;
+
+// The decks of a mixer with their post-fader effects
+class PostFaderMixer {
+  public:
+    PostFaderMixer()
+            : m_context(kNumDecks) {
+        for (int i = 0; i < kNumDecks; ++i) {
+            m_buffers.emplace_back(kSamplesPerBuffer);
+        }
+    }
+
+    EngineEffectChainTestContext& context() {
+        return m_context;
+    }
+
+    // Adds a quick effect chain for each deck
+    void addDeckChains() {
+        const auto& decks = m_context.decks();
+        for (int i = 0; i < decks.size(); ++i) {
+            EngineEffectChain* pChain = m_context.addChain(
+                    QStringLiteral("[QuickEffectRack1_%1]").arg(decks[i].name()),
+                    {FilterEffect::getId(), EchoEffect::getId()},
+                    0);
+            for (int j = 0; j < decks.size(); ++j) {
+                if (j != i) {
+                    m_context.setInputChannelEnabled(pChain, decks[j], false);
+                }
+            }
+            const QList<EngineEffect*> effects = m_context.effects(pChain);
+            m_context.setParameter(effects[0], QStringLiteral("lpf"), 500.0 * (i + 1));
+            m_context.setParameter(effects[1], QStringLiteral("delay_time"), 0.125);
+        }
+    }
+
+    // Adds an effect unit that is only assigned to the first deck
+    void addFirstDeckChain() {
+        const auto& decks = m_context.decks();
+        EngineEffectChain* pChain = m_context.addChain(
+                QStringLiteral("[EffectRack1_EffectUnit1]"),
+                {ReverbEffect::getId()},
+                0,
+                EffectChainMixMode::DrySlashWet,
+                0.5);
+        for (int j = 1; j < decks.size(); ++j) {
+            m_context.setInputChannelEnabled(pChain, decks[j], false);
+        }
+    }
+
+    // Processes the post-fader effects of all decks with the fader gains
+    // ramping up during the first callback
+    void process(int callback,
+            const std::vector<mixxx::SampleBuffer>& inputs,
+            EngineRealtimeWorkerPool* pWorkerPool) {
+        const auto channels = makeChannels(callback, inputs);
+        m_context.effectsManager()->processPostFaderInPlace(channels.data(),
+                static_cast<int>(channels.size()),
+                m_context.master().handle(),
+                kSamplesPerBuffer,
+                kSampleRate,
+                pWorkerPool);
+    }
+
+    bool canProcessConcurrently() {
+        const auto channels = makeChannels(0, {});
+        return m_context.effectsManager()->canProcessPostFaderConcurrently(
+                channels.data(),
+                static_cast<int>(channels.size()),
+                m_context.master().handle());
+    }
+
+    const mixxx::SampleBuffer& buffer(int deck) const {
+        return m_buffers[deck];
+    }
+
+  private:
+    std::vector<EngineEffectsManager::PostFaderChannel> makeChannels(
+            int callback, const std::vector<mixxx::SampleBuffer>& inputs) {
+        std::vector<EngineEffectsManager::PostFaderChannel> channels;
+        for (int i = 0; i < kNumDecks; ++i) {
+            if (!inputs.empty()) {
+                SampleUtil::copy(m_buffers[i].data(), inputs[i].data(), kSamplesPerBuffer);
+            }
+            const CSAMPLE_GAIN gain = 0.25f * (i + 1);
+            channels.push_back(EngineEffectsManager::PostFaderChannel{
+                    m_context.decks()[i].handle(),
+                    m_buffers[i].data(),
+                    &m_features,
+                    callback == 0 ? CSAMPLE_GAIN_ZERO : gain,
+                    gain,
+                    false});
+        }
+        return channels;
+    }
+
+    EngineEffectChainTestContext m_context;
+    std::vector<mixxx::SampleBuffer> m_buffers;
+    GroupFeatureState m_features;
+};
+
+class EngineEffectsManagerTest : public MixxxTest {
+  protected:
+    EngineEffectsManagerTest()
+            : m_workerPool(kNumWorkers) {
+        for (int i = 0; i < kNumDecks; ++i) {
+            m_inputs.emplace_back(kSamplesPerBuffer);
+        }
+    }
+
+    // Processes the same noise serially and on the worker pool and expects
+    // bit identical output
+    void processAndCompare(PostFaderMixer* pSerial, PostFaderMixer* pParallel) {
+        for (int callback = 0; callback < 16; ++callback) {
+            SCOPED_TRACE(QStringLiteral("callback %1").arg(callback).toStdString());
+            for (auto& input : m_inputs) {
+                fillNoise(input.data(), kSamplesPerBuffer, &m_seed);
+            }
+            pSerial->process(callback, m_inputs, nullptr);
+            pParallel->process(callback, m_inputs, &m_workerPool);
+            for (int deck = 0; deck < kNumDecks; ++deck) {
+                for (SINT i = 0; i < kSamplesPerBuffer; ++i) {
+                    ASSERT_EQ(pSerial->buffer(deck)[i], pParallel->buffer(deck)[i])
+                            << "deck " << deck << " sample " << i;
+                }
+            }
+        }
+    }
+
+    EngineRealtimeWorkerPool m_workerPool;
+    std::vector<mixxx::SampleBuffer> m_inputs;
+    quint32 m_seed = 1;
+};
+
+TEST_F(EngineEffectsManagerTest, ParallelPostFaderMatchesSerial) {
+    PostFaderMixer serial;
+    PostFaderMixer parallel;
+    for (auto* pMixer : {&serial, &parallel}) {
+        pMixer->addFirstDeckChain();
+        pMixer->addDeckChains();
+    }
+    EXPECT_TRUE(parallel.canProcessConcurrently());
+
+    processAndCompare(&serial, &parallel);
+}
+
+TEST_F(EngineEffectsManagerTest, SharedChainIsProcessedSerially) {
+    PostFaderMixer serial;
+    PostFaderMixer parallel;
+    for (auto* pMixer : {&serial, &parallel}) {
+        pMixer->addDeckChains();
+        // Enabled for all decks
+        pMixer->context().addChain(QStringLiteral("[EffectRack1_EffectUnit1]"),
+                {ReverbEffect::getId()},
+                0,
+                EffectChainMixMode::DrySlashWet,
+                0.5);
+    }
+    EXPECT_FALSE(parallel.canProcessConcurrently());
+
+    processAndCompare(&serial, &parallel);
+}
+
+} // namespace
@@ -0,0 +1,244 @@
+#include "engine/filters/enginefilteriirbank.h"
+
+#include <benchmark/benchmark.h>
+#include <gtest/gtest.h>
+
+#include <type_traits>
+
+#include "engine/filters/enginefilterbessel4.h"
+#include "engine/filters/enginefilterbessel8.h"
+#include "engine/filters/enginefilterbiquad1.h"
+#include "engine/filters/enginefilterlinkwitzriley2.h"
+#include "engine/filters/enginefilterlinkwitzriley8.h"
+#include "test/whitenoise.h"
+#include "util/sample.h"
+#include "util/samplebuffer.h"
+
+namespace {
+
+constexpr int kSampleRate = 44100;
+constexpr SINT kSamplesPerBuffer = 1024 * 2;
+
+// Processes the fidlib coefficients of the filter with the generated
+// fidlib code, like EngineFilterIIR did before it used EngineFilterIIRBank
+template<class Filter>
+class FidlibFormFilter : public Filter {
+  public:
+    using Filter::Filter;
+
+    void processFidlibForm(const CSAMPLE* pIn, CSAMPLE* pOutput, SINT numSamples) {
+        for (SINT i = 0; i < numSamples; i += 2) {
+            pOutput[i] = static_cast<CSAMPLE>(
+                    Filter::processSample(this->m_coef, m_buf1, pIn[i]));
+            pOutput[i + 1] = static_cast<CSAMPLE>(
+                    Filter::processSample(this->m_coef, m_buf2, pIn[i + 1]));
+        }
+    }
+
+  private:
+    // fidlib keeps one state value per coefficient besides the gain
+    static constexpr std::size_t kBufferSize = std::extent_v<decltype(Filter::m_coef)> - 1;
+    double m_buf1[kBufferSize] = {};
+    double m_buf2[kBufferSize] = {};
+};
+
+class EngineFilterIIRBankTest : public testing::Test {
+  protected:
+    EngineFilterIIRBankTest()
+            : m_input(kSamplesPerBuffer),
+              m_output(kSamplesPerBuffer),
+              m_expected(kSamplesPerBuffer),
+              m_output2(kSamplesPerBuffer),
+              m_expected2(kSamplesPerBuffer) {
+    }
+
+    template<class Filter>
+    void expectFidlibForm(FidlibFormFilter<Filter>* pFilter) {
+        pFilter->assumeSettled();
+        for (int buffer = 0; buffer < 8; ++buffer) {
+            fillNoise(m_input.data(), kSamplesPerBuffer, &m_seed);
+            pFilter->process(m_input.data(), m_output.data(), kSamplesPerBuffer);
+            pFilter->processFidlibForm(m_input.data(), m_expected.data(), kSamplesPerBuffer);
+            for (SINT i = 0; i < kSamplesPerBuffer; ++i) {
+                ASSERT_NEAR(m_expected[i], m_output[i], 1e-5f)
+                        << "buffer " << buffer << " sample " << i;
+            }
+        }
+    }
+
+    quint32 m_seed = 1;
+    mixxx::SampleBuffer m_input;
+    mixxx::SampleBuffer m_output;
+    mixxx::SampleBuffer m_expected;
+    mixxx::SampleBuffer m_output2;
+    mixxx::SampleBuffer m_expected2;
+};
+
+TEST_F(EngineFilterIIRBankTest, SecondOrderSectionsMatchFidlibForm) {
+    FidlibFormFilter<EngineFilterBessel4Low> bessel4Low(kSampleRate, 250);
+    expectFidlibForm(&bessel4Low);
+    FidlibFormFilter<EngineFilterBessel8High> bessel8High(kSampleRate, 2500);
+    expectFidlibForm(&bessel8High);
+    FidlibFormFilter<EngineFilterBessel8Band> bessel8Band(kSampleRate, 250, 2500);
+    expectFidlibForm(&bessel8Band);
+    FidlibFormFilter<EngineFilterLinkwitzRiley8Low> linkwitzRiley8Low(kSampleRate, 250);
+    expectFidlibForm(&linkwitzRiley8Low);
+    FidlibFormFilter<EngineFilterBiquad1Band> biquadBand(kSampleRate, 1000, 1.75);
+    expectFidlibForm(&biquadBand);
+}
+
+TEST_F(EngineFilterIIRBankTest, FirstOrderSectionsMatchFidlibForm) {
+    FidlibFormFilter<EngineFilterLinkwitzRiley2Low> linkwitzRiley2Low(kSampleRate, 250);
+    expectFidlibForm(&linkwitzRiley2Low);
+    FidlibFormFilter<EngineFilterLinkwitzRiley2High> linkwitzRiley2High(kSampleRate, 2500);
+    expectFidlibForm(&linkwitzRiley2High);
+}
+
+TEST_F(EngineFilterIIRBankTest, ShelvingAndPeakingMatchFidlibForm) {
+    FidlibFormFilter<EngineFilterBiquad1LowShelving> lowShelving(kSampleRate, 250, 0.4);
+    lowShelving.setFrequencyCorners(kSampleRate, 250, 0.4, -12.0);
+    expectFidlibForm(&lowShelving);
+    FidlibFormFilter<EngineFilterBiquad1Peaking> peaking(kSampleRate, 1000, 1.75);
+    peaking.setFrequencyCorners(kSampleRate, 1000, 1.75, 6.0);
+    expectFidlibForm(&peaking);
+    FidlibFormFilter<EngineFilterBiquad1HighShelving> highShelving(kSampleRate, 2500, 0.4);
+    highShelving.setFrequencyCorners(kSampleRate, 2500, 0.4, 3.0);
+    expectFidlibForm(&highShelving);
+}
+
+TEST_F(EngineFilterIIRBankTest, PairMatchesSingleFilters) {
+    EngineFilterLinkwitzRiley8Low low(kSampleRate, 250);
+    EngineFilterLinkwitzRiley8High high(kSampleRate, 250);
+    EngineFilterLinkwitzRiley8Low pairedLow(kSampleRate, 250);
+    EngineFilterLinkwitzRiley8High pairedHigh(kSampleRate, 250);
+
+    for (int buffer = 0; buffer < 8; ++buffer) {
+        if (buffer == 4) {
+            // The pair falls back to the single filters while they are ramping
+            low.setFrequencyCorners(kSampleRate, 500);
+            pairedLow.setFrequencyCorners(kSampleRate, 500);
+        }
+        fillNoise(m_input.data(), kSamplesPerBuffer, &m_seed);
+        low.process(m_input.data(), m_expected.data(), kSamplesPerBuffer);
+        high.process(m_input.data(), m_expected2.data(), kSamplesPerBuffer);
+        pairedLow.processPair(m_input.data(),
+                m_output.data(),
+                &pairedHigh,
+                m_input.data(),
+                m_output2.data(),
+                kSamplesPerBuffer);
+        for (SINT i = 0; i < kSamplesPerBuffer; ++i) {
+            ASSERT_NEAR(m_expected[i], m_output[i], 1e-6f)
+                    << "buffer " << buffer << " sample " << i;
+            ASSERT_NEAR(m_expected2[i], m_output2[i], 1e-6f)
+                    << "buffer " << buffer << " sample " << i;
+        }
+    }
+}
+
+TEST_F(EngineFilterIIRBankTest, PairProcessesInPlace) {
+    EngineFilterBessel4Low low(kSampleRate, 250);
+    EngineFilterBessel4Low band(kSampleRate, 2500);
+    EngineFilterBessel4Low pairedLow(kSampleRate, 250);
+    EngineFilterBessel4Low pairedBand(kSampleRate, 2500);
+    for (auto* pFilter : {&low, &band, &pairedLow, &pairedBand}) {
+        pFilter->assumeSettled();
+    }
+
+    for (int buffer = 0; buffer < 4; ++buffer) {
+        fillNoise(m_input.data(), kSamplesPerBuffer, &m_seed);
+        low.process(m_input.data(), m_expected.data(), kSamplesPerBuffer);
+        band.process(m_input.data(), m_expected2.data(), kSamplesPerBuffer);
+        // Like the LV-Mix EQ, one of the filters runs in place
+        SampleUtil::copy(m_output2.data(), m_input.data(), kSamplesPerBuffer);
+        pairedBand.processPair(m_output2.data(),
+                m_output2.data(),
+                &pairedLow,
+                m_input.data(),
+                m_output.data(),
+                kSamplesPerBuffer);
+        for (SINT i = 0; i < kSamplesPerBuffer; ++i) {
+            ASSERT_NEAR(m_expected[i], m_output[i], 1e-6f)
+                    << "buffer " << buffer << " sample " << i;
+            ASSERT_NEAR(m_expected2[i], m_output2[i], 1e-6f)
+                    << "buffer " << buffer << " sample " << i;
+        }
+    }
+}
+
+// An 8th order low pass of both channels with the generated fidlib code
+static void BM_EngineFilterIIR_FidlibForm(benchmark::State& state) {
+    const SINT numSamples = state.range(0) * 2;
+    FidlibFormFilter<EngineFilterLinkwitzRiley8Low> filter(kSampleRate, 250);
+    mixxx::SampleBuffer input(numSamples);
+    mixxx::SampleBuffer output(numSamples);
+    quint32 seed = 1;
+    fillNoise(input.data(), numSamples, &seed);
+    for (auto _ : state) {
+        filter.processFidlibForm(input.data(), output.data(), numSamples);
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(BM_EngineFilterIIR_FidlibForm)->Range(64, 4096);
+
+// The same filter with an EngineFilterIIRBank
+static void BM_EngineFilterIIR_Bank(benchmark::State& state) {
+    const SINT numSamples = state.range(0) * 2;
+    EngineFilterLinkwitzRiley8Low filter(kSampleRate, 250);
+    filter.assumeSettled();
+    mixxx::SampleBuffer input(numSamples);
+    mixxx::SampleBuffer output(numSamples);
+    quint32 seed = 1;
+    fillNoise(input.data(), numSamples, &seed);
+    for (auto _ : state) {
+        filter.process(input.data(), output.data(), numSamples);
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(BM_EngineFilterIIR_Bank)->Range(64, 4096);
+
+// The low and high pass of a crossover, one after the other
+static void BM_EngineFilterIIR_Crossover(benchmark::State& state) {
+    const SINT numSamples = state.range(0) * 2;
+    EngineFilterLinkwitzRiley8Low low(kSampleRate, 250);
+    EngineFilterLinkwitzRiley8High high(kSampleRate, 250);
+    low.assumeSettled();
+    high.assumeSettled();
+    mixxx::SampleBuffer input(numSamples);
+    mixxx::SampleBuffer lowOutput(numSamples);
+    mixxx::SampleBuffer highOutput(numSamples);
+    quint32 seed = 1;
+    fillNoise(input.data(), numSamples, &seed);
+    for (auto _ : state) {
+        low.process(input.data(), lowOutput.data(), numSamples);
+        high.process(input.data(), highOutput.data(), numSamples);
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(BM_EngineFilterIIR_Crossover)->Range(64, 4096);
+
+// The low and high pass of a crossover in one pass
+static void BM_EngineFilterIIR_CrossoverPair(benchmark::State& state) {
+    const SINT numSamples = state.range(0) * 2;
+    EngineFilterLinkwitzRiley8Low low(kSampleRate, 250);
+    EngineFilterLinkwitzRiley8High high(kSampleRate, 250);
+    low.assumeSettled();
+    high.assumeSettled();
+    mixxx::SampleBuffer input(numSamples);
+    mixxx::SampleBuffer lowOutput(numSamples);
+    mixxx::SampleBuffer highOutput(numSamples);
+    quint32 seed = 1;
+    fillNoise(input.data(), numSamples, &seed);
+    for (auto _ : state) {
+        low.processPair(input.data(),
+                lowOutput.data(),
+                &high,
+                input.data(),
+                highOutput.data(),
+                numSamples);
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(BM_EngineFilterIIR_CrossoverPair)->Range(64, 4096);
+
+} // namespace
@@ -0,0 +1,150 @@
+#include "engine/enginerealtimeworkerpool.h"
+
+#include <benchmark/benchmark.h>
+#include <gtest/gtest.h>
+
+#include <QThread>
+#include <atomic>
+#include <vector>
+
+#include "util/sample.h"
+#include "util/types.h"
+
+namespace {
+
+struct CountingContext {
+    std::vector<std::atomic<int>> counts;
+
+    explicit CountingContext(int size)
+            : counts(size) {
+    }
+};
+
+void countingTask(void* pContext, int index) {
+    static_cast<CountingContext*>(pContext)->counts[index].fetch_add(1);
+}
+
+class EngineRealtimeWorkerPoolTest : public testing::Test {
+  protected:
+    const std::vector<int> m_numWorkers = {0, 1, 3};
+};
+
+TEST_F(EngineRealtimeWorkerPoolTest, RunsEachIndexExactlyOnce) {
+    constexpr int kMaxCount = 64;
+    for (const int numWorkers : m_numWorkers) {
+        EngineRealtimeWorkerPool pool(numWorkers);
+        EXPECT_EQ(numWorkers, pool.numWorkers());
+
+        CountingContext context(kMaxCount);
+        for (int i = 0; i < 1000; ++i) {
+            const int count = 1 + i % kMaxCount;
+            for (auto& value : context.counts) {
+                value.store(0);
+            }
+            pool.run(&countingTask, &context, count);
+            for (int j = 0; j < kMaxCount; ++j) {
+                ASSERT_EQ(j < count ? 1 : 0, context.counts[j].load())
+                        << numWorkers << " workers, run " << i << ", index " << j;
+            }
+        }
+    }
+}
+
+TEST_F(EngineRealtimeWorkerPoolTest, EmptyRun) {
+    for (const int numWorkers : m_numWorkers) {
+        EngineRealtimeWorkerPool pool(numWorkers);
+        CountingContext context(1);
+        pool.run(&countingTask, &context, 0);
+        EXPECT_EQ(0, context.counts[0].load());
+    }
+}
+
+struct DelayedContext {
+    CountingContext counting;
+    Qt::HANDLE callerThreadId;
+
+    explicit DelayedContext(int size)
+            : counting(size),
+              callerThreadId(QThread::currentThreadId()) {
+    }
+};
+
+// Delays the items processed by the workers beyond the spinning time of
+// the caller at the barrier
+void delayedWorkerTask(void* pContext, int index) {
+    auto* pDelayedContext = static_cast<DelayedContext*>(pContext);
+    if (QThread::currentThreadId() != pDelayedContext->callerThreadId) {
+        QThread::msleep(5);
+    }
+    countingTask(&pDelayedContext->counting, index);
+}
+
+TEST_F(EngineRealtimeWorkerPoolTest, WaitsForDelayedWorkers) {
+    constexpr int kCount = 8;
+    for (const int numWorkers : m_numWorkers) {
+        EngineRealtimeWorkerPool pool(numWorkers);
+        DelayedContext context(kCount);
+        for (int i = 0; i < 20; ++i) {
+            for (auto& value : context.counting.counts) {
+                value.store(0);
+            }
+            pool.run(&delayedWorkerTask, &context, kCount);
+            for (int j = 0; j < kCount; ++j) {
+                ASSERT_EQ(1, context.counting.counts[j].load())
+                        << numWorkers << " workers, run " << i << ", index " << j;
+            }
+        }
+    }
+}
+
+// Emulates the processing of a deck (resampling, EQ, ...) with a cascade
+// of one-pole filters over the channel buffer.
+struct ChannelProcessingContext {
+    std::vector<CSAMPLE*> buffers;
+    SINT bufferSize;
+};
+
+void simulateChannelProcessing(void* pContext, int index) {
+    auto* pChannelContext = static_cast<ChannelProcessingContext*>(pContext);
+    CSAMPLE* pBuffer = pChannelContext->buffers[index];
+    for (int pass = 0; pass < 32; ++pass) {
+        CSAMPLE stateLeft = 0;
+        CSAMPLE stateRight = 0;
+        for (SINT i = 0; i < pChannelContext->bufferSize; i += 2) {
+            stateLeft += 0.1f * (pBuffer[i] - stateLeft);
+            stateRight += 0.1f * (pBuffer[i + 1] - stateRight);
+            pBuffer[i] = stateLeft;
+            pBuffer[i + 1] = stateRight;
+        }
+    }
+}
+
+// Callback time for processing state.range(0) channels with
+// state.range(1) additional workers at a 64 frame buffer.
+static void BM_ProcessChannels(benchmark::State& state) {
+    const int numChannels = static_cast<int>(state.range(0));
+    const int numWorkers = static_cast<int>(state.range(1));
+    constexpr SINT kBufferSize = 64 * 2;
+
+    ChannelProcessingContext context;
+    context.bufferSize = kBufferSize;
+    for (int i = 0; i < numChannels; ++i) {
+        CSAMPLE* pBuffer = SampleUtil::alloc(kBufferSize);
+        SampleUtil::fill(pBuffer, 0.5f, kBufferSize);
+        context.buffers.push_back(pBuffer);
+    }
+    EngineRealtimeWorkerPool pool(numWorkers);
+
+    for (auto _ : state) {
+        pool.run(&simulateChannelProcessing, &context, numChannels);
+    }
+
+    for (CSAMPLE* pBuffer : context.buffers) {
+        SampleUtil::free(pBuffer);
+    }
+}
+BENCHMARK(BM_ProcessChannels)
+        ->ArgsProduct({{1, 2, 4, 8, 12, 16}, {0, 1, 3}})
+        ->UseRealTime();
+
+} // namespace
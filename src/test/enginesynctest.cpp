@@ -3021,3 +3021,33 @@ TEST_F(EngineSyncTest, ImplicitLeaderToInternalClock) {
     ASSERT_FALSE(isSoftLeader(m_sGroup2));
     ASSERT_FALSE(isSoftLeader(m_sInternalClockGroup));
 }
+
+TEST_F(EngineSyncTest, PrepareConcurrentProcessAppliesSyncRequests) {
+    mixxx::BeatsPointer pBeats1 = mixxx::Beats::fromConstTempo(
+            m_pTrack1->getSampleRate(), mixxx::audio::kStartFramePos, mixxx::Bpm(130));
+    m_pTrack1->trySetBeats(pBeats1);
+    mixxx::BeatsPointer pBeats2 = mixxx::Beats::fromConstTempo(
+            m_pTrack2->getSampleRate(), mixxx::audio::kStartFramePos, mixxx::Bpm(100));
+    m_pTrack2->trySetBeats(pBeats2);
+    ControlObject::set(ConfigKey(m_sGroup1, "play"), 1.0);
+    ControlObject::set(ConfigKey(m_sGroup2, "play"), 1.0);
+    ProcessBuffer();
+
+    // The request is queued while playing
+    auto pButtonSyncEnabled1 =
+            std::make_unique<ControlProxy>(m_sGroup1, "sync_enabled");
+    pButtonSyncEnabled1->set(1.0);
+    EXPECT_FALSE(isSoftLeader(m_sGroup1));
+
+    // Synchronized channels must be processed serially
+    EXPECT_FALSE(m_pChannel1->getEngineBuffer()->prepareConcurrentProcess());
+    EXPECT_TRUE(isSoftLeader(m_sGroup1));
+    EXPECT_TRUE(m_pChannel2->getEngineBuffer()->prepareConcurrentProcess());
+    ProcessBuffer();
+
+    // Processing has reset the prepared state
+    EXPECT_FALSE(m_pChannel1->getEngineBuffer()->prepareConcurrentProcess());
+    EXPECT_TRUE(m_pChannel2->getEngineBuffer()->prepareConcurrentProcess());
+    ProcessBuffer();
+    EXPECT_TRUE(isSoftLeader(m_sGroup1));
+}
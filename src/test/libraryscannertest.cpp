@@ -1,15 +1,108 @@
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
 
+#include <QSemaphore>
+#include <QSqlQuery>
+#include <QTemporaryDir>
+#include <thread>
+
 #include "test/librarytest.h"
 
+#include "library/dao/trackschema.h"
+#include "library/queryutil.h"
 #include "library/scanner/libraryscanner.h"
+#include "util/performancetimer.h"
+
+namespace {
+
+constexpr int kTimeoutMillis = 10000;
+
+const QStringList kTrackFileNames = {
+        QStringLiteral("artist.mp3"),
+        QStringLiteral("TOAL_TPE2.mp3"),
+        QStringLiteral("cover-test-jpg.mp3"),
+        QStringLiteral("cover-test-png.mp3"),
+};
+
+} // namespace
 
 class LibraryScannerTest : public LibraryTest {
   protected:
     LibraryScannerTest()
             : m_libraryScanner(dbConnectionPooler(), config()) {
     }
+
+    /// Creates a library directory with subdirectories that are
+    /// scanned by separate tasks and returns its path
+    QString createLibraryDirectory(const QString& name, int numSubdirectories) {
+        const QDir testDataDir(getTestDir().filePath(QStringLiteral("id3-test-data")));
+        QDir dir(m_tempDir.path());
+        EXPECT_TRUE(dir.mkdir(name));
+        EXPECT_TRUE(dir.cd(name));
+        for (int i = 0; i < numSubdirectories; ++i) {
+            const QString subdirName = QStringLiteral("dir%1").arg(i);
+            EXPECT_TRUE(dir.mkdir(subdirName));
+            for (const auto& fileName : kTrackFileNames) {
+                EXPECT_TRUE(QFile::copy(testDataDir.filePath(fileName),
+                        dir.filePath(subdirName + QChar('/') + fileName)));
+            }
+        }
+        EXPECT_TRUE(internalCollection()->addDirectory(mixxx::FileInfo(dir.path())));
+        return dir.path();
+    }
+
+    /// Returns true if the scan has finished within the timeout
+    bool scanAndWait() {
+        QSemaphore finished;
+        const auto connection = QObject::connect(&m_libraryScanner,
+                &LibraryScanner::scanFinished,
+                [&finished]() { finished.release(); });
+        m_libraryScanner.scan();
+        const bool result = finished.tryAcquire(1, kTimeoutMillis);
+        QObject::disconnect(connection);
+        return result;
+    }
+
+    /// Returns the properties of all tracks in the directory that are
+    /// imported from the files, with the locations relative to the directory
+    QStringList queryTracksInDirectory(const QString& dirPath) {
+        const QStringList columns = {
+                QStringLiteral("track_locations.") + TRACKLOCATIONSTABLE_LOCATION,
+                LIBRARYTABLE_ARTIST,
+                LIBRARYTABLE_TITLE,
+                LIBRARYTABLE_ALBUM,
+                LIBRARYTABLE_ALBUMARTIST,
+                LIBRARYTABLE_DURATION,
+                LIBRARYTABLE_SAMPLERATE,
+                LIBRARYTABLE_CHANNELS,
+                LIBRARYTABLE_BITRATE,
+                LIBRARYTABLE_COVERART_DIGEST,
+        };
+        QSqlQuery query(dbConnection());
+        query.prepare(QStringLiteral(
+                "SELECT %1 FROM library "
+                "INNER JOIN track_locations ON library.location=track_locations.id "
+                "WHERE track_locations.location LIKE :prefix "
+                "ORDER BY track_locations.location")
+                              .arg(columns.join(QChar(','))));
+        query.bindValue(":prefix", dirPath + QStringLiteral("/%"));
+        if (!query.exec()) {
+            LOG_FAILED_QUERY(query);
+            return {};
+        }
+        QStringList tracks;
+        while (query.next()) {
+            QStringList values;
+            values.append(query.value(0).toString().mid(dirPath.size()));
+            for (int i = 1; i < columns.size(); ++i) {
+                values.append(query.value(i).toString());
+            }
+            tracks.append(values.join(QChar('|')));
+        }
+        return tracks;
+    }
+
+    QTemporaryDir m_tempDir;
     LibraryScanner m_libraryScanner;
 };
 
@@ -52,3 +145,79 @@ TEST_F(LibraryScannerTest, ScannerRoundtrip) {
     m_libraryScanner.changeScannerState(LibraryScanner::IDLE);
     EXPECT_EQ(m_libraryScanner.m_state, LibraryScanner::IDLE);
 }
+
+TEST_F(LibraryScannerTest, ParallelScanMatchesSerialScan) {
+    ASSERT_TRUE(m_tempDir.isValid());
+    m_libraryScanner.start();
+
+    const QString serialDirPath = createLibraryDirectory(QStringLiteral("serial"), 4);
+    m_libraryScanner.m_pool.setMaxThreadCount(1);
+    ASSERT_TRUE(scanAndWait());
+
+    // The tracks of the unchanged directory are not scanned again
+    const QString parallelDirPath = createLibraryDirectory(QStringLiteral("parallel"), 4);
+    m_libraryScanner.m_pool.setMaxThreadCount(4);
+    ASSERT_TRUE(scanAndWait());
+
+    const QStringList serialTracks = queryTracksInDirectory(serialDirPath);
+    EXPECT_EQ(4 * kTrackFileNames.size(), serialTracks.size());
+    EXPECT_EQ(serialTracks, queryTracksInDirectory(parallelDirPath));
+}
+
+TEST_F(LibraryScannerTest, CancelWhileWaitingForPendingNewTracks) {
+    ASSERT_TRUE(m_tempDir.isValid());
+    // More new tracks than may be pending
+    const int numSubdirectories =
+            ScannerGlobal::kMaxPendingNewTracks / kTrackFileNames.size() + 2;
+    createLibraryDirectory(QStringLiteral("library"), numSubdirectories);
+    m_libraryScanner.m_pool.setMaxThreadCount(2);
+    m_libraryScanner.start();
+
+    // Block the scanner thread after the scan has been started, so that
+    // the parsed tracks are never added and the workers have to wait
+    QSemaphore scannerBlocked;
+    QSemaphore resumeScanner;
+    QSemaphore finished;
+    ScannerGlobalPointer pScannerGlobal;
+    const auto connection = QObject::connect(&m_libraryScanner,
+            &LibraryScanner::scanFinished,
+            [&finished]() { finished.release(); });
+    m_libraryScanner.scan();
+    QMetaObject::invokeMethod(
+            &m_libraryScanner,
+            [this, &pScannerGlobal, &scannerBlocked, &resumeScanner]() {
+                pScannerGlobal = m_libraryScanner.m_scannerGlobal;
+                scannerBlocked.release();
+                resumeScanner.acquire();
+            },
+            Qt::QueuedConnection);
+    ASSERT_TRUE(scannerBlocked.tryAcquire(1, kTimeoutMillis));
+    if (!pScannerGlobal) {
+        resumeScanner.release();
+        FAIL() << "No scan in progress";
+    }
+
+    PerformanceTimer timer;
+    timer.start();
+    while (pScannerGlobal->numParsedNewTracks() < ScannerGlobal::kMaxPendingNewTracks &&
+            timer.elapsed() < mixxx::Duration::fromMillis(kTimeoutMillis)) {
+        QThread::msleep(10);
+    }
+    // The workers don't parse more tracks until the pending tracks are added
+    QThread::msleep(200);
+    EXPECT_EQ(ScannerGlobal::kMaxPendingNewTracks, pScannerGlobal->numParsedNewTracks());
+
+    QSemaphore cancelled;
+    std::thread cancelThread([this, &cancelled]() {
+        m_libraryScanner.slotCancel();
+        cancelled.release();
+    });
+    EXPECT_TRUE(cancelled.tryAcquire(1, kTimeoutMillis));
+    EXPECT_TRUE(pScannerGlobal->shouldCancel());
+
+    resumeScanner.release();
+    cancelThread.join();
+    // The cancelled scan finishes when the scanner thread resumes
+    EXPECT_TRUE(finished.tryAcquire(1, kTimeoutMillis));
+    QObject::disconnect(connection);
+}
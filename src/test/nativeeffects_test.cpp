@@ -1,85 +1,75 @@
-#if 0
-// TODO: make this work again
 #include <benchmark/benchmark.h>
-#include <gtest/gtest.h>
+
+#include <vector>
 
 #include "control/controlpotmeter.h"
-#include "effects/builtin/autopaneffect.h"
-#include "effects/builtin/bessel4lvmixeqeffect.h"
-#include "effects/builtin/bessel8lvmixeqeffect.h"
-#include "effects/builtin/bitcrushereffect.h"
-#include "effects/builtin/echoeffect.h"
-#include "effects/builtin/filtereffect.h"
-#include "effects/builtin/flangereffect.h"
-#include "effects/builtin/graphiceqeffect.h"
-#include "effects/builtin/linkwitzriley8eqeffect.h"
-#include "effects/builtin/moogladder4filtereffect.h"
-#include "effects/builtin/phasereffect.h"
-#include "effects/builtin/reverbeffect.h"
-#include "engine/channelhandle.h"
+#include "effects/backends/builtin/autopaneffect.h"
+#include "effects/backends/builtin/bessel4lvmixeqeffect.h"
+#include "effects/backends/builtin/bessel8lvmixeqeffect.h"
+#include "effects/backends/builtin/bitcrushereffect.h"
+#include "effects/backends/builtin/echoeffect.h"
+#include "effects/backends/builtin/filtereffect.h"
+#include "effects/backends/builtin/flangereffect.h"
+#include "effects/backends/builtin/graphiceqeffect.h"
+#include "effects/backends/builtin/linkwitzriley8eqeffect.h"
+#include "effects/backends/builtin/moogladder4filtereffect.h"
+#include "effects/backends/builtin/phasereffect.h"
+#include "effects/backends/builtin/reverbeffect.h"
 #include "engine/effects/groupfeaturestate.h"
-#include "test/baseeffecttest.h"
+#include "engine/engine.h"
+#include "test/engineeffectchaintest.h"
+#include "util/sample.h"
 #include "util/samplebuffer.h"
 
 namespace {
 
-class EffectsBenchmarkTest : public BaseEffectTest {
-  protected:
-    void SetUp() override {
-        registerTestBackend();
-    }
-};
-
-template <class EffectType>
-void benchmarkBuiltInEffectDefaultParameters(const mixxx::EngineParameters& engineParameters,
-                                            benchmark::State* pState, EffectsManager* pEffectsManager) {
-    EffectManifestPointer pManifest = EffectType::getManifest();
-
-    ChannelHandleFactory factory;
-    QSet<ChannelHandleAndGroup> activeInputChannels;
-
-    QString channel1_group = QString("[Channel1]");
-    ChannelHandle channel1 = factory.getOrCreateHandle(channel1_group);
-    ChannelHandleAndGroup handle_and_group(channel1, channel1_group);
-    pEffectsManager->registerInputChannel(handle_and_group);
-    pEffectsManager->registerOutputChannel(handle_and_group);
-    activeInputChannels.insert(handle_and_group);
-    EffectInstantiatorPointer pInstantiator = EffectInstantiatorPointer(
-        new EffectProcessorInstantiator<EffectType>());
-    EngineEffect effect(pManifest, activeInputChannels, pEffectsManager, pInstantiator);
-
-    GroupFeatureState featureState;
-    EffectEnableState enableState = EffectEnableState::Enabled;
-
-    mixxx::SampleBuffer input(engineParameters.samplesPerBuffer());
-    mixxx::SampleBuffer output(engineParameters.samplesPerBuffer());
-
-    while (pState->KeepRunning()) {
-        effect.process(channel1, channel1, input.data(), output.data(),
-                       engineParameters.samplesPerBuffer(),
-                       engineParameters.sampleRate(),
-                       enableState, featureState);
+constexpr unsigned int kSampleRate = 44100;
+
+template<class EffectType>
+void benchmarkBuiltInEffectDefaultParameters(benchmark::State& state) {
+    ControlPotmeter loEqFrequency(
+            ConfigKey("[Mixer Profile]", "LoEQFrequency"), 0., 22040);
+    loEqFrequency.setDefaultValue(250.0);
+    ControlPotmeter hiEqFrequency(
+            ConfigKey("[Mixer Profile]", "HiEQFrequency"), 0., 22040);
+    hiEqFrequency.setDefaultValue(2500.0);
+
+    EngineEffectChainTestContext context(1);
+    EngineEffectChain* pChain = context.addChain(
+            QStringLiteral("[EffectRack1_EffectUnit1]"), {EffectType::getId()}, 0);
+    EngineEffect* pEffect = context.effects(pChain).first();
+    const ChannelHandle deck = context.decks().first().handle();
+    const ChannelHandle master = context.master().handle();
+    const GroupFeatureState featureState;
+
+    const SINT numSamples = state.range(0) * mixxx::kEngineChannelCount;
+    mixxx::SampleBuffer input(numSamples);
+    mixxx::SampleBuffer output(numSamples);
+    SampleUtil::fill(input.data(), 0.5f, numSamples);
+
+    for (auto _ : state) {
+        pEffect->process(deck,
+                master,
+                input.data(),
+                output.data(),
+                numSamples,
+                kSampleRate,
+                EffectEnableState::Enabled,
+                featureState);
     }
 }
 
-#define FOR_COMMON_BUFFER_SIZES(bm) bm->Arg(32)->Arg(64)->Arg(128)->Arg(256)->Arg(512)->Arg(1024)->Arg(2048)->Arg(4096);
-
-#define DECLARE_EFFECT_BENCHMARK(EffectName)                                         \
-    TEST_F(EffectsBenchmarkTest, BM_BuiltInEffects_DefaultParameters_##EffectName) { \
-        ControlPotmeter loEqFrequency(                                               \
-                ConfigKey("[Mixer Profile]", "LoEQFrequency"), 0., 22040);           \
-        loEqFrequency.setDefaultValue(250.0);                                        \
-        ControlPotmeter hiEqFrequency(                                               \
-                ConfigKey("[Mixer Profile]", "HiEQFrequency"), 0., 22040);           \
-        hiEqFrequency.setDefaultValue(2500.0);                                       \
-        mixxx::EngineParameters engineParameters(                                    \
-                mixxx::audio::SampleRate(44100),                                     \
-                state.range_x());                                                    \
-        benchmarkBuiltInEffectDefaultParameters<EffectName>(                         \
-                engineParameters, &state, m_pEffectsManager);                        \
-    }                                                                                \
+#define FOR_COMMON_BUFFER_SIZES(bm) \
+    bm->Arg(32)->Arg(64)->Arg(128)->Arg(256)->Arg(512)->Arg(1024)->Arg(2048)->Arg(4096);
+
+#define DECLARE_EFFECT_BENCHMARK(EffectName)                                    \
+    static void BM_BuiltInEffects_DefaultParameters_##EffectName(              \
+            benchmark::State& state) {                                         \
+        benchmarkBuiltInEffectDefaultParameters<EffectName>(state);            \
+    }                                                                          \
     FOR_COMMON_BUFFER_SIZES(BENCHMARK(BM_BuiltInEffects_DefaultParameters_##EffectName));
 
+DECLARE_EFFECT_BENCHMARK(AutoPanEffect)
 DECLARE_EFFECT_BENCHMARK(Bessel4LVMixEQEffect)
 DECLARE_EFFECT_BENCHMARK(Bessel8LVMixEQEffect)
 DECLARE_EFFECT_BENCHMARK(BitCrusherEffect)
@@ -92,5 +82,45 @@ DECLARE_EFFECT_BENCHMARK(MoogLadder4FilterEffect)
 DECLARE_EFFECT_BENCHMARK(PhaserEffect)
 DECLARE_EFFECT_BENCHMARK(ReverbEffect)
 
-}  // namespace
-#endif
+// Callback time of a Filter, Echo and Reverb chain on state.range(0) decks
+// at a buffer of 1024 frames. The chain processes blocks of state.range(1)
+// frames or the whole buffer at once if it is 0.
+static void BM_EffectChain_FilterEchoReverb(benchmark::State& state) {
+    const int numDecks = static_cast<int>(state.range(0));
+    const SINT blockFrames = static_cast<SINT>(state.range(1));
+    constexpr SINT kNumSamples = 1024 * mixxx::kEngineChannelCount;
+
+    EngineEffectChainTestContext context(numDecks);
+    EngineEffectChain* pChain = context.addChain(QStringLiteral("[EffectRack1_EffectUnit1]"),
+            {FilterEffect::getId(), EchoEffect::getId(), ReverbEffect::getId()},
+            blockFrames);
+    const QList<EngineEffect*> effects = context.effects(pChain);
+    context.setParameter(effects[0], QStringLiteral("lpf"), 2000);
+    context.setParameter(effects[2], QStringLiteral("send_amount"), 0.5);
+    const ChannelHandle master = context.master().handle();
+    const GroupFeatureState featureState;
+
+    std::vector<mixxx::SampleBuffer> inputs;
+    std::vector<mixxx::SampleBuffer> outputs;
+    for (int i = 0; i < numDecks; ++i) {
+        inputs.emplace_back(kNumSamples);
+        SampleUtil::fill(inputs.back().data(), 0.5f, kNumSamples);
+        outputs.emplace_back(kNumSamples);
+    }
+
+    for (auto _ : state) {
+        for (int i = 0; i < numDecks; ++i) {
+            pChain->process(context.decks()[i].handle(),
+                    master,
+                    inputs[i].data(),
+                    outputs[i].data(),
+                    kNumSamples,
+                    kSampleRate,
+                    featureState,
+                    false);
+        }
+    }
+}
+BENCHMARK(BM_EffectChain_FilterEchoReverb)->ArgsProduct({{1, 4}, {0, 32, 64, 128, 256}});
+
+} // namespace
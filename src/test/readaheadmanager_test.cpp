@@ -1,13 +1,23 @@
+#include <benchmark/benchmark.h>
 #include <gtest/gtest.h>
 
+#include <QDeadlineTimer>
 #include <QtDebug>
 #include <QScopedPointer>
+#include <QThread>
+#include <atomic>
+#include <cmath>
+#include <set>
+#include <vector>
 
 #include "engine/cachingreader/cachingreader.h"
 #include "control/controlobject.h"
 #include "engine/controls/loopingcontrol.h"
+#include "engine/engineworkerscheduler.h"
 #include "engine/readaheadmanager.h"
 #include "test/mixxxtest.h"
+#include "test/soundsourceproviderregistration.h"
+#include "track/track.h"
 #include "util/assert.h"
 #include "util/defs.h"
 #include "util/sample.h"
@@ -138,3 +148,386 @@ TEST_F(ReadAheadManagerTest, FractionalFrameLoop) {
     // The rounding error must not exceed a half frame (one samples in stereo)
     EXPECT_NEAR(16, m_pReadAheadManager->getPlaypos(), 1);
 }
+
+namespace {
+
+// A CachingReader that counts the reads that failed because the first
+// chunk was not cached yet.
+class CountingReader : public CachingReader {
+  public:
+    explicit CountingReader(UserSettingsPointer pConfig)
+            : CachingReader(kGroup, pConfig),
+              m_reads(0),
+              m_unavailableReads(0) {
+    }
+
+    CachingReader::ReadResult read(SINT startSample,
+            SINT numSamples,
+            bool reverse,
+            CSAMPLE* buffer) override {
+        ++m_reads;
+        const auto result = CachingReader::read(startSample, numSamples, reverse, buffer);
+        if (result == CachingReader::ReadResult::UNAVAILABLE) {
+            ++m_unavailableReads;
+        }
+        return result;
+    }
+
+    int m_reads;
+    int m_unavailableReads;
+};
+
+// A looping control without any loops, the loops are emulated by seeking
+class NoLoopControl : public LoopingControl {
+  public:
+    NoLoopControl()
+            : LoopingControl(kGroup, UserSettingsPointer()) {
+    }
+
+    mixxx::audio::FramePos nextTrigger(bool reverse,
+            mixxx::audio::FramePos currentPosition,
+            mixxx::audio::FramePos* pTargetPosition) override {
+        Q_UNUSED(reverse);
+        Q_UNUSED(currentPosition);
+        *pTargetPosition = mixxx::audio::kInvalidFramePos;
+        return mixxx::audio::kInvalidFramePos;
+    }
+};
+
+class ProviderRegistration : public SoundSourceProviderRegistration {
+};
+
+constexpr SINT kTraceSampleRate = 44100;
+constexpr SINT kTraceBufferFrames = 128;
+constexpr int kTraceCallbacksPerSecond = kTraceSampleRate / kTraceBufferFrames;
+
+// The deck rate of an engine callback with kTraceBufferFrames frames
+struct ScratchTraceStep {
+    // The frame to jump to before the callback or -1
+    SINT seekFrame;
+    double rate;
+};
+
+// A baby scratch at 2 Hz with a peak rate of 8 around 5 s for 4 s
+std::vector<ScratchTraceStep> babyScratchTrace() {
+    std::vector<ScratchTraceStep> trace;
+    for (int i = 0; i < 4 * kTraceCallbacksPerSecond; ++i) {
+        const double t = (i + 1) / static_cast<double>(kTraceCallbacksPerSecond);
+        trace.push_back(ScratchTraceStep{
+                i == 0 ? 5 * kTraceSampleRate : -1,
+                8.0 * std::sin(2 * M_PI * 2.0 * t)});
+    }
+    return trace;
+}
+
+// Irregular strokes with a peak rate of 10, released to normal playback
+// after half a second and jumping between 4 hotcues once per second. Each
+// hotcue is visited twice.
+std::vector<ScratchTraceStep> hotcueJuggleScratchTrace() {
+    const SINT hotcueFrames[] = {
+            3 * kTraceSampleRate,
+            24 * kTraceSampleRate,
+            17 * kTraceSampleRate,
+            11 * kTraceSampleRate,
+    };
+    std::vector<ScratchTraceStep> trace;
+    for (int visit = 0; visit < 8; ++visit) {
+        for (int i = 0; i < kTraceCallbacksPerSecond; ++i) {
+            const double t = (i + 1) / static_cast<double>(kTraceCallbacksPerSecond);
+            const double rate = t < 0.5
+                    ? 10.0 * std::sin(2 * M_PI * 3.0 * t) *
+                            (0.7 + 0.3 * std::sin(2 * M_PI * 5.0 * t))
+                    : 1.0;
+            trace.push_back(ScratchTraceStep{
+                    i == 0 ? hotcueFrames[visit % 4] : -1,
+                    rate});
+        }
+    }
+    return trace;
+}
+
+} // namespace
+
+class ReadAheadManagerScratchTest : public MixxxTest, SoundSourceProviderRegistration {
+  protected:
+    ReadAheadManagerScratchTest()
+            : m_beatClosestCO(ConfigKey(kGroup, "beat_closest")),
+              m_beatNextCO(ConfigKey(kGroup, "beat_next")),
+              m_beatPrevCO(ConfigKey(kGroup, "beat_prev")),
+              m_playCO(ConfigKey(kGroup, "play")),
+              m_quantizeCO(ConfigKey(kGroup, "quantize")),
+              m_slipEnabledCO(ConfigKey(kGroup, "slip_enabled")),
+              m_trackSamplesCO(ConfigKey(kGroup, "track_samples")) {
+    }
+
+    struct ReplayResult {
+        int expectedReads = 0;
+        int reads = 0;
+        int unavailableReads = 0;
+        // The readable chunks that have been hinted by ReadAheadManager
+        std::set<SINT> hintedChunks;
+        SINT availableChunks = 0;
+        CachingReader::ReadRequestStats stats;
+    };
+
+    // Replays the trace through ReadAheadManager on a CachingReader whose
+    // worker is only woken up every callbacksPerWake callbacks. The worker
+    // then returns all pending requests before the callback reads from the
+    // reader.
+    ReplayResult replay(const std::vector<ScratchTraceStep>& trace, int callbacksPerWake) {
+        ReplayResult result;
+        CountingReader reader{UserSettingsPointer()};
+        // Destroyed before the reader that owns the registered worker
+        EngineWorkerScheduler scheduler;
+        scheduler.start(QThread::HighPriority);
+        reader.setScheduler(&scheduler);
+        const SINT trackFrames = loadTrack(&reader, &scheduler);
+        if (trackFrames <= 0) {
+            ADD_FAILURE() << "Failed to load track";
+            return result;
+        }
+
+        NoLoopControl loopControl;
+        ReadAheadManager readAheadManager(&reader, &loopControl);
+        mixxx::SampleBuffer buffer(16 * kTraceBufferFrames * mixxx::kEngineChannelCount);
+        HintVector hints;
+        int callbacks = 0;
+        for (const auto& step : trace) {
+            if (step.seekFrame >= 0) {
+                readAheadManager.notifySeek(mixxx::audio::FramePos(step.seekFrame));
+            }
+            hints.clear();
+            readAheadManager.hintReader(step.rate, &hints);
+            for (const auto& hint : hints) {
+                const auto readableFrameIndexRange = intersect(
+                        mixxx::IndexRange::forward(hint.frame, hint.frameCount),
+                        mixxx::IndexRange::forward(0, trackFrames));
+                if (readableFrameIndexRange.empty()) {
+                    continue;
+                }
+                for (SINT chunkIndex = CachingReaderChunk::indexForFrame(
+                             readableFrameIndexRange.start());
+                        chunkIndex <= CachingReaderChunk::indexForFrame(
+                                              readableFrameIndexRange.end() - 1);
+                        ++chunkIndex) {
+                    result.hintedChunks.insert(chunkIndex);
+                }
+            }
+            reader.hintAndMaybeWake(hints,
+                    static_cast<SINT>(readAheadManager.getPlaypos() /
+                            mixxx::kEngineChannelCount));
+            if (++callbacks % callbacksPerWake == 0) {
+                waitForPendingReadRequests(&reader, &scheduler);
+            }
+
+            const SINT numFrames = static_cast<SINT>(std::abs(step.rate) * kTraceBufferFrames);
+            if (numFrames > 0) {
+                ++result.expectedReads;
+                readAheadManager.getNextSamples(step.rate,
+                        buffer.data(),
+                        numFrames * mixxx::kEngineChannelCount);
+            }
+        }
+        waitForPendingReadRequests(&reader, &scheduler);
+
+        result.reads = reader.m_reads;
+        result.unavailableReads = reader.m_unavailableReads;
+        result.availableChunks = reader.numAvailableChunks();
+        result.stats = reader.readRequestStats();
+        return result;
+    }
+
+  private:
+    // Returns the number of frames of the loaded test track or 0 on failure
+    SINT loadTrack(CachingReader* pReader, EngineWorkerScheduler* pScheduler) {
+        std::atomic<int> numSamples(0);
+        const auto connection = QObject::connect(pReader,
+                &CachingReader::trackLoaded,
+                [&numSamples](TrackPointer, int, int iNumSamples) {
+                    numSamples.store(iNumSamples);
+                });
+        pReader->newTrack(Track::newTemporary(
+                getTestDir().filePath(QStringLiteral("sine-30.wav"))));
+        QDeadlineTimer deadline(5000);
+        while (numSamples.load() == 0 && !deadline.hasExpired()) {
+            pScheduler->runWorkers();
+            QThread::usleep(100);
+        }
+        QObject::disconnect(connection);
+        // Receive the TRACK_LOADED update
+        pReader->process();
+        return numSamples.load() / mixxx::kEngineChannelCount;
+    }
+
+    // Wakes the worker and waits until it has returned all pending read
+    // requests
+    void waitForPendingReadRequests(CachingReader* pReader, EngineWorkerScheduler* pScheduler) {
+        QDeadlineTimer deadline(5000);
+        while (pReader->hasPendingReadRequests() && !deadline.hasExpired()) {
+            // Wakes the worker again if the scheduler has missed it
+            pScheduler->workerReady();
+            pScheduler->runWorkers();
+            QThread::usleep(100);
+            pReader->process();
+        }
+        EXPECT_FALSE(pReader->hasPendingReadRequests());
+    }
+
+    ControlObject m_beatClosestCO;
+    ControlObject m_beatNextCO;
+    ControlObject m_beatPrevCO;
+    ControlObject m_playCO;
+    ControlObject m_quantizeCO;
+    ControlObject m_slipEnabledCO;
+    ControlObject m_trackSamplesCO;
+};
+
+TEST_F(ReadAheadManagerScratchTest, WorkerKeepsUp) {
+    for (const auto& trace : {babyScratchTrace(), hotcueJuggleScratchTrace()}) {
+        const auto result = replay(trace, 1);
+        ASSERT_LE(static_cast<SINT>(result.hintedChunks.size()), result.availableChunks);
+        // Each hinted chunk is decoded exactly once and before the engine
+        // reads from it
+        EXPECT_EQ(result.expectedReads, result.reads);
+        EXPECT_EQ(0, result.unavailableReads);
+        EXPECT_EQ(static_cast<int>(result.hintedChunks.size()), result.stats.submitted);
+        EXPECT_EQ(result.stats.submitted, result.stats.served);
+        EXPECT_EQ(0, result.stats.superseded);
+        EXPECT_EQ(0, result.stats.deferred);
+    }
+}
+
+TEST_F(ReadAheadManagerScratchTest, WorkerLagsBehind) {
+    constexpr int kCallbacksPerWake = 4;
+    for (const auto& trace : {babyScratchTrace(), hotcueJuggleScratchTrace()}) {
+        const auto keepingUp = replay(trace, 1);
+        const auto result = replay(trace, kCallbacksPerWake);
+        // The hints only depend on the trace
+        EXPECT_EQ(keepingUp.hintedChunks, result.hintedChunks);
+        EXPECT_EQ(result.expectedReads, result.reads);
+        // The reads before the first wake-up miss, later reads may miss
+        // after a seek or a change of direction
+        EXPECT_GE(result.unavailableReads, kCallbacksPerWake - 1);
+        EXPECT_LT(result.unavailableReads, result.reads / 10);
+        // Superseded requests are requested again when they are hinted again
+        EXPECT_GE(result.stats.submitted, keepingUp.stats.submitted);
+        EXPECT_LE(result.stats.served, result.stats.submitted);
+        EXPECT_EQ(0, result.stats.deferred);
+    }
+}
+
+// Emulates beat juggling with state.range(0) initially cached chunks that
+// may grow up to state.range(1) chunks: The deck jumps between 8 hotcues
+// spread across the track, plays a one beat loop 4 times at each of them
+// and beatjumps ahead once. The engine callbacks are paced in real time
+// with 128 frame buffers, so the reader worker has the same time for
+// decoding as in a live set. Reports the reads that could not be served
+// from the cache. With state.range(2) the track is preloaded fully.
+static void BM_ReadAheadLoopAndBeatjump(benchmark::State& state) {
+    constexpr SINT kSampleRate = 44100;
+    constexpr SINT kBufferFrames = 128;
+    constexpr SINT kBeatFrames = kSampleRate / 2; // 120 BPM
+    constexpr int kNumHotcues = 8;
+    constexpr SINT kHotcueDistanceFrames = 7 * kBeatFrames;
+
+    ProviderRegistration providerRegistration;
+    ControlObject beatClosestCO(ConfigKey(kGroup, "beat_closest"));
+    ControlObject beatNextCO(ConfigKey(kGroup, "beat_next"));
+    ControlObject beatPrevCO(ConfigKey(kGroup, "beat_prev"));
+    ControlObject playCO(ConfigKey(kGroup, "play"));
+    ControlObject quantizeCO(ConfigKey(kGroup, "quantize"));
+    ControlObject slipEnabledCO(ConfigKey(kGroup, "slip_enabled"));
+    ControlObject trackSamplesCO(ConfigKey(kGroup, "track_samples"));
+
+    auto pConfig = UserSettingsPointer(new UserSettings(QString()));
+    pConfig->setValue(ConfigKey("[Master]", "cached_chunks_per_deck"),
+            static_cast<int>(state.range(0)));
+    pConfig->setValue(ConfigKey("[Master]", "cached_chunks_per_deck_max"),
+            static_cast<int>(state.range(1)));
+    CountingReader reader(pConfig);
+    // Destroyed before the reader that owns the registered worker
+    EngineWorkerScheduler scheduler;
+    scheduler.start(QThread::HighPriority);
+    reader.setScheduler(&scheduler);
+
+    std::atomic<bool> trackLoaded(false);
+    QObject::connect(&reader,
+            &CachingReader::trackLoaded,
+            [&trackLoaded](TrackPointer, int, int) {
+                trackLoaded.store(true);
+            });
+    reader.newTrack(Track::newTemporary(
+                            MixxxTest::getOrInitTestDir().filePath(
+                                    QStringLiteral("sine-30.wav"))),
+            state.range(2) != 0);
+    for (int i = 0; !trackLoaded.load() && i < 1000; ++i) {
+        scheduler.runWorkers();
+        QThread::msleep(5);
+    }
+    if (!trackLoaded.load()) {
+        state.SkipWithError("Failed to load track");
+        return;
+    }
+    // The track is preloaded in the background after loading it
+    for (int i = 0; state.range(2) != 0 && !reader.isPreloadedFully() && i < 1000; ++i) {
+        scheduler.runWorkers();
+        QThread::msleep(5);
+        reader.process();
+    }
+
+    NoLoopControl loopControl;
+    ReadAheadManager readAheadManager(&reader, &loopControl);
+    mixxx::SampleBuffer buffer(kBufferFrames * 2);
+    HintVector hints;
+    int hotcue = 0;
+    SINT loopStartFrame = 0;
+    int loopRepetitions = 0;
+    readAheadManager.notifySeek(0.0);
+
+    for (auto _ : state) {
+        const SINT positionFrame =
+                static_cast<SINT>(readAheadManager.getPlaypos() / 2);
+        if (positionFrame >= loopStartFrame + kBeatFrames) {
+            if (++loopRepetitions < 4) {
+                // Loop back
+                readAheadManager.notifySeek(loopStartFrame * 2.0);
+            } else if (loopRepetitions == 4) {
+                // Beatjump 8 beats ahead
+                loopStartFrame += 8 * kBeatFrames;
+                readAheadManager.notifySeek(loopStartFrame * 2.0);
+            } else {
+                // Jump to the next hotcue in a shuffled order
+                hotcue = (hotcue + 5) % kNumHotcues;
+                loopStartFrame = hotcue * kHotcueDistanceFrames;
+                loopRepetitions = 0;
+                readAheadManager.notifySeek(loopStartFrame * 2.0);
+            }
+        }
+
+        hints.clear();
+        readAheadManager.hintReader(1.0, &hints);
+        for (int i = 0; i < kNumHotcues; ++i) {
+            hints.append(Hint{i * kHotcueDistanceFrames,
+                    Hint::kFrameCountForward,
+                    Hint::Type::HotCue});
+        }
+        hints.append(Hint{loopStartFrame, Hint::kFrameCountForward, Hint::Type::LoopStart});
+        reader.hintAndMaybeWake(hints, positionFrame);
+        scheduler.runWorkers();
+        readAheadManager.getNextSamples(1.0, buffer.data(), buffer.size());
+
+        QThread::usleep(static_cast<unsigned long>(
+                kBufferFrames * 1000000 / kSampleRate));
+    }
+
+    state.counters["unavailable_reads"] = benchmark::Counter(
+            reader.m_unavailableReads, benchmark::Counter::kAvgIterations);
+    state.counters["chunks"] = static_cast<double>(reader.numAvailableChunks());
+}
+BENCHMARK(BM_ReadAheadLoopAndBeatjump)
+        ->Args({16, 16, 0})
+        ->Args({16, 256, 0})
+        ->Args({80, 80, 0})
+        ->Args({16, 16, 1})
+        ->Iterations(4000)
+        ->UseRealTime();
@@ -4,6 +4,9 @@
 #include <QList>
 #include <QPair>
 #include <QtDebug>
+#include <algorithm>
+#include <cmath>
+#include <limits>
 #include <vector>
 
 #include "util/sample.h"
@@ -210,16 +213,26 @@ TEST_F(SampleUtilTest, copy2WithGain) {
         FillBuffer(buffer2, 1.0f, size);
         CSAMPLE* buffer3 = SampleUtil::alloc(size);
         FillBuffer(buffer3, 1.0f, size);
-        SampleUtil::copy2WithGain(buffer,
-                                  buffer2, 1.0,
-                                  buffer3, 1.0,
-                                  size);
+        SampleUtil::copyWithGains<SampleUtil::ConstantGain>(buffer,
+                {buffer2, buffer3},
+                {{1.0}, {1.0}},
+                size);
         AssertWholeBufferEquals(buffer, 2.0f, size);
-        SampleUtil::copy2WithGain(buffer,
-                                  buffer2, 2.0,
-                                  buffer3, 3.0,
-                                  size);
+        SampleUtil::copyWithGains<SampleUtil::ConstantGain>(buffer,
+                {buffer2, buffer3},
+                {{2.0}, {3.0}},
+                size);
         AssertWholeBufferEquals(buffer, 5.0f, size);
+        SampleUtil::copyWithGains<SampleUtil::ConstantGain>(buffer,
+                {buffer2, buffer3},
+                {{0.0}, {3.0}},
+                size);
+        AssertWholeBufferEquals(buffer, 3.0f, size);
+        SampleUtil::copyWithGains<SampleUtil::ConstantGain>(buffer,
+                {buffer2, buffer3},
+                {{0.0}, {0.0}},
+                size);
+        AssertWholeBufferEquals(buffer, 0.0f, size);
         SampleUtil::free(buffer2);
         SampleUtil::free(buffer3);
     }
@@ -236,17 +249,15 @@ TEST_F(SampleUtilTest, copy3WithGain) {
         FillBuffer(buffer3, 1.0f, size);
         CSAMPLE* buffer4 = SampleUtil::alloc(size);
         FillBuffer(buffer4, 1.0f, size);
-        SampleUtil::copy3WithGain(buffer,
-                                  buffer2, 1.0,
-                                  buffer3, 1.0,
-                                  buffer4, 1.0,
-                                  size);
+        SampleUtil::copyWithGains<SampleUtil::ConstantGain>(buffer,
+                {buffer2, buffer3, buffer4},
+                {{1.0}, {1.0}, {1.0}},
+                size);
         AssertWholeBufferEquals(buffer, 3.0f, size);
-        SampleUtil::copy3WithGain(buffer,
-                                  buffer2, 2.0,
-                                  buffer3, 3.0,
-                                  buffer4, 4.0,
-                                  size);
+        SampleUtil::copyWithGains<SampleUtil::ConstantGain>(buffer,
+                {buffer2, buffer3, buffer4},
+                {{2.0}, {3.0}, {4.0}},
+                size);
         AssertWholeBufferEquals(buffer, 9.0f, size);
         SampleUtil::free(buffer2);
         SampleUtil::free(buffer3);
@@ -254,6 +265,106 @@ TEST_F(SampleUtilTest, copy3WithGain) {
     }
 }
 
+TEST_F(SampleUtilTest, copyWithRampingGains) {
+    for (int i : evenBuffers) {
+        CSAMPLE* buffer = buffers[i];
+        int size = sizes[i];
+        CSAMPLE* buffer2 = SampleUtil::alloc(size);
+        FillBuffer(buffer2, 1.0f, size);
+        CSAMPLE* buffer3 = SampleUtil::alloc(size);
+        FillBuffer(buffer3, 2.0f, size);
+        CSAMPLE* expected = SampleUtil::alloc(size);
+        CSAMPLE* expected2 = SampleUtil::alloc(size);
+
+        SampleUtil::copyWithRampingGain(expected, buffer2, 0.5f, 1.0f, size);
+        SampleUtil::copyWithRampingGain(expected2, buffer3, 1.0f, 0.0f, size);
+        SampleUtil::add(expected, expected2, size);
+
+        SampleUtil::copyWithGains<SampleUtil::RampingGain>(buffer,
+                {buffer2, buffer3},
+                {{0.5f, 1.0f}, {1.0f, 0.0f}},
+                size);
+        for (int j = 0; j < size; ++j) {
+            EXPECT_FLOAT_EQ(expected[j], buffer[j]);
+        }
+
+        SampleUtil::free(buffer2);
+        SampleUtil::free(buffer3);
+        SampleUtil::free(expected);
+        SampleUtil::free(expected2);
+    }
+}
+
+TEST_F(SampleUtilTest, copyWithGainsInPlace) {
+    for (int i : evenBuffers) {
+        CSAMPLE* buffer = buffers[i];
+        int size = sizes[i];
+        CSAMPLE* buffer2 = SampleUtil::alloc(size);
+        FillBuffer(buffer2, 1.0f, size);
+        CSAMPLE* expected = SampleUtil::alloc(size);
+
+        FillBuffer(buffer, 2.0f, size);
+        SampleUtil::copyWithGains<SampleUtil::ConstantGain>(buffer,
+                {buffer, buffer2},
+                {{0.5f}, {3.0f}},
+                size);
+        AssertWholeBufferEquals(buffer, 4.0f, size);
+
+        FillBuffer(buffer, 2.0f, size);
+        SampleUtil::copyWithRampingGain(expected, buffer, 1.0f, 0.5f, size);
+        SampleUtil::add(expected, buffer2, size);
+        SampleUtil::copyWithGains<SampleUtil::RampingGain>(buffer,
+                {buffer, buffer2},
+                {{1.0f, 0.5f}, {1.0f, 1.0f}},
+                size);
+        for (int j = 0; j < size; ++j) {
+            EXPECT_FLOAT_EQ(expected[j], buffer[j]);
+        }
+
+        SampleUtil::free(buffer2);
+        SampleUtil::free(expected);
+    }
+}
+
+TEST_F(SampleUtilTest, copyWithGainsManyChannels) {
+    constexpr int kNumChannels = 32;
+    for (int i = 0; i < buffers.size(); ++i) {
+        CSAMPLE* buffer = buffers[i];
+        int size = sizes[i];
+        std::vector<CSAMPLE*> channels;
+        std::vector<SampleUtil::ConstantGain> gains;
+        CSAMPLE expected = 0;
+        for (int channel = 0; channel < kNumChannels; ++channel) {
+            CSAMPLE* pChannel = SampleUtil::alloc(size);
+            FillBuffer(pChannel, 0.25f * channel, size);
+            channels.push_back(pChannel);
+            // Every third channel is muted
+            const CSAMPLE_GAIN gain = channel % 3 == 0 ? 0.0f : 0.5f;
+            gains.push_back(SampleUtil::ConstantGain{gain});
+            expected += 0.25f * channel * gain;
+        }
+
+        SampleUtil::copyWithGains(buffer,
+                channels.data(),
+                gains.data(),
+                kNumChannels,
+                size);
+        AssertWholeBufferEquals(buffer, expected, size);
+
+        // Without channels the result is silence
+        SampleUtil::copyWithGains(buffer,
+                channels.data(),
+                gains.data(),
+                0,
+                size);
+        AssertWholeBufferEquals(buffer, 0.0f, size);
+
+        for (CSAMPLE* pChannel : channels) {
+            SampleUtil::free(pChannel);
+        }
+    }
+}
+
 TEST_F(SampleUtilTest, convertS16ToFloat32) {
     // Shorts are asymmetric, so SAMPLE_MAX is less than -SAMPLE_MIN.
     const float expectedMax = static_cast<float>(SAMPLE_MAXIMUM) /
@@ -397,6 +508,87 @@ TEST_F(SampleUtilTest, copyReverse) {
     }
 }
 
+TEST_F(SampleUtilTest, isSilent) {
+    for (int i = 0; i < buffers.size(); ++i) {
+        CSAMPLE* buffer = buffers[i];
+        int size = sizes[i];
+        EXPECT_TRUE(SampleUtil::isSilent(buffer, size));
+        FillBuffer(buffer, SampleUtil::kSilenceThreshold / 2, size);
+        EXPECT_TRUE(SampleUtil::isSilent(buffer, size));
+        buffer[size - 1] = -SampleUtil::kSilenceThreshold * 2;
+        EXPECT_FALSE(SampleUtil::isSilent(buffer, size));
+        EXPECT_TRUE(SampleUtil::isSilent(buffer, size - 1));
+    }
+}
+
+TEST_F(SampleUtilTest, simdLevelsMatchBaseline) {
+    const SampleUtil::SimdLevel detectedLevel = SampleUtil::simdLevel();
+    for (int i = 0; i < evenBuffers.size(); ++i) {
+        int j = evenBuffers[i];
+        int size = sizes[j];
+        std::vector<CSAMPLE> source(size);
+        for (int s = 0; s < size; ++s) {
+            // Includes values beyond the clipping threshold
+            source[s] = static_cast<CSAMPLE>((s * 37) % 101 - 50) / 40.0f;
+        }
+
+        std::vector<std::vector<CSAMPLE>> results;
+        std::vector<SampleUtil::CLIP_STATUS> clipStatus;
+        for (int level = static_cast<int>(SampleUtil::SimdLevel::Baseline);
+                level <= static_cast<int>(SampleUtil::maxSupportedSimdLevel());
+                ++level) {
+            ASSERT_TRUE(SampleUtil::setSimdLevel(
+                    static_cast<SampleUtil::SimdLevel>(level)));
+            std::vector<CSAMPLE> result(size, 0.25f);
+            SampleUtil::addWithRampingGain(
+                    result.data(), source.data(), 0.3f, 0.9f, size);
+            SampleUtil::applyRampingGain(result.data(), 1.2f, 0.4f, size);
+            SampleUtil::applyGain(result.data(), 0.8f, size);
+            std::vector<CSAMPLE> clamped(size);
+            SampleUtil::copyClampBuffer(clamped.data(), source.data(), size);
+            SampleUtil::addWithGain(result.data(), clamped.data(), 0.5f, size);
+            std::vector<CSAMPLE> left(size / 2);
+            std::vector<CSAMPLE> right(size / 2);
+            SampleUtil::deinterleaveBuffer(
+                    left.data(), right.data(), result.data(), size / 2);
+            SampleUtil::interleaveBuffer(
+                    result.data(), right.data(), left.data(), size / 2);
+            CSAMPLE sumL;
+            CSAMPLE sumR;
+            clipStatus.push_back(SampleUtil::sumAbsPerChannel(
+                    &sumL, &sumR, source.data(), size));
+            result.push_back(sumL);
+            result.push_back(sumR);
+            results.push_back(result);
+        }
+        // FMA variants are not bit exact. The samples are the result of a
+        // few operations on values of magnitude ~1, so allow a few ULPs
+        // relative to that magnitude. The rounding error of the sums grows
+        // with the number of summed samples.
+        const std::size_t numSamples = results[0].size() - 2;
+        const auto sampleTolerance = [](CSAMPLE expected) {
+            return 32 * std::numeric_limits<CSAMPLE>::epsilon() *
+                    std::max(1.0f, std::abs(expected));
+        };
+        const auto sumTolerance = [size](CSAMPLE expected) {
+            return (size / 2) * std::numeric_limits<CSAMPLE>::epsilon() *
+                    std::abs(expected);
+        };
+        for (std::size_t k = 1; k < results.size(); ++k) {
+            EXPECT_EQ(clipStatus[0], clipStatus[k]);
+            for (std::size_t s = 0; s < results[0].size(); ++s) {
+                const CSAMPLE expected = results[0][s];
+                EXPECT_NEAR(expected,
+                        results[k][s],
+                        s < numSamples ? sampleTolerance(expected)
+                                       : sumTolerance(expected))
+                        << "level " << k << ", sample " << s;
+            }
+        }
+    }
+    SampleUtil::setSimdLevel(detectedLevel);
+}
+
 static void BM_MemCpy(benchmark::State& state) {
     SINT size = static_cast<SINT>(state.range(0));
     CSAMPLE* buffer = SampleUtil::alloc(size);
@@ -463,13 +655,15 @@ TEST_F(SampleUtilTest, copy3WithGainSpeed) {
 
     // For ensure data is cached and equal start conditions
     SampleUtil::copy(buffer, buffer2, size);
-    SampleUtil::copy2WithGain(buffer, buffer2, 1.1f, buffer3, 1.1f, size);
+    SampleUtil::copyWithGains<SampleUtil::ConstantGain>(
+            buffer, {buffer2, buffer3}, {{1.1f}, {1.1f}}, size);
 
     qint64 elapsed;
     Timer t("");
     t.start();
 
-    SampleUtil::copy2WithGain(buffer, buffer2, 1.1f, buffer3, 1.1f, size);
+    SampleUtil::copyWithGains<SampleUtil::ConstantGain>(
+            buffer, {buffer2, buffer3}, {{1.1f}, {1.1f}}, size);
 
     elapsed = t.elapsed("");
     qDebug() << "copy2WithGain" << elapsed << "ns" << size;
@@ -478,19 +672,19 @@ TEST_F(SampleUtilTest, copy3WithGainSpeed) {
 
     t.start();
 
-    SampleUtil::copy1WithGain(buffer, buffer2, 1.1f, size);
+    SampleUtil::copyWithGain(buffer, buffer2, 1.1f, size);
 
     elapsed = t.elapsed("");
-    qDebug() << "SampleUtil::copy1WithGain" << elapsed << "ns" << size;
+    qDebug() << "SampleUtil::copyWithGain" << elapsed << "ns" << size;
 
 //############
 
     t.start();
 
-    SampleUtil::copy1WithGain(buffer, buffer2, 1.1f, size);
+    SampleUtil::copyWithGain(buffer, buffer2, 1.1f, size);
 
     elapsed = t.elapsed("");
-    qDebug() << "SampleUtil::copy1WithGain" << elapsed << "ns" << size;
+    qDebug() << "SampleUtil::copyWithGain" << elapsed << "ns" << size;
 
 //############
 
@@ -532,7 +726,8 @@ TEST_F(SampleUtilTest, copy3WithGainSpeed) {
 
     t.start();
 
-    SampleUtil::copy2WithGain(buffer, buffer2, 1.1f, buffer3, 1.1f, size);
+    SampleUtil::copyWithGains<SampleUtil::ConstantGain>(
+            buffer, {buffer2, buffer3}, {{1.1f}, {1.1f}}, size);
 
     elapsed = t.elapsed("");
     qDebug() << "copy2WithGain" << elapsed << "ns" << size;
@@ -554,7 +749,8 @@ static void BM_Copy2WithGain(benchmark::State& state) {
     SampleUtil::fill(buffer3, 0.0f, size);
 
     while(state.KeepRunning()) {
-        SampleUtil::copy2WithGain(buffer, buffer2, 1.1f, buffer3, 1.1f, size);
+        SampleUtil::copyWithGains<SampleUtil::ConstantGain>(
+            buffer, {buffer2, buffer3}, {{1.1f}, {1.1f}}, size);
     }
 
     SampleUtil::free(buffer);
@@ -573,8 +769,10 @@ static void BM_Copy2WithRampingGain(benchmark::State& state) {
     SampleUtil::fill(buffer3, 0.0f, size);
 
     while(state.KeepRunning()) {
-        SampleUtil::copy2WithRampingGain(buffer, buffer2, 1.1f, 1.2f, buffer3,
-                                         1.1f, 1.2f, size);
+        SampleUtil::copyWithGains<SampleUtil::RampingGain>(buffer,
+                {buffer2, buffer3},
+                {{1.1f, 1.2f}, {1.1f, 1.2f}},
+                size);
     }
 
     SampleUtil::free(buffer);
@@ -583,4 +781,112 @@ static void BM_Copy2WithRampingGain(benchmark::State& state) {
 }
 BENCHMARK(BM_Copy2WithRampingGain)->Range(64, 4096);
 
+// Runs the given SampleUtil function with the SimdLevel state.range(1).
+template<typename Function>
+static void benchmarkSimdLevel(benchmark::State& state, Function function) {
+    const auto level = static_cast<SampleUtil::SimdLevel>(state.range(1));
+    const SampleUtil::SimdLevel detectedLevel = SampleUtil::simdLevel();
+    if (!SampleUtil::setSimdLevel(level)) {
+        state.SkipWithError("Instruction set not supported");
+        return;
+    }
+    SINT size = static_cast<SINT>(state.range(0));
+    CSAMPLE* buffer = SampleUtil::alloc(size);
+    SampleUtil::fill(buffer, 0.5f, size);
+    CSAMPLE* buffer2 = SampleUtil::alloc(size);
+    SampleUtil::fill(buffer2, 0.25f, size);
+
+    for (auto _ : state) {
+        function(buffer, buffer2, size);
+        benchmark::ClobberMemory();
+    }
+
+    SampleUtil::free(buffer);
+    SampleUtil::free(buffer2);
+    SampleUtil::setSimdLevel(detectedLevel);
+}
+
+// Buffer sizes x (Baseline, Avx2, Avx512)
+static void simdLevelArgs(benchmark::internal::Benchmark* pBenchmark) {
+    pBenchmark->ArgsProduct({benchmark::CreateRange(64, 4096, 4), {0, 1, 2}});
+}
+
+static void BM_SimdApplyGain(benchmark::State& state) {
+    benchmarkSimdLevel(state, [](CSAMPLE* pBuffer, CSAMPLE*, SINT size) {
+        SampleUtil::applyGain(pBuffer, 0.999f, size);
+    });
+}
+BENCHMARK(BM_SimdApplyGain)->Apply(simdLevelArgs);
+
+static void BM_SimdCopyWithRampingGain(benchmark::State& state) {
+    benchmarkSimdLevel(state, [](CSAMPLE* pBuffer, CSAMPLE* pBuffer2, SINT size) {
+        SampleUtil::copyWithRampingGain(pBuffer, pBuffer2, 0.5f, 0.6f, size);
+    });
+}
+BENCHMARK(BM_SimdCopyWithRampingGain)->Apply(simdLevelArgs);
+
+static void BM_SimdAddWithRampingGain(benchmark::State& state) {
+    benchmarkSimdLevel(state, [](CSAMPLE* pBuffer, CSAMPLE* pBuffer2, SINT size) {
+        SampleUtil::addWithRampingGain(pBuffer, pBuffer2, 0.5f, 0.6f, size);
+    });
+}
+BENCHMARK(BM_SimdAddWithRampingGain)->Apply(simdLevelArgs);
+
+static void BM_SimdSumAbsPerChannel(benchmark::State& state) {
+    benchmarkSimdLevel(state, [](CSAMPLE* pBuffer, CSAMPLE*, SINT size) {
+        CSAMPLE sumL;
+        CSAMPLE sumR;
+        benchmark::DoNotOptimize(SampleUtil::sumAbsPerChannel(&sumL, &sumR, pBuffer, size));
+    });
+}
+BENCHMARK(BM_SimdSumAbsPerChannel)->Apply(simdLevelArgs);
+
+static void BM_SimdInterleaveBuffer(benchmark::State& state) {
+    benchmarkSimdLevel(state, [](CSAMPLE* pBuffer, CSAMPLE* pBuffer2, SINT size) {
+        SampleUtil::interleaveBuffer(pBuffer, pBuffer2, pBuffer2 + size / 2, size / 4);
+    });
+}
+BENCHMARK(BM_SimdInterleaveBuffer)->Apply(simdLevelArgs);
+
+// Mixes state.range(0) channels with state.range(1) samples each, either
+// with copyWithGains() or, if state.range(2) is set, with one addWithGain()
+// pass per channel for comparison.
+static void BM_MixChannels(benchmark::State& state) {
+    const int numChannels = static_cast<int>(state.range(0));
+    const SINT size = static_cast<SINT>(state.range(1));
+    const bool perChannelPasses = state.range(2) != 0;
+    CSAMPLE* buffer = SampleUtil::alloc(size);
+    std::vector<const CSAMPLE*> channels;
+    std::vector<SampleUtil::ConstantGain> gains;
+    for (int i = 0; i < numChannels; ++i) {
+        CSAMPLE* pChannel = SampleUtil::alloc(size);
+        SampleUtil::fill(pChannel, 0.5f, size);
+        channels.push_back(pChannel);
+        gains.push_back(SampleUtil::ConstantGain{0.9f});
+    }
+
+    for (auto _ : state) {
+        if (perChannelPasses) {
+            SampleUtil::clear(buffer, size);
+            for (int i = 0; i < numChannels; ++i) {
+                SampleUtil::addWithGain(buffer, channels[i], gains[i].gain, size);
+            }
+        } else {
+            SampleUtil::copyWithGains(buffer,
+                    channels.data(),
+                    gains.data(),
+                    numChannels,
+                    size);
+        }
+        benchmark::ClobberMemory();
+    }
+
+    SampleUtil::free(buffer);
+    for (const CSAMPLE* pChannel : channels) {
+        SampleUtil::free(const_cast<CSAMPLE*>(pChannel));
+    }
+}
+BENCHMARK(BM_MixChannels)
+        ->ArgsProduct({{2, 4, 8, 16, 32}, {128, 1024, 8192}, {0, 1}});
+
 }  // namespace
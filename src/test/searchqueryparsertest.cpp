@@ -1,12 +1,20 @@
+#include <benchmark/benchmark.h>
 #include <gtest/gtest.h>
 
 #include <QDir>
+#include <QSet>
+#include <QSqlQuery>
 #include <QtDebug>
 
+#include "library/dao/trackschema.h"
+#include "library/dao/tracksearchindex.h"
+#include "library/queryutil.h"
+#include "library/searchquery.h"
 #include "library/searchqueryparser.h"
 #include "test/librarytest.h"
 #include "track/track.h"
 #include "util/assert.h"
+#include "util/db/sqltransaction.h"
 
 TrackPointer newTestTrack(int sampleRate) {
     TrackPointer pTrack(Track::newTemporary());
@@ -1097,3 +1105,248 @@ TEST_F(SearchQueryParserTest, QueryIsLessSpecific) {
             QStringLiteral("-crate:\"a b c\""),
             QStringLiteral("crate:\"a b c\"")));
 }
+
+TEST_F(SearchQueryParserTest, TextFilterUsesSearchIndex) {
+    TrackSearchIndex& searchIndex = internalCollection()->getTrackDAO().searchIndex();
+    if (!searchIndex.isAvailable()) {
+        GTEST_SKIP() << "Full-text search is not supported by SQLite";
+    }
+    ASSERT_TRUE(searchIndex.synchronize());
+    const SearchQueryParser parser(internalCollection(), &searchIndex);
+
+    auto pQuery(parser.parseQuery("ASDF", {"artist", "album"}, ""));
+    EXPECT_STREQ(
+            qPrintable(QString("id IN (SELECT rowid FROM library_search "
+                               "WHERE library_search MATCH '{artist album} : \"asdf\"')")),
+            qPrintable(pQuery->toSql()));
+
+    // Columns that are not indexed are still matched with LIKE
+    pQuery = parser.parseQuery("asdf", {"artist", "key"}, "");
+    EXPECT_STREQ(
+            qPrintable(QString("(id IN (SELECT rowid FROM library_search "
+                               "WHERE library_search MATCH '{artist} : \"asdf\"')) "
+                               "OR (key LIKE '%asdf%')")),
+            qPrintable(pQuery->toSql()));
+
+    // The index can't match terms that are shorter than a trigram
+    pQuery = parser.parseQuery("as", {"artist"}, "");
+    EXPECT_STREQ(
+            qPrintable(QString("artist LIKE '%as%'")),
+            qPrintable(pQuery->toSql()));
+}
+
+TEST_F(SearchQueryParserTest, SearchIndexFindsFoldedSubstrings) {
+    TrackSearchIndex& searchIndex = internalCollection()->getTrackDAO().searchIndex();
+    if (!searchIndex.isAvailable()) {
+        GTEST_SKIP() << "Full-text search is not supported by SQLite";
+    }
+
+    TrackPointer pTrackA = getOrAddTrackByLocation(getTestDir().filePath(
+            QStringLiteral("id3-test-data/cover-test-jpg.mp3")));
+    ASSERT_TRUE(pTrackA);
+    TrackPointer pTrackB = getOrAddTrackByLocation(getTestDir().filePath(
+            QStringLiteral("id3-test-data/cover-test-png.mp3")));
+    ASSERT_TRUE(pTrackB);
+    pTrackA->setArtist("Björk");
+    pTrackB->setArtist("Bjorn \"The Bear\"");
+    trackCollectionManager()->saveTrack(pTrackA);
+    trackCollectionManager()->saveTrack(pTrackB);
+
+    const auto findTracks = [&searchIndex, this](const QString& foldedSearchTerm) {
+        QSet<TrackId> trackIds;
+        EXPECT_TRUE(searchIndex.synchronize());
+        QSqlQuery query(internalCollection()->database());
+        EXPECT_TRUE(query.exec(searchIndex.formatQueryForTrackIdsContaining(
+                {"artist", "title"}, foldedSearchTerm)));
+        while (query.next()) {
+            trackIds.insert(TrackId(query.value(0)));
+        }
+        return trackIds;
+    };
+    EXPECT_EQ(QSet<TrackId>({pTrackA->getId()}), findTracks("bjork"));
+    EXPECT_EQ(QSet<TrackId>({pTrackA->getId(), pTrackB->getId()}), findTracks("bjo"));
+    EXPECT_EQ(QSet<TrackId>({pTrackB->getId()}), findTracks("n \"the"));
+
+    // Modified tracks are reindexed
+    pTrackA->setArtist("Bjorn Again");
+    trackCollectionManager()->saveTrack(pTrackA);
+    EXPECT_EQ(QSet<TrackId>(), findTracks("bjork"));
+    EXPECT_EQ(QSet<TrackId>({pTrackA->getId(), pTrackB->getId()}), findTracks("bjorn"));
+}
+
+TEST_F(SearchQueryParserTest, SearchIndexFollowsDatabaseModifications) {
+    TrackSearchIndex& searchIndex = internalCollection()->getTrackDAO().searchIndex();
+    if (!searchIndex.isAvailable()) {
+        GTEST_SKIP() << "Full-text search is not supported by SQLite";
+    }
+    const TrackId trackIdA = addTrackToCollection(getTestDir().filePath(
+            QStringLiteral("id3-test-data/cover-test-jpg.mp3")));
+    ASSERT_TRUE(trackIdA.isValid());
+    const TrackId trackIdB = addTrackToCollection(getTestDir().filePath(
+            QStringLiteral("id3-test-data/cover-test-png.mp3")));
+    ASSERT_TRUE(trackIdB.isValid());
+
+    // The index is not used until all modified tracks have been reindexed
+    EXPECT_FALSE(searchIndex.synchronize(1));
+    EXPECT_FALSE(searchIndex.isSynchronized());
+    EXPECT_TRUE(searchIndex.formatQueryForTrackIdsContaining({"title"}, "cover").isEmpty());
+    EXPECT_TRUE(searchIndex.synchronize(1));
+    EXPECT_TRUE(searchIndex.isSynchronized());
+
+    const auto findTracks = [&searchIndex, this](const QString& foldedSearchTerm) {
+        QSet<TrackId> trackIds;
+        EXPECT_TRUE(searchIndex.synchronize());
+        QSqlQuery query(internalCollection()->database());
+        EXPECT_TRUE(query.exec(searchIndex.formatQueryForTrackIdsContaining(
+                {"artist", "location"}, foldedSearchTerm)));
+        while (query.next()) {
+            trackIds.insert(TrackId(query.value(0)));
+        }
+        return trackIds;
+    };
+    EXPECT_EQ(QSet<TrackId>({trackIdA, trackIdB}), findTracks("cover-test"));
+
+    // Modifications that bypass TrackDAO are recorded by the triggers
+    QSqlQuery query(internalCollection()->database());
+    ASSERT_TRUE(query.exec(QStringLiteral(
+            "UPDATE library SET artist='Sigur R\u00f3s' WHERE id=%1")
+                                   .arg(trackIdA.toString())));
+    EXPECT_EQ(QSet<TrackId>({trackIdA}), findTracks("sigur ros"));
+
+    ASSERT_TRUE(query.exec(QStringLiteral(
+            "UPDATE track_locations SET location='/moved/track.mp3' "
+            "WHERE id=(SELECT location FROM library WHERE id=%1)")
+                                   .arg(trackIdB.toString())));
+    EXPECT_EQ(QSet<TrackId>({trackIdA}), findTracks("cover-test"));
+    EXPECT_EQ(QSet<TrackId>({trackIdB}), findTracks("/moved/"));
+
+    ASSERT_TRUE(query.exec(QStringLiteral("DELETE FROM library WHERE id=%1")
+                                   .arg(trackIdA.toString())));
+    EXPECT_EQ(QSet<TrackId>(), findTracks("sigur ros"));
+}
+
+namespace {
+
+// A library of 200k tracks with a handful of distinct values, like the
+// benchmark of TrackColumnIndex. Compares the SQL queries of a text filter
+// with and without the search index, i.e. the queries of BaseTrackCache
+// for models with an extra filter.
+class SearchIndexBenchmark : public LibraryTest {
+  public:
+    static constexpr int kTrackCount = 200000;
+
+    SearchIndexBenchmark() {
+        const QStringList words = {"Love", "Night", "Sun", "Dance", "Rain", "Fire", "Dream"};
+        SqlTransaction transaction(database());
+        QSqlQuery insertLocation(database());
+        insertLocation.prepare(QStringLiteral(
+                "INSERT INTO track_locations "
+                "(id,location,filename,directory,filesize,fs_deleted,needs_verification) "
+                "VALUES (:id,:location,:filename,'/music',0,0,0)"));
+        QSqlQuery insertTrack(database());
+        insertTrack.prepare(QStringLiteral(
+                "INSERT INTO library (id,artist,title,album,location,mixxx_deleted) "
+                "VALUES (:id,:artist,:title,:album,:id,0)"));
+        for (int id = 1; id <= kTrackCount; ++id) {
+            const QString title =
+                    words[id % words.size()] + ' ' + words[(id / 7) % words.size()];
+            const QString filename = QStringLiteral("%1.mp3").arg(id);
+            insertLocation.bindValue(":id", id);
+            insertLocation.bindValue(":location", QStringLiteral("/music/") + filename);
+            insertLocation.bindValue(":filename", filename);
+            if (!insertLocation.exec()) {
+                LOG_FAILED_QUERY(insertLocation);
+                return;
+            }
+            insertTrack.bindValue(":id", id);
+            insertTrack.bindValue(":artist", QStringLiteral("Artist %1").arg(id % 5000));
+            insertTrack.bindValue(":title", title);
+            insertTrack.bindValue(":album", QStringLiteral("Album %1").arg(id % 20000));
+            if (!insertTrack.exec()) {
+                LOG_FAILED_QUERY(insertTrack);
+                return;
+            }
+        }
+        transaction.commit();
+
+        // Fill the index like TrackDAO does after startup
+        TrackSearchIndex& index = searchIndex();
+        for (int i = 0; i <= kTrackCount / TrackSearchIndex::kMaxSynchronousUpdates &&
+                index.isAvailable() && !index.synchronize();
+                ++i) {
+        }
+    }
+
+    void TestBody() override {
+    }
+
+    QSqlDatabase database() const {
+        return internalCollection()->database();
+    }
+
+    TrackSearchIndex& searchIndex() const {
+        return internalCollection()->getTrackDAO().searchIndex();
+    }
+
+    void selectTracks(benchmark::State& state, const TextFilterNode& filter) const {
+        const QString queryString =
+                QStringLiteral("SELECT id FROM library WHERE ") + filter.toSql();
+        QSqlQuery query(database());
+        query.setForwardOnly(true);
+        for (auto _ : state) {
+            if (!query.exec(queryString)) {
+                LOG_FAILED_QUERY(query);
+                state.SkipWithError("Query failed");
+                return;
+            }
+            int trackCount = 0;
+            while (query.next()) {
+                ++trackCount;
+            }
+            benchmark::DoNotOptimize(trackCount);
+        }
+    }
+};
+
+const QStringList kSearchColumns = {
+        LIBRARYTABLE_ARTIST,
+        LIBRARYTABLE_TITLE,
+        LIBRARYTABLE_ALBUM,
+};
+
+} // namespace
+
+static void BM_TextFilter_Like(benchmark::State& state, const char* searchTerm) {
+    const SearchIndexBenchmark library;
+    const TextFilterNode filter(library.database(),
+            kSearchColumns,
+            QString::fromUtf8(searchTerm));
+    library.selectTracks(state, filter);
+}
+// Matches about a quarter of the tracks
+BENCHMARK_CAPTURE(BM_TextFilter_Like, common, "love")
+        ->Unit(benchmark::kMillisecond)
+        ->Iterations(20);
+// Matches 40 tracks
+BENCHMARK_CAPTURE(BM_TextFilter_Like, rare, "artist 4711")
+        ->Unit(benchmark::kMillisecond)
+        ->Iterations(20);
+
+static void BM_TextFilter_SearchIndex(benchmark::State& state, const char* searchTerm) {
+    const SearchIndexBenchmark library;
+    if (!library.searchIndex().isSynchronized()) {
+        state.SkipWithError("Full-text search is not supported by SQLite");
+        return;
+    }
+    const TextFilterNode filter(library.database(),
+            kSearchColumns,
+            QString::fromUtf8(searchTerm),
+            &library.searchIndex());
+    library.selectTracks(state, filter);
+}
+BENCHMARK_CAPTURE(BM_TextFilter_SearchIndex, common, "love")
+        ->Unit(benchmark::kMillisecond)
+        ->Iterations(20);
+BENCHMARK_CAPTURE(BM_TextFilter_SearchIndex, rare, "artist 4711")
+        ->Unit(benchmark::kMillisecond)
+        ->Iterations(20);
@@ -0,0 +1,245 @@
+#include "library/trackcolumnindex.h"
+
+#include <benchmark/benchmark.h>
+#include <gtest/gtest.h>
+
+#include <QSet>
+
+#include "library/columncache.h"
+#include "library/dao/trackschema.h"
+#include "library/searchquery.h"
+#include "library/searchqueryparser.h"
+#include "test/librarytest.h"
+#include "util/string.h"
+
+namespace {
+
+const QStringList kColumns = {
+        LIBRARYTABLE_ID,
+        LIBRARYTABLE_ARTIST,
+        LIBRARYTABLE_ALBUMARTIST,
+        LIBRARYTABLE_TITLE,
+        LIBRARYTABLE_BPM,
+        LIBRARYTABLE_KEY_ID,
+};
+
+QVector<QVariant> newRecord(int id,
+        const QString& artist,
+        const QString& title,
+        const QVariant& bpm,
+        mixxx::track::io::key::ChromaticKey key) {
+    return {id, artist, QString(), title, bpm, static_cast<int>(key)};
+}
+
+class TrackColumnIndexTest : public LibraryTest {
+  protected:
+    TrackColumnIndexTest()
+            : m_columnCache(kColumns),
+              m_index(&m_records, &m_columnCache, &m_collator),
+              m_parser(internalCollection()) {
+        using namespace mixxx::track::io::key;
+        addRecord(newRecord(1, "Björk", "Army of Me", 96.0, C_MINOR));
+        addRecord(newRecord(2, "bjorn", "Love Song", 128.0, A_MINOR));
+        addRecord(newRecord(3, "Aphex Twin", "Xtal", QVariant(), INVALID));
+        addRecord(newRecord(4, "aphex twin", "Love", 140.0, A_MINOR));
+        addRecord(newRecord(5, "Caribou", "Sun", 120.0, E_MINOR));
+    }
+
+    void addRecord(QVector<QVariant> record) {
+        const TrackId trackId(record.front());
+        m_records.insert(trackId, std::move(record));
+        m_index.updateRow(trackId);
+    }
+
+    // Returns the ids of all tracks that match the query
+    QSet<int> filter(const QString& query) {
+        return filter(*m_parser.parseQuery(
+                query, {LIBRARYTABLE_ARTIST, LIBRARYTABLE_TITLE}, QString()));
+    }
+
+    QSet<int> filter(const QueryNode& query) {
+        TrackColumnIndex::RowMask rows(m_index.rowCount(), 1);
+        EXPECT_TRUE(query.filterRows(m_index, &rows)) << query.toSql().toStdString();
+        QSet<int> trackIds;
+        for (int row = 0; row < m_index.rowCount(); ++row) {
+            if (rows[row]) {
+                trackIds.insert(m_index.trackId(row).toVariant().toInt());
+            }
+        }
+        return trackIds;
+    }
+
+    // Returns the ids of all tracks in sort order
+    QList<int> sort(const QList<TrackColumnIndex::SortSpec>& sortSpecs) {
+        std::vector<int> rows;
+        for (int row = 0; row < m_index.rowCount(); ++row) {
+            rows.push_back(row);
+        }
+        m_index.sortRows(&rows, sortSpecs);
+        QList<int> trackIds;
+        for (const int row : rows) {
+            trackIds.append(m_index.trackId(row).toVariant().toInt());
+        }
+        return trackIds;
+    }
+
+    const ColumnCache m_columnCache;
+    const mixxx::StringCollator m_collator;
+    QHash<TrackId, QVector<QVariant>> m_records;
+    TrackColumnIndex m_index;
+    SearchQueryParser m_parser;
+};
+
+TEST_F(TrackColumnIndexTest, TextFilterFoldsCaseAndAccents) {
+    EXPECT_EQ(QSet<int>({1, 2}), filter("BJOR"));
+    EXPECT_EQ(QSet<int>({3, 4}), filter("artist:\"Aphex Twin\""));
+    EXPECT_EQ(QSet<int>({2, 4}), filter("love"));
+    EXPECT_EQ(QSet<int>({2}), filter("love bjorn"));
+}
+
+TEST_F(TrackColumnIndexTest, NumericAndKeyFilters) {
+    EXPECT_EQ(QSet<int>({2, 4}), filter("bpm:>125"));
+    EXPECT_EQ(QSet<int>({1, 5}), filter("bpm:90-120"));
+    EXPECT_EQ(QSet<int>({5}), filter("bpm:=120"));
+    EXPECT_EQ(QSet<int>({3}), filter("bpm:\"\""));
+    EXPECT_EQ(QSet<int>({2, 4}), filter("key:Am"));
+}
+
+TEST_F(TrackColumnIndexTest, NegationAndAlternatives) {
+    EXPECT_EQ(QSet<int>({1, 3, 5}), filter("-love"));
+    EXPECT_EQ(QSet<int>({1, 3}), filter("-love -caribou"));
+
+    OrNode query;
+    query.addNode(std::make_unique<NumericFilterNode>(
+            QStringList{LIBRARYTABLE_BPM}, QStringLiteral("<100")));
+    query.addNode(std::make_unique<NumericFilterNode>(
+            QStringList{LIBRARYTABLE_BPM}, QStringLiteral(">130")));
+    query.addNode(std::make_unique<TextFilterNode>(
+            QSqlDatabase(), QStringList{LIBRARYTABLE_TITLE}, QStringLiteral("sun")));
+    EXPECT_EQ(QSet<int>({1, 4, 5}), filter(query));
+}
+
+TEST_F(TrackColumnIndexTest, SortByTextAndNumber) {
+    const int artist = m_columnCache.fieldIndex(LIBRARYTABLE_ARTIST);
+    const int bpm = m_columnCache.fieldIndex(LIBRARYTABLE_BPM);
+    // Equal artists are sorted by the next column and then by id
+    EXPECT_EQ(QList<int>({4, 3, 1, 2, 5}),
+            sort({{artist, TrackColumnIndex::SortType::Text, Qt::AscendingOrder},
+                    {bpm, TrackColumnIndex::SortType::Number, Qt::DescendingOrder}}));
+    // Missing numbers are sorted like 0
+    EXPECT_EQ(QList<int>({3, 1, 5, 2, 4}),
+            sort({{bpm, TrackColumnIndex::SortType::Number, Qt::AscendingOrder}}));
+    EXPECT_EQ(QList<int>({1, 2, 3, 4, 5}), sort({}));
+}
+
+TEST_F(TrackColumnIndexTest, CompareRowsInSortOrder) {
+    const QList<TrackColumnIndex::SortSpec> sortSpecs = {
+            {m_columnCache.fieldIndex(LIBRARYTABLE_ARTIST),
+                    TrackColumnIndex::SortType::Text,
+                    Qt::AscendingOrder},
+            {m_columnCache.fieldIndex(LIBRARYTABLE_BPM),
+                    TrackColumnIndex::SortType::Number,
+                    Qt::DescendingOrder}};
+    const QList<int> sortedTrackIds = sort(sortSpecs);
+    for (int i = 0; i < sortedTrackIds.size(); ++i) {
+        const int row = m_index.row(TrackId(sortedTrackIds[i]));
+        EXPECT_EQ(0, m_index.compareRows(row, row, sortSpecs));
+        for (int j = i + 1; j < sortedTrackIds.size(); ++j) {
+            const int otherRow = m_index.row(TrackId(sortedTrackIds[j]));
+            EXPECT_LT(m_index.compareRows(row, otherRow, sortSpecs), 0);
+            EXPECT_GT(m_index.compareRows(otherRow, row, sortSpecs), 0);
+        }
+    }
+}
+
+TEST_F(TrackColumnIndexTest, UpdateAndRemoveRows) {
+    // Build the columns before modifying the rows
+    EXPECT_EQ(QSet<int>({2, 4}), filter("love"));
+    EXPECT_EQ(QSet<int>({2, 4}), filter("bpm:>125"));
+
+    m_records[TrackId(5)][m_columnCache.fieldIndex(LIBRARYTABLE_TITLE)] = "Lovesick";
+    m_index.updateRow(TrackId(5));
+    m_records.remove(TrackId(2));
+    m_index.updateRow(TrackId(2));
+    m_index.removeRow(TrackId(1));
+    addRecord(newRecord(6, "Four Tet", "Love Cry", 129.0, mixxx::track::io::key::D_MAJOR));
+
+    EXPECT_EQ(4, m_index.rowCount());
+    EXPECT_EQ(-1, m_index.row(TrackId(1)));
+    EXPECT_EQ(-1, m_index.row(TrackId(2)));
+    EXPECT_EQ(QSet<int>({4, 5, 6}), filter("love"));
+    EXPECT_EQ(QSet<int>({4, 6}), filter("bpm:>125"));
+}
+
+TEST_F(TrackColumnIndexTest, UnknownColumnFallsBackToDatabase) {
+    const auto pQuery = m_parser.parseQuery("genre:techno", {}, QString());
+    TrackColumnIndex::RowMask rows(m_index.rowCount(), 1);
+    EXPECT_FALSE(pQuery->filterRows(m_index, &rows));
+}
+
+// A library of 200k tracks with a handful of distinct values
+class TrackColumnIndexBenchmark {
+  public:
+    static constexpr int kTrackCount = 200000;
+
+    TrackColumnIndexBenchmark()
+            : m_columnCache(kColumns),
+              m_index(&m_records, &m_columnCache, &m_collator) {
+        const QStringList words = {"Love", "Night", "Sun", "Dance", "Rain", "Fire", "Dream"};
+        for (int id = 1; id <= kTrackCount; ++id) {
+            const TrackId trackId(id);
+            m_records.insert(trackId,
+                    newRecord(id,
+                            QStringLiteral("Artist %1").arg(id % 5000),
+                            words[id % words.size()] + ' ' + words[(id / 7) % words.size()],
+                            80.0 + id % 90,
+                            static_cast<mixxx::track::io::key::ChromaticKey>(id % 25)));
+            m_index.updateRow(trackId);
+        }
+    }
+
+    const ColumnCache m_columnCache;
+    const mixxx::StringCollator m_collator;
+    QHash<TrackId, QVector<QVariant>> m_records;
+    TrackColumnIndex m_index;
+};
+
+static void BM_TrackColumnIndex_Filter(benchmark::State& state) {
+    TrackColumnIndexBenchmark library;
+    AndNode query;
+    query.addNode(std::make_unique<TextFilterNode>(QSqlDatabase(),
+            QStringList{LIBRARYTABLE_ARTIST, LIBRARYTABLE_TITLE},
+            QStringLiteral("love")));
+    query.addNode(std::make_unique<NumericFilterNode>(
+            QStringList{LIBRARYTABLE_BPM}, QStringLiteral(">120")));
+    TrackColumnIndex::RowMask rows;
+    for (auto _ : state) {
+        rows.assign(library.m_index.rowCount(), 1);
+        query.filterRows(library.m_index, &rows);
+        benchmark::DoNotOptimize(rows.data());
+    }
+}
+BENCHMARK(BM_TrackColumnIndex_Filter);
+
+static void BM_TrackColumnIndex_Sort(benchmark::State& state) {
+    TrackColumnIndexBenchmark library;
+    const QList<TrackColumnIndex::SortSpec> sortSpecs = {
+            {library.m_columnCache.fieldIndex(LIBRARYTABLE_ARTIST),
+                    TrackColumnIndex::SortType::Text,
+                    Qt::AscendingOrder},
+            {library.m_columnCache.fieldIndex(LIBRARYTABLE_BPM),
+                    TrackColumnIndex::SortType::Number,
+                    Qt::DescendingOrder}};
+    std::vector<int> rows;
+    for (auto _ : state) {
+        rows.clear();
+        for (int row = 0; row < library.m_index.rowCount(); ++row) {
+            rows.push_back(row);
+        }
+        library.m_index.sortRows(&rows, sortSpecs);
+        benchmark::DoNotOptimize(rows.data());
+    }
+}
+BENCHMARK(BM_TrackColumnIndex_Sort);
+
+} // namespace
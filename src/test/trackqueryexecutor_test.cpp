@@ -0,0 +1,143 @@
+#include "library/trackqueryexecutor.h"
+
+#include <gtest/gtest.h>
+
+#include <QElapsedTimer>
+#include <QSqlQuery>
+
+#include "test/librarytest.h"
+#include "track/track.h"
+
+namespace {
+
+// Selects the numbers from 1 to count
+QString formatSequenceQuery(int count) {
+    return QStringLiteral(
+            "WITH RECURSIVE seq(x) AS "
+            "(SELECT 1 UNION ALL SELECT x+1 FROM seq WHERE x<%1) "
+            "SELECT x FROM seq")
+            .arg(count);
+}
+
+class TrackQueryExecutorTest : public LibraryTest {
+  protected:
+    struct Result {
+        bool finished = false;
+        bool success = false;
+        QList<int> batchSizes;
+        QList<QVariant> firstColumn;
+    };
+
+    TrackQueryExecutorTest()
+            : m_pExecutor(trackCollectionManager()->queryExecutor()) {
+        QObject::connect(m_pExecutor,
+                &TrackQueryExecutor::rowsFetched,
+                &m_receiver,
+                [this](quint64 requestId, int query, const TrackQueryExecutor::Rows& rows) {
+                    EXPECT_EQ(0, query);
+                    Result& result = m_results[requestId];
+                    EXPECT_FALSE(result.finished);
+                    result.batchSizes.append(rows.size());
+                    for (const auto& row : rows) {
+                        result.firstColumn.append(row.value(0));
+                    }
+                });
+        QObject::connect(m_pExecutor,
+                &TrackQueryExecutor::requestFinished,
+                &m_receiver,
+                [this](quint64 requestId, bool success) {
+                    Result& result = m_results[requestId];
+                    EXPECT_FALSE(result.finished);
+                    result.finished = true;
+                    result.success = success;
+                });
+    }
+
+    quint64 submit(const QString& query,
+            const QMap<QString, QString>& views = {}) {
+        TrackQueryExecutor::Request request;
+        request.views = views;
+        request.queries.append(query);
+        return m_pExecutor->submit(this, std::move(request));
+    }
+
+    Result waitForResult(quint64 requestId) {
+        QElapsedTimer timer;
+        timer.start();
+        while (!m_results.value(requestId).finished && timer.elapsed() < 10000) {
+            application()->processEvents();
+            QThread::msleep(1);
+        }
+        // Deliver all signals that might have been emitted for
+        // cancelled requests
+        application()->processEvents();
+        return m_results.value(requestId);
+    }
+
+    TrackQueryExecutor* const m_pExecutor;
+    QObject m_receiver;
+    QMap<quint64, Result> m_results;
+};
+
+TEST_F(TrackQueryExecutorTest, DeliverRowsInBatches) {
+    const int rowCount = 2 * TrackQueryExecutor::kBatchSize + 1;
+    const Result result = waitForResult(submit(formatSequenceQuery(rowCount)));
+    ASSERT_TRUE(result.finished);
+    EXPECT_TRUE(result.success);
+    EXPECT_EQ(QList<int>({TrackQueryExecutor::kBatchSize, TrackQueryExecutor::kBatchSize, 1}),
+            result.batchSizes);
+    ASSERT_EQ(rowCount, result.firstColumn.size());
+    EXPECT_EQ(1, result.firstColumn.first().toInt());
+    EXPECT_EQ(rowCount, result.firstColumn.last().toInt());
+}
+
+TEST_F(TrackQueryExecutorTest, CreateTemporaryViews) {
+    const TrackPointer pTrack = getOrAddTrackByLocation(
+            getTestDir().filePath(QStringLiteral("id3-test-data/cover-test-jpg.mp3")));
+    ASSERT_TRUE(pTrack);
+
+    // The view only exists on the connection of the GUI thread
+    QSqlQuery query(internalCollection()->database());
+    ASSERT_TRUE(query.exec(QStringLiteral(
+            "CREATE TEMPORARY VIEW test_view AS SELECT id FROM library")));
+    const auto views = TrackQueryExecutor::temporaryViews(
+            internalCollection()->database(),
+            {QStringLiteral("test_view"), QStringLiteral("library")});
+    EXPECT_EQ(QStringList{QStringLiteral("test_view")}, views.keys());
+
+    Result result = waitForResult(submit(QStringLiteral("SELECT id FROM test_view"), views));
+    ASSERT_TRUE(result.finished);
+    EXPECT_TRUE(result.success);
+    EXPECT_EQ(QList<QVariant>{pTrack->getId().toVariant()}, result.firstColumn);
+
+    // A view with the same name but another definition is recreated
+    ASSERT_TRUE(query.exec(QStringLiteral("DROP VIEW test_view")));
+    ASSERT_TRUE(query.exec(QStringLiteral(
+            "CREATE TEMPORARY VIEW test_view AS SELECT id FROM library WHERE id<0")));
+    result = waitForResult(submit(QStringLiteral("SELECT id FROM test_view"),
+            TrackQueryExecutor::temporaryViews(
+                    internalCollection()->database(), {QStringLiteral("test_view")})));
+    ASSERT_TRUE(result.finished);
+    EXPECT_TRUE(result.success);
+    EXPECT_TRUE(result.firstColumn.isEmpty());
+}
+
+TEST_F(TrackQueryExecutorTest, SubmitCancelsPreviousRequest) {
+    // A query that takes a while to finish
+    const quint64 slowRequestId = submit(QStringLiteral("SELECT count(*) FROM (%1)")
+                                                 .arg(formatSequenceQuery(100000000)));
+    const Result result = waitForResult(submit(formatSequenceQuery(10)));
+    ASSERT_TRUE(result.finished);
+    EXPECT_TRUE(result.success);
+    EXPECT_EQ(10, result.firstColumn.size());
+    // Neither rows nor the result of the cancelled request are delivered
+    EXPECT_FALSE(m_results.contains(slowRequestId));
+}
+
+TEST_F(TrackQueryExecutorTest, ReportFailedQueries) {
+    const Result result = waitForResult(submit(QStringLiteral("SELECT id FROM no_such_table")));
+    ASSERT_TRUE(result.finished);
+    EXPECT_FALSE(result.success);
+}
+
+} // namespace
@@ -0,0 +1,13 @@
+#pragma once
+
+#include "util/types.h"
+
+/// Fills the buffer with reproducible white noise in [-0.5, 0.5). The same
+/// seed always produces the same samples, and *pSeed is advanced, so
+/// consecutive calls continue the sequence.
+inline void fillNoise(CSAMPLE* pBuffer, SINT numSamples, quint32* pSeed) {
+    for (SINT i = 0; i < numSamples; ++i) {
+        *pSeed = *pSeed * 1664525u + 1013904223u;
+        pBuffer[i] = static_cast<CSAMPLE>(*pSeed >> 8) / (1 << 24) - 0.5f;
+    }
+}
@@ -0,0 +1,142 @@
+#include "util/audiocallbackprofiler.h"
+
+#include <QStringList>
+#include <QtDebug>
+#include <atomic>
+
+#include "rigtorp/SPSCQueue.h"
+#include "util/mutex.h"
+#include "util/statsmanager.h"
+
+namespace {
+
+// About half a second of callbacks at 1 ms latency
+constexpr int kProfileQueueSize = 1 << 9;
+constexpr int kProcessLength = kProfileQueueSize * 3 / 4;
+
+std::atomic<bool> s_enabled{false};
+
+MMutex s_stageNamesMutex;
+
+QStringList s_stageNames GUARDED_BY(s_stageNamesMutex);
+
+/// Only grows, stage ids are never reused
+std::atomic<int> s_numStages{0};
+
+/// The accumulated time of each stage during the current callback
+std::atomic<qint64> s_stageNanos[AudioCallbackProfiler::kMaxRegisteredStages];
+
+// Only accessed from the audio thread
+bool s_inCallback = false;
+bool s_xrunReported = false;
+qint64 s_callbackStartNanos = 0;
+qint64 s_callbackBudgetNanos = 0;
+
+rigtorp::SPSCQueue<AudioCallbackProfile>& profileQueue() {
+    // Initialized by setEnabled() before the audio thread uses it
+    static rigtorp::SPSCQueue<AudioCallbackProfile> s_profiles(kProfileQueueSize);
+    return s_profiles;
+}
+
+} // namespace
+
+// static
+void AudioCallbackProfiler::setEnabled(bool enabled) {
+    if (enabled) {
+        profileQueue();
+    }
+    s_enabled.store(enabled, std::memory_order_release);
+}
+
+// static
+bool AudioCallbackProfiler::isEnabled() {
+    return s_enabled.load(std::memory_order_relaxed);
+}
+
+// static
+int AudioCallbackProfiler::registerStage(const QString& name) {
+    const MMutexLocker locker(&s_stageNamesMutex);
+    int stageId = s_stageNames.indexOf(name);
+    if (stageId >= 0) {
+        return stageId;
+    }
+    if (s_stageNames.size() >= kMaxRegisteredStages) {
+        qWarning() << "AudioCallbackProfiler: Too many stages, not profiling" << name;
+        return -1;
+    }
+    stageId = s_stageNames.size();
+    s_stageNames.append(name);
+    s_numStages.store(s_stageNames.size(), std::memory_order_release);
+    return stageId;
+}
+
+// static
+QString AudioCallbackProfiler::stageName(int stageId) {
+    const MMutexLocker locker(&s_stageNamesMutex);
+    return s_stageNames.value(stageId);
+}
+
+// static
+void AudioCallbackProfiler::beginCallback(mixxx::Duration budget, bool xrunReported) {
+    if (!isEnabled()) {
+        s_inCallback = false;
+        return;
+    }
+    s_inCallback = true;
+    s_xrunReported = xrunReported;
+    s_callbackBudgetNanos = budget.toIntegerNanos();
+    s_callbackStartNanos = mixxx::Time::elapsed().toIntegerNanos();
+}
+
+// static
+void AudioCallbackProfiler::endCallback() {
+    if (!s_inCallback) {
+        return;
+    }
+    s_inCallback = false;
+
+    AudioCallbackProfile profile;
+    profile.startNanos = s_callbackStartNanos;
+    profile.durationNanos = mixxx::Time::elapsed().toIntegerNanos() - s_callbackStartNanos;
+    profile.budgetNanos = s_callbackBudgetNanos;
+    profile.xrunReported = s_xrunReported;
+    profile.numStages = 0;
+    profile.numDroppedStages = 0;
+    const int numStages = s_numStages.load(std::memory_order_acquire);
+    for (int stageId = 0; stageId < numStages; ++stageId) {
+        const qint64 nanos = s_stageNanos[stageId].exchange(0, std::memory_order_relaxed);
+        if (nanos <= 0) {
+            continue;
+        }
+        if (profile.numStages < AudioCallbackProfile::kMaxStagesPerCallback) {
+            profile.stages[profile.numStages++] = {stageId, nanos};
+        } else {
+            ++profile.numDroppedStages;
+        }
+    }
+
+    auto& profiles = profileQueue();
+    // The profile is dropped if the StatsManager did not keep up
+    Q_UNUSED(profiles.try_push(profile));
+    if (profiles.size() >= kProcessLength && StatsManager::s_bStatsManagerEnabled) {
+        StatsManager::instance()->updateStats();
+    }
+}
+
+// static
+void AudioCallbackProfiler::addStageTime(int stageId, mixxx::Duration duration) {
+    DEBUG_ASSERT(stageId >= 0 && stageId < kMaxRegisteredStages);
+    s_stageNanos[stageId].fetch_add(duration.toIntegerNanos(), std::memory_order_relaxed);
+}
+
+// static
+bool AudioCallbackProfiler::takeProfile(AudioCallbackProfile* pProfile) {
+    auto& profiles = profileQueue();
+    const AudioCallbackProfile* pFront = profiles.front();
+    if (!pFront) {
+        return false;
+    }
+    *pProfile = *pFront;
+    profiles.pop();
+    return true;
+}
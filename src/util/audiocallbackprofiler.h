@@ -0,0 +1,102 @@
+#pragma once
+
+#include <QString>
+#include <QtGlobal>
+
+#include "util/class.h"
+#include "util/duration.h"
+#include "util/time.h"
+
+/// The timing of a single audio callback, broken down by stages.
+struct AudioCallbackProfile {
+    static constexpr int kMaxStagesPerCallback = 64;
+
+    struct StageTime {
+        int stageId;
+        qint64 nanos;
+    };
+
+    /// Start of the callback, relative to mixxx::Time::elapsed()
+    qint64 startNanos;
+    qint64 durationNanos;
+    /// The duration of the audio buffer that was processed
+    qint64 budgetNanos;
+    /// The sound device reported an xrun at the beginning of this callback,
+    /// which was usually caused by the preceding callback.
+    bool xrunReported;
+    int numStages;
+    StageTime stages[kMaxStagesPerCallback];
+    /// The number of stages that took time in this callback but did not
+    /// fit into stages
+    int numDroppedStages;
+
+    bool isOverrun() const {
+        return durationNanos > budgetNanos;
+    }
+};
+
+/// Records the time that each stage of the engine takes in the audio callback,
+/// to find out which subsystem has consumed the budget when an xrun happens.
+///
+/// Stages are registered by name outside the audio thread and identified by
+/// their id afterwards. The durations of all stages are accumulated during the
+/// callback, from the audio thread or the realtime workers, without locks or
+/// allocations. At the end of the callback, the profile is pushed into a
+/// lock-free ring that is drained by the StatsManager.
+///
+/// Stages may nest and channels are processed in parallel, so the sum of all
+/// stages does not necessarily match the duration of the callback.
+///
+/// The profiler is only enabled while the StatsManager exists, i.e. in
+/// developer mode or when a trace is written.
+class AudioCallbackProfiler final {
+  public:
+    static constexpr int kMaxRegisteredStages = 512;
+
+    static void setEnabled(bool enabled);
+    static bool isEnabled();
+
+    /// Returns the id of the stage with the given name, registering it if
+    /// needed, or -1 if there are too many stages. Not realtime safe.
+    static int registerStage(const QString& name);
+    static QString stageName(int stageId);
+
+    /// Called by the audio thread at the beginning of each callback.
+    static void beginCallback(mixxx::Duration budget, bool xrunReported);
+    /// Called by the audio thread at the end of each callback.
+    static void endCallback();
+    /// Called by any thread that is processing the current callback.
+    static void addStageTime(int stageId, mixxx::Duration duration);
+
+    /// Takes the oldest recorded profile. Must only be called from a
+    /// single thread, i.e. the StatsManager.
+    static bool takeProfile(AudioCallbackProfile* pProfile);
+
+  private:
+    AudioCallbackProfiler() = delete;
+};
+
+/// Adds the time until it goes out of scope to a stage of the current audio
+/// callback.
+class ScopedAudioCallbackStage final {
+  public:
+    explicit ScopedAudioCallbackStage(int stageId)
+            : m_stageId(AudioCallbackProfiler::isEnabled() ? stageId : -1) {
+        if (m_stageId >= 0) {
+            m_start = mixxx::Time::elapsed();
+        }
+    }
+
+    ~ScopedAudioCallbackStage() {
+        if (m_stageId >= 0) {
+            AudioCallbackProfiler::addStageTime(
+                    m_stageId, mixxx::Time::elapsed() - m_start);
+        }
+    }
+
+  private:
+    const int m_stageId;
+    mixxx::Duration m_start;
+
+    DISALLOW_COPY_AND_ASSIGN(ScopedAudioCallbackStage);
+};
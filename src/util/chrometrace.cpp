@@ -0,0 +1,123 @@
+#include "util/chrometrace.h"
+
+#include <QCoreApplication>
+#include <QIODevice>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QtDebug>
+#include <algorithm>
+
+#include "util/assert.h"
+
+namespace {
+
+const QString kCategory = QStringLiteral("mixxx");
+
+QString phaseForType(Stat::StatType type) {
+    switch (type) {
+    case Stat::EVENT_START:
+        return QStringLiteral("B");
+    case Stat::EVENT_END:
+        return QStringLiteral("E");
+    case Stat::EVENT:
+        return QStringLiteral("i");
+    case Stat::FLOW_START:
+        return QStringLiteral("s");
+    case Stat::FLOW_STEP:
+        return QStringLiteral("t");
+    case Stat::FLOW_END:
+        return QStringLiteral("f");
+    default:
+        return QString();
+    }
+}
+
+bool writeObject(QIODevice* pDevice, const QJsonObject& object, bool* pFirst) {
+    if (!*pFirst && pDevice->write(",\n") < 0) {
+        return false;
+    }
+    *pFirst = false;
+    return pDevice->write(QJsonDocument(object).toJson(QJsonDocument::Compact)) >= 0;
+}
+
+} // namespace
+
+// static
+bool ChromeTrace::write(QIODevice* pDevice,
+        QList<Event> events,
+        const QHash<int, QString>& threadNames) {
+    DEBUG_ASSERT(pDevice);
+    // Slices of the same thread must be ordered, the order of events with
+    // the same time stamp is kept.
+    std::stable_sort(events.begin(), events.end(), [](const Event& lhs, const Event& rhs) {
+        return lhs.m_time < rhs.m_time;
+    });
+
+    const qint64 pid = QCoreApplication::applicationPid();
+    if (pDevice->write("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n") < 0) {
+        return false;
+    }
+    bool first = true;
+
+    QJsonObject processName;
+    processName.insert(QStringLiteral("name"), QStringLiteral("process_name"));
+    processName.insert(QStringLiteral("ph"), QStringLiteral("M"));
+    processName.insert(QStringLiteral("pid"), pid);
+    processName.insert(QStringLiteral("args"),
+            QJsonObject{{QStringLiteral("name"), QCoreApplication::applicationName()}});
+    if (!writeObject(pDevice, processName, &first)) {
+        return false;
+    }
+
+    for (auto it = threadNames.constBegin(); it != threadNames.constEnd(); ++it) {
+        QJsonObject threadName;
+        threadName.insert(QStringLiteral("name"), QStringLiteral("thread_name"));
+        threadName.insert(QStringLiteral("ph"), QStringLiteral("M"));
+        threadName.insert(QStringLiteral("pid"), pid);
+        threadName.insert(QStringLiteral("tid"), it.key());
+        threadName.insert(QStringLiteral("args"),
+                QJsonObject{{QStringLiteral("name"), it.value()}});
+        if (!writeObject(pDevice, threadName, &first)) {
+            return false;
+        }
+    }
+
+    for (const Event& event : qAsConst(events)) {
+        const QString phase = phaseForType(event.m_type);
+        if (phase.isEmpty()) {
+            qWarning() << "ChromeTrace: Skipping event of unsupported type"
+                       << Stat::statTypeToString(event.m_type) << event.m_tag;
+            continue;
+        }
+        QJsonObject object;
+        object.insert(QStringLiteral("name"), event.m_tag);
+        object.insert(QStringLiteral("cat"), kCategory);
+        object.insert(QStringLiteral("ph"), phase);
+        // The trace event format expects microseconds
+        object.insert(QStringLiteral("ts"), event.m_time.toDoubleMicros());
+        object.insert(QStringLiteral("pid"), pid);
+        object.insert(QStringLiteral("tid"), event.m_threadId);
+        switch (event.m_type) {
+        case Stat::EVENT:
+            // Only draw the instant event on the track of its thread
+            object.insert(QStringLiteral("s"), QStringLiteral("t"));
+            break;
+        case Stat::FLOW_START:
+        case Stat::FLOW_STEP:
+            object.insert(QStringLiteral("id"), QString::number(event.m_flowId));
+            break;
+        case Stat::FLOW_END:
+            object.insert(QStringLiteral("id"), QString::number(event.m_flowId));
+            // Bind to the enclosing slice instead of the next one
+            object.insert(QStringLiteral("bp"), QStringLiteral("e"));
+            break;
+        default:
+            break;
+        }
+        if (!writeObject(pDevice, object, &first)) {
+            return false;
+        }
+    }
+
+    return pDevice->write("\n]}\n") >= 0;
+}
@@ -0,0 +1,27 @@
+#pragma once
+
+#include <QHash>
+#include <QList>
+#include <QString>
+
+#include "util/event.h"
+
+class QIODevice;
+
+/// Writes recorded events in the JSON trace event format that is understood
+/// by chrome://tracing and https://ui.perfetto.dev
+///
+/// Each thread that has reported events is shown as a separate track. Pairs
+/// of EVENT_START/EVENT_END become slices on the track of their thread and
+/// flows are drawn as arrows between the enclosing slices.
+class ChromeTrace final {
+  public:
+    /// The events do not need to be sorted. The thread names are looked up
+    /// by Event::m_threadId.
+    static bool write(QIODevice* pDevice,
+            QList<Event> events,
+            const QHash<int, QString>& threadNames);
+
+  private:
+    ChromeTrace() = delete;
+};
@@ -11,6 +11,7 @@
 #include <QCoreApplication>
 #include <QProcessEnvironment>
 #include <QStandardPaths>
+#include <QThread>
 
 #include "config.h"
 #include "defs_urls.h"
@@ -22,6 +23,8 @@ CmdlineArgs::CmdlineArgs()
           m_controllerDebug(false),
           m_developer(false),
           m_safeMode(false),
+          m_analyzeLibrary(false),
+          m_analyzerThreads(QThread::idealThreadCount()),
           m_useVuMeterGL(true),
           m_debugAssertBreak(false),
           m_settingsPathSet(false),
@@ -171,6 +174,15 @@ bool CmdlineArgs::parse(const QStringList& arguments, CmdlineArgs::ParseMode mod
     parser.addOption(timelinePath);
     parser.addOption(timelinePathDeprecated);
 
+    const QCommandLineOption tracePath(QStringLiteral("trace-path"),
+            forUserFeedback ? QCoreApplication::translate("CmdlineArgs",
+                                      "Path a trace of the recorded events is written to on "
+                                      "exit. The JSON file can be opened with "
+                                      "chrome://tracing or https://ui.perfetto.dev")
+                            : QString(),
+            QStringLiteral("path"));
+    parser.addOption(tracePath);
+
     const QCommandLineOption disableVuMeterGL(QStringLiteral("disable-vumetergl"),
             forUserFeedback ? QCoreApplication::translate("CmdlineArgs",
                                       "Do not use OpenGL vu meter")
@@ -211,6 +223,22 @@ bool CmdlineArgs::parse(const QStringList& arguments, CmdlineArgs::ParseMode mod
     parser.addOption(safeMode);
     parser.addOption(safeModeDeprecated);
 
+    const QCommandLineOption analyzeLibrary(QStringLiteral("analyze-library"),
+            forUserFeedback ? QCoreApplication::translate("CmdlineArgs",
+                                      "Analyzes all library tracks without beats, key, or "
+                                      "waveform and exits afterwards. Neither the GUI nor any "
+                                      "sound or controller devices are opened.")
+                            : QString());
+    parser.addOption(analyzeLibrary);
+
+    const QCommandLineOption analyzerThreads(QStringLiteral("analyzer-threads"),
+            forUserFeedback ? QCoreApplication::translate("CmdlineArgs",
+                                      "Number of tracks that are analyzed concurrently with "
+                                      "--analyze-library. Defaults to the number of CPU cores.")
+                            : QString(),
+            QStringLiteral("n"));
+    parser.addOption(analyzerThreads);
+
     const QCommandLineOption color(QStringLiteral("color"),
             forUserFeedback ? QCoreApplication::translate("CmdlineArgs",
                                       "[auto|always|never] Use colors on the console output.")
@@ -330,10 +358,26 @@ bool CmdlineArgs::parse(const QStringList& arguments, CmdlineArgs::ParseMode mod
         m_timelinePath = parser.value(timelinePathDeprecated);
     }
 
+    if (parser.isSet(tracePath)) {
+        m_tracePath = parser.value(tracePath);
+    }
+
     m_useVuMeterGL = !(parser.isSet(disableVuMeterGL) || parser.isSet(disableVuMeterGLDeprecated));
     m_controllerDebug = parser.isSet(controllerDebug) || parser.isSet(controllerDebugDeprecated);
     m_developer = parser.isSet(developer);
     m_safeMode = parser.isSet(safeMode) || parser.isSet(safeModeDeprecated);
+    m_analyzeLibrary = parser.isSet(analyzeLibrary);
+    if (parser.isSet(analyzerThreads)) {
+        bool ok = false;
+        const int numThreads = parser.value(analyzerThreads).toInt(&ok);
+        if (ok && numThreads > 0) {
+            m_analyzerThreads = numThreads;
+        } else {
+            fputs("\nanalyzer-threads must be a positive number!\n"
+                  "Mixxx will use one analyzer thread per CPU core.\n",
+                    stdout);
+        }
+    }
     m_debugAssertBreak = parser.isSet(debugAssertBreak) || parser.isSet(debugAssertBreakDeprecated);
 
     m_musicFiles = parser.positionalArguments();
@@ -35,7 +35,18 @@ class CmdlineArgs final {
         return m_controllerDebug;
     }
     bool getDeveloper() const { return m_developer; }
+    /// Stats and traces are only recorded in developer mode or when a
+    /// trace file has been requested.
+    bool getStatsEnabled() const {
+        return m_developer || getTraceEnabled();
+    }
     bool getSafeMode() const { return m_safeMode; }
+    bool getAnalyzeLibrary() const {
+        return m_analyzeLibrary;
+    }
+    int getAnalyzerThreads() const {
+        return m_analyzerThreads;
+    }
     bool useColors() const {
         return m_useColors;
     }
@@ -47,6 +58,9 @@ class CmdlineArgs final {
     mixxx::LogLevel getLogLevel() const { return m_logLevel; }
     mixxx::LogLevel getLogFlushLevel() const { return m_logFlushLevel; }
     bool getTimelineEnabled() const { return !m_timelinePath.isEmpty(); }
+    bool getTraceEnabled() const {
+        return !m_tracePath.isEmpty();
+    }
     const QString& getLocale() const { return m_locale; }
     const QString& getSettingsPath() const { return m_settingsPath; }
     void setSettingsPath(const QString& newSettingsPath) {
@@ -54,6 +68,9 @@ class CmdlineArgs final {
     }
     const QString& getResourcePath() const { return m_resourcePath; }
     const QString& getTimelinePath() const { return m_timelinePath; }
+    const QString& getTracePath() const {
+        return m_tracePath;
+    }
 
     void setScaleFactor(double scaleFactor) {
         m_scaleFactor = scaleFactor;
@@ -75,6 +92,8 @@ class CmdlineArgs final {
     bool m_controllerDebug;
     bool m_developer; // Developer Mode
     bool m_safeMode;
+    bool m_analyzeLibrary; // Analyze the library without GUI and exit
+    int m_analyzerThreads;
     bool m_useVuMeterGL;
     bool m_debugAssertBreak;
     bool m_settingsPathSet; // has --settingsPath been set on command line ?
@@ -87,4 +106,5 @@ class CmdlineArgs final {
     QString m_settingsPath;
     QString m_resourcePath;
     QString m_timelinePath;
+    QString m_tracePath;
 };
@@ -9,7 +9,9 @@
 class Event {
   public:
     Event()
-            : m_type(Stat::UNSPECIFIED) {
+            : m_type(Stat::UNSPECIFIED),
+              m_threadId(-1),
+              m_flowId(0) {
     }
 
     typedef Stat::StatType EventType;
@@ -17,6 +19,10 @@ class Event {
     QString m_tag;
     EventType m_type;
     mixxx::Duration m_time;
+    // Identifies the thread that has reported the event
+    int m_threadId;
+    // Only used for FLOW_START, FLOW_STEP and FLOW_END
+    quint64 m_flowId;
 
     static bool event(const QString& tag, Event::EventType type = Stat::EVENT) {
         return Stat::track(tag, type, Stat::experimentFlags(Stat::COUNT), 0.0);
@@ -30,6 +36,28 @@ class Event {
         return event(tag, Stat::EVENT_END);
     }
 
+    // Flows link the events of different threads, e.g. a request to its
+    // completion. All reports with the same tag and id belong to one flow.
+    // The id is passed as a double and must not exceed 2^53.
+    static bool flow(const QString& tag, Event::EventType type, quint64 flowId) {
+        return Stat::track(tag,
+                type,
+                Stat::experimentFlags(Stat::COUNT),
+                static_cast<double>(flowId));
+    }
+
+    static bool flowStart(const QString& tag, quint64 flowId) {
+        return flow(tag, Stat::FLOW_START, flowId);
+    }
+
+    static bool flowStep(const QString& tag, quint64 flowId) {
+        return flow(tag, Stat::FLOW_STEP, flowId);
+    }
+
+    static bool flowEnd(const QString& tag, quint64 flowId) {
+        return flow(tag, Stat::FLOW_END, flowId);
+    }
+
     // Disallow to use this class with implicit converted char strings.
     // This should not be uses to avoid unicode encoding and memory
     // allocation at every call. Use a static tag like this:
@@ -37,4 +65,8 @@ class Event {
     static bool event(const char*, Event::EventType) = delete;
     static bool start(const char*) = delete;
     static bool end(const char*) = delete;
+    static bool flow(const char*, Event::EventType, quint64) = delete;
+    static bool flowStart(const char*, quint64) = delete;
+    static bool flowStep(const char*, quint64) = delete;
+    static bool flowEnd(const char*, quint64) = delete;
 };
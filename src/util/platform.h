@@ -8,6 +8,7 @@
 #define M_MUST_USE_RESULT __attribute__((warn_unused_result))
 #define M_PREDICT_FALSE(x) (__builtin_expect(x, 0))
 #define M_PREDICT_TRUE(x) (__builtin_expect(!!(x), 1))
+#define M_ALWAYS_INLINE inline __attribute__((always_inline))
 #elif defined(_MSC_VER)
 // MSVC
 #define M_ALIGN(x) __declspec(align(x))
@@ -18,6 +19,7 @@
 #define M_MUST_USE_RESULT
 #define M_PREDICT_FALSE(x) (x)
 #define M_PREDICT_TRUE(x) (x)
+#define M_ALWAYS_INLINE __forceinline
 #else
 #error We do not support your compiler. Please email mixxx-devel@lists.sourceforge.net and tell us about your use case.
 #endif
@@ -1,5 +1,6 @@
 #include "util/sample.h"
 
+#include <atomic>
 #include <cstddef>
 #include <cstdlib>
 
@@ -38,8 +39,460 @@ constexpr bool useAlignedAlloc() {
             sizeof(CSAMPLE*) == sizeof(size_t);
 }
 
+
+// The loops of the hot functions below are compiled multiple times for
+// different instruction sets. The variant matching the CPU is selected once
+// at runtime, so distribution builds that target the SSE2 baseline still
+// benefit from AVX2/FMA and AVX-512 registers. The loop bodies are kept
+// plain to leave the vectorization to the compiler as before.
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define SAMPLEUTIL_RUNTIME_DISPATCH
+#define SAMPLEUTIL_TARGET_AVX2 __attribute__((target("avx2,fma")))
+#define SAMPLEUTIL_TARGET_AVX512 \
+    __attribute__((target("avx512f,avx512vl,avx512dq,avx512bw,avx2,fma")))
+#endif
+
+namespace kernel {
+
+M_ALWAYS_INLINE void applyGain(CSAMPLE* pBuffer,
+        CSAMPLE_GAIN gain,
+        SINT numSamples) {
+    // note: LOOP VECTORIZED.
+    for (SINT i = 0; i < numSamples; ++i) {
+        pBuffer[i] *= gain;
+    }
+}
+
+M_ALWAYS_INLINE void applyRampingGain(CSAMPLE* pBuffer,
+        CSAMPLE_GAIN start_gain,
+        CSAMPLE_GAIN gain_delta,
+        SINT numSamples) {
+    // note: LOOP VECTORIZED.
+    for (int i = 0; i < numSamples / 2; ++i) {
+        const CSAMPLE_GAIN gain = start_gain + gain_delta * i;
+        // a loop counter i += 2 prevents vectorizing.
+        pBuffer[i * 2] *= gain;
+        pBuffer[i * 2 + 1] *= gain;
+    }
+}
+
+M_ALWAYS_INLINE void add(CSAMPLE* M_RESTRICT pDest,
+        const CSAMPLE* M_RESTRICT pSrc,
+        SINT numSamples) {
+    // note: LOOP VECTORIZED.
+    for (SINT i = 0; i < numSamples; ++i) {
+        pDest[i] += pSrc[i];
+    }
+}
+
+M_ALWAYS_INLINE void addWithGain(CSAMPLE* M_RESTRICT pDest,
+        const CSAMPLE* M_RESTRICT pSrc,
+        CSAMPLE_GAIN gain,
+        SINT numSamples) {
+    // note: LOOP VECTORIZED.
+    for (SINT i = 0; i < numSamples; ++i) {
+        pDest[i] += pSrc[i] * gain;
+    }
+}
+
+M_ALWAYS_INLINE void addWithRampingGain(CSAMPLE* M_RESTRICT pDest,
+        const CSAMPLE* M_RESTRICT pSrc,
+        CSAMPLE_GAIN start_gain,
+        CSAMPLE_GAIN gain_delta,
+        SINT numSamples) {
+    // note: LOOP VECTORIZED.
+    for (int i = 0; i < numSamples / 2; ++i) {
+        const CSAMPLE_GAIN gain = start_gain + gain_delta * i;
+        pDest[i * 2] += pSrc[i * 2] * gain;
+        pDest[i * 2 + 1] += pSrc[i * 2 + 1] * gain;
+    }
+}
+
+M_ALWAYS_INLINE void copyWithGain(CSAMPLE* M_RESTRICT pDest,
+        const CSAMPLE* M_RESTRICT pSrc,
+        CSAMPLE_GAIN gain,
+        SINT numSamples) {
+    // note: LOOP VECTORIZED.
+    for (SINT i = 0; i < numSamples; ++i) {
+        pDest[i] = pSrc[i] * gain;
+    }
+}
+
+M_ALWAYS_INLINE void copyWithRampingGain(CSAMPLE* M_RESTRICT pDest,
+        const CSAMPLE* M_RESTRICT pSrc,
+        CSAMPLE_GAIN start_gain,
+        CSAMPLE_GAIN gain_delta,
+        SINT numSamples) {
+    // note: LOOP VECTORIZED only with "int i" (not SINT i)
+    for (int i = 0; i < numSamples / 2; ++i) {
+        const CSAMPLE_GAIN gain = start_gain + gain_delta * i;
+        pDest[i * 2] = pSrc[i * 2] * gain;
+        pDest[i * 2 + 1] = pSrc[i * 2 + 1] * gain;
+    }
+}
+
+M_ALWAYS_INLINE SampleUtil::CLIP_STATUS sumAbsPerChannel(CSAMPLE* pfAbsL,
+        CSAMPLE* pfAbsR,
+        const CSAMPLE* pBuffer,
+        SINT numSamples) {
+    CSAMPLE fAbsL = CSAMPLE_ZERO;
+    CSAMPLE fAbsR = CSAMPLE_ZERO;
+    CSAMPLE clippedL = 0;
+    CSAMPLE clippedR = 0;
+
+    // note: LOOP VECTORIZED.
+    for (SINT i = 0; i < numSamples / 2; ++i) {
+        CSAMPLE absl = fabs(pBuffer[i * 2]);
+        fAbsL += absl;
+        clippedL += absl > CSAMPLE_PEAK ? 1 : 0;
+        CSAMPLE absr = fabs(pBuffer[i * 2 + 1]);
+        fAbsR += absr;
+        // Replacing the code with a bool clipped will prevent vetorizing
+        clippedR += absr > CSAMPLE_PEAK ? 1 : 0;
+    }
+
+    *pfAbsL = fAbsL;
+    *pfAbsR = fAbsR;
+    SampleUtil::CLIP_STATUS clipping = SampleUtil::NO_CLIPPING;
+    if (clippedL > 0) {
+        clipping |= SampleUtil::CLIPPING_LEFT;
+    }
+    if (clippedR > 0) {
+        clipping |= SampleUtil::CLIPPING_RIGHT;
+    }
+    return clipping;
+}
+
+M_ALWAYS_INLINE void copyClampBuffer(CSAMPLE* M_RESTRICT pDest,
+        const CSAMPLE* M_RESTRICT pSrc,
+        SINT iNumSamples) {
+    // note: LOOP VECTORIZED.
+    for (SINT i = 0; i < iNumSamples; ++i) {
+        pDest[i] = SampleUtil::clampSample(pSrc[i]);
+    }
+}
+
+M_ALWAYS_INLINE void interleaveBuffer(CSAMPLE* M_RESTRICT pDest,
+        const CSAMPLE* M_RESTRICT pSrc1,
+        const CSAMPLE* M_RESTRICT pSrc2,
+        SINT numFrames) {
+    // note: LOOP VECTORIZED.
+    for (SINT i = 0; i < numFrames; ++i) {
+        pDest[2 * i] = pSrc1[i];
+        pDest[2 * i + 1] = pSrc2[i];
+    }
+}
+
+M_ALWAYS_INLINE void deinterleaveBuffer(CSAMPLE* M_RESTRICT pDest1,
+        CSAMPLE* M_RESTRICT pDest2,
+        const CSAMPLE* M_RESTRICT pSrc,
+        SINT numFrames) {
+    // note: LOOP VECTORIZED.
+    for (SINT i = 0; i < numFrames; ++i) {
+        pDest1[i] = pSrc[i * 2];
+        pDest2[i] = pSrc[i * 2 + 1];
+    }
+}
+
+// The kernels of SampleUtil::copyWithGains() for a number of channels
+// that is known at compile time, so the loop over the channels is unrolled
+// and each sample of pDest is written once. If kInPlace, the first channel
+// is pDest itself.
+template<int kNumChannels, bool kInPlace>
+M_ALWAYS_INLINE void copyWithGains(CSAMPLE* M_RESTRICT pDest,
+        const CSAMPLE* const* pSources,
+        const CSAMPLE_GAIN* pGains,
+        SINT numSamples) {
+    const CSAMPLE* pSrc[kNumChannels];
+    CSAMPLE_GAIN gains[kNumChannels];
+    for (int c = 0; c < kNumChannels; ++c) {
+        pSrc[c] = kInPlace && c == 0 ? pDest : pSources[c];
+        gains[c] = pGains[c];
+    }
+    for (SINT i = 0; i < numSamples; ++i) {
+        CSAMPLE sum = pSrc[0][i] * gains[0];
+        for (int c = 1; c < kNumChannels; ++c) {
+            sum += pSrc[c][i] * gains[c];
+        }
+        pDest[i] = sum;
+    }
+}
+
+template<int kNumChannels, bool kInPlace>
+M_ALWAYS_INLINE void copyWithRampingGains(CSAMPLE* M_RESTRICT pDest,
+        const CSAMPLE* const* pSources,
+        const CSAMPLE_GAIN* pStartGains,
+        const CSAMPLE_GAIN* pGainDeltas,
+        SINT numSamples) {
+    const CSAMPLE* pSrc[kNumChannels];
+    CSAMPLE_GAIN startGains[kNumChannels];
+    CSAMPLE_GAIN gainDeltas[kNumChannels];
+    for (int c = 0; c < kNumChannels; ++c) {
+        pSrc[c] = kInPlace && c == 0 ? pDest : pSources[c];
+        startGains[c] = pStartGains[c];
+        gainDeltas[c] = pGainDeltas[c];
+    }
+    for (int i = 0; i < numSamples / 2; ++i) {
+        CSAMPLE left = CSAMPLE_ZERO;
+        CSAMPLE right = CSAMPLE_ZERO;
+        for (int c = 0; c < kNumChannels; ++c) {
+            const CSAMPLE_GAIN gain = startGains[c] + gainDeltas[c] * i;
+            left += pSrc[c][i * 2] * gain;
+            right += pSrc[c][i * 2 + 1] * gain;
+        }
+        pDest[i * 2] = left;
+        pDest[i * 2 + 1] = right;
+    }
+}
+
+// Selects the instantiation for the number of channels
+template<bool kInPlace>
+M_ALWAYS_INLINE void copyWithGains(CSAMPLE* pDest,
+        const CSAMPLE* const* pSources,
+        const CSAMPLE_GAIN* pGains,
+        int numChannels,
+        SINT numSamples) {
+    switch (numChannels) {
+    case 1:
+        copyWithGains<1, kInPlace>(pDest, pSources, pGains, numSamples);
+        break;
+    case 2:
+        copyWithGains<2, kInPlace>(pDest, pSources, pGains, numSamples);
+        break;
+    case 3:
+        copyWithGains<3, kInPlace>(pDest, pSources, pGains, numSamples);
+        break;
+    case 4:
+        copyWithGains<4, kInPlace>(pDest, pSources, pGains, numSamples);
+        break;
+    default:
+        DEBUG_ASSERT(!"unsupported number of channels");
+    }
+}
+
+template<bool kInPlace>
+M_ALWAYS_INLINE void copyWithRampingGains(CSAMPLE* pDest,
+        const CSAMPLE* const* pSources,
+        const CSAMPLE_GAIN* pStartGains,
+        const CSAMPLE_GAIN* pGainDeltas,
+        int numChannels,
+        SINT numSamples) {
+    switch (numChannels) {
+    case 1:
+        copyWithRampingGains<1, kInPlace>(
+                pDest, pSources, pStartGains, pGainDeltas, numSamples);
+        break;
+    case 2:
+        copyWithRampingGains<2, kInPlace>(
+                pDest, pSources, pStartGains, pGainDeltas, numSamples);
+        break;
+    case 3:
+        copyWithRampingGains<3, kInPlace>(
+                pDest, pSources, pStartGains, pGainDeltas, numSamples);
+        break;
+    case 4:
+        copyWithRampingGains<4, kInPlace>(
+                pDest, pSources, pStartGains, pGainDeltas, numSamples);
+        break;
+    default:
+        DEBUG_ASSERT(!"unsupported number of channels");
+    }
+}
+
+} // namespace kernel
+
+// A table with one variant of each kernel, compiled for a specific
+// instruction set.
+struct KernelTable {
+    SampleUtil::SimdLevel level;
+    void (*applyGain)(CSAMPLE*, CSAMPLE_GAIN, SINT);
+    void (*applyRampingGain)(CSAMPLE*, CSAMPLE_GAIN, CSAMPLE_GAIN, SINT);
+    void (*add)(CSAMPLE*, const CSAMPLE*, SINT);
+    void (*addWithGain)(CSAMPLE*, const CSAMPLE*, CSAMPLE_GAIN, SINT);
+    void (*addWithRampingGain)(CSAMPLE*, const CSAMPLE*, CSAMPLE_GAIN, CSAMPLE_GAIN, SINT);
+    void (*copyWithGain)(CSAMPLE*, const CSAMPLE*, CSAMPLE_GAIN, SINT);
+    void (*copyWithRampingGain)(CSAMPLE*, const CSAMPLE*, CSAMPLE_GAIN, CSAMPLE_GAIN, SINT);
+    SampleUtil::CLIP_STATUS (*sumAbsPerChannel)(CSAMPLE*, CSAMPLE*, const CSAMPLE*, SINT);
+    void (*copyClampBuffer)(CSAMPLE*, const CSAMPLE*, SINT);
+    void (*interleaveBuffer)(CSAMPLE*, const CSAMPLE*, const CSAMPLE*, SINT);
+    void (*deinterleaveBuffer)(CSAMPLE*, CSAMPLE*, const CSAMPLE*, SINT);
+    void (*copyWithGains)(CSAMPLE*, const CSAMPLE* const*, const CSAMPLE_GAIN*, int, SINT);
+    void (*copyWithRampingGains)(CSAMPLE*,
+            const CSAMPLE* const*,
+            const CSAMPLE_GAIN*,
+            const CSAMPLE_GAIN*,
+            int,
+            SINT);
+};
+
+// Defines a namespace with all kernels compiled with the given target
+// attributes and the corresponding KernelTable.
+#define SAMPLEUTIL_DEFINE_KERNEL_TABLE(NAMESPACE, LEVEL, TARGET)                \
+    namespace NAMESPACE {                                                      \
+    TARGET void applyGain(CSAMPLE* pBuffer, CSAMPLE_GAIN gain, SINT n) {        \
+        kernel::applyGain(pBuffer, gain, n);                                   \
+    }                                                                          \
+    TARGET void applyRampingGain(                                              \
+            CSAMPLE* pBuffer, CSAMPLE_GAIN start, CSAMPLE_GAIN delta, SINT n) { \
+        kernel::applyRampingGain(pBuffer, start, delta, n);                    \
+    }                                                                          \
+    TARGET void add(CSAMPLE* pDest, const CSAMPLE* pSrc, SINT n) {              \
+        kernel::add(pDest, pSrc, n);                                           \
+    }                                                                          \
+    TARGET void addWithGain(                                                   \
+            CSAMPLE* pDest, const CSAMPLE* pSrc, CSAMPLE_GAIN gain, SINT n) {   \
+        kernel::addWithGain(pDest, pSrc, gain, n);                             \
+    }                                                                          \
+    TARGET void addWithRampingGain(CSAMPLE* pDest,                             \
+            const CSAMPLE* pSrc,                                               \
+            CSAMPLE_GAIN start,                                                \
+            CSAMPLE_GAIN delta,                                                \
+            SINT n) {                                                          \
+        kernel::addWithRampingGain(pDest, pSrc, start, delta, n);              \
+    }                                                                          \
+    TARGET void copyWithGain(                                                  \
+            CSAMPLE* pDest, const CSAMPLE* pSrc, CSAMPLE_GAIN gain, SINT n) {   \
+        kernel::copyWithGain(pDest, pSrc, gain, n);                            \
+    }                                                                          \
+    TARGET void copyWithRampingGain(CSAMPLE* pDest,                            \
+            const CSAMPLE* pSrc,                                               \
+            CSAMPLE_GAIN start,                                                \
+            CSAMPLE_GAIN delta,                                                \
+            SINT n) {                                                          \
+        kernel::copyWithRampingGain(pDest, pSrc, start, delta, n);             \
+    }                                                                          \
+    TARGET SampleUtil::CLIP_STATUS sumAbsPerChannel(                           \
+            CSAMPLE* pfAbsL, CSAMPLE* pfAbsR, const CSAMPLE* pBuffer, SINT n) { \
+        return kernel::sumAbsPerChannel(pfAbsL, pfAbsR, pBuffer, n);           \
+    }                                                                          \
+    TARGET void copyClampBuffer(CSAMPLE* pDest, const CSAMPLE* pSrc, SINT n) {  \
+        kernel::copyClampBuffer(pDest, pSrc, n);                               \
+    }                                                                          \
+    TARGET void interleaveBuffer(CSAMPLE* pDest,                               \
+            const CSAMPLE* pSrc1,                                              \
+            const CSAMPLE* pSrc2,                                              \
+            SINT n) {                                                          \
+        kernel::interleaveBuffer(pDest, pSrc1, pSrc2, n);                      \
+    }                                                                          \
+    TARGET void deinterleaveBuffer(                                            \
+            CSAMPLE* pDest1, CSAMPLE* pDest2, const CSAMPLE* pSrc, SINT n) {    \
+        kernel::deinterleaveBuffer(pDest1, pDest2, pSrc, n);                   \
+    }                                                                          \
+    TARGET void copyWithGains(CSAMPLE* pDest,                                  \
+            const CSAMPLE* const* pSources,                                    \
+            const CSAMPLE_GAIN* pGains,                                        \
+            int numChannels,                                                   \
+            SINT n) {                                                          \
+        if (pSources[0] == pDest) {                                            \
+            kernel::copyWithGains<true>(                                       \
+                    pDest, pSources, pGains, numChannels, n);                  \
+        } else {                                                               \
+            kernel::copyWithGains<false>(                                      \
+                    pDest, pSources, pGains, numChannels, n);                  \
+        }                                                                      \
+    }                                                                          \
+    TARGET void copyWithRampingGains(CSAMPLE* pDest,                           \
+            const CSAMPLE* const* pSources,                                    \
+            const CSAMPLE_GAIN* pStartGains,                                   \
+            const CSAMPLE_GAIN* pGainDeltas,                                   \
+            int numChannels,                                                   \
+            SINT n) {                                                          \
+        if (pSources[0] == pDest) {                                            \
+            kernel::copyWithRampingGains<true>(                                \
+                    pDest, pSources, pStartGains, pGainDeltas, numChannels, n);\
+        } else {                                                               \
+            kernel::copyWithRampingGains<false>(                               \
+                    pDest, pSources, pStartGains, pGainDeltas, numChannels, n);\
+        }                                                                      \
+    }                                                                          \
+    constexpr KernelTable kKernelTable = {                                     \
+            LEVEL,                                                             \
+            &applyGain,                                                        \
+            &applyRampingGain,                                                 \
+            &add,                                                              \
+            &addWithGain,                                                      \
+            &addWithRampingGain,                                               \
+            &copyWithGain,                                                     \
+            &copyWithRampingGain,                                              \
+            &sumAbsPerChannel,                                                 \
+            &copyClampBuffer,                                                  \
+            &interleaveBuffer,                                                 \
+            &deinterleaveBuffer,                                               \
+            &copyWithGains,                                                    \
+            &copyWithRampingGains,                                             \
+    };                                                                         \
+    }
+
+SAMPLEUTIL_DEFINE_KERNEL_TABLE(baseline, SampleUtil::SimdLevel::Baseline, )
+#ifdef SAMPLEUTIL_RUNTIME_DISPATCH
+SAMPLEUTIL_DEFINE_KERNEL_TABLE(avx2, SampleUtil::SimdLevel::Avx2, SAMPLEUTIL_TARGET_AVX2)
+SAMPLEUTIL_DEFINE_KERNEL_TABLE(avx512, SampleUtil::SimdLevel::Avx512, SAMPLEUTIL_TARGET_AVX512)
+#endif
+
+const KernelTable* kernelTableForLevel(SampleUtil::SimdLevel level) {
+    switch (level) {
+#ifdef SAMPLEUTIL_RUNTIME_DISPATCH
+    case SampleUtil::SimdLevel::Avx512:
+        return &avx512::kKernelTable;
+    case SampleUtil::SimdLevel::Avx2:
+        return &avx2::kKernelTable;
+#endif
+    default:
+        return &baseline::kKernelTable;
+    }
+}
+
+// Constant initialized, so it is safe to use during static initialization
+// of other translation units. nullptr until the CPU has been detected.
+std::atomic<const KernelTable*> s_pKernelTable{nullptr};
+
+inline const KernelTable& kernels() {
+    const KernelTable* pKernelTable = s_pKernelTable.load(std::memory_order_relaxed);
+    if (M_PREDICT_FALSE(!pKernelTable)) {
+        pKernelTable = kernelTableForLevel(SampleUtil::maxSupportedSimdLevel());
+        s_pKernelTable.store(pKernelTable, std::memory_order_relaxed);
+    }
+    return *pKernelTable;
+}
+
 } // anonymous namespace
 
+// static
+SampleUtil::SimdLevel SampleUtil::maxSupportedSimdLevel() {
+#ifdef SAMPLEUTIL_RUNTIME_DISPATCH
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f") &&
+            __builtin_cpu_supports("avx512vl") &&
+            __builtin_cpu_supports("avx512dq") &&
+            __builtin_cpu_supports("avx512bw")) {
+        return SimdLevel::Avx512;
+    }
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+        return SimdLevel::Avx2;
+    }
+#endif
+    return SimdLevel::Baseline;
+}
+
+// static
+SampleUtil::SimdLevel SampleUtil::simdLevel() {
+    return kernels().level;
+}
+
+// static
+bool SampleUtil::setSimdLevel(SimdLevel level) {
+    if (level > maxSupportedSimdLevel()) {
+        return false;
+    }
+    const KernelTable* pKernelTable = kernelTableForLevel(level);
+    if (pKernelTable->level != level) {
+        // Not compiled for this platform
+        return false;
+    }
+    s_pKernelTable.store(pKernelTable, std::memory_order_relaxed);
+    return true;
+}
+
 // static
 CSAMPLE* SampleUtil::alloc(SINT size) {
     // To speed up vectorization we align our sample buffers to 16-byte (128
@@ -121,10 +574,7 @@ void SampleUtil::applyGain(CSAMPLE* pBuffer, CSAMPLE_GAIN gain,
         return;
     }
 
-    // note: LOOP VECTORIZED.
-    for (SINT i = 0; i < numSamples; ++i) {
-        pBuffer[i] *= gain;
-    }
+    kernels().applyGain(pBuffer, gain, numSamples);
 }
 
 // static
@@ -142,18 +592,9 @@ void SampleUtil::applyRampingGain(CSAMPLE* pBuffer, CSAMPLE_GAIN old_gain,
             / CSAMPLE_GAIN(numSamples / 2);
     if (gain_delta != 0) {
         const CSAMPLE_GAIN start_gain = old_gain + gain_delta;
-        // note: LOOP VECTORIZED.
-        for (int i = 0; i < numSamples / 2; ++i) {
-            const CSAMPLE_GAIN gain = start_gain + gain_delta * i;
-            // a loop counter i += 2 prevents vectorizing.
-            pBuffer[i * 2] *= gain;
-            pBuffer[i * 2 + 1] *= gain;
-        }
+        kernels().applyRampingGain(pBuffer, start_gain, gain_delta, numSamples);
     } else {
-        // note: LOOP VECTORIZED.
-        for (int i = 0; i < numSamples; ++i) {
-            pBuffer[i] *= old_gain;
-        }
+        kernels().applyGain(pBuffer, old_gain, numSamples);
     }
 }
 
@@ -236,10 +677,7 @@ void SampleUtil::applyRampingAlternatingGain(CSAMPLE* pBuffer,
 void SampleUtil::add(CSAMPLE* M_RESTRICT pDest,
         const CSAMPLE* M_RESTRICT pSrc,
         SINT numSamples) {
-    // note: LOOP VECTORIZED.
-    for (SINT i = 0; i < numSamples; ++i) {
-        pDest[i] += pSrc[i];
-    }
+    kernels().add(pDest, pSrc, numSamples);
 }
 
 // static
@@ -250,10 +688,7 @@ void SampleUtil::addWithGain(CSAMPLE* M_RESTRICT pDest,
         return;
     }
 
-    // note: LOOP VECTORIZED.
-    for (SINT i = 0; i < numSamples; ++i) {
-        pDest[i] += pSrc[i] * gain;
-    }
+    kernels().addWithGain(pDest, pSrc, gain, numSamples);
 }
 
 void SampleUtil::addWithRampingGain(CSAMPLE* M_RESTRICT pDest,
@@ -268,17 +703,9 @@ void SampleUtil::addWithRampingGain(CSAMPLE* M_RESTRICT pDest,
             / CSAMPLE_GAIN(numSamples / 2);
     if (gain_delta != 0) {
         const CSAMPLE_GAIN start_gain = old_gain + gain_delta;
-        // note: LOOP VECTORIZED.
-        for (int i = 0; i < numSamples / 2; ++i) {
-            const CSAMPLE_GAIN gain = start_gain + gain_delta * i;
-            pDest[i * 2] += pSrc[i * 2] * gain;
-            pDest[i * 2 + 1] += pSrc[i * 2 + 1] * gain;
-        }
+        kernels().addWithRampingGain(pDest, pSrc, start_gain, gain_delta, numSamples);
     } else {
-        // note: LOOP VECTORIZED.
-        for (int i = 0; i < numSamples; ++i) {
-            pDest[i] += pSrc[i] * old_gain;
-        }
+        kernels().addWithGain(pDest, pSrc, old_gain, numSamples);
     }
 }
 
@@ -337,10 +764,7 @@ void SampleUtil::copyWithGain(CSAMPLE* M_RESTRICT pDest,
         return;
     }
 
-    // note: LOOP VECTORIZED.
-    for (SINT i = 0; i < numSamples; ++i) {
-        pDest[i] = pSrc[i] * gain;
-    }
+    kernels().copyWithGain(pDest, pSrc, gain, numSamples);
 
     // OR! need to test which fares better
     // copy(pDest, pSrc, iNumSamples);
@@ -366,17 +790,9 @@ void SampleUtil::copyWithRampingGain(CSAMPLE* M_RESTRICT pDest,
             / CSAMPLE_GAIN(numSamples / 2);
     if (gain_delta != 0) {
         const CSAMPLE_GAIN start_gain = old_gain + gain_delta;
-        // note: LOOP VECTORIZED only with "int i" (not SINT i)
-        for (int i = 0; i < numSamples / 2; ++i) {
-            const CSAMPLE_GAIN gain = start_gain + gain_delta * i;
-            pDest[i * 2] = pSrc[i * 2] * gain;
-            pDest[i * 2 + 1] = pSrc[i * 2 + 1] * gain;
-        }
+        kernels().copyWithRampingGain(pDest, pSrc, start_gain, gain_delta, numSamples);
     } else {
-        // note: LOOP VECTORIZED.
-        for (SINT i = 0; i < numSamples; ++i) {
-            pDest[i] = pSrc[i] * old_gain;
-        }
+        kernels().copyWithGain(pDest, pSrc, old_gain, numSamples);
     }
 
     // OR! need to test which fares better
@@ -384,6 +800,63 @@ void SampleUtil::copyWithRampingGain(CSAMPLE* M_RESTRICT pDest,
     // applyRampingGain(pDest, gain);
 }
 
+// static
+void SampleUtil::mixBlockWithGain(bool add,
+        CSAMPLE* pDest,
+        const CSAMPLE* pSrc,
+        CSAMPLE_GAIN gain,
+        SINT numSamples) {
+    if (pDest == pSrc) {
+        // The other kernels require distinct buffers
+        kernels().applyGain(pDest, add ? CSAMPLE_GAIN_ONE + gain : gain, numSamples);
+    } else if (add) {
+        kernels().addWithGain(pDest, pSrc, gain, numSamples);
+    } else {
+        kernels().copyWithGain(pDest, pSrc, gain, numSamples);
+    }
+}
+
+// static
+void SampleUtil::mixBlockWithRampingGain(bool add,
+        CSAMPLE* pDest,
+        const CSAMPLE* pSrc,
+        CSAMPLE_GAIN startGain,
+        CSAMPLE_GAIN gainDelta,
+        SINT numSamples) {
+    if (pDest == pSrc) {
+        kernels().applyRampingGain(pDest,
+                add ? CSAMPLE_GAIN_ONE + startGain : startGain,
+                gainDelta,
+                numSamples);
+    } else if (add) {
+        kernels().addWithRampingGain(pDest, pSrc, startGain, gainDelta, numSamples);
+    } else {
+        kernels().copyWithRampingGain(pDest, pSrc, startGain, gainDelta, numSamples);
+    }
+}
+
+// static
+void SampleUtil::mixFusedWithGains(CSAMPLE* pDest,
+        const CSAMPLE* const* pSources,
+        const CSAMPLE_GAIN* pGains,
+        int numChannels,
+        SINT numSamples) {
+    DEBUG_ASSERT(numChannels > 0 && numChannels <= static_cast<int>(kMaxFusedChannels));
+    kernels().copyWithGains(pDest, pSources, pGains, numChannels, numSamples);
+}
+
+// static
+void SampleUtil::mixFusedWithRampingGains(CSAMPLE* pDest,
+        const CSAMPLE* const* pSources,
+        const CSAMPLE_GAIN* pStartGains,
+        const CSAMPLE_GAIN* pGainDeltas,
+        int numChannels,
+        SINT numSamples) {
+    DEBUG_ASSERT(numChannels > 0 && numChannels <= static_cast<int>(kMaxFusedChannels));
+    kernels().copyWithRampingGains(
+            pDest, pSources, pStartGains, pGainDeltas, numChannels, numSamples);
+}
+
 // static
 void SampleUtil::convertS16ToFloat32(CSAMPLE* M_RESTRICT pDest,
         const SAMPLE* M_RESTRICT pSrc, SINT numSamples) {
@@ -416,32 +889,7 @@ void SampleUtil::convertFloat32ToS16(SAMPLE* pDest, const CSAMPLE* pSrc,
 // static
 SampleUtil::CLIP_STATUS SampleUtil::sumAbsPerChannel(CSAMPLE* pfAbsL,
         CSAMPLE* pfAbsR, const CSAMPLE* pBuffer, SINT numSamples) {
-    CSAMPLE fAbsL = CSAMPLE_ZERO;
-    CSAMPLE fAbsR = CSAMPLE_ZERO;
-    CSAMPLE clippedL = 0;
-    CSAMPLE clippedR = 0;
-
-    // note: LOOP VECTORIZED.
-    for (SINT i = 0; i < numSamples / 2; ++i) {
-        CSAMPLE absl = fabs(pBuffer[i * 2]);
-        fAbsL += absl;
-        clippedL += absl > CSAMPLE_PEAK ? 1 : 0;
-        CSAMPLE absr = fabs(pBuffer[i * 2 + 1]);
-        fAbsR += absr;
-        // Replacing the code with a bool clipped will prevent vetorizing
-        clippedR += absr > CSAMPLE_PEAK ? 1 : 0;
-    }
-
-    *pfAbsL = fAbsL;
-    *pfAbsR = fAbsR;
-    SampleUtil::CLIP_STATUS clipping = SampleUtil::NO_CLIPPING;
-    if (clippedL > 0) {
-        clipping |= SampleUtil::CLIPPING_LEFT;
-    }
-    if (clippedR > 0) {
-        clipping |= SampleUtil::CLIPPING_RIGHT;
-    }
-    return clipping;
+    return kernels().sumAbsPerChannel(pfAbsL, pfAbsR, pBuffer, numSamples);
 }
 
 // static
@@ -471,13 +919,20 @@ CSAMPLE SampleUtil::maxAbsAmplitude(const CSAMPLE* pBuffer, SINT numSamples) {
     return max;
 }
 
+// static
+bool SampleUtil::isSilent(const CSAMPLE* pBuffer, SINT numSamples) {
+    for (SINT i = 0; i < numSamples; ++i) {
+        if (fabs(pBuffer[i]) > kSilenceThreshold) {
+            return false;
+        }
+    }
+    return true;
+}
+
 // static
 void SampleUtil::copyClampBuffer(CSAMPLE* M_RESTRICT pDest,
         const CSAMPLE* M_RESTRICT pSrc, SINT iNumSamples) {
-    // note: LOOP VECTORIZED.
-    for (SINT i = 0; i < iNumSamples; ++i) {
-        pDest[i] = clampSample(pSrc[i]);
-    }
+    kernels().copyClampBuffer(pDest, pSrc, iNumSamples);
 }
 
 // static
@@ -485,11 +940,7 @@ void SampleUtil::interleaveBuffer(CSAMPLE* M_RESTRICT pDest,
         const CSAMPLE* M_RESTRICT pSrc1,
         const CSAMPLE* M_RESTRICT pSrc2,
         SINT numFrames) {
-    // note: LOOP VECTORIZED.
-    for (SINT i = 0; i < numFrames; ++i) {
-        pDest[2 * i] = pSrc1[i];
-        pDest[2 * i + 1] = pSrc2[i];
-    }
+    kernels().interleaveBuffer(pDest, pSrc1, pSrc2, numFrames);
 }
 
 // static
@@ -497,11 +948,7 @@ void SampleUtil::deinterleaveBuffer(CSAMPLE* M_RESTRICT pDest1,
         CSAMPLE* M_RESTRICT pDest2,
         const CSAMPLE* M_RESTRICT pSrc,
         SINT numFrames) {
-    // note: LOOP VECTORIZED.
-    for (SINT i = 0; i < numFrames; ++i) {
-        pDest1[i] = pSrc[i * 2];
-        pDest2[i] = pSrc[i * 2 + 1];
-    }
+    kernels().deinterleaveBuffer(pDest1, pDest2, pSrc, numFrames);
 }
 
 // static
@@ -5,6 +5,7 @@
 
 #include <QFlags>
 
+#include "util/assert.h"
 #include "util/types.h"
 #include "util/platform.h"
 
@@ -25,6 +26,26 @@ class SampleUtil {
     // This is some legacy, we cannot easily revert.
     static constexpr double kPlayPositionChannels = 2.0;
 
+    // The instruction sets for which the hot loops (applyGain,
+    // addWithRampingGain, sumAbsPerChannel, ...) are compiled. The best
+    // variant for the CPU is selected once at runtime. Baseline is the
+    // instruction set of the build, i.e. SSE2 for portable x86 builds.
+    enum class SimdLevel {
+        Baseline = 0,
+        Avx2 = 1, // AVX2 + FMA
+        Avx512 = 2,
+    };
+
+    // The highest SimdLevel supported by this CPU and build
+    static SimdLevel maxSupportedSimdLevel();
+
+    // The SimdLevel currently in use
+    static SimdLevel simdLevel();
+
+    // Overrides the detected SimdLevel for comparing the variants in tests
+    // and benchmarks. Returns false if the level is not supported.
+    static bool setSimdLevel(SimdLevel level);
+
     // Allocated a buffer of CSAMPLE's with length size. Ensures that the buffer
     // is 16-byte aligned for SSE enhancement.
     static CSAMPLE* alloc(SINT size);
@@ -226,6 +247,13 @@ class SampleUtil {
 
     static CSAMPLE maxAbsAmplitude(const CSAMPLE* pBuffer, SINT numSamples);
 
+    // The amplitude below which a sample is inaudible, about -100 dBFS
+    static constexpr CSAMPLE kSilenceThreshold = 0.00001f;
+
+    // Returns true if no sample of the buffer exceeds kSilenceThreshold.
+    // Returns at the first audible sample, which makes it cheap for music.
+    static bool isSilent(const CSAMPLE* pBuffer, SINT numSamples);
+
     // Copies every sample in pSrc to pDest, limiting the values in pDest
     // to the valid range of CSAMPLE. pDest and pSrc must not overlap.
     static void copyClampBuffer(CSAMPLE* pDest, const CSAMPLE* pSrc,
@@ -309,10 +337,202 @@ class SampleUtil {
     static void copyReverse(CSAMPLE* M_RESTRICT pDest,
             const CSAMPLE* M_RESTRICT pSrc, SINT numSamples);
 
+    // Gain policies for the mixing functions below.
+
+    // A gain that is constant for the whole buffer.
+    struct ConstantGain {
+        static constexpr bool kRamping = false;
+
+        CSAMPLE_GAIN gain;
+
+        bool isZero() const {
+            return gain == CSAMPLE_GAIN_ZERO;
+        }
+
+        // The gain of the first frame of the buffer and its change per frame
+        void getStartAndDelta(CSAMPLE_GAIN* pStartGain,
+                CSAMPLE_GAIN* pGainDelta,
+                SINT /*numSamples*/) const {
+            *pStartGain = gain;
+            *pGainDelta = CSAMPLE_GAIN_ZERO;
+        }
+
+        // Writes (add = false) or adds (add = true) the samples
+        // [begin, end) of pSrc multiplied by the gain to pDest.
+        void apply(bool add,
+                CSAMPLE* pDest,
+                const CSAMPLE* pSrc,
+                SINT begin,
+                SINT end,
+                SINT /*numSamples*/) const {
+            mixBlockWithGain(add, pDest + begin, pSrc + begin, gain, end - begin);
+        }
+    };
+
+    // A gain that ramps from oldGain to newGain over the whole buffer of
+    // numSamples stereo samples, like in copyWithRampingGain().
+    struct RampingGain {
+        static constexpr bool kRamping = true;
+
+        CSAMPLE_GAIN oldGain;
+        CSAMPLE_GAIN newGain;
+
+        bool isZero() const {
+            return oldGain == CSAMPLE_GAIN_ZERO && newGain == CSAMPLE_GAIN_ZERO;
+        }
+
+        void getStartAndDelta(CSAMPLE_GAIN* pStartGain,
+                CSAMPLE_GAIN* pGainDelta,
+                SINT numSamples) const {
+            *pGainDelta = (newGain - oldGain) / CSAMPLE_GAIN(numSamples / 2);
+            *pStartGain = oldGain + *pGainDelta;
+        }
+
+        void apply(bool add,
+                CSAMPLE* pDest,
+                const CSAMPLE* pSrc,
+                SINT begin,
+                SINT end,
+                SINT numSamples) const {
+            const CSAMPLE_GAIN gainDelta = (newGain - oldGain) /
+                    CSAMPLE_GAIN(numSamples / 2);
+            if (gainDelta == 0) {
+                mixBlockWithGain(add, pDest + begin, pSrc + begin, oldGain, end - begin);
+                return;
+            }
+            // The gain of the first frame of the block
+            const CSAMPLE_GAIN startGain = oldGain + gainDelta * (begin / 2 + 1);
+            mixBlockWithRampingGain(add,
+                    pDest + begin,
+                    pSrc + begin,
+                    startGain,
+                    gainDelta,
+                    end - begin);
+        }
+    };
+
+    // The number of samples of each channel that are mixed at once. Small
+    // enough that the blocks of 32 channels plus the destination fit into
+    // a typical 32 KiB L1 data cache. Must be even to not split frames.
+    static constexpr SINT kMixBlockSamples = 256;
 
-    // Include auto-generated methods (e.g. copyXWithGain, copyXWithRampingGain,
-    // etc.)
-#include "util/sample_autogen.h"
+    // Copies the sum of the kNumChannels source buffers, each multiplied by
+    // its gain, to pDest. Sources with a gain of zero are not read at all.
+    // pDest may be the first source buffer for mixing in place, but must
+    // not overlap any of the other source buffers, e.g.:
+    //
+    //   SampleUtil::copyWithGains<SampleUtil::ConstantGain>(pDest,
+    //           {pSrc1, pSrc2}, {gain1, gain2}, numSamples);
+    //
+    // Up to kMaxFusedChannels channels are mixed in a single pass over pDest
+    // by a kernel that is unrolled for the number of audible channels and
+    // selected for the CPU.
+    template<typename Gain, std::size_t kNumChannels>
+    static void copyWithGains(CSAMPLE* pDest,
+            const CSAMPLE* const (&pSources)[kNumChannels],
+            const Gain (&gains)[kNumChannels],
+            SINT numSamples) {
+        if constexpr (kNumChannels > kMaxFusedChannels) {
+            mixChannels(pDest, pSources, gains, static_cast<int>(kNumChannels), numSamples);
+        } else {
+            const CSAMPLE* audibleSources[kNumChannels];
+            CSAMPLE_GAIN startGains[kNumChannels];
+            CSAMPLE_GAIN gainDeltas[kNumChannels];
+            int numAudible = 0;
+            for (std::size_t i = 0; i < kNumChannels; ++i) {
+                DEBUG_ASSERT(i == 0 || pSources[i] != pDest);
+                if (gains[i].isZero()) {
+                    continue;
+                }
+                audibleSources[numAudible] = pSources[i];
+                gains[i].getStartAndDelta(&startGains[numAudible],
+                        &gainDeltas[numAudible],
+                        numSamples);
+                ++numAudible;
+            }
+            if (numAudible == 0) {
+                clear(pDest, numSamples);
+            } else if constexpr (Gain::kRamping) {
+                mixFusedWithRampingGains(pDest,
+                        audibleSources,
+                        startGains,
+                        gainDeltas,
+                        numAudible,
+                        numSamples);
+            } else {
+                mixFusedWithGains(pDest, audibleSources, startGains, numAudible, numSamples);
+            }
+        }
+    }
+
+    // The same for a number of channels that is only known at runtime.
+    template<typename Gain>
+    static void copyWithGains(CSAMPLE* pDest,
+            const CSAMPLE* const* pSources,
+            const Gain* pGains,
+            int numChannels,
+            SINT numSamples) {
+        mixChannels(pDest, pSources, pGains, numChannels, numSamples);
+    }
+
+  private:
+    static constexpr std::size_t kMaxFusedChannels = 4;
+
+    // Mixes 1 to kMaxFusedChannels channels in a single pass over pDest.
+    // Only pSources[0] may be pDest. The ramping gains change per frame.
+    static void mixFusedWithGains(CSAMPLE* pDest,
+            const CSAMPLE* const* pSources,
+            const CSAMPLE_GAIN* pGains,
+            int numChannels,
+            SINT numSamples);
+    static void mixFusedWithRampingGains(CSAMPLE* pDest,
+            const CSAMPLE* const* pSources,
+            const CSAMPLE_GAIN* pStartGains,
+            const CSAMPLE_GAIN* pGainDeltas,
+            int numChannels,
+            SINT numSamples);
+
+    // Mixes the channels block by block, so each block of pDest stays in
+    // the cache while all channels are added to it. This keeps the cost
+    // linear in the number of channels.
+    template<typename Gain>
+    static void mixChannels(CSAMPLE* pDest,
+            const CSAMPLE* const* pSources,
+            const Gain* pGains,
+            int numChannels,
+            SINT numSamples) {
+        for (int i = 1; i < numChannels; ++i) {
+            DEBUG_ASSERT(pSources[i] != pDest);
+        }
+        for (SINT begin = 0; begin < numSamples; begin += kMixBlockSamples) {
+            const SINT end = std::min(begin + kMixBlockSamples, numSamples);
+            bool initialized = false;
+            for (int i = 0; i < numChannels; ++i) {
+                if (pGains[i].isZero()) {
+                    continue;
+                }
+                pGains[i].apply(initialized, pDest, pSources[i], begin, end, numSamples);
+                initialized = true;
+            }
+            if (!initialized) {
+                clear(pDest + begin, end - begin);
+            }
+        }
+    }
+
+    // The block operations of the gain policies. They use the kernels
+    // selected for the CPU and support pDest == pSrc.
+    static void mixBlockWithGain(bool add,
+            CSAMPLE* pDest,
+            const CSAMPLE* pSrc,
+            CSAMPLE_GAIN gain,
+            SINT numSamples);
+    static void mixBlockWithRampingGain(bool add,
+            CSAMPLE* pDest,
+            const CSAMPLE* pSrc,
+            CSAMPLE_GAIN startGain,
+            CSAMPLE_GAIN gainDelta,
+            SINT numSamples);
 };
 
 Q_DECLARE_OPERATORS_FOR_FLAGS(SampleUtil::CLIP_STATUS);
@@ -30,6 +30,9 @@ QString Stat::valueUnits() const {
         case EVENT:
         case EVENT_START:
         case EVENT_END:
+        case FLOW_START:
+        case FLOW_STEP:
+        case FLOW_END:
         case UNSPECIFIED:
         default:
             return "";
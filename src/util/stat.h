@@ -19,6 +19,9 @@ class Stat {
         EVENT,
         EVENT_START,
         EVENT_END,
+        FLOW_START,
+        FLOW_STEP,
+        FLOW_END,
     };
 
     static QString statTypeToString(StatType type) {
@@ -39,6 +42,12 @@ class Stat {
                 return "START";
             case EVENT_END:
                 return "END";
+            case FLOW_START:
+                return "FLOW_START";
+            case FLOW_STEP:
+                return "FLOW_STEP";
+            case FLOW_END:
+                return "FLOW_END";
             default:
                 return "UNKNOWN";
         }
@@ -140,4 +149,7 @@ struct StatReport {
     Stat::StatType type;
     Stat::ComputeFlags compute;
     double value;
+    // The name of the reporting thread, only set until it has been reported
+    // once per thread.
+    QString threadName;
 };
@@ -2,10 +2,13 @@
 
 #include <QFile>
 #include <QMetaType>
+#include <QSet>
 #include <QTextStream>
 #include <QtDebug>
+#include <algorithm>
 
 #include "moc_statsmanager.cpp"
+#include "util/chrometrace.h"
 #include "util/cmdlineargs.h"
 #include "util/compatibility/qmutex.h"
 
@@ -13,12 +16,49 @@
 constexpr int kStatsPipeSize = 1 << 10;
 constexpr int kProcessLength = kStatsPipeSize * 4 / 5;
 
+constexpr int kNumWorstAudioCallbacks = 20;
+
+const Stat::ComputeFlags kAudioCallbackComputeFlags = Stat::COUNT | Stat::SUM |
+        Stat::AVERAGE | Stat::MAX | Stat::MIN | Stat::SAMPLE_VARIANCE;
+
+const QString kAudioCallbackDurationTag = QStringLiteral("AudioCallback duration");
+const QString kAudioCallbackOverrunTag = QStringLiteral("AudioCallback overrun");
+const QString kAudioCallbackStageTag = QStringLiteral("AudioCallback stage %1");
+const QString kAudioCallbackDroppedStagesTag = QStringLiteral("AudioCallback dropped stages");
+
+QString humanizeNanos(qint64 nanos) {
+    double seconds = static_cast<double>(nanos) / 1e9;
+    if (seconds > 1) {
+        return QString("%1s").arg(QString::number(seconds));
+    }
+
+    double millis = static_cast<double>(nanos) / 1e6;
+    if (millis > 1) {
+        return QString("%1ms").arg(QString::number(millis));
+    }
+
+    double micros = static_cast<double>(nanos) / 1e3;
+    if (micros > 1) {
+        return QString("%1us").arg(QString::number(micros));
+    }
+
+    return QString("%1ns").arg(QString::number(nanos));
+}
+
+bool isFlowType(Stat::StatType type) {
+    return type == Stat::FLOW_START ||
+            type == Stat::FLOW_STEP ||
+            type == Stat::FLOW_END;
+}
+
 // static
 bool StatsManager::s_bStatsManagerEnabled = false;
 
-StatsPipe::StatsPipe(StatsManager* pManager)
+StatsPipe::StatsPipe(StatsManager* pManager, int threadId)
         : m_pManager(pManager),
-          m_queue(kStatsPipeSize) {
+          m_queue(kStatsPipeSize),
+          m_threadId(threadId),
+          m_threadNameReported(false) {
     qRegisterMetaType<Stat>("Stat");
 }
 
@@ -30,14 +70,17 @@ StatsPipe::~StatsPipe() {
 
 StatsManager::StatsManager()
         : QThread(),
-          m_quit(0) {
+          m_quit(0),
+          m_nextThreadId(0) {
     s_bStatsManagerEnabled = true;
+    AudioCallbackProfiler::setEnabled(true);
     setObjectName("StatsManager");
     moveToThread(this);
     start(QThread::LowPriority);
 }
 
 StatsManager::~StatsManager() {
+    AudioCallbackProfiler::setEnabled(false);
     s_bStatsManagerEnabled = false;
     m_quit = 1;
     m_statsPipeCondition.wakeAll();
@@ -70,11 +113,33 @@ StatsManager::~StatsManager() {
             qDebug() << it.value();
         }
     }
+    if (!m_worstAudioCallbacks.isEmpty()) {
+        qDebug() << "=====================================";
+        qDebug() << "WORST AUDIO CALLBACKS";
+        qDebug() << "=====================================";
+        for (const auto& profile : qAsConst(m_worstAudioCallbacks)) {
+            qDebug() << "Callback at" << humanizeNanos(profile.startNanos)
+                     << "took" << humanizeNanos(profile.durationNanos)
+                     << "of" << humanizeNanos(profile.budgetNanos)
+                     << (profile.xrunReported ? "(xrun reported)" : "");
+            for (int i = 0; i < profile.numStages; ++i) {
+                qDebug() << "   "
+                         << AudioCallbackProfiler::stageName(profile.stages[i].stageId)
+                         << humanizeNanos(profile.stages[i].nanos);
+            }
+            if (profile.numDroppedStages > 0) {
+                qDebug() << "   " << profile.numDroppedStages << "more stages not recorded";
+            }
+        }
+    }
     qDebug() << "=====================================";
 
     if (CmdlineArgs::Instance().getTimelineEnabled()) {
         writeTimeline(CmdlineArgs::Instance().getTimelinePath());
     }
+    if (CmdlineArgs::Instance().getTraceEnabled()) {
+        writeChromeTrace(CmdlineArgs::Instance().getTracePath());
+    }
 }
 
 class OrderByTime {
@@ -84,25 +149,6 @@ class OrderByTime {
     }
 };
 
-QString humanizeNanos(qint64 nanos) {
-    double seconds = static_cast<double>(nanos) / 1e9;
-    if (seconds > 1) {
-        return QString("%1s").arg(QString::number(seconds));
-    }
-
-    double millis = static_cast<double>(nanos) / 1e6;
-    if (millis > 1) {
-        return QString("%1ms").arg(QString::number(millis));
-    }
-
-    double micros = static_cast<double>(nanos) / 1e3;
-    if (micros > 1) {
-        return QString("%1us").arg(QString::number(micros));
-    }
-
-    return QString("%1ns").arg(QString::number(nanos));
-}
-
 void StatsManager::writeTimeline(const QString& filename) {
     QFile timeline(filename);
     if (!timeline.open(QIODevice::WriteOnly | QIODevice::Text)) {
@@ -162,6 +208,22 @@ void StatsManager::writeTimeline(const QString& filename) {
     timeline.close();
 }
 
+void StatsManager::writeChromeTrace(const QString& filename) {
+    QFile trace(filename);
+    if (!trace.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+        qWarning() << "Could not open trace file for writing:"
+                   << trace.fileName();
+        return;
+    }
+    if (!ChromeTrace::write(&trace, m_events, m_threadNames)) {
+        qWarning() << "Failed to write trace file:"
+                   << trace.fileName() << trace.errorString();
+        return;
+    }
+    qDebug() << "Wrote" << m_events.size() << "events to trace file"
+             << trace.fileName();
+}
+
 void StatsManager::onStatsPipeDestroyed(StatsPipe* pPipe) {
     const auto locker = lockMutex(&m_statsPipeLock);
     processIncomingStatReports();
@@ -172,9 +234,9 @@ StatsPipe* StatsManager::getStatsPipeForThread() {
     if (m_threadStatsPipes.hasLocalData()) {
         return m_threadStatsPipes.localData();
     }
-    StatsPipe* pResult = new StatsPipe(this);
-    m_threadStatsPipes.setLocalData(pResult);
     const auto locker = lockMutex(&m_statsPipeLock);
+    StatsPipe* pResult = new StatsPipe(this, m_nextThreadId++);
+    m_threadStatsPipes.setLocalData(pResult);
     m_statsPipes.push_back(pResult);
     return pResult;
 }
@@ -184,7 +246,16 @@ bool StatsManager::maybeWriteReport(StatReport report) {
     if (!pStatsPipe) {
         return false;
     }
+    if (!pStatsPipe->m_threadNameReported) {
+        // Most threads are named after they have started reporting, so the
+        // name is attached until it is known.
+        report.threadName = QThread::currentThread()->objectName();
+    }
+    const bool hasThreadName = !report.threadName.isEmpty();
     bool success = pStatsPipe->enqueue(std::move(report));
+    if (success && hasThreadName) {
+        pStatsPipe->m_threadNameReported = true;
+    }
     if (pStatsPipe->remainingCapacity() < kProcessLength) {
         m_statsPipeCondition.wakeAll();
     }
@@ -201,6 +272,9 @@ void StatsManager::processIncomingStatReports() {
     StatReport report;
     foreach (StatsPipe* pStatsPipe, m_statsPipes) {
         while (pStatsPipe->dequeue(&report)) {
+            if (!report.threadName.isEmpty()) {
+                m_threadNames.insert(pStatsPipe->threadId(), report.threadName);
+            }
             QString tag = report.tag;
             Stat& info = m_stats[tag];
             info.m_tag = tag;
@@ -223,20 +297,103 @@ void StatsManager::processIncomingStatReports() {
                 base.processReport(report);
             }
 
-            if (CmdlineArgs::Instance().getTimelineEnabled() &&
+            if ((CmdlineArgs::Instance().getTimelineEnabled() ||
+                        CmdlineArgs::Instance().getTraceEnabled()) &&
                     (report.type == Stat::EVENT ||
-                     report.type == Stat::EVENT_START ||
-                     report.type == Stat::EVENT_END)) {
+                            report.type == Stat::EVENT_START ||
+                            report.type == Stat::EVENT_END ||
+                            isFlowType(report.type))) {
                 Event event;
                 event.m_tag = tag;
                 event.m_type = report.type;
                 event.m_time = mixxx::Duration::fromNanos(report.time);
+                event.m_threadId = pStatsPipe->threadId();
+                if (isFlowType(report.type)) {
+                    event.m_flowId = static_cast<quint64>(report.value);
+                }
                 m_events.append(event);
             }
         }
     }
 }
 
+QVector<AudioCallbackProfile> StatsManager::worstAudioCallbacks() {
+    const auto locker = lockMutex(&m_statsPipeLock);
+    return m_worstAudioCallbacks;
+}
+
+void StatsManager::insertWorstAudioCallback(const AudioCallbackProfile& profile) {
+    if (m_worstAudioCallbacks.size() >= kNumWorstAudioCallbacks &&
+            profile.durationNanos <= m_worstAudioCallbacks.last().durationNanos) {
+        return;
+    }
+    const auto it = std::upper_bound(m_worstAudioCallbacks.begin(),
+            m_worstAudioCallbacks.end(),
+            profile,
+            [](const AudioCallbackProfile& lhs, const AudioCallbackProfile& rhs) {
+                return lhs.durationNanos > rhs.durationNanos;
+            });
+    m_worstAudioCallbacks.insert(it, profile);
+    if (m_worstAudioCallbacks.size() > kNumWorstAudioCallbacks) {
+        m_worstAudioCallbacks.removeLast();
+    }
+}
+
+void StatsManager::processAudioCallbackProfiles() {
+    QSet<QString> updatedTags;
+    auto track = [this, &updatedTags](const QString& tag,
+                         Stat::StatType type,
+                         qint64 time,
+                         double value) {
+        StatReport report;
+        report.tag = tag;
+        report.time = time;
+        report.type = type;
+        report.compute = kAudioCallbackComputeFlags;
+        report.value = value;
+        Stat& info = m_stats[tag];
+        info.m_tag = tag;
+        info.m_type = report.type;
+        info.m_compute = report.compute;
+        info.processReport(report);
+        updatedTags.insert(tag);
+    };
+
+    AudioCallbackProfile profile;
+    while (AudioCallbackProfiler::takeProfile(&profile)) {
+        track(kAudioCallbackDurationTag,
+                Stat::DURATION_NANOSEC,
+                profile.startNanos,
+                static_cast<double>(profile.durationNanos));
+        if (profile.isOverrun()) {
+            track(kAudioCallbackOverrunTag, Stat::COUNTER, profile.startNanos, 1.0);
+        }
+        if (profile.numDroppedStages > 0) {
+            track(kAudioCallbackDroppedStagesTag,
+                    Stat::COUNTER,
+                    profile.startNanos,
+                    static_cast<double>(profile.numDroppedStages));
+        }
+        for (int i = 0; i < profile.numStages; ++i) {
+            const auto& stage = profile.stages[i];
+            while (stage.stageId >= m_audioCallbackStageTags.size()) {
+                m_audioCallbackStageTags.append(kAudioCallbackStageTag.arg(
+                        AudioCallbackProfiler::stageName(
+                                m_audioCallbackStageTags.size())));
+            }
+            track(m_audioCallbackStageTags[stage.stageId],
+                    Stat::DURATION_NANOSEC,
+                    profile.startNanos,
+                    static_cast<double>(stage.nanos));
+        }
+        insertWorstAudioCallback(profile);
+    }
+
+    for (const auto& tag : qAsConst(updatedTags)) {
+        emit statUpdated(m_stats[tag]);
+    }
+}
+
 void StatsManager::run() {
     qDebug() << "StatsManager thread starting up.";
     while (true) {
@@ -245,6 +402,7 @@ void StatsManager::run() {
         // We want to process reports even when we are about to quit since we
         // want to print the most accurate stat report on shutdown.
         processIncomingStatReports();
+        processAudioCallbackProfiles();
         m_statsPipeLock.unlock();
 
         if (m_emitAllStats.loadAcquire() == 1) {
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <QHash>
 #include <QMap>
 #include <QObject>
 #include <QString>
@@ -10,9 +11,11 @@
 #include <QWaitCondition>
 #include <QThreadStorage>
 #include <QList>
+#include <QVector>
 
 #include "rigtorp/SPSCQueue.h"
 
+#include "util/audiocallbackprofiler.h"
 #include "util/singleton.h"
 #include "util/stat.h"
 #include "util/event.h"
@@ -21,13 +24,17 @@ class StatsManager;
 
 class StatsPipe final {
   public:
-    explicit StatsPipe(StatsManager* pManager);
+    StatsPipe(StatsManager* pManager, int threadId);
     ~StatsPipe();
 
     bool enqueue(StatReport report) {
         return m_queue.try_emplace(std::move(report));
     }
 
+    int threadId() const {
+        return m_threadId;
+    }
+
     bool dequeue(StatReport* pReport) {
         auto pFront = m_queue.front();
         if (!pFront) {
@@ -45,6 +52,11 @@ class StatsPipe final {
   private:
     StatsManager* m_pManager;
     rigtorp::SPSCQueue<StatReport> m_queue;
+    const int m_threadId;
+    // Only accessed by the reporting thread
+    bool m_threadNameReported;
+
+    friend class StatsManager;
 };
 
 class StatsManager : public QThread, public Singleton<StatsManager> {
@@ -67,6 +79,9 @@ class StatsManager : public QThread, public Singleton<StatsManager> {
         m_statsPipeCondition.wakeAll();
     }
 
+    // Returns the audio callbacks that took longest so far, longest first.
+    QVector<AudioCallbackProfile> worstAudioCallbacks();
+
   signals:
     void statUpdated(const Stat& stat);
 
@@ -75,9 +90,12 @@ class StatsManager : public QThread, public Singleton<StatsManager> {
 
   private:
     void processIncomingStatReports();
+    void processAudioCallbackProfiles();
+    void insertWorstAudioCallback(const AudioCallbackProfile& profile);
     StatsPipe* getStatsPipeForThread();
     void onStatsPipeDestroyed(StatsPipe* pPipe);
     void writeTimeline(const QString& filename);
+    void writeChromeTrace(const QString& filename);
 
     QAtomicInt m_emitAllStats;
     QAtomicInt m_quit;
@@ -85,10 +103,14 @@ class StatsManager : public QThread, public Singleton<StatsManager> {
     QMap<QString, Stat> m_baseStats;
     QMap<QString, Stat> m_experimentStats;
     QList<Event> m_events;
+    QHash<int, QString> m_threadNames;
+    QVector<AudioCallbackProfile> m_worstAudioCallbacks;
+    QVector<QString> m_audioCallbackStageTags;
 
     QWaitCondition m_statsPipeCondition;
     QMutex m_statsPipeLock;
     QList<StatsPipe*> m_statsPipes;
+    int m_nextThreadId;
     QThreadStorage<StatsPipe*> m_threadStatsPipes;
 
     friend class StatsPipe;
@@ -56,7 +56,7 @@ class ScopedTimer {
                 Stat::ComputeFlags compute = kDefaultComputeFlags)
             : m_pTimer(NULL),
               m_cancel(false) {
-        if (CmdlineArgs::Instance().getDeveloper()) {
+        if (CmdlineArgs::Instance().getStatsEnabled()) {
             initialize(QString(key), QString::number(i), compute);
         }
     }
@@ -65,7 +65,7 @@ class ScopedTimer {
                 Stat::ComputeFlags compute = kDefaultComputeFlags)
             : m_pTimer(NULL),
               m_cancel(false) {
-        if (CmdlineArgs::Instance().getDeveloper()) {
+        if (CmdlineArgs::Instance().getStatsEnabled()) {
             initialize(QString(key), arg ? QString(arg) : QString(), compute);
         }
     }
@@ -74,7 +74,7 @@ class ScopedTimer {
                 Stat::ComputeFlags compute = kDefaultComputeFlags)
             : m_pTimer(NULL),
               m_cancel(false) {
-        if (CmdlineArgs::Instance().getDeveloper()) {
+        if (CmdlineArgs::Instance().getStatsEnabled()) {
             initialize(QString(key), arg, compute);
         }
     }
@@ -15,7 +15,7 @@ class Trace {
           bool writeToStdout=false, bool time=true)
             : m_writeToStdout(writeToStdout),
               m_time(time) {
-        if (writeToStdout || CmdlineArgs::Instance().getDeveloper()) {
+        if (writeToStdout || CmdlineArgs::Instance().getStatsEnabled()) {
             initialize(tag, arg);
         }
     }
@@ -24,7 +24,7 @@ class Trace {
           bool writeToStdout=false, bool time=true)
             : m_writeToStdout(writeToStdout),
               m_time(time) {
-        if (writeToStdout || CmdlineArgs::Instance().getDeveloper()) {
+        if (writeToStdout || CmdlineArgs::Instance().getStatsEnabled()) {
             initialize(tag, QString::number(arg));
         }
     }
@@ -33,7 +33,7 @@ class Trace {
           bool writeToStdout=false, bool time=true)
             : m_writeToStdout(writeToStdout),
               m_time(time) {
-        if (writeToStdout || CmdlineArgs::Instance().getDeveloper()) {
+        if (writeToStdout || CmdlineArgs::Instance().getStatsEnabled()) {
             initialize(tag, arg);
         }
     }
@@ -1,12 +1,18 @@
 #include <QTimer>
 
 #include "waveform/guitick.h"
+#include "control/controlchangedispatcher.h"
 #include "control/controlobject.h"
 
 GuiTick::GuiTick() {
     m_pCOGuiTickTime = std::make_unique<ControlObject>(ConfigKey("[Master]", "guiTickTime"));
     m_pCOGuiTick50ms = std::make_unique<ControlObject>(ConfigKey("[Master]", "guiTick50ms"));
     m_cpuTimer.start();
+    ControlChangeDispatcher::setEnabled(true);
+}
+
+GuiTick::~GuiTick() {
+    ControlChangeDispatcher::setEnabled(false);
 }
 
 // this is called from WaveformWidgetFactory::render in the main thread with the
@@ -20,4 +26,6 @@ void GuiTick::process() {
         m_lastUpdateTime = m_cpuTimeLastTick;
         m_pCOGuiTick50ms->set(cpuTimeLastTickSeconds);
     }
+
+    ControlChangeDispatcher::dispatch();
 }
@@ -9,9 +9,12 @@
 
 // A helper class that manages the "guiTickTime" COs, that drive updates of the
 // GUI from the VsyncThread at the user's configured FPS (possibly downsampled).
+// It also drives the ControlChangeDispatcher, so coalesced control changes are
+// delivered once per frame.
 class GuiTick {
   public:
     GuiTick();
+    ~GuiTick();
     void process();
 
   private:
@@ -7,6 +7,7 @@
 #include <QUrl>
 
 #include "control/controlobject.h"
+#include "library/basesqltablemodel.h"
 #include "library/dao/trackschema.h"
 #include "library/library.h"
 #include "library/library_prefs.h"
@@ -166,6 +167,9 @@ void WTrackTableView::loadTrackModel(QAbstractItemModel* model, bool restoreStat
         return;
     }
 
+    // A pending search of the previous model must not restore this view
+    disconnect(m_searchFinishedConnection);
+
     setVisible(false);
 
     // Save the previous track model's header state
@@ -523,24 +527,42 @@ void WTrackTableView::onSearch(const QString& text) {
         TrackId prevTrack = getCurrentTrackId();
         saveCurrentIndex();
         trackModel->search(text);
-        if (queryIsLessSpecific) {
-            // If the user removed query terms, we try to select the same
-            // tracks as before
-            setCurrentTrackId(prevTrack, m_prevColumn);
-            setSelectedTracks(selectedTracks);
+        disconnect(m_searchFinishedConnection);
+        auto* pSqlTableModel = qobject_cast<BaseSqlTableModel*>(model());
+        if (pSqlTableModel && pSqlTableModel->isSearchPending()) {
+            m_searchFinishedConnection = connect(pSqlTableModel,
+                    &BaseSqlTableModel::searchFinished,
+                    this,
+                    [this, queryIsLessSpecific, selectedTracks, prevTrack]() {
+                        disconnect(m_searchFinishedConnection);
+                        restoreViewAfterSearch(queryIsLessSpecific, selectedTracks, prevTrack);
+                    });
         } else {
-            // The user created a more specific search query, try to restore a
-            // previous state
-            if (!restoreCurrentViewState()) {
-                // We found no saved state for this query, try to select the
-                // tracks last active, if they are part of the result set
-                if (!setCurrentTrackId(prevTrack, m_prevColumn)) {
-                    // if the last focused track is not present try to focus the
-                    // respective index and scroll there
-                    restoreCurrentIndex();
-                }
-                setSelectedTracks(selectedTracks);
+            restoreViewAfterSearch(queryIsLessSpecific, selectedTracks, prevTrack);
+        }
+    }
+}
+
+void WTrackTableView::restoreViewAfterSearch(bool queryIsLessSpecific,
+        const QList<TrackId>& selectedTracks,
+        TrackId prevTrack) {
+    if (queryIsLessSpecific) {
+        // If the user removed query terms, we try to select the same
+        // tracks as before
+        setCurrentTrackId(prevTrack, m_prevColumn);
+        setSelectedTracks(selectedTracks);
+    } else {
+        // The user created a more specific search query, try to restore a
+        // previous state
+        if (!restoreCurrentViewState()) {
+            // We found no saved state for this query, try to select the
+            // tracks last active, if they are part of the result set
+            if (!setCurrentTrackId(prevTrack, m_prevColumn)) {
+                // if the last focused track is not present try to focus the
+                // respective index and scroll there
+                restoreCurrentIndex();
             }
+            setSelectedTracks(selectedTracks);
         }
     }
 }
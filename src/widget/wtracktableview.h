@@ -116,6 +116,10 @@ class WTrackTableView : public WLibraryTableView {
 
     void hideOrRemoveSelectedTracks();
 
+    void restoreViewAfterSearch(bool queryIsLessSpecific,
+            const QList<TrackId>& selectedTracks,
+            TrackId prevTrack);
+
     const UserSettingsPointer m_pConfig;
     Library* const m_pLibrary;
 
@@ -135,4 +139,8 @@ class WTrackTableView : public WLibraryTableView {
     ControlProxy* m_pKeyNotation;
     ControlProxy* m_pSortColumn;
     ControlProxy* m_pSortOrder;
+
+    // Restores the view when the rows of a search have been
+    // selected in the background
+    QMetaObject::Connection m_searchFinishedConnection;
 };